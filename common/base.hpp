@@ -71,6 +71,7 @@ enum class TargetDevice : uint8_t
     Golden = 3,
     StaticAnalyzer = 4,
     Emulation = 5,
+    Mock = 6,
     Invalid = 0xFF,
 };
 
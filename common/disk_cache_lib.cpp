@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "common/disk_cache_lib.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace tt::disk_cache {
+
+namespace {
+
+const std::string STAGING_MARKER = ".tmp.";
+
+std::uint64_t get_size_bytes(const fs::directory_entry &entry) {
+    if (!entry.is_directory()) {
+        return entry.file_size();
+    }
+    std::uint64_t size_bytes = 0;
+    for (const auto &file : fs::recursive_directory_iterator(entry.path())) {
+        if (file.is_regular_file()) {
+            size_bytes += file.file_size();
+        }
+    }
+    return size_bytes;
+}
+
+}  // namespace
+
+content_hash hash_bytes(const void *data, std::size_t size) {
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    content_hash hash;
+    hash.std_hash = std::hash<std::string_view>{}(std::string_view(static_cast<const char *>(data), size));
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL ^ size;
+    std::size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        state = (state ^ word) * 0xff51afd7ed558ccdULL;
+        state ^= state >> 32;
+    }
+    for (; i < size; i++) {
+        state = (state ^ bytes[i]) * 0xc4ceb9fe1a85ec53ULL;
+    }
+    hash.word_hash = state;
+    return hash;
+}
+
+void content_hasher::update(const content_hash &hash) {
+    std_hash ^= hash.std_hash + 0x9e3779b97f4a7c15ULL + (std_hash << 6) + (std_hash >> 2);
+    word_hash = (word_hash ^ hash.word_hash) * 0x100000001b3ULL;
+}
+
+void content_hasher::update_file(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    update(path.filename().string());
+    update(contents.str());
+}
+
+std::string content_hasher::hex() const {
+    std::stringstream out;
+    out << std::hex << std::setfill('0') << std::setw(16) << std_hash << std::setw(16) << word_hash;
+    return out.str();
+}
+
+fs::path get_staging_path(const fs::path &entry_path) {
+    std::stringstream staging_path;
+    staging_path << entry_path.string() << STAGING_MARKER << getpid() << "." << std::this_thread::get_id();
+    return staging_path.str();
+}
+
+bool is_staging_path(const fs::path &path) {
+    return path.filename().string().find(STAGING_MARKER) != std::string::npos;
+}
+
+void touch(const fs::path &entry_path) {
+    std::error_code ec;
+    fs::last_write_time(entry_path, fs::file_time_type::clock::now(), ec);
+}
+
+std::uint32_t evict_least_recently_used(
+    const std::string &cache_dir,
+    std::uint64_t max_size_bytes,
+    const std::function<bool(const fs::directory_entry &)> &is_entry,
+    LogType log_type) {
+    struct cache_entry {
+        fs::path path;
+        fs::file_time_type last_use;
+        std::uint64_t size_bytes;
+    };
+
+    std::uint32_t num_evicted = 0;
+    try {
+        std::vector<cache_entry> entries;
+        std::uint64_t total_size_bytes = 0;
+        const auto now = fs::file_time_type::clock::now();
+        for (const auto &entry : fs::directory_iterator(cache_dir)) {
+            if (is_staging_path(entry.path())) {
+                if (now - entry.last_write_time() > STALE_STAGING_AGE) {
+                    fs::remove_all(entry.path());
+                }
+                continue;
+            }
+            if (!is_entry(entry)) {
+                continue;
+            }
+            const std::uint64_t size_bytes = get_size_bytes(entry);
+            entries.push_back({entry.path(), entry.last_write_time(), size_bytes});
+            total_size_bytes += size_bytes;
+        }
+
+        if (total_size_bytes <= max_size_bytes) {
+            return num_evicted;
+        }
+        std::sort(entries.begin(), entries.end(), [](const cache_entry &a, const cache_entry &b) {
+            return a.last_use < b.last_use;
+        });
+        for (const cache_entry &entry : entries) {
+            if (total_size_bytes <= max_size_bytes) {
+                break;
+            }
+            fs::remove_all(entry.path);
+            total_size_bytes -= entry.size_bytes;
+            num_evicted++;
+        }
+    } catch (const fs::filesystem_error &e) {
+        // Entries can disappear underneath us when several processes evict at once
+        log_debug(log_type, "Eviction from cache {} stopped early: {}", cache_dir, e.what());
+    }
+    return num_evicted;
+}
+
+}  // namespace tt::disk_cache
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "utils/logger.hpp"
+
+// Building blocks of the persistent caches shared across runs and processes (TRISC binaries, tilized tensors, netlist
+// snapshots). Entries live directly in the cache directory, are staged privately and published with a rename, so
+// concurrent readers never see a partial entry, and their mtime tracks recency for eviction.
+namespace tt::disk_cache {
+
+// Staging files and directories older than this were left behind by a process which died mid store
+constexpr auto STALE_STAGING_AGE = std::chrono::hours(1);
+
+// 128 bit hash of a byte range made of two independent 64 bit hashes: the standard library hash and a
+// multiply-xorshift hash over 64 bit words. Collisions would silently load the wrong entry, so a single 64 bit hash is
+// not enough.
+struct content_hash {
+    std::uint64_t std_hash = 0;
+    std::uint64_t word_hash = 0;
+};
+
+content_hash hash_bytes(const void *data, std::size_t size);
+
+// Chains hashes of several inputs into a cache key. Every input is hashed on its own, so the boundaries between
+// inputs affect the key. Large inputs can be hashed in parallel with hash_bytes and added in order.
+class content_hasher {
+   public:
+    void update(const content_hash &hash);
+    void update(std::string_view data) { update(hash_bytes(data.data(), data.size())); }
+    // Hashes the file name and contents
+    void update_file(const std::filesystem::path &path);
+
+    template <typename T>
+    void update_value(const T &value) {
+        update(hash_bytes(&value, sizeof(value)));
+    }
+
+    std::string hex() const;
+
+   private:
+    std::uint64_t std_hash = 0;
+    std::uint64_t word_hash = 0xcbf29ce484222325ULL;
+};
+
+// Unique per process and thread, so concurrent stores of the same entry never write into each other's staging area
+std::filesystem::path get_staging_path(const std::filesystem::path &entry_path);
+bool is_staging_path(const std::filesystem::path &path);
+
+// Marks the entry as just used
+void touch(const std::filesystem::path &entry_path);
+
+// Removes least recently used entries of cache_dir until their total size fits max_size_bytes, along with stale
+// staging leftovers. is_entry selects the files or directories which are entries, directories count with all their
+// contents. Returns the number of entries removed.
+std::uint32_t evict_least_recently_used(
+    const std::string &cache_dir,
+    std::uint64_t max_size_bytes,
+    const std::function<bool(const std::filesystem::directory_entry &)> &is_entry,
+    LogType log_type);
+
+}  // namespace tt::disk_cache
@@ -1,52 +1,59 @@
 // SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
 //
 // SPDX-License-Identifier: Apache-2.0
+#pragma once
 #include <vector>
-#include <thread>
 #include <algorithm>
-#include <exception>
-#include <numeric>
+#include <cstdint>
+#include <iterator>
+
+#include "common/tt_task_scheduler.hpp"
 
 namespace tt {
-    // Utility function to parallelize a for loop using std::thread.
+    // Loops are split into this many chunks per thread, so threads that drew cheap items pick up the remaining work of
+    // uneven loops (eg. epochs of very different sizes) instead of idling
+    constexpr int PARALLEL_FOR_CHUNKS_PER_THREAD = 4;
+
+    inline int get_parallel_for_num_chunks(int total_work, int num_threads) {
+        return std::min(total_work, std::max(num_threads, 1) * PARALLEL_FOR_CHUNKS_PER_THREAD);
+    }
+
+    inline int get_parallel_for_chunk_offset(int total_work, int num_chunks, int chunk) {
+        return static_cast<int>(static_cast<std::int64_t>(total_work) * chunk / num_chunks);
+    }
+
+    // Utility function to parallelize a for loop on the process wide task scheduler. Runs on at most num_threads
+    // threads, the calling one included, and may be nested. Every chunk gets its own copy of func. The first exception
+    // thrown by func is rethrown once the loop stops, items not started by then are skipped.
     template <typename Iterator, typename Function>
     void parallel_for(Iterator begin, Iterator end, Function func, int num_threads) {
-        int total_work = std::distance(begin, end);
-        int work_per_thread = (total_work + num_threads - 1) / num_threads;
-
-        std::vector<std::thread> threads;
-        threads.reserve(num_threads);
-        std::vector<std::exception_ptr> exceptions_all_threads(num_threads, nullptr);
-
-        Iterator chunk_start = begin;
-        for (int t = 0; t < num_threads && t < total_work; ++t) {
-            Iterator chunk_end = std::next(chunk_start, std::min(work_per_thread, std::max(0, total_work - t * work_per_thread)));
-            threads.emplace_back([=, &exceptions_all_threads, &func]() {
-                try {
-                    std::for_each(chunk_start, chunk_end, func);
-                } catch (std::exception& e) {
-                    exceptions_all_threads[t] = std::current_exception();
-                }
-            });
-            chunk_start = chunk_end;
-        }
+        const int total_work = std::distance(begin, end);
+        const int num_chunks = get_parallel_for_num_chunks(total_work, num_threads);
 
-        for (std::thread& thread : threads) {
-            thread.join();
+        // Chunk boundaries are computed up front, so iterators without random access are only walked once
+        std::vector<Iterator> chunk_starts;
+        chunk_starts.reserve(num_chunks + 1);
+        for (int chunk = 0; chunk < num_chunks; ++chunk) {
+            chunk_starts.push_back(begin);
+            std::advance(begin, get_parallel_for_chunk_offset(total_work, num_chunks, chunk + 1) - get_parallel_for_chunk_offset(total_work, num_chunks, chunk));
         }
+        chunk_starts.push_back(end);
 
-        for (const auto& exception : exceptions_all_threads) {
-            if (exception) {
-                std::rethrow_exception(exception);
-                return;
-            }
-        }
+        detail::run_parallel_chunks(num_chunks, num_threads, [&](int chunk) {
+            std::for_each(chunk_starts[chunk], chunk_starts[chunk + 1], func);
+        });
     }
 
     template <typename Function>
     void parallel_for(int start_index, int end_index, Function func, int num_threads) {
-        std::vector<int> indices(end_index - start_index);
-        std::iota(indices.begin(), indices.end(), start_index);
-        parallel_for(indices.begin(), indices.end(), func, num_threads);
+        const int total_work = std::max(end_index - start_index, 0);
+        const int num_chunks = get_parallel_for_num_chunks(total_work, num_threads);
+        detail::run_parallel_chunks(num_chunks, num_threads, [&](int chunk) {
+            Function chunk_func = func;
+            const int chunk_end = start_index + get_parallel_for_chunk_offset(total_work, num_chunks, chunk + 1);
+            for (int index = start_index + get_parallel_for_chunk_offset(total_work, num_chunks, chunk); index < chunk_end; ++index) {
+                chunk_func(index);
+            }
+        });
     }
-} // namespace tt
\ No newline at end of file
+} // namespace tt
@@ -0,0 +1,236 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "tt_task_scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "common/env_lib.hpp"
+#include "device/cpuset_lib.hpp"
+#include "utils/logger.hpp"
+
+namespace tt {
+
+namespace {
+
+// How long an idle waiter sleeps before looking for queued tasks again, tasks submitted by other threads only wake workers
+constexpr std::chrono::microseconds WAITER_POLL_INTERVAL(100);
+
+thread_local const tt_task_scheduler *current_scheduler = nullptr;
+thread_local std::uint32_t current_worker = 0;
+
+struct parallel_chunks_state {
+    const std::function<void(int)> *run_chunk = nullptr;
+    int num_chunks = 0;
+    std::atomic<int> next_chunk = 0;
+    std::atomic<int> num_finished = 0;
+    std::atomic<bool> failed = false;
+
+    std::mutex mutex;
+    std::condition_variable finished_cv;
+    std::exception_ptr exception;
+
+    // Claims and runs chunks until none are left. Threads that find no chunk left never touch run_chunk, so late
+    // helpers are safe to run after the parallel loop returned.
+    void run() {
+        for (int chunk = next_chunk.fetch_add(1); chunk < num_chunks; chunk = next_chunk.fetch_add(1)) {
+            if (!failed.load(std::memory_order_relaxed)) {
+                try {
+                    (*run_chunk)(chunk);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+            if (num_finished.fetch_add(1, std::memory_order_acq_rel) + 1 == num_chunks) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished_cv.notify_all();
+            }
+        }
+    }
+
+    bool finished() const { return num_finished.load(std::memory_order_acquire) == num_chunks; }
+};
+
+}  // namespace
+
+tt_task_scheduler::tt_task_scheduler(std::uint32_t num_threads, std::function<void()> thread_init) {
+    for (std::uint32_t i = 0; i < num_threads; i++) {
+        queues.push_back(std::make_unique<worker_queue>());
+    }
+    for (std::uint32_t i = 0; i < num_threads; i++) {
+        threads.emplace_back(&tt_task_scheduler::loop, this, i, thread_init);
+    }
+}
+
+tt_task_scheduler::~tt_task_scheduler() {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        stop_flag = true;
+    }
+    work_cv.notify_all();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+tt_task_scheduler &tt_task_scheduler::get() {
+    // The calling thread of a parallel loop takes part in it, so one worker less than there are cpus
+    static tt_task_scheduler scheduler(parse_env<std::uint32_t>(
+        "TT_BACKEND_TASK_SCHEDULER_THREADS", std::max(tt::cpuset::get_allowed_num_threads(), 1) - 1));
+    return scheduler;
+}
+
+bool tt_task_scheduler::is_worker_thread() const { return current_scheduler == this; }
+
+void tt_task_scheduler::submit(std::function<void()> task) {
+    num_pending.fetch_add(1, std::memory_order_acq_rel);
+    if (threads.empty()) {
+        run_task(task);
+        return;
+    }
+    const std::uint32_t index = is_worker_thread() ? current_worker : next_queue.fetch_add(1) % queues.size();
+    // Counted before it is visible, so a worker never sees the task without the count
+    num_queued.fetch_add(1, std::memory_order_acq_rel);
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    // Taking the lock orders the notify after any worker that just found num_queued empty started waiting
+    { std::lock_guard<std::mutex> lock(state_mutex); }
+    work_cv.notify_one();
+}
+
+bool tt_task_scheduler::pop_task(std::uint32_t first_queue, std::function<void()> &task) {
+    const bool own_queue = is_worker_thread() and first_queue == current_worker;
+    for (std::uint32_t i = 0; i < queues.size(); i++) {
+        worker_queue &queue = *queues[(first_queue + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        if (i == 0 and own_queue) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        num_queued.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+    return false;
+}
+
+void tt_task_scheduler::run_task(std::function<void()> &task) {
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        if (!task_exception) {
+            task_exception = std::current_exception();
+        }
+    }
+    task = nullptr;
+    if (num_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        idle_cv.notify_all();
+    }
+}
+
+bool tt_task_scheduler::run_pending_task() {
+    if (queues.empty()) {
+        return false;
+    }
+    std::function<void()> task;
+    const std::uint32_t first_queue = is_worker_thread() ? current_worker : next_queue.load() % queues.size();
+    if (!pop_task(first_queue, task)) {
+        return false;
+    }
+    run_task(task);
+    return true;
+}
+
+void tt_task_scheduler::wait_idle() {
+    log_assert(!is_worker_thread(), "A task cannot wait for its own scheduler to become idle");
+    while (busy()) {
+        if (run_pending_task()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state_mutex);
+        idle_cv.wait_for(lock, WAITER_POLL_INTERVAL, [this] { return !busy(); });
+    }
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        std::swap(exception, task_exception);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void tt_task_scheduler::loop(std::uint32_t index, const std::function<void()> &thread_init) {
+    current_scheduler = this;
+    current_worker = index;
+    if (thread_init) {
+        thread_init();
+    }
+    std::function<void()> task;
+    while (true) {
+        if (pop_task(index, task)) {
+            run_task(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state_mutex);
+        work_cv.wait(lock, [this] { return stop_flag or num_queued.load(std::memory_order_acquire) != 0; });
+        if (stop_flag) {
+            return;
+        }
+    }
+}
+
+namespace detail {
+
+void run_parallel_chunks(int num_chunks, int num_threads, const std::function<void(int)> &run_chunk) {
+    if (num_chunks <= 0) {
+        return;
+    }
+    tt_task_scheduler &scheduler = tt_task_scheduler::get();
+    const int num_helpers = std::min({num_threads - 1, num_chunks - 1, static_cast<int>(scheduler.get_num_threads())});
+    if (num_helpers <= 0) {
+        for (int chunk = 0; chunk < num_chunks; chunk++) {
+            run_chunk(chunk);
+        }
+        return;
+    }
+
+    // Shared with the helpers, which may only get to run once the loop is long done
+    auto state = std::make_shared<parallel_chunks_state>();
+    state->run_chunk = &run_chunk;
+    state->num_chunks = num_chunks;
+    for (int i = 0; i < num_helpers; i++) {
+        scheduler.submit([state] { state->run(); });
+    }
+    state->run();
+
+    // Helpers may still be running their last chunks, which can in turn have queued nested loops to help with
+    while (!state->finished()) {
+        if (scheduler.run_pending_task()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished_cv.wait_for(lock, WAITER_POLL_INTERVAL, [&state] { return state->finished(); });
+    }
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace tt
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tt {
+
+// Persistent pool of worker threads with one task deque per worker.
+//
+// Workers pop their own deque from the back (most recently submitted first, which keeps nested work cache hot) and
+// steal from the front of the other deques when theirs runs dry. Tasks submitted from a worker go to that worker's
+// deque, tasks submitted from other threads are spread round robin. Threads waiting on the scheduler run queued tasks
+// instead of blocking, so tasks may themselves submit and wait on work without deadlocking the pool.
+class tt_task_scheduler {
+   public:
+    // thread_init runs once on every worker before it picks up tasks, eg. to bind it to a cpuset
+    explicit tt_task_scheduler(std::uint32_t num_threads, std::function<void()> thread_init = nullptr);
+    ~tt_task_scheduler();
+    tt_task_scheduler(const tt_task_scheduler &) = delete;
+    tt_task_scheduler &operator=(const tt_task_scheduler &) = delete;
+
+    // Process wide scheduler backing tt::parallel_for. Sized to the cpus this process may run on, which respects
+    // cpusets and the cpuset allocator, unless overridden through TT_BACKEND_TASK_SCHEDULER_THREADS.
+    static tt_task_scheduler &get();
+
+    std::uint32_t get_num_threads() const { return threads.size(); }
+    // True if the calling thread is one of this scheduler's workers
+    bool is_worker_thread() const;
+
+    void submit(std::function<void()> task);
+    // Runs one queued task on the calling thread. Returns false if there was none.
+    bool run_pending_task();
+    // Blocks until every submitted task has completed, running queued tasks meanwhile. Rethrows the first exception
+    // thrown by a task since the previous wait_idle.
+    void wait_idle();
+    // True while submitted tasks are queued or running
+    bool busy() const { return num_pending.load(std::memory_order_acquire) != 0; }
+
+   private:
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<worker_queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<std::uint64_t> num_queued = 0;
+    // Queued plus running tasks
+    std::atomic<std::uint64_t> num_pending = 0;
+    std::atomic<std::uint32_t> next_queue = 0;
+
+    std::mutex state_mutex;
+    std::condition_variable work_cv;
+    std::condition_variable idle_cv;
+    bool stop_flag = false;
+    std::exception_ptr task_exception;
+
+    void loop(std::uint32_t index, const std::function<void()> &thread_init);
+    bool pop_task(std::uint32_t first_queue, std::function<void()> &task);
+    void run_task(std::function<void()> &task);
+};
+
+namespace detail {
+// Runs run_chunk(i) for every i in [0, num_chunks) on up to num_threads threads of the process wide scheduler,
+// including the calling thread. Returns once all chunks have run and rethrows the first exception of any chunk, chunks
+// not started by then are skipped.
+void run_parallel_chunks(int num_chunks, int num_threads, const std::function<void(int)> &run_chunk);
+}  // namespace detail
+
+}  // namespace tt
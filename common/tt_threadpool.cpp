@@ -3,74 +3,40 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "tt_threadpool.hpp"
 
-void TT_ThreadPool::loop() {
-    //bind each sub thread to a single slot (L3 cache)
-    {
-        std::unique_lock<std::mutex> lock(core_mutex);
-        if(ndesc_ != nullptr) {
-            // Bind thread if multi-threading is actually performed and if the network
-            // descriptor is passed in for the CPU Allocator
-            tt::cpuset::tt_cpuset_allocator::bind_thread_to_cpuset(ndesc_, chip_id_, true);
-        }
-    }
-
-    while(true) {
-        std::function<void()> job;
-        {
-            std::unique_lock<std::mutex> lock(job_mutex);
-            job_cv.wait(lock, [this] { return stop_flag || !jobs.empty();});
-            if(stop_flag) return;
-            free_mutex.lock();
-            num_free--;
-            free_mutex.unlock();
-            job = jobs.front();
-            jobs.pop();
-        }
-        job();
-        std::unique_lock<std::mutex> lock(free_mutex);
-        num_free++;
-    }
-}
+#include "utils/logger.hpp"
 
 void TT_ThreadPool::start(std::uint32_t num_threads, tt_cluster_description* ndesc, chip_id_t chip_id) {
-    ndesc_ = ndesc;
-    chip_id_ = chip_id;
     num_threads_ = num_threads;
-    num_free = num_threads;
-    stop_flag = false;
-    if(num_threads > 1) {
-        for(uint32_t i = 0; i < num_threads; i++){
-            threads.push_back(std::thread(&TT_ThreadPool::loop, this));
-        }
+    std::function<void()> bind_thread = nullptr;
+    if(ndesc != nullptr) {
+        //bind each sub thread to a single slot (L3 cache)
+        bind_thread = [this, ndesc, chip_id] {
+            // Bind thread if multi-threading is actually performed and if the network
+            // descriptor is passed in for the CPU Allocator
+            std::unique_lock<std::mutex> lock(core_mutex);
+            tt::cpuset::tt_cpuset_allocator::bind_thread_to_cpuset(ndesc, chip_id, true);
+        };
     }
+    // Single threaded pools run jobs inline on the queueing thread
+    scheduler = std::make_unique<tt::tt_task_scheduler>(num_threads > 1 ? num_threads : 0, bind_thread);
 }
 
 void TT_ThreadPool::queue_job(std::function<void()> push_func) {
-    {
-        std::unique_lock<std::mutex> lock(job_mutex);
-        jobs.push(push_func);
-    }
-    job_cv.notify_one();
+    log_assert(scheduler != nullptr, "Thread pool must be started before queueing jobs");
+    scheduler->submit(std::move(push_func));
 }
 
 void TT_ThreadPool::stop() {
-    {
-        std::unique_lock<std::mutex> lock(job_mutex);
-        stop_flag = true;
-    }
-    job_cv.notify_all();
-
-    for(std::thread& active_thread : threads) {
-        active_thread.join();
-    }
-    threads.clear();
+    // Queued jobs that did not start yet are dropped
+    scheduler.reset();
 }
 
 bool TT_ThreadPool::wait() {
-    bool in_use = false;
-    {
-        std::unique_lock<std::mutex> lock(job_mutex);
-        in_use = !jobs.empty();
+    return scheduler != nullptr and scheduler->busy();
+}
+
+void TT_ThreadPool::wait_idle() {
+    if(scheduler != nullptr) {
+        scheduler->wait_idle();
     }
-    return in_use;
-}
\ No newline at end of file
+}
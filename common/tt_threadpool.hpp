@@ -1,32 +1,26 @@
 // SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
 //
 // SPDX-License-Identifier: Apache-2.0
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <condition_variable>
-#include <queue>
-#include <thread>
 #include "loader/tt_cluster.hpp"
 #include "device/cpuset_lib.hpp"
+#include "common/tt_task_scheduler.hpp"
 
+// Work stealing pool whose threads are bound to the cpuset closest to a chip, used for pushing data to that chip
 class TT_ThreadPool{
     public:
         void start(std::uint32_t num_threads, tt_cluster_description* ndesc = nullptr, chip_id_t chip_id = 0);
         void queue_job(std::function<void()> push_func);
         void stop();
+        // Returns true while queued jobs are still pending or running
         bool wait();
-        uint32_t num_free = 0;
+        // Blocks until all queued jobs have run, the calling thread runs pending jobs meanwhile
+        void wait_idle();
         uint32_t num_threads_ = 0;
         
     private:
-        void loop();
-        bool stop_flag = false;
-        std::mutex job_mutex;
-        std::mutex free_mutex;
         std::mutex core_mutex;
-        std::condition_variable job_cv;
-        tt_cluster_description* ndesc_;
-        std::vector<std::thread> threads;
-        std::queue<std::function<void()>> jobs;
-        chip_id_t chip_id_;
-        
-};
\ No newline at end of file
+        std::unique_ptr<tt::tt_task_scheduler> scheduler;
+};
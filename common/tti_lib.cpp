@@ -3,11 +3,19 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "tti_lib.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
 
+#include "common/env_lib.hpp"
 #include "model/base_defs.h"
 #include "utils/logger.hpp"
 
@@ -89,6 +97,188 @@ void uncompress_image(const std::string &path, const std::string &output_path) {
     }
 }
 
+constexpr std::size_t TAR_BLOCK_SIZE = 512;
+
+// Numeric header fields are octal text, or big endian base-256 when the top bit is set (GNU, for files over 8GB)
+std::uint64_t parse_tar_number(const char *field, std::size_t size) {
+    std::uint64_t value = 0;
+    if (field[0] & 0x80) {
+        value = field[0] & 0x7f;
+        for (std::size_t i = 1; i < size; i++) {
+            value = (value << 8) | static_cast<std::uint8_t>(field[i]);
+        }
+        return value;
+    }
+    for (std::size_t i = 0; i < size and field[i] != '\0'; i++) {
+        if (field[i] >= '0' and field[i] <= '7') {
+            value = (value << 3) | (field[i] - '0');
+        }
+    }
+    return value;
+}
+
+std::string get_tar_string(const char *field, std::size_t size) {
+    return std::string(field, std::find(field, field + size, '\0'));
+}
+
+bool is_valid_tar_header(const char *header) {
+    // The checksum is computed with its own field treated as spaces
+    std::uint64_t checksum = 8 * ' ';
+    for (std::size_t i = 0; i < TAR_BLOCK_SIZE; i++) {
+        if (i < 148 or i >= 156) {
+            checksum += static_cast<std::uint8_t>(header[i]);
+        }
+    }
+    return checksum == parse_tar_number(header + 148, 8);
+}
+
+// Strips "./" components, returns false for names that would escape the output directory
+bool normalize_tar_name(std::string &name) {
+    std::stringstream components(name);
+    std::string component;
+    std::string normalized;
+    while (std::getline(components, component, '/')) {
+        if (component.empty() or component == ".") {
+            continue;
+        }
+        if (component == "..") {
+            return false;
+        }
+        normalized += (normalized.empty() ? "" : "/") + component;
+    }
+    name = normalized;
+    return true;
+}
+
+// Symlinks may only point inside the output directory: absolute targets and ".." components are rejected
+bool is_valid_tar_link_target(const std::string &target) {
+    std::string normalized = target;
+    return !target.empty() and target.front() != '/' and normalize_tar_name(normalized);
+}
+
+// Decimal pax numbers, the whole string must be a number
+bool parse_pax_number(const char *begin, const char *end, std::uint64_t &value) {
+    const auto [number_end, error] = std::from_chars(begin, end, value);
+    return begin != end and error == std::errc() and number_end == end;
+}
+
+}  // namespace
+
+namespace tt::tti_tar {
+
+bool index_tar_image(const std::uint8_t *data, std::size_t size, std::vector<tar_entry> &entries) {
+    std::string long_name = "";
+    std::string pax_path = "";
+    std::uint64_t pax_size = 0;
+    bool has_pax_size = false;
+
+    std::size_t pos = 0;
+    while (pos + TAR_BLOCK_SIZE <= size) {
+        const char *header = reinterpret_cast<const char *>(data + pos);
+        if (std::all_of(header, header + TAR_BLOCK_SIZE, [](char c) { return c == '\0'; })) {
+            return not entries.empty();
+        }
+        if (!is_valid_tar_header(header)) {
+            return false;
+        }
+        const char type = header[156];
+        std::uint64_t entry_size = parse_tar_number(header + 124, 12);
+        const bool is_member = type != 'L' and type != 'x' and type != 'g';
+        if (is_member and has_pax_size) {
+            entry_size = pax_size;
+        }
+        const std::uint64_t offset = pos + TAR_BLOCK_SIZE;
+        if (offset + entry_size > size) {
+            return false;
+        }
+        const std::string payload(reinterpret_cast<const char *>(data + offset), type == 'L' or type == 'x' ? entry_size : 0);
+
+        if (type == 'L') {
+            // GNU long name of the next member
+            long_name = payload.substr(0, payload.find('\0'));
+        } else if (type == 'x') {
+            // Pax records of the next member: "<record length> <key>=<value>\n"
+            for (std::size_t record = 0; record < payload.size();) {
+                const std::size_t space = payload.find(' ', record);
+                if (space == std::string::npos) {
+                    return false;
+                }
+                std::uint64_t length = 0;
+                if (!parse_pax_number(payload.data() + record, payload.data() + space, length) or
+                    length > payload.size() - record or payload[record + length - 1] != '\n') {
+                    return false;
+                }
+                const std::size_t equals = payload.find('=', space);
+                if (equals == std::string::npos or equals >= record + length) {
+                    return false;
+                }
+                const std::string key = payload.substr(space + 1, equals - space - 1);
+                const std::string value = payload.substr(equals + 1, record + length - equals - 2);
+                if (key == "path") {
+                    pax_path = value;
+                } else if (key == "size") {
+                    if (!parse_pax_number(value.data(), value.data() + value.size(), pax_size)) {
+                        return false;
+                    }
+                    has_pax_size = true;
+                }
+                record += length;
+            }
+        } else if (type == 'g') {
+            // Global pax records only carry metadata we do not need
+        } else if (type == '0' or type == '\0' or type == '7' or type == '5' or type == '2') {
+            std::string name = get_tar_string(header, 100);
+            const std::string prefix = get_tar_string(header + 345, 155);
+            if (!pax_path.empty()) {
+                name = pax_path;
+            } else if (!long_name.empty()) {
+                name = long_name;
+            } else if (std::string(header + 257, 5) == "ustar" and !prefix.empty()) {
+                name = prefix + "/" + name;
+            }
+            const std::string link_name = get_tar_string(header + 157, 100);
+            if (!normalize_tar_name(name) or (type == '2' and !is_valid_tar_link_target(link_name))) {
+                return false;
+            }
+            entries.push_back({name, type, static_cast<std::uint32_t>(parse_tar_number(header + 100, 8)), offset, entry_size, link_name});
+            long_name = "";
+            pax_path = "";
+            has_pax_size = false;
+        } else {
+            return false;
+        }
+        pos = offset + (entry_size + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE * TAR_BLOCK_SIZE;
+    }
+    // Archives without end of archive blocks are still accepted by tar
+    return not entries.empty();
+}
+
+}  // namespace tt::tti_tar
+
+namespace {
+
+using tt::tti_tar::tar_entry;
+
+void write_tar_entry(const std::uint8_t *image, const tar_entry &entry, const std::string &output_path) {
+    const fs::path path = fs::path(output_path) / entry.name;
+    if (entry.type == '5') {
+        fs::create_directories(path);
+        return;
+    }
+    fs::create_directories(path.parent_path());
+    if (entry.type == '2') {
+        fs::create_symlink(entry.link_name, path);
+        return;
+    }
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(image + entry.offset), entry.size);
+    if (!file.good()) {
+        log_fatal("Failed to extract {} from pre-compiled image", path.string());
+    }
+    file.close();
+    fs::permissions(path, static_cast<fs::perms>(entry.mode & 0777));
+}
+
 void set_envvars(const json &envvars) {
     // do not overwrite existing envvars
     constexpr int overwrite = 0;
@@ -111,12 +301,14 @@ tt_device_image::tt_device_image(const std::string &path, const ::std::string &o
         fs::remove_all(output_path);
     }
     fs::create_directory(output_path);
-    uncompress_image(path, output_path);
+    if (parse_env("TT_BACKEND_TTI_EXTRACT_ALL", false) or !map_tar_image(path)) {
+        uncompress_image(path, output_path);
+    }
 
     model_path = output_path + "/unzipped_tti";
     if (!fs::exists(model_path)) {
         log_warning(tt::LogBackend, "TTI model path {} does not exist, performing search for device.json to locate the model path", model_path);
-        model_path = find_file("device.json", output_path);
+        model_path = fs::path(find_file("device.json", output_path)).parent_path().string();
     }
 
     std::string env_json_path = get_model_path("compile_and_runtime_config.json");
@@ -137,6 +329,96 @@ tt_device_image::tt_device_image(const std::string &path, const ::std::string &o
     populate_io_prestride_map();
 }
 
+tt_device_image::~tt_device_image() { unmap_image(); }
+
+bool tt_device_image::map_tar_image(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0 and file_stat.st_size > 0) {
+        void *data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            image_data = static_cast<const std::uint8_t *>(data);
+            image_size = file_stat.st_size;
+        }
+    }
+    close(fd);
+
+    std::vector<tar_entry> entries = {};
+    if (image_data == nullptr or !tti_tar::index_tar_image(image_data, image_size, entries)) {
+        log_debug(tt::LogBackend, "Pre-compiled image {} is not an uncompressed tar archive, extracting it", path);
+        unmap_image();
+        return false;
+    }
+
+    // device.json names the serialized tensors, relative to the directory it is in
+    const auto device_json = std::find_if(entries.begin(), entries.end(), [](const tar_entry &entry) {
+        return fs::path(entry.name).filename() == "device.json" and entry.type != '5';
+    });
+    if (device_json == entries.end()) {
+        unmap_image();
+        return false;
+    }
+    const std::string model_dir = fs::path(device_json->name).parent_path().string();
+    const json device_metadata = json::parse(image_data + device_json->offset, image_data + device_json->offset + device_json->size);
+    // Archive name of every serialized tensor -> the path get_tensor_meta() reports for it
+    const std::string model_path_in_output = output_path + (model_dir.empty() ? "" : "/" + model_dir);
+    std::unordered_map<std::string, std::string> tensor_paths = {};
+    const auto &graph_state = device_metadata["compiled_graph_state"];
+    for (const char *section : {"post_const_eval_parameters", "post_const_eval_constants"}) {
+        if (graph_state.find(section) == graph_state.end()) {
+            continue;
+        }
+        for (const auto &tensor : graph_state[section]) {
+            if (tensor.find("bin") == tensor.end()) {
+                continue;
+            }
+            const std::string bin = tensor["bin"].get<std::string>();
+            std::string name = (model_dir.empty() ? "" : model_dir + "/") + bin;
+            if (normalize_tar_name(name)) {
+                tensor_paths[name] = model_path_in_output + "/" + bin;
+            }
+        }
+    }
+
+    for (const tar_entry &entry : entries) {
+        const auto tensor_path = tensor_paths.find(entry.name);
+        if (tensor_path != tensor_paths.end() and (entry.type == '0' or entry.type == '\0' or entry.type == '7')) {
+            mapped_files[tensor_path->second] = {entry.offset, entry.size};
+        } else {
+            write_tar_entry(image_data, entry, output_path);
+        }
+    }
+    log_debug(tt::LogBackend, "Indexed pre-compiled image {}, {} of {} files stay memory mapped", path, mapped_files.size(), entries.size());
+    if (mapped_files.empty()) {
+        unmap_image();
+    } else {
+        // Tensors are read once, front to back, when they are pushed to device
+        madvise(const_cast<std::uint8_t *>(image_data), image_size, MADV_SEQUENTIAL);
+    }
+    return true;
+}
+
+void tt_device_image::unmap_image() {
+    if (image_data != nullptr) {
+        munmap(const_cast<std::uint8_t *>(image_data), image_size);
+        image_data = nullptr;
+        image_size = 0;
+    }
+}
+
+const void *tt_device_image::get_mapped_file(const std::string &path, std::size_t &size) const {
+    const auto it = mapped_files.find(path);
+    if (it == mapped_files.end()) {
+        size = 0;
+        return nullptr;
+    }
+    size = it->second.second;
+    return image_data + it->second.first;
+}
+
 void tt_device_image::populate_io_prestride_map() {
     const auto& input_names = get_graph_input_names();
     uint32_t transform_idx = 0;
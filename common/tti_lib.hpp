@@ -3,7 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <cstdint>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "third_party/json/json.hpp"
@@ -13,6 +16,23 @@ using json_node = nlohmann::basic_json<>::value_type;
 
 namespace tt {
 
+namespace tti_tar {
+// Member of an uncompressed tar archive, its contents are the size bytes at offset in the archive
+struct tar_entry {
+    std::string name;
+    char type;
+    std::uint32_t mode;
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::string link_name;
+};
+
+// Indexes the members of an uncompressed tar archive, whose contents are stored contiguously and can be used in place.
+// Returns false for anything this reader does not handle (compressed archives, hard links, ...) or will not extract
+// (names or symlink targets leaving the output directory), so that callers can fall back to extracting with tar.
+bool index_tar_image(const std::uint8_t *data, std::size_t size, std::vector<tar_entry> &entries);
+}  // namespace tti_tar
+
 struct tt_device_image {
     using tensor_meta =
         std::tuple<std::string, uint32_t, std::string, std::vector<uint32_t>, std::vector<uint32_t>, uint32_t>;
@@ -22,7 +42,11 @@ struct tt_device_image {
     std::string arch() const;
     std::string backend() const;
 
+    // Uncompressed tar images are indexed in place: only the small model files are extracted to output_path while the
+    // serialized parameter and constant tensors stay in the memory mapped image (see get_mapped_file). Zip and
+    // compressed images, or any image when TT_BACKEND_TTI_EXTRACT_ALL is set, are fully extracted instead.
     tt_device_image(const std::string &tti_path, const ::std::string &output_path = "tt_build/tti");
+    ~tt_device_image();
     tt_device_image() = delete;
     tt_device_image(tt_device_image const &) = delete;
     void operator=(tt_device_image const &) = delete;
@@ -36,6 +60,9 @@ struct tt_device_image {
     std::unordered_map<std::string, prestride_info> get_io_prestride_map() const;
     tensor_meta get_tensor_meta(const std::string &name) const;
     tensor_meta get_tensor_meta(const json_node &node) const;
+    // Contents of a model file (eg. the bin path of a tensor_meta) that was left in the mapped image, or nullptr if it
+    // was extracted to disk. Valid for the lifetime of the image.
+    const void *get_mapped_file(const std::string &path, std::size_t &size) const;
 
    private:
     json metadata;
@@ -46,6 +73,13 @@ struct tt_device_image {
     std::set<std::string> parameter_names = {};
     std::unordered_map<std::string, prestride_info> prestride_transform_per_input = {};
 
+    const std::uint8_t *image_data = nullptr;
+    std::size_t image_size = 0;
+    // Extracted path of every file left in the mapped image -> <offset, size> of its contents
+    std::unordered_map<std::string, std::pair<std::uint64_t, std::uint64_t>> mapped_files = {};
+
+    bool map_tar_image(const std::string &tti_path);
+    void unmap_image();
     void populate_io_prestride_map();
 };
 
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "common/env_lib.hpp"
+
+namespace tt::wait {
+
+// Latency targets of a polling wait. A waiter busy polls for spin_us, then polls and yields its core to other runnable
+// threads until yield_us, then sleeps between polls. Sleeps double from min_sleep_us up to max_sleep_us, which bounds
+// how late a long wait notices its condition.
+struct tt_backoff_policy {
+    uint64_t spin_us = 20;
+    uint64_t yield_us = 1000;
+    uint64_t min_sleep_us = 10;
+    uint64_t max_sleep_us = 1000;
+
+    // Read once from TT_BACKEND_IO_WAIT_{SPIN,YIELD,MIN_SLEEP,MAX_SLEEP}_US
+    static const tt_backoff_policy &get() {
+        static const tt_backoff_policy policy = [] {
+            tt_backoff_policy p;
+            p.spin_us = parse_env<uint64_t>("TT_BACKEND_IO_WAIT_SPIN_US", p.spin_us);
+            p.yield_us = std::max(p.spin_us, parse_env<uint64_t>("TT_BACKEND_IO_WAIT_YIELD_US", p.yield_us));
+            p.max_sleep_us = parse_env<uint64_t>("TT_BACKEND_IO_WAIT_MAX_SLEEP_US", p.max_sleep_us);
+            p.min_sleep_us = std::min(p.max_sleep_us, parse_env<uint64_t>("TT_BACKEND_IO_WAIT_MIN_SLEEP_US", p.min_sleep_us));
+            return p;
+        }();
+        return policy;
+    }
+};
+
+// Paces the polls of one wait, call pause() after every poll that did not see the condition
+class tt_backoff {
+   public:
+    explicit tt_backoff(const tt_backoff_policy &policy = tt_backoff_policy::get()) :
+        policy(policy), start(std::chrono::steady_clock::now()), sleep_us(policy.min_sleep_us) {}
+
+    void pause() {
+        const uint64_t waited_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        if (waited_us < policy.spin_us) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        } else if (waited_us < policy.yield_us) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+            sleep_us = std::min(2 * sleep_us, policy.max_sleep_us);
+        }
+    }
+
+   private:
+    const tt_backoff_policy &policy;
+    std::chrono::steady_clock::time_point start;
+    uint64_t sleep_us;
+};
+
+// Polls condition until it returns true or timeout has passed since start_time. Returns false on timeout.
+template <typename Clock, typename Condition>
+bool wait_with_backoff(
+    Condition &&condition,
+    const std::chrono::time_point<Clock> &start_time,
+    const std::chrono::milliseconds &timeout,
+    const tt_backoff_policy &policy = tt_backoff_policy::get()) {
+    tt_backoff backoff(policy);
+    while (!condition()) {
+        if (Clock::now() - start_time > timeout) {
+            return false;
+        }
+        backoff.pause();
+    }
+    return true;
+}
+
+}  // namespace tt::wait
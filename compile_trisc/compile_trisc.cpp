@@ -12,6 +12,7 @@
 #include "common/cache_lib.hpp"
 #include "common/model/tt_core.hpp"
 #include "common/tt_parallel_for.h"
+#include "compile_trisc/trisc_bin_cache.hpp"
 #include "common/env_lib.hpp"
 #include "common/size_lib.hpp"
 #include "device/cpuset_lib.hpp"
@@ -958,6 +959,11 @@ void generate_trisc_fw(
         generate_op_info_file(graph_it.second.my_graph_info.op_map, graph_path);
     }
 
+    if (tt_trisc_bin_cache* bin_cache = tt_trisc_bin_cache::get()) {
+        bin_cache->evict();
+        bin_cache->report_stats();
+    }
+
     log_debug(tt::LogCompileTrisc, "Compiling TRISC kernels, Done!");
 }
 
@@ -1093,15 +1099,33 @@ void compile_ckernels_for_all_triscs(
     const string& graph_name) {
     fs::remove("hlk_ckernels_compile.log");  // clean the log file
 
+    std::vector<std::string> compile_cmds;
+    std::vector<std::string> link_cmds;
+    for (int thread_id = 0; thread_id < 3; thread_id++) {
+        compile_cmds.push_back(get_trisc_compile_cmd(root, device_name, perf_desc, chlkc_src_dir, thread_id));
+        link_cmds.push_back(get_trisc_link_cmd(root, device_name, chlkc_src_dir, thread_id));
+    }
+
+    tt_trisc_bin_cache* bin_cache = tt_trisc_bin_cache::get();
+    std::string bin_cache_key;
+    if (bin_cache != nullptr) {
+        std::vector<std::string> build_cmds = compile_cmds;
+        build_cmds.insert(build_cmds.end(), link_cmds.begin(), link_cmds.end());
+        bin_cache_key = bin_cache->get_key(root, chlkc_src_dir, build_cmds);
+        if (bin_cache->load(bin_cache_key, chlkc_src_dir)) {
+            return;
+        }
+    }
+
     tt::parallel_for(
         0, 3,
         [&](int thread_id) {
-            compile_ckernels_for_trisc(
-                chlkc_src_dir,
-                thread_id,
-                get_trisc_compile_cmd(root, device_name, perf_desc, chlkc_src_dir, thread_id),
-                get_trisc_link_cmd(root, device_name, chlkc_src_dir, thread_id));
+            compile_ckernels_for_trisc(chlkc_src_dir, thread_id, compile_cmds[thread_id], link_cmds[thread_id]);
         }, 3);
+
+    if (bin_cache != nullptr) {
+        bin_cache->store(bin_cache_key, chlkc_src_dir);
+    }
 }
 
 void print_tile_dims(stringstream& out, const vector<vector<int>>& tile_dims) {
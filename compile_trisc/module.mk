@@ -8,7 +8,8 @@ COMPILE_TRISC_LDFLAGS = -lmodel -lyaml-cpp
 COMPILE_TRISC_CFLAGS = $(CFLAGS) -Werror
 
 COMPILE_TRISC_SRCS = \
-	compile_trisc/compile_trisc.cpp 
+	compile_trisc/compile_trisc.cpp \
+	compile_trisc/trisc_bin_cache.cpp
 
 COMPILE_TRISC_OBJS = $(addprefix $(OBJDIR)/, $(COMPILE_TRISC_SRCS:.cpp=.o))
 COMPILE_TRISC_DEPS = $(addprefix $(OBJDIR)/, $(COMPILE_TRISC_SRCS:.cpp=.d))
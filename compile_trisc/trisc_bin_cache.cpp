@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "compile_trisc/trisc_bin_cache.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+
+#include "common/disk_cache_lib.hpp"
+#include "common/env_lib.hpp"
+#include "utils/logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tt {
+
+namespace {
+
+constexpr int NUM_TRISC_THREADS = 3;
+
+std::vector<fs::path> get_sorted_files(const fs::path &dir, bool recursive) {
+    std::vector<fs::path> files;
+    if (!fs::is_directory(dir)) {
+        return files;
+    }
+    if (recursive) {
+        for (const auto &entry : fs::recursive_directory_iterator(dir)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry.path());
+            }
+        }
+    } else {
+        for (const auto &entry : fs::directory_iterator(dir)) {
+            if (entry.is_regular_file()) {
+                files.push_back(entry.path());
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::string get_trisc_thread_dir(int thread_id) { return "tensix_thread" + std::to_string(thread_id); }
+
+// Object and dependency files are only build intermediates, the loader and log server need the rest
+void copy_trisc_thread_dir(const fs::path &src, const fs::path &dst) {
+    fs::create_directories(dst);
+    for (const auto &entry : fs::recursive_directory_iterator(src)) {
+        const fs::path relative_path = fs::relative(entry.path(), src);
+        if (entry.is_directory()) {
+            fs::create_directories(dst / relative_path);
+        } else if (entry.path().extension() != ".o" and entry.path().extension() != ".d") {
+            fs::copy_file(entry.path(), dst / relative_path, fs::copy_options::overwrite_existing);
+        }
+    }
+}
+
+void replace_all(std::string &str, const std::string &from, const std::string &to) {
+    if (from.empty()) {
+        return;
+    }
+    for (std::size_t pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + to.size())) {
+        str.replace(pos, from.size(), to);
+    }
+}
+
+}  // namespace
+
+tt_trisc_bin_cache::tt_trisc_bin_cache(const std::string &cache_dir, std::uint64_t max_size_bytes) :
+    cache_dir(cache_dir), max_size_bytes(max_size_bytes) {
+    fs::create_directories(cache_dir);
+}
+
+tt_trisc_bin_cache *tt_trisc_bin_cache::get() {
+    static const std::unique_ptr<tt_trisc_bin_cache> cache = []() -> std::unique_ptr<tt_trisc_bin_cache> {
+        const std::string cache_dir = parse_env<std::string>("TT_BACKEND_TRISC_BIN_CACHE_DIR", "");
+        if (cache_dir.empty()) {
+            return nullptr;
+        }
+        const std::uint64_t max_size_mb = parse_env<std::uint64_t>("TT_BACKEND_TRISC_BIN_CACHE_MAX_MB", 4096);
+        log_debug(tt::LogCompileTrisc, "TRISC binary cache at {}, limited to {} MB", cache_dir, max_size_mb);
+        return std::make_unique<tt_trisc_bin_cache>(cache_dir, max_size_mb << 20);
+    }();
+    return cache.get();
+}
+
+const std::string &tt_trisc_bin_cache::get_source_fingerprint(const std::string &root) {
+    std::call_once(source_fingerprint_flag, [&] {
+        // Everything the ckernels make files pull in besides the op directory: llk/ckernel and hlk library headers,
+        // firmware headers, linker scripts and the generated firmware includes, plus the compiler itself
+        disk_cache::content_hasher hasher;
+        for (const char *dir : {"src/ckernels", "hlks/inc", "src/firmware/riscv", "build/src/firmware/riscv"}) {
+            for (const fs::path &file : get_sorted_files(fs::path(root) / dir, true)) {
+                hasher.update(fs::relative(file, root).string());
+                hasher.update_file(file);
+            }
+        }
+        const std::string sfpi = parse_env<std::string>("SFPI", root + "/third_party/sfpi");
+        const fs::path compiler = fs::path(sfpi) / "compiler/bin/riscv32-unknown-elf-g++";
+        if (fs::exists(compiler)) {
+            hasher.update_file(compiler);
+        } else {
+            log_warning(tt::LogCompileTrisc, "TRISC binary cache could not find the riscv compiler at {}", compiler.string());
+        }
+        source_fingerprint = hasher.hex();
+    });
+    return source_fingerprint;
+}
+
+std::string tt_trisc_bin_cache::get_key(
+    const std::string &root, const std::string &op_path, const std::vector<std::string> &build_cmds) {
+    disk_cache::content_hasher hasher;
+    hasher.update(get_source_fingerprint(root));
+
+    for (const fs::path &file : get_sorted_files(op_path, false)) {
+        if (file.extension() != ".log") {
+            hasher.update_file(file);
+        }
+    }
+
+    // Build commands carry absolute paths of the op directory and checkout, which must not affect the key
+    const std::string absolute_op_path = fs::absolute(op_path).string();
+    for (std::string cmd : build_cmds) {
+        replace_all(cmd, absolute_op_path, "<op_path>");
+        replace_all(cmd, root, "<root>/");
+        hasher.update(cmd);
+    }
+    return hasher.hex();
+}
+
+bool tt_trisc_bin_cache::load(const std::string &key, const std::string &op_path) {
+    const fs::path entry = fs::path(cache_dir) / key;
+    std::error_code ec;
+    if (fs::is_directory(entry, ec)) {
+        try {
+            for (int thread_id = 0; thread_id < NUM_TRISC_THREADS; thread_id++) {
+                copy_trisc_thread_dir(entry / get_trisc_thread_dir(thread_id), fs::path(op_path) / get_trisc_thread_dir(thread_id));
+            }
+            disk_cache::touch(entry);
+            num_hits++;
+            log_trace(tt::LogCompileTrisc, "TRISC binary cache hit {} for {}", key, op_path);
+            return true;
+        } catch (const fs::filesystem_error &e) {
+            // Entry got evicted by another process while copying, compile instead
+            log_debug(tt::LogCompileTrisc, "TRISC binary cache failed to load {}: {}", key, e.what());
+            for (int thread_id = 0; thread_id < NUM_TRISC_THREADS; thread_id++) {
+                fs::remove_all(fs::path(op_path) / get_trisc_thread_dir(thread_id), ec);
+            }
+        }
+    }
+    num_misses++;
+    return false;
+}
+
+void tt_trisc_bin_cache::store(const std::string &key, const std::string &op_path) {
+    const fs::path entry = fs::path(cache_dir) / key;
+    std::error_code ec;
+    if (fs::exists(entry, ec)) {
+        return;
+    }
+
+    // Stage privately and publish with a rename, so concurrent readers never see a partial entry
+    const fs::path staging = disk_cache::get_staging_path(entry);
+    try {
+        for (int thread_id = 0; thread_id < NUM_TRISC_THREADS; thread_id++) {
+            copy_trisc_thread_dir(fs::path(op_path) / get_trisc_thread_dir(thread_id), staging / get_trisc_thread_dir(thread_id));
+        }
+        // Fails if another process published the same key first, which is fine
+        fs::rename(staging, entry, ec);
+        if (!ec) {
+            num_stores++;
+        }
+    } catch (const fs::filesystem_error &e) {
+        log_warning(tt::LogCompileTrisc, "TRISC binary cache failed to store {}: {}", key, e.what());
+    }
+    fs::remove_all(staging, ec);
+}
+
+void tt_trisc_bin_cache::evict() {
+    num_evictions += disk_cache::evict_least_recently_used(cache_dir, max_size_bytes, [](const fs::directory_entry &entry) {
+        return entry.is_directory();
+    }, tt::LogCompileTrisc);
+}
+
+void tt_trisc_bin_cache::report_stats() const {
+    log_info(
+        tt::LogCompileTrisc,
+        "TRISC binary cache {}: {} hits, {} misses, {} stored, {} evicted",
+        cache_dir,
+        num_hits.load(),
+        num_misses.load(),
+        num_stores.load(),
+        num_evictions.load());
+}
+
+}  // namespace tt
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tt {
+
+// Persistent, content-addressed cache of compiled TRISC kernels, shared across runs and processes.
+//
+// Enabled by pointing TT_BACKEND_TRISC_BIN_CACHE_DIR at a directory. Cache keys hash everything that goes into a
+// TRISC compile: the generated op descriptors and hlk source in the op directory, the make commands, the ckernels,
+// hlk library and firmware sources and the riscv toolchain. An entry holds the tensix_thread{0,1,2} output
+// directories of one op, and on a hit they are copied into the op directory instead of running make.
+// Least recently used entries are evicted once the cache grows past TT_BACKEND_TRISC_BIN_CACHE_MAX_MB (4096 by default).
+class tt_trisc_bin_cache {
+   public:
+    tt_trisc_bin_cache(const std::string &cache_dir, std::uint64_t max_size_bytes);
+
+    // Returns the process wide cache configured through the environment, or nullptr if caching is disabled
+    static tt_trisc_bin_cache *get();
+
+    // Must be called before compiling, while op_path only holds the compile inputs
+    std::string get_key(const std::string &root, const std::string &op_path, const std::vector<std::string> &build_cmds);
+    // Copies the binaries cached under key into op_path, returns false on a miss
+    bool load(const std::string &key, const std::string &op_path);
+    // Publishes the binaries compiled into op_path under key
+    void store(const std::string &key, const std::string &op_path);
+    // Removes least recently used entries until the cache fits its size limit
+    void evict();
+    void report_stats() const;
+
+   private:
+    std::string cache_dir;
+    std::uint64_t max_size_bytes;
+
+    std::once_flag source_fingerprint_flag;
+    std::string source_fingerprint;
+
+    std::atomic<std::uint32_t> num_hits = 0;
+    std::atomic<std::uint32_t> num_misses = 0;
+    std::atomic<std::uint32_t> num_stores = 0;
+    std::atomic<std::uint32_t> num_evictions = 0;
+
+    const std::string &get_source_fingerprint(const std::string &root);
+};
+
+}  // namespace tt
@@ -4,10 +4,15 @@
 #pragma once
 
 #include "common/base.hpp"
+#include "common/env_lib.hpp"
 #include "netlist/tt_backend_api_types.hpp"
 namespace tt::golden {
 struct tt_golden_config : tt::tt_backend_config {
     bool en_quantize_golden = false;  // Quantize golden results
+    // Number of threads used to run independent ops of a graph concurrently, 1 runs ops serially in topological order
+    int num_threads = tt::parse_env<int>("TT_BACKEND_GOLDEN_NUM_THREADS", 1);
+    // Release intermediate op outputs as soon as their last consumer in the graph has run
+    bool free_intermediate_tensors = tt::parse_env<bool>("TT_BACKEND_GOLDEN_FREE_INTERMEDIATES", true);
 };
 
 inline tt_golden_config get_golden_config(const tt::tt_backend_config &base_config) {
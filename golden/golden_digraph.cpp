@@ -8,19 +8,34 @@
 #include "ops/mm_bare.hpp"
 #include "netlist/netlist_utils.hpp"
 #include "common/tensor_lib.hpp"
+#include "common/tt_parallel_for.h"
 #include "ops/tm_bare.hpp"
 #include "tensor.hpp"
 #include "tt_backend_api_types.hpp"
 
 using namespace netlist_utils;
 namespace tt::golden {
+namespace {
+// Host memory held by the tiles of a tensor
+std::size_t get_tensor_host_bytes(const tt_tensor& tensor) {
+    return static_cast<std::size_t>(tensor.get_num_stored_tiles()) * sizeof(tt_tile);
+}
+}  // namespace
+
 //////////////////////
 // golden_digraph
 //////////////////////
-golden_digraph::golden_digraph(tt_graph_info graph_info, const ARCH arch, const bool en_quantize) {
+golden_digraph::golden_digraph(
+    tt_graph_info graph_info,
+    const ARCH arch,
+    const bool en_quantize,
+    const int num_threads,
+    const bool free_intermediate_tensors) {
     my_graph_info = graph_info;
     en_quantize_golden = en_quantize;
     m_arch = arch;
+    m_num_threads = std::max(num_threads, 1);
+    m_free_intermediate_tensors = free_intermediate_tensors;
 }
 
 void golden_digraph::add_all_nodes(std::map<string, tt_queue_wrap>& queues, tt_graph_info& graph_info) {
@@ -69,6 +84,34 @@ void golden_digraph::create_ops(const unordered_map<string, tt_fused_op_info>& f
             graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr = std::make_shared<tt_tensor>();
         }
     }
+    // Graph structure is fixed from here on, so the execution schedule is computed once and reused for every input
+    m_topo_order = topo_order;
+    compute_execution_levels();
+    compute_tensor_liveness();
+}
+
+void golden_digraph::compute_execution_levels() {
+    // Level of a node is one more than the deepest of its producers, so all producers of a node finish in earlier levels
+    std::vector<int> node_level(boost::num_vertices(graph), 0);
+    m_execution_levels.clear();
+    for (const vertex_t node : m_topo_order) {
+        int level = 0;
+        digraph_t::in_edge_iterator in_begin, in_end;
+        for (boost::tie(in_begin, in_end) = in_edges(node, graph); in_begin != in_end; ++in_begin) {
+            level = std::max(level, node_level.at(boost::source(*in_begin, graph)) + 1);
+        }
+        node_level.at(node) = level;
+        if (m_execution_levels.size() <= static_cast<std::size_t>(level)) {
+            m_execution_levels.resize(level + 1);
+        }
+        m_execution_levels.at(level).push_back(node);
+    }
+    log_trace(
+        tt::LogGolden,
+        "Graph {} scheduled as {} levels for {} nodes",
+        my_graph_info.name,
+        m_execution_levels.size(),
+        m_topo_order.size());
 }
 
 vector<int> golden_digraph::get_input_nodes_ordered_by_input_index(int current_node) {
@@ -84,283 +127,395 @@ vector<int> golden_digraph::get_input_nodes_ordered_by_input_index(int current_n
     return (in_nodes);
 }
 
-void golden_digraph::run() {
-    std::deque<vertex_t> topo_order;
-    boost::topological_sort(graph, std::front_inserter(topo_order));
-    for (unsigned int i = 0; i < topo_order.size(); ++i) {
-        vector<int> input_nodes = get_input_nodes_ordered_by_input_index(topo_order[i]);
-        vector<tt_tensor*> input_tensor_ptrs(input_nodes.size());
+void golden_digraph::compute_tensor_liveness() {
+    // Position of every node in the serial order and in the level schedule
+    std::unordered_map<vertex_t, int> node_position = {};
+    std::unordered_map<vertex_t, int> node_level = {};
+    for (std::size_t i = 0; i < m_topo_order.size(); ++i) {
+        node_position[m_topo_order[i]] = i;
+    }
+    for (std::size_t level = 0; level < m_execution_levels.size(); ++level) {
+        for (const vertex_t node : m_execution_levels[level]) {
+            node_level[node] = level;
+        }
+    }
 
-        if (graph[topo_order[i]].op_not_queue) {
-            log_trace(
-                tt::LogGolden,
-                "running_op: {} on node {}",
-                *graph[topo_order[i]].my_op_info_ptr,
-                graph[topo_order[i]].name);
-
-            vector<tt_tensor> tm_output_tensors(input_nodes.size());
-            vector<bool> ublock_order_changed(input_nodes.size());
-            auto op_ublock_order = graph[topo_order[i]].my_op_info_ptr->output_dim.ublock_order;
-            // fill input tensors into input_tensor_ptrs vector
-            for (unsigned int j = 0; j < input_nodes.size(); ++j) {
-                input_tensor_ptrs[j] = graph[input_nodes[j]].my_golden_output_ptr.get();
-                if (graph[input_nodes[j]].op_not_queue) {
-                    ublock_order_changed.at(j) =
-                        op_ublock_order != graph[input_nodes[j]].my_op_info_ptr->output_dim.ublock_order;
-                } else {
-                    ublock_order_changed.at(j) =
-                        op_ublock_order != Dim::R;  // input node is from queue which is always row-major
-                }
-                // Copy inputs to temp tensors to perform tm ops
-                log_assert(
-                    graph[input_nodes[j]].my_golden_output_ptr->get_data_format() != DataFormat::Invalid,
-                    "input={} data_format is invalid",
-                    j);
-                tm_output_tensors[j] = *graph[input_nodes[j]].my_golden_output_ptr;
-                log_assert(
-                    not tm_output_tensors[j].is_shape_only(),
-                    "Input {} for op {} is uninitialized, missing queue settings could cause us to access out of "
-                    "bounds queue.  Op Info: {}",
-                    j,
-                    graph[topo_order[i]].name,
-                    *graph[topo_order[i]].my_op_info_ptr);
-
-                log_trace(tt::LogGolden, "in {} tensor dims {}", j, tm_output_tensors[j].get_shape());
+    m_release_after_node.clear();
+    m_release_after_level.assign(m_execution_levels.size(), {});
+    for (const vertex_t node : m_topo_order) {
+        // Queue outputs live in the queue and gradient ops read back their previous output, so only
+        // plain op outputs that are consumed within the graph can be released
+        if (not graph[node].op_not_queue or graph[node].my_op_info_ptr->gradient_op or
+            boost::out_degree(node, graph) == 0) {
+            continue;
+        }
+        vertex_t last_consumer = node;
+        int last_consumer_level = node_level.at(node);
+        digraph_t::out_edge_iterator out_begin, out_end;
+        for (boost::tie(out_begin, out_end) = out_edges(node, graph); out_begin != out_end; ++out_begin) {
+            vertex_t consumer = boost::target(*out_begin, graph);
+            if (node_position.at(consumer) > node_position.at(last_consumer)) {
+                last_consumer = consumer;
             }
+            last_consumer_level = std::max(last_consumer_level, node_level.at(consumer));
+        }
+        m_release_after_node[last_consumer].push_back(node);
+        m_release_after_level.at(last_consumer_level).push_back(node);
+    }
+}
 
-            // Unpadding of all inputs
-            for (uint32_t input = 0; input < graph[topo_order[i]].my_op_info_ptr->input_names.size(); input++) {
-                const auto & in_unpad_info = graph[topo_order[i]].my_op_info_ptr->input_unpadding.at(input);
-                const uint32_t unpad_r = in_unpad_info.rt;
-                const uint32_t unpad_c = in_unpad_info.ct;
-                if (unpad_r != 0 || unpad_c != 0) {
-                    log_trace(
-                        tt::LogGolden, "unpad input {} shape before: {}", input, tm_output_tensors[input].get_shape());
-                    tm_output_tensors[input] = tt::tensor_lib::unpad(tm_output_tensors[input], unpad_r, unpad_c);
-                    log_trace(
-                        tt::LogGolden, "unpad input {} shape after: {}", input, tm_output_tensors[input].get_shape());
-                }
-            }
+void golden_digraph::track_produced_tensors(const vector<vertex_t>& nodes) {
+    for (const vertex_t node : nodes) {
+        if (not graph[node].op_not_queue or graph[node].my_golden_output_ptr == nullptr) {
+            continue;
+        }
+        std::size_t& node_bytes = m_live_tensor_bytes_per_node[node];
+        m_live_tensor_bytes -= node_bytes;
+        node_bytes = get_tensor_host_bytes(*graph[node].my_golden_output_ptr);
+        m_live_tensor_bytes += node_bytes;
+    }
+    m_peak_live_tensor_bytes = std::max(m_peak_live_tensor_bytes, m_live_tensor_bytes);
+}
 
-            // Apply TMs for each input
-            for (const auto& it : graph[topo_order[i]].my_op_info_ptr->input_tm_ops) {
-                std::uint32_t input = it.first;
-
-                // Process list of all TM's in place
-                for (const auto& tm : it.second) {
-                    string tm_name = get<0>(tm);
-                    if(tm_name == "pad") {
-                        const auto & in_pad_info = graph[topo_order[i]].my_op_info_ptr->input_padding.at(input);
-                        const float pad_val = in_pad_info.pad_value;
-                        tm_output_tensors[input] =
-                            tt::tensor_lib::pad_rc_val(tm_output_tensors[input], get<1>(tm).at(0), get<1>(tm).at(1), pad_val);
-                    }
-                    else {
-                        tt_tm_config config({
-                            .op = netlist_utils::get_valid_tm_op(tm_name),
-                            .args = get<1>(tm),
-                        });
-                        log_assert(
-                            (config.op != TmOp::TileBroadcast) or
-                                ((input == 1) and
-                                (netlist_utils::is_valid_binary_op(graph[topo_order[i]].my_op_info_ptr->type))),
-                            "Can only do a tile_broadcast if it is the second input of a binary op");
-                        log_trace(tt::LogGolden, "Running TM OP {} on input {}", tm_name, input);
-
-                        // Create input tensor vector for TM op
-                        vector<tt_tensor*> tm_input = {&tm_output_tensors[input]};
-                        tt_tm::utils::golden_model(config, tm_input, &tm_output_tensors[input]);
-                    }
-                }
+void golden_digraph::release_dead_tensors(const vector<vertex_t>& nodes) {
+    if (not m_free_intermediate_tensors) {
+        return;
+    }
+    for (const vertex_t node : nodes) {
+        log_trace(tt::LogGolden, "Releasing output of node {} after its last consumer", graph[node].name);
+        graph[node].my_golden_output_ptr.reset();
+        graph[node].my_op_info_ptr->op_output_tensor_ptr.reset();
+        m_live_tensor_bytes -= m_live_tensor_bytes_per_node[node];
+        m_live_tensor_bytes_per_node[node] = 0;
+    }
+}
+
+void golden_digraph::run() {
+    if (m_num_threads > 1) {
+        run_levels_in_parallel();
+    } else {
+        for (const vertex_t node : m_topo_order) {
+            run_node(node);
+            track_produced_tensors({node});
+            auto release_it = m_release_after_node.find(node);
+            if (release_it != m_release_after_node.end()) {
+                release_dead_tensors(release_it->second);
             }
+        }
+    }
+    log_trace(
+        tt::LogGolden,
+        "Graph {} live op output memory after run: {} bytes, high-water mark: {} bytes",
+        my_graph_info.name,
+        m_live_tensor_bytes,
+        m_peak_live_tensor_bytes);
+}
+
+void golden_digraph::run_levels_in_parallel() {
+    // Nodes within a level have no dependencies between each other and each one only writes its own output,
+    // so the results are identical to the serial topological order. Ops parallelize internally with tt::parallel_for too,
+    // those loops are queued on the same process wide scheduler as this one, so nesting never adds threads beyond it.
+    for (std::size_t level_index = 0; level_index < m_execution_levels.size(); ++level_index) {
+        const auto& level = m_execution_levels[level_index];
+        if (level.size() == 1) {
+            run_node(level.front());
+        } else {
+            int num_threads = std::min<int>(m_num_threads, level.size());
+            tt::parallel_for(
+                level.begin(), level.end(), [this](const vertex_t node) { run_node(node); }, num_threads);
+        }
+        track_produced_tensors(level);
+        release_dead_tensors(m_release_after_level.at(level_index));
+    }
+}
+
+void golden_digraph::run_node(vertex_t node) {
+    vector<int> input_nodes = get_input_nodes_ordered_by_input_index(node);
+    if (graph[node].op_not_queue) {
+        run_op_node(node, input_nodes);
+    } else {
+        run_queue_node(node, input_nodes);
+    }
+}
+
+void golden_digraph::run_op_node(vertex_t node, const vector<int>& input_nodes) {
+    vector<tt_tensor*> input_tensor_ptrs(input_nodes.size());
+    log_trace(
+        tt::LogGolden,
+        "running_op: {} on node {}",
+        *graph[node].my_op_info_ptr,
+        graph[node].name);
+
+    // Inputs borrow the producer's tensor and are only copied once something needs to modify them
+    vector<tt_cow_tensor> tm_output_tensors(input_nodes.size());
+    vector<bool> ublock_order_changed(input_nodes.size());
+    auto op_ublock_order = graph[node].my_op_info_ptr->output_dim.ublock_order;
+    // fill input tensors into input_tensor_ptrs vector
+    for (unsigned int j = 0; j < input_nodes.size(); ++j) {
+        input_tensor_ptrs[j] = graph[input_nodes[j]].my_golden_output_ptr.get();
+        if (graph[input_nodes[j]].op_not_queue) {
+            ublock_order_changed.at(j) =
+                op_ublock_order != graph[input_nodes[j]].my_op_info_ptr->output_dim.ublock_order;
+        } else {
+            ublock_order_changed.at(j) =
+                op_ublock_order != Dim::R;  // input node is from queue which is always row-major
+        }
+        log_assert(
+            graph[input_nodes[j]].my_golden_output_ptr->get_data_format() != DataFormat::Invalid,
+            "input={} data_format is invalid",
+            j);
+        tm_output_tensors[j] = tt_cow_tensor(graph[input_nodes[j]].my_golden_output_ptr);
+        log_assert(
+            not tm_output_tensors[j].get().is_shape_only(),
+            "Input {} for op {} is uninitialized, missing queue settings could cause us to access out of "
+            "bounds queue.  Op Info: {}",
+            j,
+            graph[node].name,
+            *graph[node].my_op_info_ptr);
+
+        log_trace(tt::LogGolden, "in {} tensor dims {}", j, tm_output_tensors[j].get().get_shape());
+    }
+
+    // Unpadding of all inputs
+    for (uint32_t input = 0; input < graph[node].my_op_info_ptr->input_names.size(); input++) {
+        const auto & in_unpad_info = graph[node].my_op_info_ptr->input_unpadding.at(input);
+        const uint32_t unpad_r = in_unpad_info.rt;
+        const uint32_t unpad_c = in_unpad_info.ct;
+        if (unpad_r != 0 || unpad_c != 0) {
+            log_trace(
+                tt::LogGolden, "unpad input {} shape before: {}", input, tm_output_tensors[input].get().get_shape());
+            tm_output_tensors[input].reset(tt::tensor_lib::unpad(tm_output_tensors[input].get(), unpad_r, unpad_c));
+            log_trace(
+                tt::LogGolden, "unpad input {} shape after: {}", input, tm_output_tensors[input].get().get_shape());
+        }
+    }
+
+    // Apply TMs for each input
+    for (const auto& it : graph[node].my_op_info_ptr->input_tm_ops) {
+        std::uint32_t input = it.first;
 
-            // Add padding
-            for (uint32_t input = 0; input < graph[topo_order[i]].my_op_info_ptr->input_names.size(); input++) {
-                const auto & in_pad_info = graph[topo_order[i]].my_op_info_ptr->input_padding.at(input);
-                const uint32_t pad_r = in_pad_info.rt;
-                const uint32_t pad_c = in_pad_info.ct;
+        // Each TM produces a new tensor from the previous one, so the producer's tensor is never modified
+        for (const auto& tm : it.second) {
+            string tm_name = get<0>(tm);
+            if(tm_name == "pad") {
+                const auto & in_pad_info = graph[node].my_op_info_ptr->input_padding.at(input);
                 const float pad_val = in_pad_info.pad_value;
-                if (pad_r > 0 || pad_c > 0) {
-                    log_trace(
-                        tt::LogGolden, "pad input {} shape before: {}", input, tm_output_tensors[input].get_shape());
-                    tm_output_tensors[input] =
-                        tt::tensor_lib::pad_rc_val(tm_output_tensors[input], pad_r, pad_c, pad_val);
-                    log_trace(
-                        tt::LogGolden, "pad input {} shape after: {}", input, tm_output_tensors[input].get_shape());
-                }
+                tm_output_tensors[input].reset(tt::tensor_lib::pad_rc_val(
+                    tm_output_tensors[input].get(), get<1>(tm).at(0), get<1>(tm).at(1), pad_val));
             }
-
-            std::shared_ptr<tt_op> op_ptr;
-            op_ptr = graph[topo_order[i]].my_op_info_ptr->my_op;
-            bool is_wormhole = ((m_arch == ARCH::WORMHOLE) or (m_arch == ARCH::WORMHOLE_B0));
-            // Check if input/output tensors use bfp2/4 dataformats, enable quantization for bfp formats
-            for (auto& input_tensor : tm_output_tensors) {
-                bool is_bfp_df =
-                    is_bfp2_format(input_tensor.get_data_format()) || is_bfp4_format(input_tensor.get_data_format());
-                bool convert_float32_to_tf32 = (input_tensor.get_data_format() == DataFormat::Float32) and is_wormhole;
-                // Quantize tensors if quantize_golden is enabled and Bfp4/2 is detected or it is TF32
-                if (en_quantize_golden && (is_bfp_df or convert_float32_to_tf32)) {
-                    if (convert_float32_to_tf32) {
-                        input_tensor.set_data_format(DataFormat::Tf32);
-                    }
-                    input_tensor.adjust_tensor_for_accuracy();
-                }
+            else {
+                tt_tm_config config({
+                    .op = netlist_utils::get_valid_tm_op(tm_name),
+                    .args = get<1>(tm),
+                });
+                log_assert(
+                    (config.op != TmOp::TileBroadcast) or
+                        ((input == 1) and
+                        (netlist_utils::is_valid_binary_op(graph[node].my_op_info_ptr->type))),
+                    "Can only do a tile_broadcast if it is the second input of a binary op");
+                log_trace(tt::LogGolden, "Running TM OP {} on input {}", tm_name, input);
+
+                // Create input tensor vector for TM op, TMs only read their input
+                vector<tt_tensor*> tm_input = {const_cast<tt_tensor*>(&tm_output_tensors[input].get())};
+                tt_tensor tm_output_tensor;
+                tt_tm::utils::golden_model(config, tm_input, &tm_output_tensor);
+                tm_output_tensors[input].reset(std::move(tm_output_tensor));
             }
+        }
+    }
 
-            // Save prev output for gradient op
-            tt_tensor* op_acc_output_tensor_ptr = nullptr;
-            if (graph[topo_order[i]].my_op_info_ptr->gradient_op) {
-                if (graph[topo_order[i]].my_golden_output_ptr != nullptr) {
-                    tt_tensor* op_prev_output_tensor_ptr = graph[topo_order[i]].my_golden_output_ptr.get();
-                    op_acc_output_tensor_ptr = new tt_tensor(op_prev_output_tensor_ptr->metadata);
-                    log_trace(tt::LogGolden, "Using previous accumulator for op={}", op_ptr->name);
-                    log_assert(
-                        op_prev_output_tensor_ptr->get_data_format() != DataFormat::Invalid,
-                        "gradient_op data_format is invalid");
-                    *op_acc_output_tensor_ptr = *op_prev_output_tensor_ptr;
-                }
-            }
-            std::vector<tt_tensor*> tm_output_tensor_ptrs = {};
-            for (auto& tm_output_tensor : tm_output_tensors) {
-                tm_output_tensor_ptrs.push_back(&tm_output_tensor);
+    // Add padding
+    for (uint32_t input = 0; input < graph[node].my_op_info_ptr->input_names.size(); input++) {
+        const auto & in_pad_info = graph[node].my_op_info_ptr->input_padding.at(input);
+        const uint32_t pad_r = in_pad_info.rt;
+        const uint32_t pad_c = in_pad_info.ct;
+        const float pad_val = in_pad_info.pad_value;
+        if (pad_r > 0 || pad_c > 0) {
+            log_trace(
+                tt::LogGolden, "pad input {} shape before: {}", input, tm_output_tensors[input].get().get_shape());
+            tm_output_tensors[input].reset(
+                tt::tensor_lib::pad_rc_val(tm_output_tensors[input].get(), pad_r, pad_c, pad_val));
+            log_trace(
+                tt::LogGolden, "pad input {} shape after: {}", input, tm_output_tensors[input].get().get_shape());
+        }
+    }
+
+    std::shared_ptr<tt_op> op_ptr;
+    op_ptr = graph[node].my_op_info_ptr->my_op;
+    bool is_wormhole = ((m_arch == ARCH::WORMHOLE) or (m_arch == ARCH::WORMHOLE_B0));
+    // Check if input/output tensors use bfp2/4 dataformats, enable quantization for bfp formats
+    for (auto& staged_input_tensor : tm_output_tensors) {
+        DataFormat input_data_format = staged_input_tensor.get().get_data_format();
+        bool is_bfp_df = is_bfp2_format(input_data_format) || is_bfp4_format(input_data_format);
+        bool convert_float32_to_tf32 = (input_data_format == DataFormat::Float32) and is_wormhole;
+        // Quantize tensors if quantize_golden is enabled and Bfp4/2 is detected or it is TF32
+        if (en_quantize_golden && (is_bfp_df or convert_float32_to_tf32)) {
+            tt_tensor& input_tensor = staged_input_tensor.get_mutable();
+            if (convert_float32_to_tf32) {
+                input_tensor.set_data_format(DataFormat::Tf32);
             }
-            // Run Golden for the OP.
-            try {
-                op_ptr->model(tm_output_tensor_ptrs, graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr.get());
-            } catch (const std::exception& e) {
-                log_error("{}", e.what());
-                log_fatal("Hit Error while running op={}", graph[topo_order[i]].my_op_info_ptr->name);
+            input_tensor.adjust_tensor_for_accuracy();
+        }
+    }
+
+    // Save prev output for gradient op
+    tt_tensor* op_acc_output_tensor_ptr = nullptr;
+    if (graph[node].my_op_info_ptr->gradient_op) {
+        if (graph[node].my_golden_output_ptr != nullptr) {
+            tt_tensor* op_prev_output_tensor_ptr = graph[node].my_golden_output_ptr.get();
+            op_acc_output_tensor_ptr = new tt_tensor(op_prev_output_tensor_ptr->metadata);
+            log_trace(tt::LogGolden, "Using previous accumulator for op={}", op_ptr->name);
+            log_assert(
+                op_prev_output_tensor_ptr->get_data_format() != DataFormat::Invalid,
+                "gradient_op data_format is invalid");
+            *op_acc_output_tensor_ptr = *op_prev_output_tensor_ptr;
+        }
+    }
+    // Inputs that are still borrowed are only materialized for ops that modify their inputs
+    std::vector<tt_tensor*> tm_output_tensor_ptrs = {};
+    for (auto& tm_output_tensor : tm_output_tensors) {
+        if (op_ptr->model_modifies_inputs()) {
+            tm_output_tensor_ptrs.push_back(&tm_output_tensor.get_mutable());
+        } else {
+            tm_output_tensor_ptrs.push_back(const_cast<tt_tensor*>(&tm_output_tensor.get()));
+        }
+    }
+    // Every run produces a new output tensor, so the previous output can be shared with queues and consumers
+    graph[node].my_op_info_ptr->op_output_tensor_ptr = std::make_shared<tt_tensor>();
+    // Run Golden for the OP.
+    try {
+        op_ptr->model(tm_output_tensor_ptrs, graph[node].my_op_info_ptr->op_output_tensor_ptr.get());
+    } catch (const std::exception& e) {
+        log_error("{}", e.what());
+        log_fatal("Hit Error while running op={}", graph[node].my_op_info_ptr->name);
+    }
+    // Accumulate output and delete temp tensor
+    if (graph[node].my_op_info_ptr->gradient_op) {
+        if (op_name_to_output_queue_map.find(op_ptr->name) == op_name_to_output_queue_map.end()) {
+            log_fatal(
+                "Op={} is being used as a gradient op and must output to a queue, but cannot find output "
+                "queue assosciated",
+                graph[node].my_op_info_ptr->name);
+        }
+        tt_queue_wrap output_queue = op_name_to_output_queue_map.at(op_ptr->name);
+
+        if (op_acc_output_tensor_ptr != nullptr) {
+            if (output_queue.my_io->zero) {
+                log_trace(tt::LogGolden, "Zeroing accumulator for op={}", op_ptr->name);
+                output_queue.my_io->set_zero(false);
+            } else {
+                tt_tensor* op_output_tensor_ptr =
+                    graph[node].my_op_info_ptr->op_output_tensor_ptr.get();
+                *op_output_tensor_ptr = op_acc_output_tensor_ptr->add(*op_output_tensor_ptr);
+                delete op_acc_output_tensor_ptr;
             }
-            // Accumulate output and delete temp tensor
-            if (graph[topo_order[i]].my_op_info_ptr->gradient_op) {
-                if (op_name_to_output_queue_map.find(op_ptr->name) == op_name_to_output_queue_map.end()) {
-                    log_fatal(
-                        "Op={} is being used as a gradient op and must output to a queue, but cannot find output "
-                        "queue assosciated",
-                        graph[topo_order[i]].my_op_info_ptr->name);
-                }
-                tt_queue_wrap output_queue = op_name_to_output_queue_map.at(op_ptr->name);
-
-                if (op_acc_output_tensor_ptr != nullptr) {
-                    if (output_queue.my_io->zero) {
-                        log_trace(tt::LogGolden, "Zeroing accumulator for op={}", op_ptr->name);
-                        output_queue.my_io->set_zero(false);
-                    } else {
-                        tt_tensor* op_output_tensor_ptr =
-                            graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr.get();
-                        *op_output_tensor_ptr = op_acc_output_tensor_ptr->add(*op_output_tensor_ptr);
-                        delete op_acc_output_tensor_ptr;
-                    }
-                } else {
-                    // Clear on the first iteration if zero flag is set
-                    if (output_queue.my_io->zero) {
-                        log_trace(tt::LogGolden, "Zeroing accumulator for op={}", op_ptr->name);
-                        output_queue.my_io->set_zero(false);
-                    }
-                }
+        } else {
+            // Clear on the first iteration if zero flag is set
+            if (output_queue.my_io->zero) {
+                log_trace(tt::LogGolden, "Zeroing accumulator for op={}", op_ptr->name);
+                output_queue.my_io->set_zero(false);
             }
+        }
+    }
 
-            // Apply relu if enabled -- fused_op will handle relu in the op, so skip this one
-            if (graph[topo_order[i]].my_op_info_ptr->attributes.relu_en and
-                (not netlist_utils::is_valid_fused_op(graph[topo_order[i]].my_op_info_ptr->type))) {
-                tensor_lib::relu_with_threshold(
-                    *graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr,
-                    *graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr,
-                    Dim::RC,
-                    graph[topo_order[i]].my_op_info_ptr->attributes.relu_mode,
-                    graph[topo_order[i]].my_op_info_ptr->attributes.relu_threshold);
-            }
+    // Apply relu if enabled -- fused_op will handle relu in the op, so skip this one
+    if (graph[node].my_op_info_ptr->attributes.relu_en and
+        (not netlist_utils::is_valid_fused_op(graph[node].my_op_info_ptr->type))) {
+        tensor_lib::relu_with_threshold(
+            *graph[node].my_op_info_ptr->op_output_tensor_ptr,
+            *graph[node].my_op_info_ptr->op_output_tensor_ptr,
+            Dim::RC,
+            graph[node].my_op_info_ptr->attributes.relu_mode,
+            graph[node].my_op_info_ptr->attributes.relu_threshold);
+    }
 
-            DataFormat output_df = graph[topo_order[i]].my_op_info_ptr->output_data_format;
-            string op_type = graph[topo_order[i]].my_op_info_ptr->type;
-            if (should_adjust_output_tensor_for_accuracy(output_df)) {
-                tt_tensor* out = graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr.get();
-                DataFormat df = output_df;
-                if (op_type == "requantization" || op_type == "quantization" ||
-                    graph[topo_order[i]].my_op_info_ptr->attributes.requant) {
-                    df = DataFormat::Int8;
-                }
-                if (df == DataFormat::Int32) {
-                    bool max_value_exceeded = out->check_for_max_abs_value(std::pow(2, 24));
-                    if (max_value_exceeded) {
-                        log_warning(
-                            tt::LogOp,
-                            "Op with Int32 output produced values bigger 2^24, this can lead to imprecisions in golden "
-                            "implementation, due to golden implementation using float32 for integer ops");
-                    }
-                }
-                out->set_data_format(df);
-                out->adjust_tensor_for_accuracy();
+    DataFormat output_df = graph[node].my_op_info_ptr->output_data_format;
+    string op_type = graph[node].my_op_info_ptr->type;
+    if (should_adjust_output_tensor_for_accuracy(output_df)) {
+        tt_tensor* out = graph[node].my_op_info_ptr->op_output_tensor_ptr.get();
+        DataFormat df = output_df;
+        if (op_type == "requantization" || op_type == "quantization" ||
+            graph[node].my_op_info_ptr->attributes.requant) {
+            df = DataFormat::Int8;
+        }
+        if (df == DataFormat::Int32) {
+            bool max_value_exceeded = out->check_for_max_abs_value(std::pow(2, 24));
+            if (max_value_exceeded) {
+                log_warning(
+                    tt::LogOp,
+                    "Op with Int32 output produced values bigger 2^24, this can lead to imprecisions in golden "
+                    "implementation, due to golden implementation using float32 for integer ops");
             }
+        }
+        out->set_data_format(df);
+        out->adjust_tensor_for_accuracy();
+    }
 
-            // Copy to output ptr
-            graph[topo_order[i]].my_golden_output_ptr = graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr;
+    // Copy to output ptr
+    graph[node].my_golden_output_ptr = graph[node].my_op_info_ptr->op_output_tensor_ptr;
 
-            log_trace(
-                tt::LogGolden,
-                "Tensor Dump {}",
-                graph[topo_order[i]].my_op_info_ptr->op_output_tensor_ptr->get_string());
+    log_trace(
+        tt::LogGolden,
+        "Tensor Dump {}",
+        graph[node].my_op_info_ptr->op_output_tensor_ptr->get_string());
+}
 
+void golden_digraph::run_queue_node(vertex_t node, const vector<int>& input_nodes) {
+    // Run a Queue Node
+    tt_queue_wrap* q_wrap = graph[node].my_queue_wrap_ptr;
+    tt_queue_info& q_info = q_wrap->my_queue_info;
+
+    if (q_info.type == IO_TYPE::Queue) {
+        log_trace(tt::LogGolden, "Queue: {}", q_info.name);
+        log_trace(tt::LogGolden, "Queue.local_rd_ptr(): {}", q_wrap->my_io->get_local_rd_ptr());
+        log_trace(tt::LogGolden, "Queue.global_rd_ptr(): {}", q_wrap->my_io->get_global_rd_ptr());
+        log_trace(tt::LogGolden, "Queue.entries(): {}", q_wrap->my_io->entries);
+    } else {
+        log_trace(tt::LogGolden, "RAM: {}", q_info.name);
+        log_trace(tt::LogGolden, "ram.global_wr_ptr(): {}", q_wrap->my_io->get_global_wr_ptr());
+        log_trace(tt::LogGolden, "ram.global_rd_ptr(): {}", q_wrap->my_io->get_global_rd_ptr());
+        log_trace(tt::LogGolden, "ram.entries(): {}", q_wrap->my_io->entries);
+    }
+    // If there is an input to io, then check and push to io structure.
+    if (boost::in_degree(node, graph) != 0) {
+        // IO is used as an output
+        log_assert(
+            input_nodes.size() == 1,
+            "Internal Error -- Output Node for Queue={} must have 1 input when connected in Golden Backend",
+            q_info.name);
+        if (q_info.input_tm_ops.size() == 0) {
+            // Producer ops write a new output tensor on every run, so the queue can share it without a copy
+            q_wrap->my_io->push(graph[input_nodes[0]].my_golden_output_ptr);
         } else {
-            // Run a Queue Node
-            tt_queue_wrap* q_wrap = graph[topo_order[i]].my_queue_wrap_ptr;
-            tt_queue_info& q_info = q_wrap->my_queue_info;
-
-            if (q_info.type == IO_TYPE::Queue) {
-                log_trace(tt::LogGolden, "Queue: {}", q_info.name);
-                log_trace(tt::LogGolden, "Queue.local_rd_ptr(): {}", q_wrap->my_io->get_local_rd_ptr());
-                log_trace(tt::LogGolden, "Queue.global_rd_ptr(): {}", q_wrap->my_io->get_global_rd_ptr());
-                log_trace(tt::LogGolden, "Queue.entries(): {}", q_wrap->my_io->entries);
-            } else {
-                log_trace(tt::LogGolden, "RAM: {}", q_info.name);
-                log_trace(tt::LogGolden, "ram.global_wr_ptr(): {}", q_wrap->my_io->get_global_wr_ptr());
-                log_trace(tt::LogGolden, "ram.global_rd_ptr(): {}", q_wrap->my_io->get_global_rd_ptr());
-                log_trace(tt::LogGolden, "ram.entries(): {}", q_wrap->my_io->entries);
-            }
-            // If there is an input to io, then check and push to io structure.
-            if (boost::in_degree(topo_order[i], graph) != 0) {
-                // IO is used as an output
-                log_assert(
-                    input_nodes.size() == 1,
-                    "Internal Error -- Output Node for Queue={} must have 1 input when connected in Golden Backend",
-                    q_info.name);
-                if (q_info.input_tm_ops.size() == 0) {
-                    for (unsigned int j = 0; j < input_nodes.size(); ++j) {
-                        input_tensor_ptrs[j] = graph[input_nodes[j]].my_golden_output_ptr.get();
-                    }               
-                    q_wrap->my_io->push(std::make_shared<tt_tensor>(*input_tensor_ptrs[0]));
-                } else {
-                    tt_tensor tm_output_tensor;
-                    // Copy input to temp tensor to perform TMs
-                    tm_output_tensor = *graph[input_nodes[0]].my_golden_output_ptr; 
-                    for (const auto& tm : q_info.input_tm_ops[0]) {
-                        string tm_name = get<0>(tm);
-                        if(tm_name == "pad") {
-                            log_fatal("Queue {}: input padding not supported for queues", q_info.name);
-                        }
-                        else {
-                            tt_tm_config config({
-                                .op = netlist_utils::get_valid_tm_op(tm_name),
-                                .args = get<1>(tm),
-                            });
-                            log_trace(tt::LogGolden, "Running TM OP {}", tm_name);
-                            //
-                            // Create input tensor vector for TM op
-                            vector<tt_tensor*> tm_input = {&tm_output_tensor};
-                            tt_tm::utils::golden_model(config, tm_input, &tm_output_tensor);
-                        }
-                    }
-                    q_wrap->my_io->push(std::make_shared<tt_tensor>(tm_output_tensor));
+            tt_cow_tensor tm_output_tensor(graph[input_nodes[0]].my_golden_output_ptr);
+            for (const auto& tm : q_info.input_tm_ops[0]) {
+                string tm_name = get<0>(tm);
+                if(tm_name == "pad") {
+                    log_fatal("Queue {}: input padding not supported for queues", q_info.name);
+                }
+                else {
+                    tt_tm_config config({
+                        .op = netlist_utils::get_valid_tm_op(tm_name),
+                        .args = get<1>(tm),
+                    });
+                    log_trace(tt::LogGolden, "Running TM OP {}", tm_name);
+                    //
+                    // Create input tensor vector for TM op, TMs only read their input
+                    vector<tt_tensor*> tm_input = {const_cast<tt_tensor*>(&tm_output_tensor.get())};
+                    tt_tensor tm_result_tensor;
+                    tt_tm::utils::golden_model(config, tm_input, &tm_result_tensor);
+                    tm_output_tensor.reset(std::move(tm_result_tensor));
                 }
-             }
-
-            // If there is an output for IO, then check and copy to output_ptr
-            if (boost::out_degree(topo_order[i], graph) != 0) {
-                // check if node is connected
-                graph[topo_order[i]].my_golden_output_ptr = q_wrap->my_io->get();
             }
+            q_wrap->my_io->push(tm_output_tensor.get_shared());
         }
     }
+
+    // If there is an output for IO, then check and copy to output_ptr
+    if (boost::out_degree(node, graph) != 0) {
+        // check if node is connected
+        graph[node].my_golden_output_ptr = q_wrap->my_io->get();
+    }
 }
 
 bool golden_digraph::should_adjust_output_tensor_for_accuracy(DataFormat output_data_format) {
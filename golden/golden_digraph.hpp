@@ -18,7 +18,12 @@
 namespace tt::golden {
 class golden_digraph : public tt_digraph {
    public:
-    golden_digraph(tt_graph_info graph_info, const ARCH arch, const bool en_quantize = false);
+    golden_digraph(
+        tt_graph_info graph_info,
+        const ARCH arch,
+        const bool en_quantize = false,
+        const int num_threads = 1,
+        const bool free_intermediate_tensors = true);
     golden_digraph(){};
     void add_all_nodes(std::map<string, tt_queue_wrap>& queues, tt_graph_info& graph_info);
     void remove_unconnected_nodes();
@@ -27,10 +32,32 @@ class golden_digraph : public tt_digraph {
     vector<int> get_input_nodes_ordered_by_input_index(int current_node);
     void create_ops(const unordered_map<string, tt_fused_op_info>& fused_ops_map);
     void run();
+    //! High-water mark of memory held by op outputs of this graph, across all runs
+    std::size_t get_peak_live_tensor_bytes() const { return m_peak_live_tensor_bytes; }
 
    private:
+    void compute_execution_levels();
+    void compute_tensor_liveness();
+    void track_produced_tensors(const vector<vertex_t>& nodes);
+    void release_dead_tensors(const vector<vertex_t>& nodes);
+    void run_node(vertex_t node);
+    void run_op_node(vertex_t node, const vector<int>& input_nodes);
+    void run_queue_node(vertex_t node, const vector<int>& input_nodes);
+    void run_levels_in_parallel();
     bool should_adjust_output_tensor_for_accuracy(DataFormat output_data_format);
     bool en_quantize_golden = false;
     ARCH m_arch = ARCH::Invalid;
+    int m_num_threads = 1;
+    bool m_free_intermediate_tensors = true;
+    // Topological order of the graph and the same nodes grouped into dependency wavefronts.
+    // Every node in a level only consumes outputs of nodes from earlier levels.
+    std::deque<vertex_t> m_topo_order = {};
+    vector<vector<vertex_t>> m_execution_levels = {};
+    // Op nodes whose output is dead once the given node (serial) or level (parallel) has run
+    std::unordered_map<vertex_t, vector<vertex_t>> m_release_after_node = {};
+    vector<vector<vertex_t>> m_release_after_level = {};
+    std::unordered_map<vertex_t, std::size_t> m_live_tensor_bytes_per_node = {};
+    std::size_t m_live_tensor_bytes = 0;
+    std::size_t m_peak_live_tensor_bytes = 0;
 };
 }
@@ -167,7 +167,8 @@ golden_workload_data::get_queue_settings_for_temporal_graph(const std::string &g
 
 void golden_workload_data::populate_graph(
     const tt_graph_info &graph_info, const ARCH arch, const netlist_parser &parser) {
-    graphs[graph_info.name] = golden_digraph(graph_info, arch, m_config.en_quantize_golden);
+    graphs[graph_info.name] = golden_digraph(
+        graph_info, arch, m_config.en_quantize_golden, m_config.num_threads, m_config.free_intermediate_tensors);
     graphs[graph_info.name].add_all_nodes(queues, graphs[graph_info.name].my_graph_info);
     graphs[graph_info.name].connect_nodes();
     if (m_config.dump_graphs) {
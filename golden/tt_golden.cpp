@@ -119,6 +119,7 @@ tt::DEVICE_STATUS_CODE tt_golden::initialize() {
 //! finish - Must be called once and only once after all programs are run.  Clean up
 tt::DEVICE_STATUS_CODE tt_golden::finish() {
     if (tt_object_cache<golden_workload_data>::exists(m_netlist_path)) {
+        report_peak_tensor_memory();
         tt_object_cache<golden_workload_data>::clear(m_netlist_path);
     }
     if (tt_object_cache<tt_golden_config>::exists(m_netlist_path)) {
@@ -126,6 +127,30 @@ tt::DEVICE_STATUS_CODE tt_golden::finish() {
     }
     return tt::DEVICE_STATUS_CODE::Success;
 }
+void tt_golden::report_peak_tensor_memory() {
+    std::size_t peak_bytes = 0;
+    std::string peak_graph_name = "";
+    for (const auto &graph_it : m_workload.graphs) {
+        std::size_t graph_peak_bytes = graph_it.second.get_peak_live_tensor_bytes();
+        log_debug(
+            tt::LogGolden,
+            "Graph {} peak op output memory: {:.2f} MB",
+            graph_it.first,
+            graph_peak_bytes / (1024.0 * 1024.0));
+        if (graph_peak_bytes > peak_bytes) {
+            peak_bytes = graph_peak_bytes;
+            peak_graph_name = graph_it.first;
+        }
+    }
+    if (peak_bytes > 0) {
+        log_info(
+            tt::LogGolden,
+            "Golden peak op output memory: {:.2f} MB in graph {} (intermediate release {})",
+            peak_bytes / (1024.0 * 1024.0),
+            peak_graph_name,
+            m_config.free_intermediate_tensors ? "enabled" : "disabled");
+    }
+}
 //! Run Program - Must be done to run program specified
 tt::DEVICE_STATUS_CODE tt_golden::run_program(const string &program_name, const std::map<string, string> &parameters) {
     PROFILE_SCOPE_MS();
@@ -433,7 +458,7 @@ void tt_golden::load_parameter_and_constant_queues() {
         auto q_desc = get_queue_descriptor(io);
         tt_PytorchTensorDesc pytorch_tensor_desc;
         tt_TilizedTensorDesc tilized_tensor_desc;
-        bool tilized = tensor_meta_to_tensor_desc(config.tti->get_tensor_meta(io), data, pytorch_tensor_desc, tilized_tensor_desc, q_desc.bufq_target_format);
+        bool tilized = tensor_meta_to_tensor_desc(*config.tti, io, data, pytorch_tensor_desc, tilized_tensor_desc, q_desc.bufq_target_format);
         if(tilized) {
             tt::golden::io::push_input(q_desc, tilized_tensor_desc, -1, 0);
         }
@@ -70,6 +70,7 @@ class tt_golden : public tt_backend {
     golden_workload_data m_workload;  // structure which has all the graphs/programs and state
     std::mutex get_queue_descriptor_mutex;
     golden_workload_data &get_workload(std::string netlist_path);
+    void report_peak_tensor_memory();
 
     void propagate_variable(netlist_program &program, string variable_string);
     void propagate_variable_for_io(
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "dram_write_plan.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+#include "common/tt_parallel_for.h"
+#include "tt_cluster.hpp"
+
+namespace tt {
+
+void tt_dram_write_plan::add(const tt_hex *hex, uint64_t slot_size_bytes) {
+    const uint64_t size_bytes = hex->hex_vec.size() * sizeof(uint32_t);
+    if (size_bytes == 0) {
+        return;
+    }
+    planned_hexes.push_back({hex, hex->d_addr + std::max(slot_size_bytes, size_bytes)});
+}
+
+std::vector<std::vector<tt_dram_write_plan::coalesced_write>> tt_dram_write_plan::coalesce() {
+    // Stable, so hexes added for the same address are still written in the order they were added
+    const auto dram_and_addr = [](const planned_hex &planned) {
+        return std::make_tuple(planned.hex->d_chip_id, planned.hex->d_chan, planned.hex->d_subchannel, planned.hex->d_addr);
+    };
+    std::stable_sort(planned_hexes.begin(), planned_hexes.end(), [&](const planned_hex &a, const planned_hex &b) {
+        return dram_and_addr(a) < dram_and_addr(b);
+    });
+
+    // Coalesce, keeping the writes of each dram channel in their own list
+    std::vector<std::vector<coalesced_write>> writes_per_channel;
+    const tt_hex *prev_hex = nullptr;
+    for (const planned_hex &planned : planned_hexes) {
+        const tt_hex *hex = planned.hex;
+        const uint64_t end_addr = hex->d_addr + hex->hex_vec.size() * sizeof(uint32_t);
+        const bool same_channel = prev_hex != nullptr and prev_hex->d_chip_id == hex->d_chip_id and
+                                  prev_hex->d_chan == hex->d_chan and prev_hex->d_subchannel == hex->d_subchannel;
+        if (!same_channel) {
+            writes_per_channel.emplace_back();
+        }
+        std::vector<coalesced_write> &channel_writes = writes_per_channel.back();
+        if (same_channel) {
+            coalesced_write &last = channel_writes.back();
+            // The gap must not overlap the previous hex and must fit in the unused tail of its slot
+            const bool mergeable = hex->d_addr >= last.end_addr and hex->d_addr <= last.slot_end and
+                                   hex->d_addr - last.end_addr <= max_padding_bytes and
+                                   (hex->d_addr - last.end_addr) % sizeof(uint32_t) == 0 and
+                                   end_addr - last.start_addr <= max_write_bytes;
+            if (mergeable) {
+                last.hexes.push_back(hex);
+                last.end_addr = end_addr;
+                last.slot_end = planned.slot_end;
+                prev_hex = hex;
+                continue;
+            }
+        }
+        channel_writes.push_back({{hex}, hex->d_addr, end_addr, planned.slot_end});
+        prev_hex = hex;
+    }
+    planned_hexes.clear();
+    return writes_per_channel;
+}
+
+void tt_dram_write_plan::write(tt_cluster *cluster, int num_threads) {
+    num_bytes_written = 0;
+    num_writes = 0;
+    const std::vector<std::vector<coalesced_write>> writes_per_channel = coalesce();
+    if (writes_per_channel.empty()) {
+        return;
+    }
+
+    for (const std::vector<coalesced_write> &channel_writes : writes_per_channel) {
+        num_writes += channel_writes.size();
+        for (const coalesced_write &write : channel_writes) {
+            num_bytes_written += write.end_addr - write.start_addr;
+        }
+    }
+
+    const auto write_channel = [&](int channel_idx) {
+        for (const coalesced_write &write : writes_per_channel.at(channel_idx)) {
+            issue(cluster, write);
+        }
+        // Write combined stores must be flushed from the core that issued them, before the caller's memory barrier
+        tt_driver_atomics::sfence();
+    };
+    num_threads = std::min<int>(num_threads, writes_per_channel.size());
+    if (num_threads > 1) {
+        tt::parallel_for(0, int(writes_per_channel.size()), write_channel, num_threads);
+    } else {
+        for (int channel_idx = 0; channel_idx < writes_per_channel.size(); channel_idx++) {
+            write_channel(channel_idx);
+        }
+    }
+}
+
+std::vector<uint32_t> tt_dram_write_plan::get_write_data(const coalesced_write &write) {
+    // Padding between the hexes stays zero
+    std::vector<uint32_t> staging((write.end_addr - write.start_addr) / sizeof(uint32_t), 0);
+    for (const tt_hex *hex : write.hexes) {
+        std::memcpy(
+            staging.data() + (hex->d_addr - write.start_addr) / sizeof(uint32_t),
+            hex->hex_vec.data(),
+            hex->hex_vec.size() * sizeof(uint32_t));
+    }
+    return staging;
+}
+
+void tt_dram_write_plan::issue(tt_cluster *cluster, const coalesced_write &write) {
+    const tt_hex *first = write.hexes.front();
+    const tt_target_dram dram = {first->d_chip_id, first->d_chan, first->d_subchannel};
+    if (write.hexes.size() == 1) {
+        cluster->write_dram_vec(first->hex_vec.data(), first->hex_vec.size() * sizeof(uint32_t), dram, first->d_addr);
+        return;
+    }
+    const std::vector<uint32_t> staging = get_write_data(write);
+    cluster->write_dram_vec(staging.data(), staging.size() * sizeof(uint32_t), dram, write.start_addr);
+}
+
+}  // namespace tt
@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "model/model.hpp"
+
+struct tt_cluster;
+
+namespace tt {
+
+// Plans host to device dram writes of many small hexes, such as the per core binaries of an epoch.
+//
+// Hexes which follow each other in the same dram channel are merged into one write. Each hex comes with the size of
+// the dram slot reserved for it, and the unused tail of a slot may be overwritten with zeros to bridge the gap to the
+// next hex, up to max_padding_bytes. Writes to different dram channels are independent and can be issued from
+// several threads.
+class tt_dram_write_plan {
+   public:
+    static constexpr uint64_t max_padding_bytes = 16 * 1024;
+    static constexpr uint64_t max_write_bytes = 4 * 1024 * 1024;
+
+    // Consecutive hexes of one dram channel, written with a single write
+    struct coalesced_write {
+        std::vector<const tt_hex *> hexes;
+        uint64_t start_addr;
+        uint64_t end_addr;
+        uint64_t slot_end;
+    };
+
+    // The hex must stay alive and unchanged until write() returns
+    void add(const tt_hex *hex, uint64_t slot_size_bytes);
+    // Coalesces the planned hexes into writes and clears the plan. Writes are grouped per dram channel, in ascending
+    // address order within a channel.
+    std::vector<std::vector<coalesced_write>> coalesce();
+    // Issues all the planned writes and clears the plan. Does not insert any memory barrier.
+    void write(tt_cluster *cluster, int num_threads);
+
+    // Data of a write, with zeros in the padding between its hexes
+    static std::vector<uint32_t> get_write_data(const coalesced_write &write);
+
+    // Stats of the last write()
+    uint64_t get_num_bytes_written() const { return num_bytes_written; }
+    uint32_t get_num_writes() const { return num_writes; }
+
+   private:
+    struct planned_hex {
+        const tt_hex *hex;
+        uint64_t slot_end;
+    };
+
+    std::vector<planned_hex> planned_hexes;
+    uint64_t num_bytes_written = 0;
+    uint32_t num_writes = 0;
+
+    static void issue(tt_cluster *cluster, const coalesced_write &write);
+};
+
+}  // namespace tt
@@ -8,6 +8,7 @@
 #include "dram_address_map.h"
 #include "utils.hpp"
 #include "epoch_utils.hpp"
+#include "dram_write_plan.hpp"
 #include "utils/scoped_timer.hpp"
 
 
@@ -269,6 +270,61 @@ string tt_epoch_binary_cache::policy_based_binary_name(uint32_t offset) {
     return use_lru ? list.back() : *std::next(list.begin(), offset);
 }
 
+std::string tt_epoch_binary_cache::get_policy_name() const {
+    return belady_active() ? "belady" : use_lru ? "lru" : "mru-backtrace";
+}
+
+void tt_epoch_binary_cache::set_future_accesses(const std::vector<std::string>& binary_names) {
+    future_access_positions.clear();
+    future_access_cursor = 0;
+    for (uint32_t pos = 0; pos < binary_names.size(); pos++) {
+        future_access_positions[binary_names[pos]].push_back(pos);
+    }
+    has_future_accesses = true;
+}
+
+void tt_epoch_binary_cache::clear_future_accesses() {
+    future_access_positions.clear();
+    future_access_cursor = 0;
+    has_future_accesses = false;
+}
+
+uint32_t tt_epoch_binary_cache::get_next_access(const std::string& binary_name) const {
+    auto it = future_access_positions.find(binary_name);
+    if (it == future_access_positions.end()) {
+        return NO_FUTURE_ACCESS;
+    }
+    auto pos = std::lower_bound(it->second.begin(), it->second.end(), future_access_cursor);
+    return pos == it->second.end() ? NO_FUTURE_ACCESS : *pos;
+}
+
+std::string tt_epoch_binary_cache::get_belady_victim(std::unordered_map<std::string, int>& num_cmds_per_bin, std::vector<tt_epoch_queue*>& command_qs, tt_cluster* cluster, bool io_queue_update_cmd) {
+    // Rank evictable binaries by next use, furthest first. Ties (typically binaries not used again by this program)
+    // are broken towards the least recently used one.
+    std::vector<std::pair<uint32_t, std::string>> candidates;
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+        if (pinned_binary_names.find(*it) == pinned_binary_names.end()) {
+            candidates.push_back({get_next_access(*it), *it});
+        }
+    }
+    if (candidates.empty()) {
+        log_fatal("Insufficient space in {} - all binaries are pinned.", cache_name);
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    // Take the highest ranked binary that no command in flight refers to, polling device rd ptrs until one frees up
+    while (true) {
+        for (const auto& candidate : candidates) {
+            if (!num_cmds_per_bin.at(candidate.second)) {
+                return candidate.second;
+            }
+        }
+        for (int i = 0; i < command_qs.size(); i++) {
+            (command_qs[i]) -> update_num_commands_per_binary(cluster, io_queue_update_cmd);
+        }
+    }
+}
+
 void tt_epoch_binary_cache::clear_pinned_binaries() {
     if (pinned_binary_names.size() > 0){
         log_trace(tt::LogLoader, "Clearing {} pinned binaries for {}", pinned_binary_names.size(), cache_name);
@@ -281,6 +337,15 @@ bool tt_epoch_binary_cache::get_slot_for_binary(const std::string& binary_name,
     slot = get(binary_name, binary_preload);
     bool cache_hit = slot >= 0;
 
+    // Preloads happen ahead of the program, only real accesses move along the trace. Accesses missing from the
+    // trace (eg. skipped launches while looping on device) leave the cursor where it is.
+    if (belady_active() and !binary_preload) {
+        uint32_t next_access = get_next_access(binary_name);
+        if (next_access != NO_FUTURE_ACCESS) {
+            future_access_cursor = next_access + 1;
+        }
+    }
+
     if (pin_binary) {
         pinned_binary_names.insert(binary_name);
         log_trace(tt::LogLoader, "Pinning Binary: {} in Cache: {}", binary_name, cache_name);
@@ -293,34 +358,40 @@ bool tt_epoch_binary_cache::get_slot_for_binary(const std::string& binary_name,
                 "Insufficient space for binary {} in {} (capacity: {} pinned_binaries: {}). Consider increasing size via env-var.",
                 binary_name, cache_name, capacity, pinned_binary_names.size());
 
-            while(num_cmds_per_bin.at(policy_based_binary_name(offset))) {
-                // Find a binary that can be evicted. Starting in the middle of the cache and moving towards the LRU binary reduces overhead of querying device rd ptrs.
-                for(int i = 0; i < command_qs.size(); i++) {
-                    (command_qs[i]) -> update_num_commands_per_binary(cluster, io_queue_update_cmd);
+            if (belady_active()) {
+                const auto& victim = cache.at(get_belady_victim(num_cmds_per_bin, command_qs, cluster, io_queue_update_cmd));
+                slot = victim.first;
+                offset = std::distance(list.begin(), victim.second);
+            } else {
+                while(num_cmds_per_bin.at(policy_based_binary_name(offset))) {
+                    // Find a binary that can be evicted. Starting in the middle of the cache and moving towards the LRU binary reduces overhead of querying device rd ptrs.
+                    for(int i = 0; i < command_qs.size(); i++) {
+                        (command_qs[i]) -> update_num_commands_per_binary(cluster, io_queue_update_cmd);
+                    }
+                    offset = (offset - 1 + capacity) % capacity; // Wrap at 0 back to capacity.
                 }
-                offset = (offset - 1 + capacity) % capacity; // Wrap at 0 back to capacity.
-            }
-            // After rd ptr updates, trace back towards the MRU binary, in case a more recent binary got evicted. This approximates an ideal MRU cache eviction policy.
-            uint32_t initial_offset = (!use_lru) * offset;
-            for(int i = 0; i < initial_offset; i++) {
-                if(!num_cmds_per_bin.at(policy_based_binary_name(offset - 1))) {
-                    offset--;
+                // After rd ptr updates, trace back towards the MRU binary, in case a more recent binary got evicted. This approximates an ideal MRU cache eviction policy.
+                uint32_t initial_offset = (!use_lru) * offset;
+                for(int i = 0; i < initial_offset; i++) {
+                    if(!num_cmds_per_bin.at(policy_based_binary_name(offset - 1))) {
+                        offset--;
+                    }
+                    else break;
                 }
-                else break;
-            }
 
-            // Catch the case if somehow evicted binary is pinned (requried to not be evicted)
-            auto evicted_binary_name = policy_based_binary_name(offset);
-            if (pinned_binary_names.find(evicted_binary_name) != pinned_binary_names.end()){
-                log_fatal("Insufficient space in {} - pinned binary {} would be evicted to make room for {}.", cache_name, evicted_binary_name, binary_name);
-            }
+                // Catch the case if somehow evicted binary is pinned (requried to not be evicted)
+                auto evicted_binary_name = policy_based_binary_name(offset);
+                if (pinned_binary_names.find(evicted_binary_name) != pinned_binary_names.end()){
+                    log_fatal("Insufficient space in {} - pinned binary {} would be evicted to make room for {}.", cache_name, evicted_binary_name, binary_name);
+                }
 
-            slot = policy_based_binary_slot(offset);
+                slot = policy_based_binary_slot(offset);
+            }
         }
         else {
             slot = binary_q_ptr.incr_get_wr();
         }
-        if(use_lru) put_lru(binary_name, slot, offset);
+        if(use_lru and !belady_active()) put_lru(binary_name, slot, offset);
         else put_mru_bt(binary_name, slot, offset);
     }
     return cache_hit;
@@ -517,32 +588,45 @@ void tt_epoch_binary::get_epoch_binaries(
     }
 }
 
-void tt_epoch_binary::update_overlay_binary(const std::string &output_dir, const std::string &graph_name, int temporal_epoch, int chip_id, const buda_soc_description* sdesc, tt_cluster* cluster)
+void tt_epoch_binary::update_overlay_binary(const std::string &output_dir, const std::string &graph_name, int temporal_epoch, int chip_id, const buda_soc_description* sdesc, tt_cluster* cluster, tt::tt_overlay_blob_images *compiled_blobs)
 {
     // Support for graph specific or epoch specific overlay blobs. TODO: merge to the same convention
     const string &epoch_path = output_dir + "/temporal_epoch_" + to_string(temporal_epoch);// + "/graph_" + graph_name;
 
     string overlay_blob_path = epoch_path + "/overlay" + "/" + tt::overlay_blobs_dir;
-    log_trace(tt::LogLoader, "Update overlay blob using path {}", overlay_blob_path);
+
+    // Blobs compiled by this process are handed over in memory. Otherwise they are loaded from the binary container
+    // the runtime writes to the build directory, falling back to the hex files written by standalone blobgen.
+    tt::tt_overlay_blob_images container_blobs;
+    const string container_path = tt::get_overlay_blob_container_path(overlay_blob_path, temporal_epoch);
+    if (compiled_blobs == nullptr and fs::exists(container_path)) {
+        container_blobs = tt::read_overlay_blob_container(container_path, chip_id);
+        compiled_blobs = &container_blobs;
+    }
+    log_trace(tt::LogLoader, "Update overlay blob using {}", compiled_blobs ? "compiled blob images" : "path " + overlay_blob_path);
+
+    const auto get_blob = [&](const tt_xy_pair &routing_core) -> vector<uint32_t> {
+        auto route_r = routing_core.y;
+        auto route_c = routing_core.x;
+        cluster -> translate_to_noc_table_coords(chip_id, route_r, route_c);
+        if (compiled_blobs == nullptr) {
+            string blob_filename = overlay_blob_path + "/pipegen_epoch" + to_string(temporal_epoch) + "_" + to_string(chip_id) + "_" + to_string(route_r) + "_" + to_string(route_c) + ".hex";
+            return get_overlay_binary(blob_filename);
+        }
+        auto blob = compiled_blobs->find(tt_cxy_pair(chip_id, route_c, route_r));
+        log_assert(blob != compiled_blobs->end(), "Missing overlay blob of epoch {} for core {}-{}, chip={}", temporal_epoch, route_r, route_c, chip_id);
+        // Every core takes its blob once, so it is moved out rather than copied
+        return std::move(blob->second);
+    };
 
     for (tt_hex &hex : blob_bin_vec) {
-        auto route_r = hex.associated_routing_core.y;
-        auto route_c = hex.associated_routing_core.x;
-        
-        cluster -> translate_to_noc_table_coords(chip_id, route_r, route_c);        
-        string blob_filename = overlay_blob_path + "/pipegen_epoch" + to_string(temporal_epoch) + "_" + to_string(chip_id) + "_" + to_string(route_r) + "_" + to_string(route_c) + ".hex";
-        hex.hex_vec = get_overlay_binary(blob_filename);
-        log_trace(tt::LogLoader, "update_overlay_binary({} bytes) at routing {}-{}, chip={}", hex.hex_vec.size()*4, route_r, route_c, hex.d_chip_id);
+        hex.hex_vec = get_blob(hex.associated_routing_core);
+        log_trace(tt::LogLoader, "update_overlay_binary({} bytes) at routing {}-{}, chip={}", hex.hex_vec.size()*4, hex.associated_routing_core.y, hex.associated_routing_core.x, hex.d_chip_id);
     }
 
     for (tt_hex &hex : ethernet_blob_bin_vec) {
-        auto route_r = hex.associated_routing_core.y;
-        auto route_c = hex.associated_routing_core.x;
-
-        cluster -> translate_to_noc_table_coords(chip_id, route_r, route_c);
-        string blob_filename = overlay_blob_path + "/pipegen_epoch" + to_string(temporal_epoch) + "_" + to_string(chip_id) + "_" + to_string(route_r) + "_" + to_string(route_c) + ".hex";
-        hex.hex_vec = get_overlay_binary(blob_filename);
-        log_trace(tt::LogLoader, "\tethernet_blob_bin_vec({} bytes) @routing_core(chip={}, x={}, y={})", hex.hex_vec.size()*4, hex.d_chip_id, route_c, route_r);
+        hex.hex_vec = get_blob(hex.associated_routing_core);
+        log_trace(tt::LogLoader, "\tethernet_blob_bin_vec({} bytes) @routing_core(chip={}, x={}, y={})", hex.hex_vec.size()*4, hex.d_chip_id, hex.associated_routing_core.x, hex.associated_routing_core.y);
     }
 }
 
@@ -1242,7 +1326,7 @@ void tt_epoch_control::incr_wr_ptr() {
     bin_q_ptrs.incr_get_wr();
 }
 
-void tt_epoch_control::init_epoch_ctrl(int cmd_slots, int cmd_size, int bin_slots, bool enable_mru_with_backtrace_bin_cache)
+void tt_epoch_control::init_epoch_ctrl(int cmd_slots, int cmd_size, int bin_slots, bool enable_mru_with_backtrace_bin_cache, bool enable_belady_bin_cache)
 {
     buda_soc_description &sdesc = cluster -> get_soc_desc(associated_chip);
     tt_cluster_description *cluster_desc = cluster->get_cluster_desc();
@@ -1254,6 +1338,7 @@ void tt_epoch_control::init_epoch_ctrl(int cmd_slots, int cmd_size, int bin_slot
     if(enable_mru_with_backtrace_bin_cache) {
         cache.use_lru = false;
     }
+    cache.use_belady = enable_belady_bin_cache;
     // We need to know if we are a silicon device until we can enable ethernet cores in Versim.
     // See the note in the routing_core assignment branch below
     bool is_silicon = this->cluster->type == TargetDevice::Silicon;
@@ -1736,6 +1821,7 @@ void tt_epoch_loader::set_optimization_level(int level) {
         enable_epoch_preloading = true;
         enable_optimized_barriers = true;
         enable_runtime_hazard_checks = true; // can be used to guard potentially expensive runtime hazard checks.
+        enable_belady_bin_cache = parse_env("TT_BACKEND_EPOCH_BIN_CACHE_BELADY", false); // Trace driven eviction, overrides LRU/MRU
     }
     if (level >= 2) {   // All prev optimizations + queue settings reuse + mru cache for epoch binaries
         enable_queue_settings_reuse = true;
@@ -1772,7 +1858,7 @@ void tt_epoch_loader::create_and_allocate_epoch_queues(bool distribute_tables) {
     for (int device: target_devices) {
         auto &sdesc = cluster->get_soc_desc(device);
         tt_epoch_control* ctrl = epoch_ctrl[device];
-        ctrl->init_epoch_ctrl(epoch_queue::get_epoch_q_num_slots(), epoch_queue::EPOCH_Q_SLOT_SIZE, epoch_queue::get_epoch_bin_num_slots(), enable_mru_with_backtrace_bin_cache);
+        ctrl->init_epoch_ctrl(epoch_queue::get_epoch_q_num_slots(), epoch_queue::EPOCH_Q_SLOT_SIZE, epoch_queue::get_epoch_bin_num_slots(), enable_mru_with_backtrace_bin_cache, enable_belady_bin_cache);
         bool disable_shadow_l1_ptr_for_chip = disable_eq_shadow_l1_wrptrs && !cluster->get_cluster_desc()->is_chip_mmio_capable(device);
 
         // Allocate/Init epoch command queues
@@ -2824,7 +2910,11 @@ void tt_epoch_loader::insert_epoch_program(tt_epoch_program_info &&epoch_info) {
 }
 
 void tt_epoch_loader::send_epoch_program(std::string name, bool epoch_binary_preload) {
-    tt_epoch_program_info &epoch_info = get_epoch_program_info(name);
+    send_epoch_program(get_epoch_program_info(name), epoch_binary_preload);
+}
+
+void tt_epoch_loader::send_epoch_program(tt_epoch_program_info &epoch_info, bool epoch_binary_preload) {
+    const std::string &name = epoch_info.name;
     tt_epoch_control &ctrl = *epoch_ctrl[epoch_info.target_device];
 
     // Check if epoch can be reused from device cache, if not lay it out in DRAM and update addrs
@@ -2857,6 +2947,25 @@ tt_epoch_program_info& tt_epoch_loader::get_epoch_program_info(std::string name)
     return graph_to_epoch_map.at(name);
 }
 
+void tt_epoch_loader::set_epoch_binary_cache_trace(const std::optional<std::vector<std::string>> &graph_names) {
+    if (!enable_epoch_caching or !enable_belady_bin_cache) return;
+    if (!graph_names) {
+        // Programs too long to trace up front run with the LRU/MRU policy
+        log_debug(tt::LogLoader, "Program too long for an epoch binary access trace, Belady eviction disabled for it");
+        for (auto &[device, ctrl] : epoch_ctrl) {
+            ctrl->cache.clear_future_accesses();
+        }
+        return;
+    }
+    std::unordered_map<int, std::vector<std::string>> binaries_per_device;
+    for (const auto &graph_name : *graph_names) {
+        binaries_per_device[get_epoch_program_info(graph_name).target_device].push_back(graph_name);
+    }
+    for (auto &[device, ctrl] : epoch_ctrl) {
+        ctrl->cache.set_future_accesses(binaries_per_device[device]);
+    }
+}
+
 bool tt_epoch_loader::lay_out_binaries(const tt_epoch_program_info &info, bool epoch_binary_preload) {
     perf::ScopedEventProfiler profile(perf::HostEventType::LAYOUT_BINARIES);
     shared_ptr<tt_epoch_binary> bin = info.binary;
@@ -3037,6 +3146,8 @@ void tt_epoch_loader::send_epoch_binaries(const tt_epoch_program_info &info) {
     int target_chip = info.target_device;
     auto *ctrl = epoch_ctrl[target_chip];
 
+    // All binaries of the epoch are planned first, so those adjacent in a dram channel go out as one write
+    tt::tt_dram_write_plan write_plan;
     for(int hex_id = 0; hex_id < bin -> number_of_tensix_hex_images(); hex_id++) {
 
         // Skip sending empty kernels always. Kernel cache enabled only preloads unique trisc binaries.
@@ -3050,38 +3161,51 @@ void tt_epoch_loader::send_epoch_binaries(const tt_epoch_program_info &info) {
             ctrl->unique_op_idx_per_ch_binary_preloaded[unique_op_index][trisc_bin_dram_channel] = true;
         }
 
-        // Send all trisc and overlay binaries corresponding to a single core at once to minimize TLB misses
         tt_hex *hex;
 
         if (send_trisc_binary) {
             hex = &(bin->trisc0_bin_vec[hex_id]);
             log_trace(tt::LogLoader, "\tSending trisc0 bin for noc core (chip={},x={}, y={}) to dram channel: {} @ 0x{:x}", hex -> d_chip_id, (hex -> associated_routing_core).x, (hex -> associated_routing_core).y, hex -> d_chan, hex -> d_addr);
-            cluster -> send_hex_to_dram(hex);
+            write_plan.add(hex, l1_mem::address_map::TRISC0_SIZE);
 
             hex = &(bin->trisc1_bin_vec[hex_id]);
             log_trace(tt::LogLoader, "\tSending trisc1 bin for noc core (chip={},x={}, y={}) to dram channel: {} @ 0x{:x}", hex -> d_chip_id, (hex -> associated_routing_core).x, (hex -> associated_routing_core).y, hex -> d_chan, hex -> d_addr);
-            cluster -> send_hex_to_dram(hex);
+            write_plan.add(hex, l1_mem::address_map::TRISC1_SIZE);
 
             hex = &(bin->trisc2_bin_vec[hex_id]);
             log_trace(tt::LogLoader, "\tSending trisc2 bin for noc core (chip={}, x={}, y={}) to dram channel: {} @ 0x{:x}", hex -> d_chip_id, (hex -> associated_routing_core).x, (hex -> associated_routing_core).y, hex -> d_chan, hex -> d_addr);
-            cluster -> send_hex_to_dram(hex);
+            write_plan.add(hex, l1_mem::address_map::TRISC2_SIZE);
         }
 
         hex = &(bin->runtime_config_vec[hex_id]);
         log_trace(tt::LogLoader, "\tSending runtime config for noc core (chip={}, x={}, y={}) to dram channel: {} @ 0x{:x}", hex -> d_chip_id, (hex -> associated_routing_core).x, (hex -> associated_routing_core).y, hex -> d_chan, hex -> d_addr);
-        cluster -> send_hex_to_dram(hex);
+        write_plan.add(hex, l1_mem::address_map::EPOCH_RUNTIME_CONFIG_SIZE);
         
         hex = &(bin->blob_bin_vec[hex_id]);
         log_trace(tt::LogLoader, "\tSending blob for noc core (chip={}, x={}, y={}) to dram channel: {} @ 0x{:x}", hex -> d_chip_id, (hex -> associated_routing_core).x, (hex -> associated_routing_core).y, hex -> d_chan, hex -> d_addr);
-        cluster -> send_hex_to_dram(hex);
+        write_plan.add(hex, dram_mem::address_map::OVERLAY_FULL_BLOB_SIZE());
     }
 
     for (tt_hex &hex : bin->ethernet_blob_bin_vec) {
         log_trace(tt::LogLoader, "\tSending ethernet_blob for noc core (chip={}, x={}, y={}) to dram channel: {} @ 0x{:x}", hex.d_chip_id, hex.associated_routing_core.x, hex.associated_routing_core.y, hex.d_chan, hex.d_addr);
-        cluster->send_hex_to_dram(&hex);
+        write_plan.add(&hex, eth_l1_mem::address_map::OVERLAY_BLOB_SIZE);
     }
+
+    // The silicon driver serializes accesses to a TLB itself, other devices get all writes from this thread
+    static const int max_write_threads = parse_env<int>("TT_BACKEND_EPOCH_BINARY_WRITE_THREADS", 4);
+    const int num_write_threads = cluster->type == TargetDevice::Silicon ? max_write_threads : 1;
+    const uint64_t write_start = perf::get_timestamp();
+    write_plan.write(cluster, num_write_threads);
     // Insert a Host -> Device DRAM barrier here to ensure that commands don't race ahead of binaries, when on different channels
     cluster -> memory_barrier(MemBarType::host_device_dram, info.target_device); 
+    // Binaries are only known to be in dram once the barrier is done, so the bandwidth includes it
+    const uint64_t write_duration_ns = std::max<uint64_t>(perf::get_timestamp() - write_start, 1);
+    log_trace(tt::LogLoader, "\tSent {} bytes of binaries for graph {} in {} writes", write_plan.get_num_bytes_written(), info.name, write_plan.get_num_writes());
+    backend_profiler.record_loader_event(perf::get_event_id(perf::HostEventType::EPOCH_BINARY_WRITE_BYTES, target_chip, info.epoch_id), write_plan.get_num_bytes_written());
+    backend_profiler.record_loader_event(perf::get_event_id(perf::HostEventType::EPOCH_BINARY_WRITE_COUNT, target_chip, info.epoch_id), write_plan.get_num_writes());
+    backend_profiler.record_loader_event(
+        perf::get_event_id(perf::HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH, target_chip, info.epoch_id),
+        write_plan.get_num_bytes_written() * 1000000000ULL / write_duration_ns);
     if (check_binaries) {
         for (tt_hex &hex : bin->trisc0_bin_vec) cluster->check_hex_from_dram(&hex, "trisc0");
         for (tt_hex &hex : bin->trisc1_bin_vec) cluster->check_hex_from_dram(&hex, "trisc1");
@@ -3,14 +3,17 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include "model/model.hpp"
 #include "common/cache_lib.hpp"
 #include "tt_cluster.hpp"
 #include "common/tt_queue_ptr.hpp"
 #include "device/device_api.h"
 #include "tt_hexfile.h"
+#include "overlay_blob_container.hpp"
 #include "netlist/netlist_info_types.hpp"
 #include "netlist/tt_digraph.hpp"
 #include "runtime/runtime_types.hpp"
@@ -81,7 +84,9 @@ struct tt_epoch_dram_manager
 /**
  * Epoch binary cache class
  * 
- * This is derived from the tt_recency_cache class and can be programmed to use an LRU replacement policy or approximate MRU
+ * This is derived from the tt_recency_cache class and can be programmed to use an LRU replacement policy, approximate MRU,
+ * or a trace driven (Belady) policy. The Belady policy is given the future binary accesses of the program about to run
+ * and evicts the binary whose next use is furthest in the future.
  * Additional functionality added on top of basic recency cache:
  *      full() : Return if the cache is full or not
  *      policy_based_binary_slot(): Return the cache list slot, at an offset from the most recently used for MRU. Return the LRU slot for LRU
@@ -89,6 +94,8 @@ struct tt_epoch_dram_manager
  *      policy_based_binary_name(): Return the name of the binary at the slot computed with the replacement policy and offset
  *      get_slot_for_binary(): Return true cache hit status. Place the binary in a slot determined by the policy and return the slot by reference
  *      clear_pinned_binaries() : Clears the set of pinned binary names. Pinnned binaries are those that cannot be evicted.
+ *      set_future_accesses() : Sets the binary access trace used by the Belady policy, starting from the next access.
+ *      clear_future_accesses() : Drops the trace, evictions fall back to the LRU/MRU policy until a new trace is set.
  */
 
 class tt_epoch_binary_cache: public tt_recency_cache
@@ -103,7 +110,23 @@ class tt_epoch_binary_cache: public tt_recency_cache
     bool get_slot_for_binary(const std::string& binary_name, std::unordered_map<std::string, int>& num_cmds_per_bin, tt_queue_ptr& binary_q_ptr, int& slot,
         std::vector<tt_epoch_queue*>& command_qs, tt_cluster* cluster, bool binary_preload, bool pin_binary, bool io_queue_update_cmd = false);
     void clear_pinned_binaries();
+    std::string get_policy_name() const;
     tt_epoch_binary_cache(std::string name, uint32_t capacity, bool enable_mru_with_backtrace_bin_cache);
+
+    // Belady replacement while a trace is set, takes precedence over use_lru
+    bool use_belady = false;
+    void set_future_accesses(const std::vector<std::string>& binary_names);
+    void clear_future_accesses();
+
+    private:
+    bool has_future_accesses = false;
+    bool belady_active() const { return use_belady and has_future_accesses; }
+    static constexpr uint32_t NO_FUTURE_ACCESS = std::numeric_limits<uint32_t>::max();
+    // Sorted trace positions of each binary, and the position of the next expected access
+    std::unordered_map<std::string, std::vector<uint32_t>> future_access_positions;
+    uint32_t future_access_cursor = 0;
+    uint32_t get_next_access(const std::string& binary_name) const;
+    std::string get_belady_victim(std::unordered_map<std::string, int>& num_cmds_per_bin, std::vector<tt_epoch_queue*>& command_qs, tt_cluster* cluster, bool io_queue_update_cmd);
 };
 
 /**
@@ -166,7 +189,8 @@ class tt_epoch_binary
     void assign_ethernet_binaries_to_dram(int hex_id, int dram_channel, int dram_subchannel, uint64_t dram_start_addr);
 
     void get_epoch_binaries(const std::string &output_dir, const std::string &graph_name, const map<string, tt_op_info> &op_map, const buda_soc_description& sdesc);
-    void update_overlay_binary(const std::string &output_dir, const std::string &graph_name, int temporal_epoch, int chip_id, const buda_soc_description *sdesc, tt_cluster* cluster);
+    // Takes the overlay blobs of the epoch from compiled_blobs if given, consuming them, and from the build directory otherwise
+    void update_overlay_binary(const std::string &output_dir, const std::string &graph_name, int temporal_epoch, int chip_id, const buda_soc_description *sdesc, tt_cluster* cluster, tt::tt_overlay_blob_images *compiled_blobs = nullptr);
 };
 
 /**
@@ -333,7 +357,7 @@ struct tt_epoch_control
 
     void incr_wr_ptr();
     vector<tt_epoch_queue *> *get_hexqs_ptr();
-    void init_epoch_ctrl(int cmd_slots, int cmd_size, int bin_slots, bool enable_mru_with_backtrace_bin_cache);
+    void init_epoch_ctrl(int cmd_slots, int cmd_size, int bin_slots, bool enable_mru_with_backtrace_bin_cache, bool enable_belady_bin_cache = false);
 
     int occupancy();
     bool all_empty();
@@ -443,6 +467,7 @@ class tt_epoch_loader
     bool enable_queues_only_sync = false;
     bool enable_queue_settings_reuse = false;
     bool enable_mru_with_backtrace_bin_cache = false;
+    bool enable_belady_bin_cache = false;
     bool enable_looping_on_device = false;
     bool enable_varinst_merge_io_queue_updates = false;
     bool disable_eq_shadow_l1_wrptrs = false;
@@ -490,7 +515,10 @@ class tt_epoch_loader
     //! epoch programs
     void insert_epoch_program(tt_epoch_program_info &&epoch);
     void send_epoch_program(std::string name, bool epoch_binary_preload);
+    void send_epoch_program(tt_epoch_program_info &epoch_info, bool epoch_binary_preload);
     tt_epoch_program_info& get_epoch_program_info(std::string name);
+    //! Upcoming graph executions of the program about to run, for the Belady epoch binary cache
+    void set_epoch_binary_cache_trace(const std::optional<std::vector<std::string>> &graph_names);
 
     //! epoch binaries
     bool lay_out_binaries(const tt_epoch_program_info &info, bool epoch_binary_preload);
@@ -9,7 +9,10 @@ LOADER_CFLAGS = $(CFLAGS) -Werror -Wno-int-to-pointer-cast -Wno-abi
 LOADER_SRCS = \
 	loader/tlb_config.cpp \
 	loader/tt_cluster.cpp \
+	loader/tt_mock_device.cpp \
 	loader/epoch_loader.cpp \
+	loader/dram_write_plan.cpp \
+	loader/overlay_blob_container.cpp \
 	loader/epoch_utils.cpp \
 	loader/utils.cpp \
 	loader/tt_memory.cpp \
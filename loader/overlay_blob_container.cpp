@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "overlay_blob_container.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <experimental/filesystem>
+#include <fstream>
+
+#include "utils/logger.hpp"
+
+namespace fs = std::experimental::filesystem;
+
+namespace tt {
+
+namespace {
+
+constexpr uint32_t CONTAINER_MAGIC = 0x424f5454;  // "TTOB"
+constexpr uint32_t CONTAINER_VERSION = 1;
+
+struct container_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_blobs;
+};
+
+struct container_index_entry {
+    uint32_t chip;
+    uint32_t x;
+    uint32_t y;
+    uint32_t offset;
+    uint32_t size;
+};
+
+}  // namespace
+
+std::string get_overlay_blob_container_path(const std::string &overlay_blob_dir, int temporal_epoch) {
+    return overlay_blob_dir + "/pipegen_epoch" + std::to_string(temporal_epoch) + ".bin";
+}
+
+void write_overlay_blob_container(const std::string &path, const tt_overlay_blob_images &blobs) {
+    const container_header header = {
+        .magic = CONTAINER_MAGIC, .version = CONTAINER_VERSION, .num_blobs = static_cast<uint32_t>(blobs.size())};
+    std::vector<container_index_entry> index;
+    index.reserve(blobs.size());
+    uint64_t offset = 0;
+    for (const auto &[core, image] : blobs) {
+        index.push_back({static_cast<uint32_t>(core.chip), static_cast<uint32_t>(core.x), static_cast<uint32_t>(core.y),
+                         static_cast<uint32_t>(offset), static_cast<uint32_t>(image.size())});
+        offset += image.size();
+    }
+    log_assert(offset <= UINT32_MAX, "Overlay blobs of {} do not fit a blob container", path);
+
+    // Written under a unique name and renamed into place, so a reader never sees a partial container
+    fs::create_directories(fs::path(path).parent_path());
+    const std::string staging_path = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(staging_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(index.data()), index.size() * sizeof(container_index_entry));
+        for (const auto &[core, image] : blobs) {
+            file.write(reinterpret_cast<const char *>(image.data()), image.size() * sizeof(uint32_t));
+        }
+        log_assert(file.good(), "Failed to write overlay blob container {}", staging_path);
+    }
+    fs::rename(staging_path, path);
+}
+
+tt_overlay_blob_images read_overlay_blob_container(const std::string &path, std::optional<std::size_t> chip) {
+    std::ifstream file(path, std::ios::binary);
+    log_assert(file.is_open(), "{} - Cannot open {}. errno: {}", __FUNCTION__, path, std::strerror(errno));
+
+    container_header header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    log_assert(
+        file.good() and header.magic == CONTAINER_MAGIC and header.version == CONTAINER_VERSION,
+        "{} is not an overlay blob container of version {}", path, CONTAINER_VERSION);
+    std::vector<container_index_entry> index(header.num_blobs);
+    file.read(reinterpret_cast<char *>(index.data()), index.size() * sizeof(container_index_entry));
+    log_assert(file.good(), "Truncated overlay blob container {}", path);
+
+    const std::streamoff data_start = sizeof(header) + index.size() * sizeof(container_index_entry);
+    tt_overlay_blob_images blobs;
+    for (const container_index_entry &entry : index) {
+        if (chip and entry.chip != *chip) {
+            continue;
+        }
+        std::vector<uint32_t> &image = blobs[tt_cxy_pair(entry.chip, entry.x, entry.y)];
+        image.resize(entry.size);
+        file.seekg(data_start + static_cast<std::streamoff>(entry.offset) * sizeof(uint32_t));
+        file.read(reinterpret_cast<char *>(image.data()), image.size() * sizeof(uint32_t));
+        log_assert(file.good(), "Truncated overlay blob container {}", path);
+    }
+    return blobs;
+}
+
+}  // namespace tt
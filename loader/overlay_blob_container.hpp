@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "device/tt_xy_pair.h"
+
+namespace tt {
+
+// Packed overlay blob images of one temporal epoch, keyed by {chip, noc table x, noc table y} of their core. Each image
+// is the content of the core's pipegen_epoch*.hex file, as parsed by tt_epoch_binary::get_overlay_binary.
+using tt_overlay_blob_images = std::map<tt_cxy_pair, std::vector<uint32_t>>;
+
+// Compact binary container holding all overlay blobs of one temporal epoch, which the runtime writes to the build
+// directory in place of one text hex file per core, so later runs can load precompiled overlays without parsing hex.
+//
+// Layout, every field a little endian uint32: a header {magic, version, number of blobs}, an index entry per blob
+// {chip, x, y, offset, size} with offset and size in words from the start of the data, then the words of all blobs.
+std::string get_overlay_blob_container_path(const std::string &overlay_blob_dir, int temporal_epoch);
+void write_overlay_blob_container(const std::string &path, const tt_overlay_blob_images &blobs);
+// Reads the blobs of the given chip only, or of all chips if none is given
+tt_overlay_blob_images read_overlay_blob_container(const std::string &path, std::optional<std::size_t> chip = std::nullopt);
+
+}  // namespace tt
@@ -25,6 +25,28 @@ tt_tensor get_tilized_tensor(uint32_t rdim, uint32_t cdim) {
     return tensor;
 }
 
+// Unblocked, single threaded tile loop the tensor matmul used before packing rhs panels. Kept as the
+// reference for checking the blocked path is bit exact and for measuring its speedup.
+tt_tensor reference_matmul(const tt_tensor &lhs, const tt_tensor &rhs) {
+    tt_tensor result = lhs.matmul(rhs, true);
+    result.reserve_tile_tensor();
+    for (int z = 0; z < lhs.getz(); ++z) {
+        for (int i = 0; i < lhs.getrt(); ++i) {
+            for (int j = 0; j < rhs.getct(); ++j) {
+                result.tile_tensor[0][z][i][j] = 0.0;
+                for (int k = 0; k < lhs.getct(); ++k) {
+                    lhs.tile_tensor[0][z][i][k].matmul_with_partial(rhs.tile_tensor[0][z][k][j], result.tile_tensor[0][z][i][j]);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+float get_gflops(uint32_t M, uint32_t K, uint32_t N, int64_t duration_us) {
+    return duration_us > 0 ? (2.0f * M * K * N) / (duration_us * 1000.0f) : 0.0f;
+}
+
 int main(int argc, char** argv)
 {
     std::vector<std::string> args(argv, argv + argc);
@@ -53,6 +75,7 @@ int main(int argc, char** argv)
     }
 
     std::vector<tt_tensor> results_slow;
+    std::vector<tt_tensor> results_reference;
     std::vector<tt_tensor> results_fast;
 
     for (int i = 0; i < sweep_steps; i++) {
@@ -65,7 +88,20 @@ int main(int argc, char** argv)
         auto tensor_op_duration = std::chrono::duration_cast<std::chrono::microseconds>(tensor_op_end - tensor_op_start).count();
 
         results_slow.push_back(C);
-        log_info(tt::LogTest, "MatMulBAD {}x{} * {}x{} operation duration = {} ms", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i), (float)tensor_op_duration/1000);
+        log_info(tt::LogTest, "MatMulBAD {}x{} * {}x{} operation duration = {} ms ({} GFLOP/s)", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i), (float)tensor_op_duration/1000, get_gflops(M_vals.at(i), K_vals.at(i), N_vals.at(i), tensor_op_duration));
+    }
+
+    for (int i = 0; i < sweep_steps; i++) {
+        auto A = get_tilized_tensor(M_vals.at(i), K_vals.at(i));
+        auto B = get_tilized_tensor(K_vals.at(i), N_vals.at(i));
+
+        auto tensor_op_start = std::chrono::high_resolution_clock::now();
+        auto C = reference_matmul(A, B);
+        auto tensor_op_end = std::chrono::high_resolution_clock::now();
+        auto tensor_op_duration = std::chrono::duration_cast<std::chrono::microseconds>(tensor_op_end - tensor_op_start).count();
+
+        results_reference.push_back(C);
+        log_info(tt::LogTest, "MatMulAVX unblocked {}x{} * {}x{} operation duration = {} ms ({} GFLOP/s)", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i), (float)tensor_op_duration/1000, get_gflops(M_vals.at(i), K_vals.at(i), N_vals.at(i), tensor_op_duration));
     }
 
     for (int i = 0; i < sweep_steps; i++) {
@@ -78,16 +114,22 @@ int main(int argc, char** argv)
         auto tensor_op_duration = std::chrono::duration_cast<std::chrono::microseconds>(tensor_op_end - tensor_op_start).count();
 
         results_fast.push_back(C);
-        log_info(tt::LogTest, "MatMulAVX {}x{} * {}x{} operation duration = {} ms", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i), (float)tensor_op_duration/1000);
+        log_info(tt::LogTest, "MatMulAVX {}x{} * {}x{} operation duration = {} ms ({} GFLOP/s)", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i), (float)tensor_op_duration/1000, get_gflops(M_vals.at(i), K_vals.at(i), N_vals.at(i), tensor_op_duration));
     }
 
+    int return_code = 0;
     for (int i = 0; i < sweep_steps; i++) {
         if (results_slow.at(i) != results_fast.at(i)) {
             log_error("LHS vs. RHS mismatch:");
             results_slow.at(i).dump();
             results_fast.at(i).dump();
         };
+        // Blocked matmul must reproduce the unblocked AVX loop bit for bit
+        if (results_reference.at(i) != results_fast.at(i)) {
+            log_error("MatMulAVX blocked vs. unblocked mismatch for {}x{} * {}x{}", M_vals.at(i), K_vals.at(i), K_vals.at(i), N_vals.at(i));
+            return_code = 1;
+        }
     }
-    return 0;
+    return return_code;
 }
 
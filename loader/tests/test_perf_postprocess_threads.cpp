@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Runs the device perf postprocessor on a fixed dram perf dump with a single thread and with --num-threads threads and
+// checks that every json and csv report is byte for byte the same.
+#include <fstream>
+#include <set>
+
+#include "runtime.hpp"
+#include "verif.hpp"
+
+#include "perf_lib/postprocess.hpp"
+
+namespace {
+
+uint get_pc_for_graph(const netlist_program &program, const string &graph_name) {
+    uint pc = 0;
+    for (const tt_instruction_info &instr: program.get_program_trace()) {
+        if (instr.opcode == INSTRUCTION_OPCODE::Execute && instr.graph_name == graph_name) {
+            return pc;
+        }
+        pc++;
+    }
+    log_assert(false, "Instruction for graph name {} not found in program", graph_name);
+    return 0;
+}
+
+// Events recorded by one epoch of a thread, without the leading PerfValFirst. Empty for threads with no sample dump.
+vector<uint32_t> read_sample_thread_events(int thread_id) {
+    const string file_name = "loader/tests/perf_test_data/thread" + to_string(thread_id) + "_0.yaml";
+    if (!fs::exists(file_name)) {
+        return {};
+    }
+    std::ifstream file(file_name);
+    vector<uint32_t> events;
+    string line;
+    while (std::getline(file, line)) {
+        // "- 0x..."
+        events.push_back(std::stoul(line.substr(line.find("0x")), nullptr, 16));
+    }
+    log_assert(events.back() == perf::PerfValLast, "Perf sample dump {} must end with PerfValLast", file_name);
+    return events;
+}
+
+// Lays out the dram perf buffers of a device the way ncrisc dumps them, with one dump per epoch and thread for every
+// epoch each worker core is active in. Threads without a sample dump record nothing, as if they were inactive.
+map<tt_cxy_pair, vector<uint32_t>> generate_dram_dump(
+    int device_id,
+    const buda_SocDescriptor &sdesc,
+    const unordered_map<tt_xy_pair, vector<int>> &cores_to_instr,
+    const perf::PerfDesc &perf_desc) {
+    vector<vector<uint32_t>> sample_events;
+    for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
+        sample_events.push_back(read_sample_thread_events(thread_id));
+    }
+
+    map<tt_cxy_pair, vector<uint32_t>> dram_dump;
+    for (const auto &[dram_core, workers] : sdesc.get_perf_dram_bank_to_workers()) {
+        vector<uint32_t> &dram_events = dram_dump[tt_cxy_pair(device_id, dram_core)];
+        for (const tt_xy_pair &worker : workers) {
+            const auto core_instrs = cores_to_instr.find(worker);
+            const int num_epochs = core_instrs == cores_to_instr.end() ? 0 : core_instrs->second.size();
+            for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
+                const uint32_t num_events = postprocess::get_num_events_per_threads_in_dram(&sdesc, dram_core, perf_desc, thread_id);
+                const uint32_t num_events_each_dump = postprocess::get_l1_perf_buf_size_each_dump(perf_desc, thread_id) / perf::NumBytesPerEvent;
+                log_assert(num_epochs * num_events_each_dump <= num_events, "Perf dump of {} epochs does not fit in dram", num_epochs);
+                log_assert(sample_events.at(thread_id).size() < num_events_each_dump, "Perf sample dump does not fit in a single l1 dump");
+
+                vector<uint32_t> thread_events(num_events, 0);
+                for (int epoch = 0; epoch < num_epochs and !sample_events.at(thread_id).empty(); epoch++) {
+                    auto dump = thread_events.begin() + epoch * num_events_each_dump;
+                    *dump = perf::PerfValFirst;
+                    std::copy(sample_events.at(thread_id).begin(), sample_events.at(thread_id).end(), dump + 1);
+                }
+                dram_events.insert(dram_events.end(), thread_events.begin(), thread_events.end());
+                const uint32_t num_padded_events = thread_id < l1_mem::address_map::PERF_NUM_THREADS - 1
+                    ? postprocess::get_num_events_to_skip_between_threads(&sdesc, dram_core, perf_desc, thread_id)
+                    : postprocess::get_num_events_to_skip_between_workers(&sdesc, dram_core, perf_desc);
+                dram_events.insert(dram_events.end(), num_padded_events, 0);
+            }
+        }
+    }
+    return dram_dump;
+}
+
+// Json and csv reports under perf_out_dir, keyed by their path relative to it
+map<string, string> read_reports(const string &perf_out_dir) {
+    map<string, string> reports;
+    for (const auto &entry : fs::recursive_directory_iterator(perf_out_dir)) {
+        const string extension = entry.path().extension().string();
+        if (!fs::is_regular_file(entry.path()) or (extension != ".json" and extension != ".csv")) {
+            continue;
+        }
+        std::ifstream file(entry.path(), std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        reports.insert({fs::relative(entry.path(), perf_out_dir).string(), contents.str()});
+    }
+    return reports;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::vector<std::string> args(argv, argv + argc);
+    tt_runtime_config config(args);
+
+    int num_threads;
+    int num_loops;
+    std::tie(num_threads, args) = verif_args::get_command_option_uint32_and_remaining_args(args, "--num-threads", 8);
+    std::tie(num_loops, args) = verif_args::get_command_option_uint32_and_remaining_args(args, "--num-loops", 4);
+    verif_args::validate_remaining_args(args);
+    config.netlist_path = "loader/tests/net_basic/netlist_binary_perf_test_multi_epoch.yaml";
+
+    tt_runtime runtime(config.netlist_path, config);
+    log_assert(runtime.initialize() == tt::DEVICE_STATUS_CODE::Success, "Expected Target Backend to be initialized successfully");
+    const tt_runtime_workload *workload = runtime.get_workload();
+    log_assert(workload->program_order.size() == 1, "In this test only netlists with single program are supported.");
+    const netlist_program &program = workload->programs.at(workload->program_order.at(0));
+    const std::unordered_map<chip_id_t, buda_soc_description> sdesc_per_chip = runtime.cluster->get_sdesc_for_all_devices();
+    const std::shared_ptr<tt_device> device = runtime.cluster->get_device();
+
+    // Perf state of the program executed num_loops times, owned by the test so the runtime doesn't postprocess itself
+    perf::PerfDesc perf_desc = config.perf_desc;
+    perf_desc.device_perf_mode = perf::PerfDumpMode::SingleDumpPerEpoch;
+    postprocess::PerfState perf_state(config.output_dir, perf_desc, tt::TargetDevice::Silicon);
+    for (int loop = 0; loop < num_loops; loop++) {
+        perf_state.initialize_for_program(program, sdesc_per_chip, workload->graphs, workload->op_to_outputs, workload->queues);
+        for (const auto &graph_it: workload->graphs) {
+            perf_state.update_executed_instr(program.get_name(), get_pc_for_graph(program, graph_it.first));
+        }
+    }
+    std::set<int> device_ids;
+    for (const auto &graph_it: workload->graphs) {
+        device_ids.insert(graph_it.second.my_graph_info.target_device);
+    }
+    for (int device_id : device_ids) {
+        perf_state.update_device_alignment_info_start(device_id, 1000, 1000);
+        perf_state.update_device_alignment_info_end(device_id, 1000000, 1000000);
+    }
+
+    const string perf_out_dir = postprocess::get_device_perf_out_directory(config.output_dir, perf_desc, false);
+    vector<postprocess::InstructionInfo> all_instructions = postprocess::populate_all_instructions(perf_state, perf_out_dir, device);
+    map<tt_cxy_pair, vector<uint32_t>> dram_dump;
+    for (int device_id : device_ids) {
+        vector<postprocess::InstructionInfo *> device_instructions;
+        for (postprocess::InstructionInfo &instr : all_instructions) {
+            if (instr.device_id == device_id) {
+                device_instructions.push_back(&instr);
+            }
+        }
+        const buda_SocDescriptor &sdesc = sdesc_per_chip.at(device_id);
+        dram_dump.merge(generate_dram_dump(device_id, sdesc, postprocess::get_cores_to_instr_idx_from_model(device_instructions, &sdesc), perf_desc));
+    }
+
+    const auto run_postprocess = [&](int threads) {
+        log_info(tt::LogTest, "Running perf postprocess with {} threads", threads);
+        setenv("TT_BACKEND_PERF_POSTPROCESS_THREADS", to_string(threads).c_str(), 1);
+        postprocess::get_device_perf_out_directory(config.output_dir, perf_desc, true);
+        postprocess::run_perf_postprocess(dram_dump, perf_state, config.output_dir, device, sdesc_per_chip);
+        return read_reports(perf_out_dir);
+    };
+    const map<string, string> single_thread_reports = run_postprocess(1);
+    const map<string, string> multi_thread_reports = run_postprocess(num_threads);
+    unsetenv("TT_BACKEND_PERF_POSTPROCESS_THREADS");
+
+    log_assert(!single_thread_reports.empty(), "Perf postprocess created no reports under {}", perf_out_dir);
+    int num_mismatches = 0;
+    for (const auto &[path, contents] : single_thread_reports) {
+        const auto multi_thread_report = multi_thread_reports.find(path);
+        if (multi_thread_report == multi_thread_reports.end()) {
+            log_error("Report {} is missing with {} threads", path, num_threads);
+            num_mismatches++;
+        } else if (multi_thread_report->second != contents) {
+            log_error("Report {} differs between 1 and {} threads", path, num_threads);
+            num_mismatches++;
+        }
+    }
+    for (const auto &[path, contents] : multi_thread_reports) {
+        if (single_thread_reports.find(path) == single_thread_reports.end()) {
+            log_error("Report {} is only created with {} threads", path, num_threads);
+            num_mismatches++;
+        }
+    }
+
+    log_assert(runtime.finish() == tt::DEVICE_STATUS_CODE::Success, "Expected Target Backend to be finished successfully");
+    log_assert(num_mismatches == 0, "{} of {} perf reports differ between 1 and {} postprocess threads", num_mismatches, single_thread_reports.size(), num_threads);
+    log_info(tt::LogTest, "All {} perf reports match between 1 and {} postprocess threads", single_thread_reports.size(), num_threads);
+    return 0;
+}
@@ -13,6 +13,7 @@
 #include "runtime/runtime_types.hpp"
 #include "runtime/runtime_utils.hpp"
 #include "tlb_config.hpp"
+#include "tt_mock_device.hpp"
 
 extern perf::tt_backend_perf backend_profiler;
 std::string cluster_desc_path = "";
@@ -143,7 +144,10 @@ void tt_cluster::create_cluster_desc_for_gs(const std::string& root) {
 std::vector<tt::ARCH> tt_cluster::detect_available_devices(const TargetDevice &target_type, bool only_detect_mmio){
     static std::vector<tt::ARCH> available_devices = {}; // Static to act as cache for repeat queries to avoid device interation.
     static std::vector<tt::ARCH> available_remote_devices = {}; // Cache the remote devices as well
-    log_assert(target_type == TargetDevice::Versim or target_type == TargetDevice::Silicon or target_type == TargetDevice::Emulation, "Expected device type Silicon, Versim or Emulation.");
+    log_assert(target_type == TargetDevice::Versim or target_type == TargetDevice::Silicon or target_type == TargetDevice::Emulation or target_type == TargetDevice::Mock, "Expected device type Silicon, Versim, Emulation or Mock.");
+    if (target_type == TargetDevice::Mock) {
+        return {}; // Mock devices are created on demand, don't pollute the cache for other device types
+    }
 
     if (target_type == TargetDevice::Silicon) {
         if (available_devices.size() == 0){
@@ -240,6 +244,8 @@ void tt_cluster::open_device(
         device = std::make_shared<tt_VersimDevice>(sdesc_path, ndesc_path);
     } else if (target_type == TargetDevice::Emulation) {
         device = std::make_shared<tt_emulation_device>(sdesc_path);
+    } else if (target_type == TargetDevice::Mock) {
+        device = std::make_shared<tt_mock_device>(sdesc_path, ndesc_path, target_devices);
     } else if (target_type == TargetDevice::Silicon) {
 
         // This is the target/desired number of mem channels per arch/device. Silicon driver will attempt to open
@@ -255,7 +261,7 @@ void tt_cluster::open_device(
     device -> set_device_l1_address_params(l1_fw_params); // Need this for Silicon and Versim
     device -> set_device_dram_address_params(dram_fw_params);
     type = target_type;
-    log_assert(type == TargetDevice::Versim or type == TargetDevice::Silicon or type == TargetDevice::Emulation, "Expected device type Silicon, Versim or Emulation.");
+    log_assert(type == TargetDevice::Versim or type == TargetDevice::Silicon or type == TargetDevice::Emulation or type == TargetDevice::Mock, "Expected device type Silicon, Versim, Emulation or Mock.");
 
     generate_soc_descriptors_and_get_harvesting_info(arch, output_dir);
     
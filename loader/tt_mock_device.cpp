@@ -0,0 +1,438 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "tt_mock_device.hpp"
+
+#include <sys/mman.h>
+
+#include <chrono>
+#include <cstring>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iomanip>
+
+#include "common/env_lib.hpp"
+#include "epoch_q.h"
+#include "l1_address_map.h"
+#include "third_party/json/json.hpp"
+#include "utils/logger.hpp"
+
+namespace fs = std::experimental::filesystem;
+
+namespace {
+// NCRISC mailbox values polled by the host
+constexpr uint32_t NCRISC_STATUS_EPOCH_QUEUES_INITIALIZED = 0xF;
+constexpr uint32_t NCRISC_STATUS_DONE = 0x1;
+// Matches the hugepage backed host channels on silicon
+constexpr uint64_t HOST_CHANNEL_SIZE = 1ULL << 30;
+
+class scoped_call_timer {
+   public:
+    scoped_call_timer(tt_mock_device_call_stats &stats, uint64_t bytes) :
+        stats(stats), bytes(bytes), start(std::chrono::steady_clock::now()) {}
+    ~scoped_call_timer() {
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        stats.record(bytes, latency.count());
+    }
+
+   private:
+    tt_mock_device_call_stats &stats;
+    uint64_t bytes;
+    std::chrono::steady_clock::time_point start;
+};
+}  // namespace
+
+std::string get_string(tt_mock_device_call call) {
+    switch (call) {
+        case tt_mock_device_call::WriteToDevice: return "write_to_device";
+        case tt_mock_device_call::RolledWriteToDevice: return "rolled_write_to_device";
+        case tt_mock_device_call::ReadFromDevice: return "read_from_device";
+        case tt_mock_device_call::BroadcastWrite: return "broadcast_write_to_cluster";
+        case tt_mock_device_call::WriteToSysmem: return "write_to_sysmem";
+        case tt_mock_device_call::ReadFromSysmem: return "read_from_sysmem";
+        case tt_mock_device_call::MemoryBarrier: return "memory_barrier";
+        default: return "invalid";
+    }
+}
+
+void tt_mock_device_call_stats::record(uint64_t bytes, uint64_t latency_ns) {
+    num_calls.fetch_add(1, std::memory_order_relaxed);
+    num_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    total_latency_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    int bucket = latency_ns == 0 ? 0 : 64 - __builtin_clzll(latency_ns);
+    latency_histogram[std::min(bucket, NUM_LATENCY_BUCKETS - 1)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void tt_mock_device_call_stats::clear() {
+    num_calls = 0;
+    num_bytes = 0;
+    total_latency_ns = 0;
+    for (auto &bucket : latency_histogram) {
+        bucket = 0;
+    }
+}
+
+tt_mock_device::tt_mock_device(const std::string &sdesc_path, const std::string &ndesc_path, const std::set<chip_id_t> &target_devices) :
+    tt_device(sdesc_path), target_devices(target_devices) {
+    log_assert(!target_devices.empty(), "Mock device requires at least one target device");
+    if (ndesc_path == "") {
+        ndesc = tt_ClusterDescriptor::create_for_grayskull_cluster(target_devices, {});
+    } else {
+        ndesc = tt_ClusterDescriptor::create_from_yaml(ndesc_path);
+    }
+
+    const uint32_t num_host_channels = tt::parse_env("TT_BACKEND_MOCK_DEVICE_NUM_HOST_CHANNELS", 1);
+    for (chip_id_t chip : target_devices) {
+        // Harvested runs hand over a directory with a descriptor per chip
+        std::string chip_sdesc_path = fs::is_directory(sdesc_path) ? sdesc_path + "/" + std::to_string(chip) + ".yaml" : sdesc_path;
+        soc_descriptor_per_chip.emplace(chip, tt_SocDescriptor(chip_sdesc_path));
+        const tt_SocDescriptor &sdesc = soc_descriptor_per_chip.at(chip);
+
+        // All subchannels of a dram channel are views of the same memory
+        for (const std::vector<tt_xy_pair> &channel_cores : sdesc.dram_cores) {
+            memory_region channel = map_region(sdesc.dram_bank_size);
+            for (const tt_xy_pair &core : channel_cores) {
+                core_memory.insert({tt_cxy_pair(chip, core), channel});
+            }
+        }
+        for (const tt_xy_pair &core : sdesc.workers) {
+            core_memory.insert({tt_cxy_pair(chip, core), map_region(sdesc.worker_l1_size)});
+        }
+        for (const tt_xy_pair &core : sdesc.ethernet_cores) {
+            core_memory.insert({tt_cxy_pair(chip, core), map_region(sdesc.eth_l1_size)});
+        }
+        if (ndesc->is_chip_mmio_capable(chip)) {
+            for (uint16_t channel = 0; channel < num_host_channels; channel++) {
+                sysmem.insert({{chip, channel}, map_region(HOST_CHANNEL_SIZE)});
+            }
+        }
+    }
+    log_info(tt::LogLoader, "Created mock device with {} chip(s), {} mapped memory regions", target_devices.size(), mappings.size());
+}
+
+tt_mock_device::~tt_mock_device() {
+    for (const memory_region &region : mappings) {
+        munmap(region.base, region.size);
+    }
+}
+
+tt_mock_device::memory_region tt_mock_device::map_region(uint64_t size) {
+    // Pages are only committed once touched, so mapping the whole device up front is cheap
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    log_assert(base != MAP_FAILED, "Mock device failed to map {} bytes of host memory", size);
+    memory_region region = {static_cast<uint8_t *>(base), size};
+    mappings.push_back(region);
+    return region;
+}
+
+void tt_mock_device::write(const void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr) {
+    auto it = core_memory.find(core);
+    if (it != core_memory.end() and addr < it->second.size) {
+        log_assert(addr + size <= it->second.size, "Mock device write of {} bytes at 0x{:x} overflows memory of core {}", size, addr, core.str());
+        std::memcpy(it->second.base + addr, mem_ptr, size);
+        return;
+    }
+    log_assert(addr % sizeof(uint32_t) == 0 and size % sizeof(uint32_t) == 0, "Mock device register writes must be word aligned");
+    const uint32_t *words = static_cast<const uint32_t *>(mem_ptr);
+    std::lock_guard<std::mutex> lock(register_memory_mutex);
+    for (uint32_t i = 0; i < size / sizeof(uint32_t); i++) {
+        register_memory[{core, addr + i * sizeof(uint32_t)}] = words[i];
+    }
+}
+
+void tt_mock_device::read(void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr) {
+    auto it = core_memory.find(core);
+    if (it != core_memory.end() and addr < it->second.size) {
+        log_assert(addr + size <= it->second.size, "Mock device read of {} bytes at 0x{:x} overflows memory of core {}", size, addr, core.str());
+        std::memcpy(mem_ptr, it->second.base + addr, size);
+        return;
+    }
+    log_assert(addr % sizeof(uint32_t) == 0 and size % sizeof(uint32_t) == 0, "Mock device register reads must be word aligned");
+    uint32_t *words = static_cast<uint32_t *>(mem_ptr);
+    std::lock_guard<std::mutex> lock(register_memory_mutex);
+    for (uint32_t i = 0; i < size / sizeof(uint32_t); i++) {
+        auto word = register_memory.find({core, addr + i * sizeof(uint32_t)});
+        words[i] = word == register_memory.end() ? 0 : word->second;
+    }
+}
+
+void tt_mock_device::write_word(tt_cxy_pair core, uint64_t addr, uint32_t data) {
+    write(&data, sizeof(data), core, addr);
+}
+
+void tt_mock_device::set_ncrisc_status(chip_id_t chip, uint32_t status) {
+    for (const tt_xy_pair &core : soc_descriptor_per_chip.at(chip).workers) {
+        write_word(tt_cxy_pair(chip, core), l1_mem::address_map::NCRISC_FIRMWARE_BASE + 4, status);
+    }
+}
+
+void tt_mock_device::emulate_epoch_queue_consumer(const void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr) {
+    const tt_SocDescriptor &sdesc = soc_descriptor_per_chip.at(core.chip);
+    if (sdesc.dram_core_channel_map.find(tt_xy_pair(core.x, core.y)) == sdesc.dram_core_channel_map.end()) {
+        return;  // Shadow write pointers in L1 need no response
+    }
+    if (size == sizeof(uint32_t)) {
+        // Write pointer update, the device drains the queue right away
+        uint32_t wr_ptr = *static_cast<const uint32_t *>(mem_ptr);
+        write_word(core, addr - epoch_queue::EPOCH_Q_WRPTR_OFFSET + epoch_queue::EPOCH_Q_RDPTR_OFFSET, wr_ptr);
+        return;
+    }
+    // Commands, possibly write combined into consecutive slots. The command type lives in the top bits of the second word.
+    const uint32_t *words = static_cast<const uint32_t *>(mem_ptr);
+    for (uint32_t offset = 0; offset + 2 * sizeof(uint32_t) <= size; offset += epoch_queue::EPOCH_Q_SLOT_SIZE) {
+        if ((words[offset / sizeof(uint32_t) + 1] >> 28) == epoch_queue::EpochCmdEndProgram) {
+            set_ncrisc_status(core.chip, NCRISC_STATUS_DONE);
+            return;
+        }
+    }
+}
+
+void tt_mock_device::set_device_l1_address_params(const tt_device_l1_address_params &l1_address_params_) {}
+
+void tt_mock_device::set_device_dram_address_params(const tt_device_dram_address_params &dram_address_params_) {}
+
+std::unordered_map<chip_id_t, tt_SocDescriptor> &tt_mock_device::get_virtual_soc_descriptors() { return soc_descriptor_per_chip; }
+
+void tt_mock_device::start_device(const tt_device_params &device_params) {}
+
+void tt_mock_device::close_device() {
+    std::string report_path = tt::parse_env<std::string>("TT_BACKEND_MOCK_DEVICE_REPORT", "");
+    if (!report_path.empty()) {
+        dump_call_stats(report_path);
+    }
+}
+
+void tt_mock_device::deassert_risc_reset() {
+    for (chip_id_t chip : target_devices) {
+        set_ncrisc_status(chip, NCRISC_STATUS_EPOCH_QUEUES_INITIALIZED);
+    }
+}
+
+void tt_mock_device::assert_risc_reset() {
+    for (chip_id_t chip : target_devices) {
+        set_ncrisc_status(chip, 0);
+    }
+}
+
+void tt_mock_device::write_to_device(const void *mem_ptr, uint32_t size_in_bytes, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use, bool send_epoch_cmd, bool last_send_epoch_cmd, bool ordered_with_prev_remote_write) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::WriteToDevice)], size_in_bytes);
+    trace_call(tt_mock_device_call::WriteToDevice, core, addr, size_in_bytes);
+    write(mem_ptr, size_in_bytes, core, addr);
+    if (send_epoch_cmd) {
+        emulate_epoch_queue_consumer(mem_ptr, size_in_bytes, core, addr);
+    }
+}
+
+void tt_mock_device::write_to_device(std::vector<uint32_t> &vec, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use, bool send_epoch_cmd, bool last_send_epoch_cmd, bool ordered_with_prev_remote_write) {
+    write_to_device(vec.data(), vec.size() * sizeof(uint32_t), core, addr, tlb_to_use, send_epoch_cmd, last_send_epoch_cmd, ordered_with_prev_remote_write);
+}
+
+void tt_mock_device::rolled_write_to_device(std::vector<uint32_t> &vec, uint32_t unroll_count, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use) {
+    const uint32_t size = vec.size() * sizeof(uint32_t);
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::RolledWriteToDevice)], uint64_t(size) * unroll_count);
+    trace_call(tt_mock_device_call::RolledWriteToDevice, core, addr, uint64_t(size) * unroll_count);
+    for (uint32_t i = 0; i < unroll_count; i++) {
+        write(vec.data(), size, core, addr + i * size);
+    }
+}
+
+void tt_mock_device::read_from_device(std::vector<uint32_t> &vec, tt_cxy_pair core, uint64_t addr, uint32_t size, const std::string &tlb_to_use) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::ReadFromDevice)], size);
+    trace_call(tt_mock_device_call::ReadFromDevice, core, addr, size);
+    vec.resize((size + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+    read(vec.data(), size, core, addr);
+}
+
+void tt_mock_device::broadcast_write_to_cluster(const void *mem_ptr, uint32_t size_in_bytes, uint64_t address, const std::set<chip_id_t> &chips_to_exclude, std::set<uint32_t> &rows_to_exclude, std::set<uint32_t> &columns_to_exclude, const std::string &fallback_tlb) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::BroadcastWrite)], size_in_bytes);
+    for (chip_id_t chip : target_devices) {
+        if (chips_to_exclude.find(chip) != chips_to_exclude.end()) {
+            continue;
+        }
+        for (const auto &[core, region] : core_memory) {
+            if (core.chip != chip or rows_to_exclude.find(core.y) != rows_to_exclude.end() or columns_to_exclude.find(core.x) != columns_to_exclude.end()) {
+                continue;
+            }
+            write(mem_ptr, size_in_bytes, core, address);
+        }
+    }
+}
+
+uint8_t *tt_mock_device::get_sysmem_ptr(uint64_t addr, uint16_t channel, chip_id_t src_device_id, uint32_t size) const {
+    auto it = sysmem.find({src_device_id, channel});
+    log_assert(it != sysmem.end(), "Mock device has no host channel {} for device {}", channel, src_device_id);
+    log_assert(addr + size <= it->second.size, "Mock device access of {} bytes at 0x{:x} overflows host channel {}", size, addr, channel);
+    return it->second.base + addr;
+}
+
+void tt_mock_device::write_to_sysmem(std::vector<uint32_t> &vec, uint64_t addr, uint16_t channel, chip_id_t src_device_id) {
+    write_to_sysmem(vec.data(), vec.size() * sizeof(uint32_t), addr, channel, src_device_id);
+}
+
+void tt_mock_device::write_to_sysmem(const void *mem_ptr, std::uint32_t size, uint64_t addr, uint16_t channel, chip_id_t src_device_id) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::WriteToSysmem)], size);
+    trace_call(tt_mock_device_call::WriteToSysmem, tt_cxy_pair(src_device_id, channel, 0), addr, size);
+    std::memcpy(get_sysmem_ptr(addr, channel, src_device_id, size), mem_ptr, size);
+}
+
+void tt_mock_device::read_from_sysmem(std::vector<uint32_t> &vec, uint64_t addr, uint16_t channel, uint32_t size, chip_id_t src_device_id) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::ReadFromSysmem)], size);
+    trace_call(tt_mock_device_call::ReadFromSysmem, tt_cxy_pair(src_device_id, channel, 0), addr, size);
+    vec.resize((size + sizeof(uint32_t) - 1) / sizeof(uint32_t));
+    std::memcpy(vec.data(), get_sysmem_ptr(addr, channel, src_device_id, size), size);
+}
+
+void tt_mock_device::wait_for_non_mmio_flush() {}
+
+void tt_mock_device::l1_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<tt_xy_pair> &cores) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::MemoryBarrier)], 0);
+    trace_call(tt_mock_device_call::MemoryBarrier, tt_cxy_pair(chip, 0, 0));
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void tt_mock_device::dram_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<uint32_t> &channels) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::MemoryBarrier)], 0);
+    trace_call(tt_mock_device_call::MemoryBarrier, tt_cxy_pair(chip, 0, 0));
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void tt_mock_device::dram_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<tt_xy_pair> &cores) {
+    scoped_call_timer timer(call_stats[static_cast<int>(tt_mock_device_call::MemoryBarrier)], 0);
+    trace_call(tt_mock_device_call::MemoryBarrier, tt_cxy_pair(chip, 0, 0));
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void *tt_mock_device::channel_address(std::uint32_t offset, const tt_xy_pair &core) {
+    // Like silicon, only the first mmio chip is directly mapped
+    auto it = core_memory.find(tt_cxy_pair(*target_devices.begin(), core));
+    if (it == core_memory.end() or offset >= it->second.size) {
+        return nullptr;
+    }
+    return it->second.base + offset;
+}
+
+void *tt_mock_device::host_dma_address(std::uint64_t offset, chip_id_t src_device_id, uint16_t channel) const {
+    auto it = sysmem.find({src_device_id, channel});
+    if (it == sysmem.end() or offset >= it->second.size) {
+        return nullptr;
+    }
+    return it->second.base + offset;
+}
+
+void tt_mock_device::translate_to_noc_table_coords(chip_id_t device_id, std::size_t &r, std::size_t &c) {}
+
+bool tt_mock_device::using_harvested_soc_descriptors() { return false; }
+
+std::unordered_map<chip_id_t, uint32_t> tt_mock_device::get_harvesting_masks_for_soc_descriptors() {
+    std::unordered_map<chip_id_t, uint32_t> masks = {};
+    for (chip_id_t chip : target_devices) {
+        masks.insert({chip, 0});
+    }
+    return masks;
+}
+
+bool tt_mock_device::noc_translation_en() { return false; }
+
+tt_ClusterDescriptor *tt_mock_device::get_cluster_description() { return ndesc.get(); }
+
+std::set<chip_id_t> tt_mock_device::get_target_mmio_device_ids() {
+    std::set<chip_id_t> mmio_device_ids = {};
+    for (chip_id_t chip : target_devices) {
+        if (ndesc->is_chip_mmio_capable(chip)) {
+            mmio_device_ids.insert(chip);
+        }
+    }
+    return mmio_device_ids;
+}
+
+std::set<chip_id_t> tt_mock_device::get_target_remote_device_ids() {
+    std::set<chip_id_t> remote_device_ids = {};
+    for (chip_id_t chip : target_devices) {
+        if (!ndesc->is_chip_mmio_capable(chip)) {
+            remote_device_ids.insert(chip);
+        }
+    }
+    return remote_device_ids;
+}
+
+int tt_mock_device::get_number_of_chips_in_cluster() { return target_devices.size(); }
+
+std::unordered_set<chip_id_t> tt_mock_device::get_all_chips_in_cluster() { return {target_devices.begin(), target_devices.end()}; }
+
+std::map<int, int> tt_mock_device::get_clocks() {
+    std::map<int, int> clocks = {};
+    for (chip_id_t chip : target_devices) {
+        clocks.insert({chip, tt::parse_env("TT_BACKEND_MOCK_DEVICE_AICLK", 1000)});
+    }
+    return clocks;
+}
+
+std::uint32_t tt_mock_device::get_num_dram_channels(std::uint32_t device_id) {
+    return soc_descriptor_per_chip.at(device_id).dram_cores.size();
+}
+
+std::uint64_t tt_mock_device::get_dram_channel_size(std::uint32_t device_id, std::uint32_t channel) {
+    return soc_descriptor_per_chip.at(device_id).dram_bank_size;
+}
+
+std::uint32_t tt_mock_device::get_num_host_channels(std::uint32_t device_id) {
+    uint32_t num_host_channels = 0;
+    for (const auto &[chip_and_channel, region] : sysmem) {
+        num_host_channels += chip_and_channel.first == chip_id_t(device_id);
+    }
+    return num_host_channels;
+}
+
+std::uint32_t tt_mock_device::get_host_channel_size(std::uint32_t device_id, std::uint32_t channel) {
+    return sysmem.find({device_id, channel}) == sysmem.end() ? 0 : HOST_CHANNEL_SIZE;
+}
+
+const tt_mock_device_call_stats &tt_mock_device::get_call_stats(tt_mock_device_call call) const {
+    return call_stats.at(static_cast<int>(call));
+}
+
+void tt_mock_device::clear_call_stats() {
+    for (auto &stats : call_stats) {
+        stats.clear();
+    }
+}
+
+void tt_mock_device::set_call_trace_enabled(bool enabled) { call_trace_enabled = enabled; }
+
+std::vector<tt_mock_device_trace_entry> tt_mock_device::get_call_trace() {
+    std::lock_guard<std::mutex> lock(call_trace_mutex);
+    return call_trace;
+}
+
+void tt_mock_device::clear_call_trace() {
+    std::lock_guard<std::mutex> lock(call_trace_mutex);
+    call_trace.clear();
+}
+
+void tt_mock_device::trace_call(tt_mock_device_call call, tt_cxy_pair core, uint64_t addr, uint64_t size) {
+    if (call_trace_enabled.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(call_trace_mutex);
+        call_trace.push_back({call, core, addr, size});
+    }
+}
+
+void tt_mock_device::dump_call_stats(const std::string &output_path) const {
+    nlohmann::json report;
+    for (int call = 0; call < static_cast<int>(tt_mock_device_call::NumCalls); call++) {
+        const tt_mock_device_call_stats &stats = call_stats.at(call);
+        nlohmann::json &entry = report[get_string(static_cast<tt_mock_device_call>(call))];
+        entry["num-calls"] = stats.num_calls.load();
+        entry["num-bytes"] = stats.num_bytes.load();
+        entry["total-latency-ns"] = stats.total_latency_ns.load();
+        // Bucket i holds calls that took [2^(i-1), 2^i) ns, only non-empty buckets are reported
+        for (int bucket = 0; bucket < tt_mock_device_call_stats::NUM_LATENCY_BUCKETS; bucket++) {
+            uint64_t count = stats.latency_histogram.at(bucket).load();
+            if (count > 0) {
+                entry["latency-histogram-ns"][std::to_string(bucket == 0 ? 0 : 1ULL << (bucket - 1))] = count;
+            }
+        }
+    }
+    std::ofstream output_file(output_path);
+    output_file << std::setw(4) << report;
+    log_info(tt::LogLoader, "Mock device call stats written to {}", output_path);
+}
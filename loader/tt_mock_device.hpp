@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "device/tt_device.h"
+
+// Device calls recorded by tt_mock_device
+enum class tt_mock_device_call : int {
+    WriteToDevice = 0,
+    RolledWriteToDevice = 1,
+    ReadFromDevice = 2,
+    BroadcastWrite = 3,
+    WriteToSysmem = 4,
+    ReadFromSysmem = 5,
+    MemoryBarrier = 6,
+    NumCalls = 7,
+};
+std::string get_string(tt_mock_device_call call);
+
+// Per call type counters. Latencies are host time spent inside the call, bucketed by log2 of nanoseconds.
+struct tt_mock_device_call_stats {
+    static constexpr int NUM_LATENCY_BUCKETS = 40;
+    std::atomic<uint64_t> num_calls = 0;
+    std::atomic<uint64_t> num_bytes = 0;
+    std::atomic<uint64_t> total_latency_ns = 0;
+    std::array<std::atomic<uint64_t>, NUM_LATENCY_BUCKETS> latency_histogram = {};
+
+    void record(uint64_t bytes, uint64_t latency_ns);
+    void clear();
+};
+
+// A device call in the order it was made, recorded while call tracing is on. Barriers have no address or size.
+struct tt_mock_device_trace_entry {
+    tt_mock_device_call call;
+    tt_cxy_pair core = tt_cxy_pair(0, 0, 0);
+    uint64_t addr = 0;
+    uint64_t size = 0;
+};
+
+/**
+ * Host memory backed device, for benchmarking and regression testing host side overhead of the loader and runtime IO
+ * without silicon.
+ *
+ * DRAM channels, worker/ethernet L1 and host sysmem channels are lazily committed anonymous mappings, so raw pointers
+ * from channel_address() and host_dma_address() are valid and fast paths (eg. hw tilizer) run as they do on silicon.
+ * Accesses outside of L1 (eg. registers) land in a sparse word map.
+ *
+ * The device firmware is not modelled, only what the host polls on:
+ *      - NCRISC reports epoch queues initialized after deassert_risc_reset()
+ *      - Epoch queue read pointers follow write pointer updates, ie. every command is consumed as soon as it's sent
+ *      - Cores report done once an end-program command was sent to the chip
+ * IO queue pointers are plain memory, so consumers/producers of IO queues must be driven by the test itself.
+ */
+class tt_mock_device : public tt_device {
+   public:
+    tt_mock_device(const std::string &sdesc_path, const std::string &ndesc_path, const std::set<chip_id_t> &target_devices);
+    virtual ~tt_mock_device();
+
+    virtual void set_device_l1_address_params(const tt_device_l1_address_params &l1_address_params_);
+    virtual void set_device_dram_address_params(const tt_device_dram_address_params &dram_address_params_);
+    virtual std::unordered_map<chip_id_t, tt_SocDescriptor> &get_virtual_soc_descriptors();
+    virtual void start_device(const tt_device_params &device_params);
+    virtual void close_device();
+    virtual void deassert_risc_reset();
+    virtual void assert_risc_reset();
+
+    virtual void write_to_device(const void *mem_ptr, uint32_t size_in_bytes, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use, bool send_epoch_cmd = false, bool last_send_epoch_cmd = true, bool ordered_with_prev_remote_write = false);
+    virtual void write_to_device(std::vector<uint32_t> &vec, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use, bool send_epoch_cmd = false, bool last_send_epoch_cmd = true, bool ordered_with_prev_remote_write = false);
+    virtual void rolled_write_to_device(std::vector<uint32_t> &vec, uint32_t unroll_count, tt_cxy_pair core, uint64_t addr, const std::string &tlb_to_use);
+    virtual void read_from_device(std::vector<uint32_t> &vec, tt_cxy_pair core, uint64_t addr, uint32_t size, const std::string &tlb_to_use);
+    virtual void broadcast_write_to_cluster(const void *mem_ptr, uint32_t size_in_bytes, uint64_t address, const std::set<chip_id_t> &chips_to_exclude, std::set<uint32_t> &rows_to_exclude, std::set<uint32_t> &columns_to_exclude, const std::string &fallback_tlb);
+    virtual void write_to_sysmem(std::vector<uint32_t> &vec, uint64_t addr, uint16_t channel, chip_id_t src_device_id);
+    virtual void write_to_sysmem(const void *mem_ptr, std::uint32_t size, uint64_t addr, uint16_t channel, chip_id_t src_device_id);
+    virtual void read_from_sysmem(std::vector<uint32_t> &vec, uint64_t addr, uint16_t channel, uint32_t size, chip_id_t src_device_id);
+    virtual void wait_for_non_mmio_flush();
+    void l1_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<tt_xy_pair> &cores = {});
+    void dram_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<uint32_t> &channels);
+    void dram_membar(const chip_id_t chip, const std::string &fallback_tlb, const std::unordered_set<tt_xy_pair> &cores = {});
+
+    virtual void *channel_address(std::uint32_t offset, const tt_xy_pair &core);
+    virtual void *host_dma_address(std::uint64_t offset, chip_id_t src_device_id, uint16_t channel) const;
+    virtual void translate_to_noc_table_coords(chip_id_t device_id, std::size_t &r, std::size_t &c);
+    virtual bool using_harvested_soc_descriptors();
+    virtual std::unordered_map<chip_id_t, uint32_t> get_harvesting_masks_for_soc_descriptors();
+    virtual bool noc_translation_en();
+    virtual tt_ClusterDescriptor *get_cluster_description();
+    virtual std::set<chip_id_t> get_target_mmio_device_ids();
+    virtual std::set<chip_id_t> get_target_remote_device_ids();
+    virtual int get_number_of_chips_in_cluster();
+    virtual std::unordered_set<chip_id_t> get_all_chips_in_cluster();
+    virtual std::map<int, int> get_clocks();
+    virtual std::uint32_t get_num_dram_channels(std::uint32_t device_id);
+    virtual std::uint64_t get_dram_channel_size(std::uint32_t device_id, std::uint32_t channel);
+    virtual std::uint32_t get_num_host_channels(std::uint32_t device_id);
+    virtual std::uint32_t get_host_channel_size(std::uint32_t device_id, std::uint32_t channel);
+
+    //! Recorded stats
+    const tt_mock_device_call_stats &get_call_stats(tt_mock_device_call call) const;
+    void clear_call_stats();
+    void dump_call_stats(const std::string &output_path) const;
+    //! Ordered trace of device calls, for tests checking the order of writes and barriers. Off by default.
+    void set_call_trace_enabled(bool enabled);
+    std::vector<tt_mock_device_trace_entry> get_call_trace();
+    void clear_call_trace();
+
+   private:
+    struct memory_region {
+        uint8_t *base = nullptr;
+        uint64_t size = 0;
+    };
+
+    std::shared_ptr<tt_ClusterDescriptor> ndesc;
+    std::set<chip_id_t> target_devices;
+    // Built at construction and never modified afterwards, so lookups need no locking
+    std::map<tt_cxy_pair, memory_region> core_memory;
+    std::map<std::pair<chip_id_t, uint16_t>, memory_region> sysmem;
+    std::vector<memory_region> mappings;
+    // Anything outside of core_memory, keyed by chip, core and word address
+    std::map<std::tuple<tt_cxy_pair, uint64_t>, uint32_t> register_memory;
+    std::mutex register_memory_mutex;
+    std::array<tt_mock_device_call_stats, static_cast<int>(tt_mock_device_call::NumCalls)> call_stats;
+    std::atomic<bool> call_trace_enabled = false;
+    std::vector<tt_mock_device_trace_entry> call_trace;
+    std::mutex call_trace_mutex;
+
+    memory_region map_region(uint64_t size);
+    void write(const void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr);
+    void read(void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr);
+    void write_word(tt_cxy_pair core, uint64_t addr, uint32_t data);
+    uint8_t *get_sysmem_ptr(uint64_t addr, uint16_t channel, chip_id_t src_device_id, uint32_t size) const;
+    void emulate_epoch_queue_consumer(const void *mem_ptr, uint32_t size, tt_cxy_pair core, uint64_t addr);
+    void set_ncrisc_status(chip_id_t chip, uint32_t status);
+    void trace_call(tt_mock_device_call call, tt_cxy_pair core = tt_cxy_pair(0, 0, 0), uint64_t addr = 0, uint64_t size = 0);
+};
@@ -16,7 +16,7 @@ LOADER_UNIT_TESTS_OBJS = $(addprefix $(LOADER_UNIT_TESTS_OBJ_DIR)/, $(LOADER_UNI
 LOADER_UNIT_TESTS_LDFLAGS = -ltt -ldevice -lstdc++fs -pthread -lruntime -lop_model -lyaml-cpp -lcommon -lhwloc -lgtest -lgtest_main
 
 # Include paths
-LOADER_UNIT_TESTS_INCLUDES = $(LOADER_INCLUDES) -I$(LOADER_UNIT_TESTS_SRC_DIR) -Icompile_trisc -Iverif
+LOADER_UNIT_TESTS_INCLUDES = $(LOADER_INCLUDES) -I$(LOADER_UNIT_TESTS_SRC_DIR) -Icompile_trisc -Iverif -Isrc/blobgen2/lib/inc
 
 # Libraries this target depends on
 LOADER_UNIT_TESTS_LIB_DEPS = $(BACKEND_LIB) $(LOADER_LIB) $(VERIF_LIB)
@@ -43,6 +43,16 @@ loader_unit_tests_run_only:
 	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='BackendParamLib.*:-BackendParamLib.*CoordTranslation'
 	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='BackendPerf.*OpModelAPI*'
 	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='BackendPerf.*:-BackendPerf.*OpModelAPI*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='TilizedTensorCache.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='TriscBinCache.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='NarrowBfpPacker.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='BfpUntilize.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='TtiTarImage.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='BatchedPush.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='FlatComparison.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='OverlayBlobContainer.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='OverlayBlobImage.*'
+	@$(LOADER_UNIT_TESTS_BIN) --gtest_filter='DramWritePlanTest.*'
 
 # Rule to link the final test binary
 $(LOADER_UNIT_TESTS_SRC_DIR): $(LOADER_UNIT_TESTS_BIN)
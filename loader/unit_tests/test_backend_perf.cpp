@@ -4,6 +4,12 @@
 #include "gtest/gtest.h"
 #include "test_unit_common.hpp"
 #include "perf_lib/op_model/op_model.hpp"
+#include "perf_lib/perf_descriptor.hpp"
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
 
 TEST(BackendPerf, OpModelAPI) {
     tt::tt_op_model_desc op_desc = {
@@ -23,3 +29,109 @@ TEST(BackendPerf, OpModelAPI) {
     EXPECT_EQ(model_cycles, be_api_cycles);
 }
 
+
+// Microbenchmark of the per event cost of the host profiler with several threads recording at once, next to the
+// mutex guarded shared vector it used to push into. Also checks every thread's events survive the merge in order.
+TEST(BackendPerf, HostProfilerEventOverhead) {
+    const char *profiler_env = std::getenv("TT_BACKEND_PROFILER");
+    const std::string saved_profiler_env = profiler_env ? profiler_env : "";
+    setenv("TT_BACKEND_PROFILER", "1", 1);
+    perf::tt_backend_perf profiler;
+    if (profiler_env) {
+        setenv("TT_BACKEND_PROFILER", saved_profiler_env.c_str(), 1);
+    } else {
+        unsetenv("TT_BACKEND_PROFILER");
+    }
+
+    constexpr int num_threads = 8;
+    constexpr int events_per_thread = 200000;
+    const auto measure_ns_per_event = [&](const auto &record) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+            threads.emplace_back([&, thread_idx] {
+                for (int event_idx = 0; event_idx < events_per_thread; event_idx++) {
+                    record(thread_idx, event_idx);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / (num_threads * events_per_thread);
+    };
+
+    const double per_thread_buffers_ns = measure_ns_per_event(
+        [&](int thread_idx, int event_idx) { profiler.record_loader_event(uint64_t(thread_idx), uint64_t(event_idx)); });
+
+    std::mutex shared_buffer_mutex;
+    std::vector<uint64_t> shared_buffer;
+    const double shared_buffer_ns = measure_ns_per_event([&](int thread_idx, int event_idx) {
+        const std::lock_guard<std::mutex> lock(shared_buffer_mutex);
+        shared_buffer.push_back(thread_idx);
+        shared_buffer.push_back(event_idx);
+    });
+
+    std::cout << "Host profiler cost per event with " << num_threads << " threads: per thread buffers "
+              << per_thread_buffers_ns << " ns, mutex guarded shared buffer " << shared_buffer_ns << " ns" << std::endl;
+
+    {
+        const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
+        profiler.merge_thread_event_buffers();
+    }
+    ASSERT_EQ(profiler.perf_buffer.size(), 2 * num_threads * events_per_thread);
+    std::vector<uint64_t> next_event_idx(num_threads, 0);
+    for (size_t i = 0; i < profiler.perf_buffer.size(); i += 2) {
+        const uint64_t thread_idx = profiler.perf_buffer[i];
+        ASSERT_LT(thread_idx, num_threads);
+        ASSERT_EQ(profiler.perf_buffer[i + 1], next_event_idx[thread_idx]++);
+    }
+    profiler.perf_buffer.clear();
+}
+
+// Thread churn, eg. pool restarts, must not leave the buffers and chunks of exited threads behind once merged
+TEST(BackendPerf, HostProfilerFreesBuffersOfExitedThreads) {
+    const char *profiler_env = std::getenv("TT_BACKEND_PROFILER");
+    const std::string saved_profiler_env = profiler_env ? profiler_env : "";
+    setenv("TT_BACKEND_PROFILER", "1", 1);
+    perf::tt_backend_perf profiler;
+    if (profiler_env) {
+        setenv("TT_BACKEND_PROFILER", saved_profiler_env.c_str(), 1);
+    } else {
+        unsetenv("TT_BACKEND_PROFILER");
+    }
+
+    // Spans a few chunks, so the exited thread leaves a partly filled tail chunk
+    constexpr uint64_t events_per_thread = 2 * perf::host_event_buffer::events_per_chunk + 5;
+    std::promise<void> recorded;
+    std::promise<void> release;
+    std::thread live_thread([&] {
+        for (uint64_t event_idx = 0; event_idx < events_per_thread; event_idx++) {
+            profiler.record_loader_event(uint64_t(0), event_idx);
+        }
+        recorded.set_value();
+        release.get_future().wait();
+    });
+    recorded.get_future().wait();
+    for (int wave = 1; wave <= 3; wave++) {
+        std::thread([&, wave] {
+            for (uint64_t event_idx = 0; event_idx < events_per_thread; event_idx++) {
+                profiler.record_loader_event(uint64_t(wave), event_idx);
+            }
+        }).join();
+    }
+
+    const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
+    EXPECT_EQ(profiler.get_num_thread_event_buffers(), 4u);
+    profiler.merge_thread_event_buffers();
+    EXPECT_EQ(profiler.get_num_thread_event_buffers(), 1u) << "Only the live thread keeps its buffer";
+    EXPECT_EQ(profiler.perf_buffer.size(), 2 * 4 * events_per_thread);
+
+    release.set_value();
+    live_thread.join();
+    profiler.merge_thread_event_buffers();
+    EXPECT_EQ(profiler.get_num_thread_event_buffers(), 0u);
+    EXPECT_EQ(profiler.perf_buffer.size(), 2 * 4 * events_per_thread) << "No events recorded after the first merge";
+    profiler.perf_buffer.clear();
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+
+#include "common/size_lib.hpp"
+#include "gtest/gtest.h"
+#include "test_unit_common.hpp"
+
+namespace {
+
+const std::vector<std::string> input_queues = {"q0", "q1"};
+
+// One entry of q0 or q1: 2x2 buffers of 2x2 tiles
+struct host_input {
+    std::vector<float> data = std::vector<float>(128 * 128);
+    tt::tt_PytorchTensorDesc tensor;
+
+    host_input(int seed) : tensor(data.data(), sizeof(float), tt::DataFormat::Float32, {1, 1, 128, 128}, {4 * 128 * 128, 4 * 128 * 128, 4 * 128, 4}, 4) {
+        for (std::uint32_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<float>((i * 7 + seed * 13) % 101) * 0.125f - 6.0f;
+        }
+    }
+};
+
+std::uint32_t get_entry_size(const tt::tt_dram_io_desc &q_desc) {
+    return tt::size::get_entry_size_in_bytes(
+        q_desc.bufq_target_format, true, q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width);
+}
+
+std::uint32_t read_queue_wptr(mock_io_netlist &netlist, const std::string &queue_name, int buf_index) {
+    const tt_queue_allocation_info &alloc = netlist.get_workload()->queues.at(queue_name).my_queue_info.alloc_info.at(buf_index);
+    std::vector<uint32_t> header;
+    netlist.get_mock_cluster()->read_dram_vec(header, tt_target_dram{0, alloc.channel, 0}, alloc.address, tt::io::io_queue_header_size_bytes);
+    return header.at(1);
+}
+
+// Pushes one entry per input queue and checks every buffer holds what the single queue tilizer produces at slot
+void push_and_check(mock_io_netlist &netlist, const std::vector<tt::tt_dram_io_desc> &q_descs, int seed, std::uint32_t slot) {
+    std::vector<host_input> inputs;
+    std::vector<tt::tt_PytorchTensorDesc> tensors;
+    inputs.reserve(q_descs.size());
+    for (std::uint32_t i = 0; i < q_descs.size(); i++) {
+        tensors.push_back(inputs.emplace_back(seed + i).tensor);
+    }
+    ASSERT_TRUE(tt::io::push_inputs_to_device(q_descs, tensors, true, 1));
+
+    for (std::uint32_t i = 0; i < q_descs.size(); i++) {
+        std::vector<uint32_t> expected;
+        tt::io::tilize_tensor_to_buffer(q_descs[i], tensors[i], expected);
+        const std::uint32_t entry_size = get_entry_size(q_descs[i]);
+        for (int buf_index = 0; buf_index < 4; buf_index++) {
+            const std::vector<uint32_t> expected_entry(expected.begin() + buf_index * entry_size / 4, expected.begin() + (buf_index + 1) * entry_size / 4);
+            EXPECT_EQ(netlist.read_queue_buffer(q_descs[i].queue_name, buf_index, slot * entry_size, entry_size), expected_entry)
+                << q_descs[i].queue_name << " buffer " << buf_index << " slot " << slot;
+            EXPECT_EQ(read_queue_wptr(netlist, q_descs[i].queue_name, buf_index), slot + 1) << q_descs[i].queue_name << " buffer " << buf_index;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BatchedPush, MatchesSingleQueueTilizeOnEveryPush) {
+    mock_io_netlist netlist(tt::buda_home() + "/loader/tests/net_basic/netlist_binary_multi_buffer.yaml");
+    std::vector<tt::tt_dram_io_desc> q_descs;
+    for (const std::string &queue_name : input_queues) {
+        q_descs.push_back(netlist.get_queue_desc(queue_name));
+    }
+    // Later pushes go through the cached tilizers and their staging buffers, which must not carry anything over
+    for (std::uint32_t slot = 0; slot < 3; slot++) {
+        push_and_check(netlist, q_descs, slot * 5, slot);
+    }
+}
+
+TEST(BatchedPush, WptrsArePublishedAfterAllDataWithOneBarrier) {
+    mock_io_netlist netlist(tt::buda_home() + "/loader/tests/net_basic/netlist_binary_multi_buffer.yaml");
+    std::vector<tt::tt_dram_io_desc> q_descs;
+    std::vector<std::uint64_t> data_addresses;
+    std::vector<std::uint64_t> wptr_addresses;
+    for (const std::string &queue_name : input_queues) {
+        q_descs.push_back(netlist.get_queue_desc(queue_name));
+        for (const tt_queue_allocation_info &alloc : netlist.get_workload()->queues.at(queue_name).my_queue_info.alloc_info) {
+            data_addresses.push_back(alloc.address + tt::io::io_queue_header_size_bytes);
+            wptr_addresses.push_back(alloc.address + 4);
+        }
+    }
+
+    tt_mock_device *device = netlist.get_mock_device();
+    device->clear_call_stats();
+    device->set_call_trace_enabled(true);
+    push_and_check(netlist, q_descs, 0, 0);
+    device->set_call_trace_enabled(false);
+    std::vector<tt_mock_device_trace_entry> trace = device->get_call_trace();
+    // Drop the reads of the checks above
+    while (!trace.empty() and trace.back().call == tt_mock_device_call::ReadFromDevice) {
+        trace.pop_back();
+    }
+
+    std::vector<std::uint64_t> written_data;
+    std::vector<std::uint64_t> written_wptrs;
+    for (const tt_mock_device_trace_entry &entry : trace) {
+        if (entry.call == tt_mock_device_call::MemoryBarrier) {
+            EXPECT_EQ(&entry, &trace.back()) << "Memory barrier before the last wptr update";
+        } else if (entry.call == tt_mock_device_call::WriteToDevice) {
+            if (std::find(wptr_addresses.begin(), wptr_addresses.end(), entry.addr) != wptr_addresses.end()) {
+                ASSERT_EQ(entry.size, 4u);
+                written_wptrs.push_back(entry.addr);
+            } else {
+                EXPECT_TRUE(written_wptrs.empty()) << "Data write to 0x" << std::hex << entry.addr << " after a wptr was published";
+                EXPECT_EQ(entry.size, static_cast<std::uint64_t>(get_entry_size(q_descs.front())));
+                written_data.push_back(entry.addr);
+            }
+        }
+    }
+    // Queues and their buffers in the order they were passed
+    EXPECT_EQ(written_data, data_addresses);
+    EXPECT_EQ(written_wptrs, wptr_addresses);
+    ASSERT_FALSE(trace.empty());
+    EXPECT_EQ(trace.back().call, tt_mock_device_call::MemoryBarrier);
+    EXPECT_EQ(device->get_call_stats(tt_mock_device_call::MemoryBarrier).num_calls.load(), 1u) << "All buffers are on one device";
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "model/tile.hpp"
+
+namespace {
+
+const std::vector<tt::DataFormat> bfp_formats = {
+    tt::DataFormat::Bfp8, tt::DataFormat::Bfp8_b, tt::DataFormat::Bfp4, tt::DataFormat::Bfp4_b, tt::DataFormat::Bfp2, tt::DataFormat::Bfp2_b};
+
+// Wide exponent spread per row, so some datums lose all their mantissa bits to the shared exponent
+void fill_random_tile(tt::tt_tile &tile, int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> mantissa(-2.0f, 2.0f);
+    std::uniform_int_distribution<int> exponent(-12, 12);
+    for (int r = 0; r < 32; r++) {
+        for (int c = 0; c < 32; c++) {
+            tile.t[r][c] = (c % 7 == 3) ? 0.0f : std::ldexp(mantissa(gen), exponent(gen));
+        }
+    }
+}
+
+tt::tt_tile make_packed_tile(tt::DataFormat format, int seed, std::uint32_t tile_height = 32) {
+    tt::tt_tile tile(format);
+    fill_random_tile(tile, seed);
+    tile.tile_height = tile_height;
+    tile.pack_data();
+    return tile;
+}
+
+// Old path: per datum scalar decode of the packed tile, then the host side format conversion of the untilizer
+std::uint32_t expected_datum(tt::tt_tile &tile, int r, int c, tt::DataFormat dst_format) {
+    const std::uint32_t data_index = (r / 16) * 512 + (c / 16) * 256 + (r % 16) * 16 + (c % 16);
+    const std::uint32_t fp32_bits = tile.get_indexed_num(data_index);
+    if (dst_format == tt::DataFormat::Float16_b) {
+        return tt::tt_tile::conv_u32_to_u16b(fp32_bits);
+    } else if (dst_format == tt::DataFormat::Float16) {
+        return tt::tt_tile::conv_u32_to_u16(fp32_bits);
+    }
+    return fp32_bits;
+}
+
+}  // namespace
+
+TEST(BfpUntilize, MatchesScalarUnpackIntoWiderRows) {
+    // Tile is decoded into the middle of a row major tensor that is 3 tiles wide
+    constexpr std::uint32_t row_pitch = 96;
+    constexpr std::uint32_t column_offset = 32;
+    for (const tt::DataFormat tile_format : bfp_formats) {
+        for (const tt::DataFormat dst_format : {tt::DataFormat::Float32, tt::DataFormat::Float16_b, tt::DataFormat::Float16}) {
+            for (int seed = 0; seed < 16; seed++) {
+                tt::tt_tile tile = make_packed_tile(tile_format, seed);
+                std::vector<std::uint32_t> dst32(32 * row_pitch, 0xdeadbeef);
+                std::vector<std::uint16_t> dst16(32 * row_pitch, 0xbeef);
+                void *dst = dst_format == tt::DataFormat::Float32 ? static_cast<void *>(dst32.data() + column_offset)
+                                                                  : static_cast<void *>(dst16.data() + column_offset);
+                tt::untilize_utils::unpack_bfp_tile_to_row_major(tile.packed_data.data(), tile_format, dst_format, dst, row_pitch);
+
+                for (int r = 0; r < 32; r++) {
+                    for (int c = 0; c < static_cast<int>(row_pitch); c++) {
+                        const bool in_tile = c >= static_cast<int>(column_offset) and c < static_cast<int>(column_offset) + 32;
+                        const std::uint32_t observed = dst_format == tt::DataFormat::Float32 ? dst32[r * row_pitch + c] : dst16[r * row_pitch + c];
+                        const std::uint32_t untouched = dst_format == tt::DataFormat::Float32 ? 0xdeadbeef : 0xbeef;
+                        const std::uint32_t expected = in_tile ? expected_datum(tile, r, c - column_offset, dst_format) : untouched;
+                        ASSERT_EQ(observed, expected) << "tile format " << tile_format << " dst format " << dst_format
+                                                      << " seed " << seed << " row " << r << " col " << c;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(BfpUntilize, PartialTilesMatchFullTileDecode) {
+    // Tiles shorter than 32 rows keep the scalar unpack, rows they hold must decode like the same rows of a full tile
+    for (const tt::DataFormat tile_format : bfp_formats) {
+        for (const std::uint32_t tile_height : {1u, 2u, 4u, 8u, 16u}) {
+            tt::tt_tile full_tile = make_packed_tile(tile_format, 7);
+            full_tile.packed_data_to_tile();
+            tt::tt_tile partial_tile = make_packed_tile(tile_format, 7, tile_height);
+            partial_tile.packed_data_to_tile();
+            for (std::uint32_t r = 0; r < tile_height; r++) {
+                for (int c = 0; c < 32; c++) {
+                    ASSERT_EQ(tt::tt_tile::float_to_dword(partial_tile.t[r][c]), tt::tt_tile::float_to_dword(full_tile.t[r][c]))
+                        << "tile format " << tile_format << " tile height " << tile_height << " row " << r << " col " << c;
+                }
+            }
+        }
+    }
+}
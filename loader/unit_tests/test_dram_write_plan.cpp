@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <deque>
+
+#include "gtest/gtest.h"
+#include "loader/dram_write_plan.hpp"
+
+namespace {
+
+using coalesced_writes = std::vector<std::vector<tt::tt_dram_write_plan::coalesced_write>>;
+
+// Hexes referenced by a plan must outlive it, a deque keeps them in place as more are added
+class DramWritePlanTest : public ::testing::Test {
+   protected:
+    tt::tt_dram_write_plan plan;
+    std::deque<tt_hex> hexes;
+
+    const tt_hex *add_hex(uint64_t addr, uint32_t num_words, uint64_t slot_size_bytes, int chan = 0, int chip = 0) {
+        tt_hex &hex = hexes.emplace_back();
+        hex.d_chip_id = chip;
+        hex.d_chan = chan;
+        hex.d_subchannel = 0;
+        hex.d_addr = addr;
+        for (uint32_t i = 0; i < num_words; i++) {
+            hex.hex_vec.push_back(static_cast<uint32_t>(hexes.size() << 16) | (i + 1));
+        }
+        plan.add(&hex, slot_size_bytes);
+        return &hex;
+    }
+};
+
+}  // namespace
+
+TEST_F(DramWritePlanTest, MergesAdjacentHexes) {
+    const tt_hex *first = add_hex(0x1000, 4, 16);
+    const tt_hex *second = add_hex(0x1010, 2, 8);
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes.at(0).size(), 1u);
+    const tt::tt_dram_write_plan::coalesced_write &write = writes.at(0).at(0);
+    EXPECT_EQ(write.hexes, (std::vector<const tt_hex *>{first, second}));
+    EXPECT_EQ(write.start_addr, 0x1000u);
+    EXPECT_EQ(write.end_addr, 0x1018u);
+
+    std::vector<uint32_t> expected = first->hex_vec;
+    expected.insert(expected.end(), second->hex_vec.begin(), second->hex_vec.end());
+    EXPECT_EQ(tt::tt_dram_write_plan::get_write_data(write), expected);
+}
+
+TEST_F(DramWritePlanTest, PadsGapInsideSlotWithZeros) {
+    // The first hex owns 0x1000-0x1040 but only fills 8 bytes of it
+    const tt_hex *first = add_hex(0x1000, 2, 0x40);
+    const tt_hex *second = add_hex(0x1040, 1, 4);
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes.at(0).size(), 1u);
+    const std::vector<uint32_t> data = tt::tt_dram_write_plan::get_write_data(writes.at(0).at(0));
+    ASSERT_EQ(data.size(), 0x44u / sizeof(uint32_t));
+    EXPECT_EQ(data.at(0), first->hex_vec.at(0));
+    EXPECT_EQ(data.at(1), first->hex_vec.at(1));
+    for (std::size_t i = 2; i < data.size() - 1; i++) {
+        EXPECT_EQ(data.at(i), 0u) << "word " << i;
+    }
+    EXPECT_EQ(data.back(), second->hex_vec.at(0));
+}
+
+TEST_F(DramWritePlanTest, KeepsNonAdjacentHexesApart) {
+    // Gap past the end of the first hex's slot, which belongs to someone else
+    add_hex(0x1000, 2, 8);
+    add_hex(0x1010, 2, 8);
+    // Gap inside the slot, but wider than the padding limit
+    add_hex(0x10000, 1, 0x100000);
+    add_hex(0x10000 + tt::tt_dram_write_plan::max_padding_bytes + 8, 1, 4);
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes.at(0).size(), 4u);
+    for (const auto &write : writes.at(0)) {
+        EXPECT_EQ(write.hexes.size(), 1u);
+        EXPECT_EQ(write.end_addr - write.start_addr, write.hexes.at(0)->hex_vec.size() * sizeof(uint32_t));
+    }
+}
+
+TEST_F(DramWritePlanTest, KeepsOverlappingHexesApartInOrderAdded) {
+    const tt_hex *first = add_hex(0x2000, 4, 16);
+    const tt_hex *overlapping = add_hex(0x2008, 4, 16);
+    const tt_hex *same_addr = add_hex(0x2008, 1, 4);
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes.at(0).size(), 3u);
+    EXPECT_EQ(writes.at(0).at(0).hexes, (std::vector<const tt_hex *>{first}));
+    // Later hexes win where they overlap earlier ones, as with one write per hex
+    EXPECT_EQ(writes.at(0).at(1).hexes, (std::vector<const tt_hex *>{overlapping}));
+    EXPECT_EQ(writes.at(0).at(2).hexes, (std::vector<const tt_hex *>{same_addr}));
+}
+
+TEST_F(DramWritePlanTest, SplitsWritesAtMaxSize) {
+    constexpr uint32_t hex_words = 256 * 1024;
+    constexpr uint64_t hex_bytes = hex_words * sizeof(uint32_t);
+    constexpr int num_hexes = 9;
+    for (int i = 0; i < num_hexes; i++) {
+        add_hex(i * hex_bytes, hex_words, hex_bytes);
+    }
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 1u);
+    const uint64_t hexes_per_write = tt::tt_dram_write_plan::max_write_bytes / hex_bytes;
+    ASSERT_EQ(writes.at(0).size(), (num_hexes + hexes_per_write - 1) / hexes_per_write);
+    uint64_t next_addr = 0;
+    for (const auto &write : writes.at(0)) {
+        EXPECT_LE(write.end_addr - write.start_addr, tt::tt_dram_write_plan::max_write_bytes);
+        EXPECT_EQ(write.start_addr, next_addr);
+        next_addr = write.end_addr;
+    }
+    EXPECT_EQ(next_addr, num_hexes * hex_bytes);
+}
+
+TEST_F(DramWritePlanTest, GroupsWritesPerChannelInAddressOrder) {
+    const tt_hex *chan1_high = add_hex(0x3000, 1, 4, 1);
+    const tt_hex *chan0_high = add_hex(0x3000, 1, 4, 0);
+    const tt_hex *chip1_chan0 = add_hex(0x1000, 1, 4, 0, 1);
+    const tt_hex *chan1_low = add_hex(0x1000, 1, 4, 1);
+    const tt_hex *chan0_low = add_hex(0x1000, 1, 4, 0);
+    const coalesced_writes writes = plan.coalesce();
+
+    ASSERT_EQ(writes.size(), 3u);
+    const auto hexes_of = [](const std::vector<tt::tt_dram_write_plan::coalesced_write> &channel_writes) {
+        std::vector<const tt_hex *> hexes;
+        for (const auto &write : channel_writes) {
+            hexes.insert(hexes.end(), write.hexes.begin(), write.hexes.end());
+        }
+        return hexes;
+    };
+    EXPECT_EQ(hexes_of(writes.at(0)), (std::vector<const tt_hex *>{chan0_low, chan0_high}));
+    EXPECT_EQ(hexes_of(writes.at(1)), (std::vector<const tt_hex *>{chan1_low, chan1_high}));
+    EXPECT_EQ(hexes_of(writes.at(2)), (std::vector<const tt_hex *>{chip1_chan0}));
+
+    // Coalescing clears the plan
+    EXPECT_TRUE(plan.coalesce().empty());
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "gtest/gtest.h"
 #include "test_unit_common.hpp"
+#include "loader/tt_mock_device.hpp"
 #include <algorithm>
 
 // Create epoch queue in chip0 dram0 at 0x1000000
@@ -136,6 +137,44 @@ TEST(EpochControl, EpochQueueIntermediateHostPush) {
 }
 
 
+// Mock device consumes epoch commands as they are sent, so pushes never block on a full queue and no pops are needed.
+TEST(EpochControl, EpochQueueMockDeviceAutoPop) {
+    unordered_map<std::string, int> num_cmds_per_binary;
+    unordered_map<int, int> num_cmds_per_epoch_id;
+    unordered_map<std::string, int> num_cmds_per_update_blob;
+
+    tt_xy_pair routing_core(0, 0);
+    auto cluster = quiet_call([&] {
+        auto sdesc_path = test_path() + "device_descriptors/grayskull_1x1_arch.yaml";
+        return get_cluster(tt::ARCH::GRAYSKULL, tt::TargetDevice::Mock, {0}, sdesc_path);
+    });
+    auto mock_device = std::dynamic_pointer_cast<tt_mock_device>(cluster->get_device());
+    ASSERT_NE(mock_device, nullptr) << "Cluster should be backed by a mock device";
+
+    int cmd_words = epoch_queue::EPOCH_Q_SLOT_SIZE / sizeof(uint32_t);
+    vector<uint32_t> cmd_blob(cmd_words, 0);
+    auto cmd = std::make_shared<tt_hex>(cmd_blob, tt_hex_type::Misc, routing_core, "cmd");
+    bool mmio_chip = true;
+
+    int num_slots = 13;
+    int wc_window_size = 0;
+    tt_epoch_queue eq = create_and_init_epoch_queue(cluster.get(), num_slots, wc_window_size, routing_core, mmio_chip, num_cmds_per_binary, num_cmds_per_epoch_id, num_cmds_per_update_blob);
+    mock_device->clear_call_stats();
+
+    int num_cmds = 4 * num_slots + 1;
+    for (int i = 0; i < num_cmds; i++) {
+        eq.push_command(cmd, cluster.get());
+        ASSERT_TRUE(eq.is_empty_dram(cluster.get())) << "Mock device should have consumed the command";
+    }
+
+    // One write for the command and one for the write pointer update
+    const auto &write_stats = mock_device->get_call_stats(tt_mock_device_call::WriteToDevice);
+    EXPECT_EQ(write_stats.num_calls.load(), 2 * num_cmds);
+    EXPECT_EQ(write_stats.num_bytes.load(), num_cmds * (epoch_queue::EPOCH_Q_SLOT_SIZE + sizeof(uint32_t)));
+    EXPECT_GT(mock_device->get_call_stats(tt_mock_device_call::ReadFromDevice).num_calls.load(), 0);
+}
+
+
 // Do it for GS to start
 // Single feature flag in code to guard this behavior for write combine path.
 
@@ -239,3 +278,47 @@ TEST(EpochControl, EpochQueueIntermediateHostPushWriteCombine) {
 
 }
 
+
+// Cyclic trace over one binary more than the cache holds: LRU misses on every access, Belady keeps capacity-1 resident
+TEST(EpochControl, EpochBinaryCacheBeladyPolicy) {
+    const uint32_t capacity = 4;
+    const int num_iterations = 8;
+    std::vector<std::string> binary_names = {"graph_0", "graph_1", "graph_2", "graph_3", "graph_4"};
+    std::vector<std::string> trace;
+    for (int i = 0; i < num_iterations; i++) {
+        trace.insert(trace.end(), binary_names.begin(), binary_names.end());
+    }
+
+    auto count_misses = [&](bool use_belady, bool has_trace) {
+        unordered_map<std::string, int> num_cmds_per_binary;
+        for (const auto &name : binary_names) {
+            num_cmds_per_binary[name] = 0;
+        }
+        std::vector<tt_epoch_queue *> command_qs = {};
+        tt_queue_ptr bin_q_ptrs(capacity);
+        tt_epoch_binary_cache cache("EpochBinaryCache_test", capacity, false);
+        cache.use_belady = use_belady;
+        cache.set_future_accesses(trace);
+        if (!has_trace) {
+            cache.clear_future_accesses();
+        }
+
+        int num_misses = 0;
+        for (const auto &name : trace) {
+            int slot = -1;
+            bool hit = cache.get_slot_for_binary(name, num_cmds_per_binary, bin_q_ptrs, slot, command_qs, nullptr, false, false);
+            EXPECT_TRUE(slot >= 0 and slot < capacity) << "Binary slot out of range";
+            num_misses += !hit;
+        }
+        return num_misses;
+    };
+
+    int lru_misses = count_misses(false, true);
+    int belady_misses = count_misses(true, true);
+    EXPECT_EQ(lru_misses, trace.size()) << "LRU should miss on every access of a cyclic trace larger than the cache";
+    // Cold misses on the first iteration, afterwards each eviction keeps the next capacity accesses hitting
+    EXPECT_EQ(belady_misses, binary_names.size() + (trace.size() - binary_names.size()) / capacity);
+    EXPECT_LT(belady_misses, lru_misses);
+    // Programs too long to trace run with plain LRU
+    EXPECT_EQ(count_misses(true, false), lru_misses);
+}
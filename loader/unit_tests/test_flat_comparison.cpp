@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "verif_comparison.hpp"
+
+using verif::comparison::compare_flat_buffers;
+
+namespace {
+
+VerifComparisonConfig get_allclose_hw_config(double rtol, double atol) {
+    VerifComparisonConfig comp(ComparisonType::AllCloseHw, ComparisonVerbosity::Concise);
+    comp.rtol = rtol;
+    comp.atol = atol;
+    comp.check_pct = 0.5;
+    comp.check_pcc = 0.5;
+    return comp;
+}
+
+FlatComparisonResult compare_scalar(
+    const std::vector<float> &lhs, const std::vector<float> &rhs, const VerifComparisonConfig &comp, std::size_t slice_size) {
+    return verif::comparison::detail::compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), comp, slice_size, false);
+}
+
+// Observed datums off the golden ones by relative errors across all histogram bins, with zeros, nans and infs mixed in
+void fill_random_buffers(std::vector<float> &lhs, std::vector<float> &rhs, int seed) {
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> value(-4.0f, 4.0f);
+    std::uniform_int_distribution<int> rel_error_exponent(-9, 1);
+    std::uniform_int_distribution<int> special(0, 15);
+    for (std::size_t i = 0; i < lhs.size(); i++) {
+        rhs[i] = value(gen);
+        lhs[i] = rhs[i] * (1.0f + std::pow(10.0f, static_cast<float>(rel_error_exponent(gen))));
+        switch (special(gen)) {
+            case 0: lhs[i] = rhs[i]; break;
+            case 1: rhs[i] = 0.0f; break;
+            case 2: lhs[i] = -0.0f; rhs[i] = 0.0f; break;
+            case 3: lhs[i] = nan; break;
+            case 4: lhs[i] = nan; rhs[i] = nan; break;
+            case 5: lhs[i] = inf; rhs[i] = inf; break;
+            case 6: lhs[i] = -inf; break;
+            case 7: lhs[i] = inf; rhs[i] = -inf; break;
+            default: break;
+        }
+    }
+}
+
+void expect_equal_results(const FlatComparisonResult &vectorized, const FlatComparisonResult &scalar) {
+    EXPECT_EQ(vectorized.pass, scalar.pass);
+    EXPECT_EQ(vectorized.num_slices, scalar.num_slices);
+    EXPECT_EQ(vectorized.num_failed_slices, scalar.num_failed_slices);
+    EXPECT_EQ(vectorized.first_failed_slice, scalar.first_failed_slice);
+    EXPECT_EQ(vectorized.num_mismatches, scalar.num_mismatches);
+    EXPECT_EQ(vectorized.num_nonfinite, scalar.num_nonfinite);
+    EXPECT_EQ(vectorized.max_abs_error, scalar.max_abs_error);
+    EXPECT_EQ(vectorized.max_rel_error, scalar.max_rel_error);
+    EXPECT_EQ(vectorized.average_matched_pct, scalar.average_matched_pct);
+    EXPECT_EQ(vectorized.min_matched_pct, scalar.min_matched_pct);
+    EXPECT_EQ(vectorized.rel_error_histogram, scalar.rel_error_histogram);
+    // The vectorized sums are added in another order
+    EXPECT_NEAR(vectorized.average_pcc, scalar.average_pcc, 1e-9);
+    EXPECT_NEAR(vectorized.min_pcc, scalar.min_pcc, 1e-9);
+}
+
+}  // namespace
+
+TEST(FlatComparison, VectorizedMatchesScalar) {
+    // Lengths around the 8 datum vector and off the slice size, so slices end in a scalar tail
+    for (const std::size_t num_datums : std::vector<std::size_t>{1, 7, 8, 9, 1023, 1025}) {
+        for (const std::size_t slice_size : std::vector<std::size_t>{13, 1024}) {
+            std::vector<float> lhs(num_datums);
+            std::vector<float> rhs(num_datums);
+            fill_random_buffers(lhs, rhs, static_cast<int>(num_datums * 31 + slice_size));
+            const VerifComparisonConfig comp = get_allclose_hw_config(1e-2, 1e-3);
+
+            const FlatComparisonResult vectorized = compare_flat_buffers(lhs.data(), rhs.data(), num_datums, comp, slice_size);
+            SCOPED_TRACE("num_datums " + std::to_string(num_datums) + " slice_size " + std::to_string(slice_size));
+            expect_equal_results(vectorized, compare_scalar(lhs, rhs, comp, slice_size));
+            EXPECT_EQ(vectorized.num_datums, num_datums);
+        }
+    }
+}
+
+TEST(FlatComparison, RelErrorHistogramBins) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    // Observed datum of 1 unless noted, golden datums exactly representable so the relative errors are exact
+    const std::vector<std::pair<float, float>> datums = {
+        {1.0f, 1.0f},                      // 0
+        {0.0f, 0.0f},                      // 0, golden and observed zero
+        {1.0f + 0x1p-22f, 1.0f},           // 2.4e-7
+        {1.0f + 0x1p-18f, 1.0f},           // 3.8e-6
+        {1.0f + 0x1p-12f, 1.0f},           // 2.4e-4
+        {1.0f + 0x1p-8f, 1.0f},            // 3.9e-3
+        {1.5f, 1.0f},                      // 0.5
+        {2.0f, 1.0f},                      // 1, the >= 1 bin
+        {1.0f, 0.0f},                      // observed zero, divided by the smallest normal float
+        {nan, 1.0f},                       // not in the histogram
+    };
+    const std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS> expected_bins = {2, 1, 1, 0, 1, 1, 0, 1, 2};
+
+    // Repeated so most datums go through the 8 wide loop and the rest through the scalar tail
+    constexpr std::size_t num_repeats = 3;
+    std::vector<float> lhs;
+    std::vector<float> rhs;
+    for (std::size_t repeat = 0; repeat < num_repeats; repeat++) {
+        for (const auto &[golden, observed] : datums) {
+            lhs.push_back(golden);
+            rhs.push_back(observed);
+        }
+    }
+    std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS> expected_repeated_bins;
+    for (std::size_t bin = 0; bin < expected_bins.size(); bin++) {
+        expected_repeated_bins[bin] = expected_bins[bin] * num_repeats;
+    }
+
+    const VerifComparisonConfig comp = get_allclose_hw_config(1e-2, 1e-3);
+    for (const bool scalar : {false, true}) {
+        const FlatComparisonResult result = scalar ? compare_scalar(lhs, rhs, comp, lhs.size())
+                                                   : compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), comp, lhs.size());
+        EXPECT_EQ(result.rel_error_histogram, expected_repeated_bins) << "scalar " << scalar;
+        EXPECT_EQ(result.num_nonfinite, num_repeats) << "scalar " << scalar;
+        EXPECT_EQ(result.max_rel_error, 1.0 / std::numeric_limits<float>::min()) << "scalar " << scalar;
+        EXPECT_EQ(result.max_abs_error, 1.0) << "scalar " << scalar;
+    }
+}
+
+TEST(FlatComparison, ToleranceIsComputedInDouble) {
+    // |3 - 4| is exactly rtol * 4 for rtol 0.25. The next double below 0.25 rounds back to 0.25 in float, so a float
+    // tolerance would still call the datums close
+    const double rtol_below = std::nextafter(0.25, 0.0);
+    ASSERT_EQ(static_cast<float>(rtol_below), 0.25f);
+
+    const std::vector<float> lhs(9, 3.0f);
+    const std::vector<float> rhs(9, 4.0f);
+    for (const bool scalar : {false, true}) {
+        const VerifComparisonConfig at_boundary = get_allclose_hw_config(0.25, 0.0);
+        const VerifComparisonConfig below_boundary = get_allclose_hw_config(rtol_below, 0.0);
+        EXPECT_EQ(
+            (scalar ? compare_scalar(lhs, rhs, at_boundary, lhs.size())
+                    : compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), at_boundary, lhs.size()))
+                .num_mismatches,
+            0u)
+            << "scalar " << scalar;
+        EXPECT_EQ(
+            (scalar ? compare_scalar(lhs, rhs, below_boundary, lhs.size())
+                    : compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), below_boundary, lhs.size()))
+                .num_mismatches,
+            lhs.size())
+            << "scalar " << scalar;
+    }
+}
+
+TEST(FlatComparison, SlicePccMatchesTilePcc) {
+    // pcc_compare on the default ranges walks rows and columns 0 to 30 but divides by all 1024 datums. Zeros in the
+    // last row and column give the flat slice of the whole tile the same sums, and eighths keep the sums exact.
+    tt::tt_tile lhs_tile(tt::DataFormat::Float32);
+    tt::tt_tile rhs_tile(tt::DataFormat::Float32);
+    std::vector<float> lhs;
+    std::vector<float> rhs;
+    for (std::uint32_t r = 0; r < tt::constants::TILE_HEIGHT; r++) {
+        for (std::uint32_t c = 0; c < tt::constants::TILE_WIDTH; c++) {
+            const bool edge = r == tt::constants::TILE_HEIGHT - 1 or c == tt::constants::TILE_WIDTH - 1;
+            lhs_tile.t[r][c] = edge ? 0.0f : ((r * 7 + c * 3) % 17) * 0.125f - 1.0f;
+            rhs_tile.t[r][c] = edge ? 0.0f : lhs_tile.t[r][c] + ((r + c) % 5) * 0.125f;
+            lhs.push_back(lhs_tile.t[r][c]);
+            rhs.push_back(rhs_tile.t[r][c]);
+        }
+    }
+
+    const VerifComparisonConfig comp = get_allclose_hw_config(1e-2, 1e-3);
+    const auto [tile_pass, tile_pcc] = verif::comparison::pcc_compare(
+        lhs_tile, rhs_tile, comp.rtol, comp.atol, comp.check_pcc, comp.check_tile_rows_range, comp.check_tile_cols_range);
+    ASSERT_TRUE(tile_pass);
+    ASSERT_LT(tile_pcc, 1.0);
+    for (const bool scalar : {false, true}) {
+        const FlatComparisonResult result =
+            scalar ? compare_scalar(lhs, rhs, comp, lhs.size()) : compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), comp);
+        EXPECT_EQ(result.num_slices, 1u);
+        EXPECT_DOUBLE_EQ(result.min_pcc, tile_pcc) << "scalar " << scalar;
+        EXPECT_DOUBLE_EQ(result.average_pcc, tile_pcc) << "scalar " << scalar;
+    }
+}
+
+TEST(FlatComparison, AllCloseChecksTrailingDatums) {
+    // AllClose slices flat tensors into ceil(n / 8) datums. Splitting into eighths of n / 8 datums used to skip the
+    // last n % 8 datums, here 8 * 64 + 5 datums are 7 slices of 65 and a last one of 62.
+    std::vector<float> lhs(8 * 64 + 5, 1.0f);
+    std::vector<float> rhs(lhs.size(), 1.0f);
+    VerifComparisonConfig comp(ComparisonType::AllClose, ComparisonVerbosity::Concise);
+    comp.rtol = 1e-2;
+    comp.atol = 1e-3;
+    comp.check_pct = 0.95;
+    EXPECT_TRUE(verif::comparison::compare_flat_tensors(lhs, rhs, comp));
+
+    std::fill(lhs.end() - 5, lhs.end(), 2.0f);
+    EXPECT_FALSE(verif::comparison::compare_flat_tensors(lhs, rhs, comp));
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "model/tile.hpp"
+#include "model/tilize_untilize_api/narrow_bfp.h"
+
+namespace {
+
+constexpr std::uint32_t tile_header_bytes = 16;
+constexpr std::uint32_t tile_exponent_bytes = 64;
+
+float bits_to_float(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// IEEE half to float, only used for finite inputs
+float half_to_float(std::uint16_t half) {
+    const float sign = (half & 0x8000) ? -1.0f : 1.0f;
+    const int exponent = (half >> 10) & 0x1f;
+    const int mantissa = half & 0x3ff;
+    if (exponent == 0) {
+        return sign * std::ldexp(static_cast<float>(mantissa), -24);
+    }
+    return sign * std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+}
+
+// Rows mix narrow and very wide exponent spreads, so mantissas get shifted out entirely, a-format exponents saturate
+// and flush, and signed zeros show up next to regular datums
+std::uint32_t random_fp32_bits(std::mt19937 &gen, int row) {
+    std::uniform_int_distribution<std::uint32_t> bits_dist;
+    const std::uint32_t bits = bits_dist(gen);
+    if (bits % 17 == 0) {
+        return bits & 0x80000000;
+    }
+    std::uint32_t exponent;
+    switch (row % 3) {
+        case 0: exponent = 120 + bits % 12; break;
+        case 1: exponent = 1 + bits % 254; break;
+        default: exponent = 90 + bits % 60; break;
+    }
+    return (bits & 0x807fffff) | (exponent << 23);
+}
+
+template <class Converter>
+typename Converter::in_type random_datum(std::mt19937 &gen, int row, float &value) {
+    const std::uint32_t bits = random_fp32_bits(gen, row);
+    if constexpr (Converter::input == NarrowBfpInput::Fp32) {
+        value = bits_to_float(bits);
+        return value;
+    } else if constexpr (Converter::input == NarrowBfpInput::Fp16b) {
+        value = bits_to_float(bits & 0xffff0000);
+        return bits >> 16;
+    } else {
+        // Keep the half exponent finite, denormals included
+        std::uint16_t half = static_cast<std::uint16_t>(bits >> 16);
+        if (((half >> 10) & 0x1f) == 0x1f) {
+            half &= ~0x4000;
+        }
+        value = half_to_float(half);
+        return half;
+    }
+}
+
+// Packs a random 32x32 tile with the fast tilizer face packer and with tt_tile, and compares every shared exponent and
+// mantissa byte
+template <class Converter>
+void check_packer_matches_tile(tt::DataFormat format, bool conversion_to_a_format, bool truncate_bfp_mantissa, int seed) {
+    using in_type = typename Converter::in_type;
+    std::mt19937 gen(seed);
+    std::vector<in_type> input(32 * 32);
+    tt::tt_tile tile(format);
+    for (int r = 0; r < 32; r++) {
+        for (int c = 0; c < 32; c++) {
+            input[r * 32 + c] = random_datum<Converter>(gen, r, tile.t[r][c]);
+        }
+    }
+    tile.pack_data(truncate_bfp_mantissa);
+    const std::uint8_t *expected = reinterpret_cast<const std::uint8_t *>(tile.packed_data.data());
+
+    constexpr std::uint32_t face_bytes = 16 * Converter::face_row_bytes;
+    for (int face = 0; face < 4; face++) {
+        const in_type *face_in = input.data() + (face / 2) * 16 * 32 + (face % 2) * 16;
+        std::vector<std::uint8_t> mantissas(face_bytes);
+        std::vector<std::uint8_t> exponents(16);
+        void *exp_out = exponents.data();
+        narrow_bfp::tensor_to_face<Converter, false>(
+            face_in, mantissas.data(), 32 * sizeof(in_type), &exp_out, conversion_to_a_format, -1, 0, 16, truncate_bfp_mantissa);
+
+        for (int row = 0; row < 16; row++) {
+            ASSERT_EQ(exponents[row], expected[tile_header_bytes + face * 16 + row])
+                << "format " << format << " seed " << seed << " face " << face << " row " << row;
+        }
+        ASSERT_EQ(std::memcmp(mantissas.data(), expected + tile_header_bytes + tile_exponent_bytes + face * face_bytes, face_bytes), 0)
+            << "format " << format << " seed " << seed << " face " << face;
+    }
+}
+
+template <class Converter>
+void check_all_formats(tt::DataFormat a_format, tt::DataFormat b_format) {
+    for (int seed = 0; seed < 64; seed++) {
+        for (const bool truncate : {false, true}) {
+            check_packer_matches_tile<Converter>(a_format, true, truncate, seed);
+            check_packer_matches_tile<Converter>(b_format, false, truncate, seed);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(NarrowBfpPacker, Fp32ToBfp4MatchesTile) { check_all_formats<Fp32_Bfp4_all>(tt::DataFormat::Bfp4, tt::DataFormat::Bfp4_b); }
+TEST(NarrowBfpPacker, Fp16bToBfp4MatchesTile) { check_all_formats<Fp16b_Bfp4_all>(tt::DataFormat::Bfp4, tt::DataFormat::Bfp4_b); }
+TEST(NarrowBfpPacker, Fp16ToBfp4MatchesTile) { check_all_formats<Fp16_Bfp4_all>(tt::DataFormat::Bfp4, tt::DataFormat::Bfp4_b); }
+TEST(NarrowBfpPacker, Fp32ToBfp2MatchesTile) { check_all_formats<Fp32_Bfp2_all>(tt::DataFormat::Bfp2, tt::DataFormat::Bfp2_b); }
+TEST(NarrowBfpPacker, Fp16bToBfp2MatchesTile) { check_all_formats<Fp16b_Bfp2_all>(tt::DataFormat::Bfp2, tt::DataFormat::Bfp2_b); }
+TEST(NarrowBfpPacker, Fp16ToBfp2MatchesTile) { check_all_formats<Fp16_Bfp2_all>(tt::DataFormat::Bfp2, tt::DataFormat::Bfp2_b); }
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <experimental/filesystem>
+
+#include "gtest/gtest.h"
+#include "loader/overlay_blob_container.hpp"
+
+namespace {
+
+std::string make_container_dir(const std::string &name) {
+    const std::string dir = "/tmp/overlay_blob_container_test_" + name + "_" + std::to_string(getpid());
+    std::experimental::filesystem::remove_all(dir);
+    return dir;
+}
+
+tt::tt_overlay_blob_images make_blobs() {
+    tt::tt_overlay_blob_images blobs;
+    for (std::size_t chip = 0; chip < 2; chip++) {
+        for (std::size_t x = 1; x < 4; x++) {
+            std::vector<uint32_t> &image = blobs[tt_cxy_pair(chip, x, 2 * x)];
+            for (uint32_t i = 0; i < 100 * x; i++) {
+                image.push_back((chip << 24) | (x << 16) | i);
+            }
+        }
+    }
+    // Cores without any blob content still get an entry
+    blobs[tt_cxy_pair(1, 9, 9)] = {};
+    return blobs;
+}
+
+}  // namespace
+
+TEST(OverlayBlobContainer, BlobsLoadBack) {
+    const std::string path = tt::get_overlay_blob_container_path(make_container_dir("load"), 7);
+    const tt::tt_overlay_blob_images blobs = make_blobs();
+    tt::write_overlay_blob_container(path, blobs);
+
+    EXPECT_EQ(tt::read_overlay_blob_container(path), blobs);
+    EXPECT_FALSE(std::experimental::filesystem::exists(path + ".tmp." + std::to_string(getpid())));
+}
+
+TEST(OverlayBlobContainer, ReadsBlobsOfOneChip) {
+    const std::string path = tt::get_overlay_blob_container_path(make_container_dir("chip"), 0);
+    const tt::tt_overlay_blob_images blobs = make_blobs();
+    tt::write_overlay_blob_container(path, blobs);
+
+    tt::tt_overlay_blob_images chip_blobs;
+    for (const auto &[core, image] : blobs) {
+        if (core.chip == 1) {
+            chip_blobs.emplace(core, image);
+        }
+    }
+    EXPECT_EQ(tt::read_overlay_blob_container(path, 1), chip_blobs);
+}
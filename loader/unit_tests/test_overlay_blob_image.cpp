@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <experimental/filesystem>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "loader/tt_memory.h"
+#include "overlay_blob/blob_section.h"
+
+namespace {
+
+const tt_cxy_pair blob_core(1, 3, 5);
+constexpr int blob_epoch = 4;
+
+// Sections in the order blobgen2 emits them: ascending, with gaps between them and empty ones mixed in
+blobgen2::BlobData make_blob() {
+    blobgen2::BlobData blob;
+    blob.blob_sections.emplace_back(0x10000);
+
+    blobgen2::BlobSection &bytes = blob.blob_sections.emplace_back(0x10040);
+    for (uint32_t i = 0; i < 14; i++) {
+        bytes.append(static_cast<uint8_t>(0x80 | i));
+    }
+    bytes.append(static_cast<uint16_t>(0xbeef));
+    bytes.pad_to_noc_alignment();
+
+    blob.blob_sections.emplace_back(0x10400);
+
+    blobgen2::BlobSection &dwords = blob.blob_sections.emplace_back(0x10400);
+    for (uint32_t i = 0; i < 100; i++) {
+        dwords.append(0x01000193u * (i + 1));
+    }
+    // Directly after the previous section
+    blobgen2::BlobSection &adjacent = blob.blob_sections.emplace_back(0x10400 + 100 * sizeof(uint32_t));
+    adjacent.append(0xffffffffu);
+    adjacent.append(0u);
+    return blob;
+}
+
+// Reads the blob back from the hex file it prints out, the way the epoch loader did before it took binary images
+ll_api::memory load_printed_hex(const blobgen2::BlobData &blob) {
+    const std::string dir = "/tmp/overlay_blob_image_test_" + std::to_string(getpid());
+    std::experimental::filesystem::remove_all(dir);
+    blob.print_out(dir, blob_core, blob_epoch, false);
+
+    std::ifstream hex_istream(
+        dir + "/pipegen_epoch" + std::to_string(blob_epoch) + "_" + std::to_string(blob_core.chip) + "_" +
+        std::to_string(blob_core.y) + "_" + std::to_string(blob_core.x) + ".hex");
+    EXPECT_TRUE(hex_istream.is_open());
+    ll_api::memory mem = ll_api::memory::from_discontiguous_hex(hex_istream);
+    std::experimental::filesystem::remove_all(dir);
+    return mem;
+}
+
+}  // namespace
+
+TEST(OverlayBlobImage, MatchesParsedHexOutput) {
+    const blobgen2::BlobData blob = make_blob();
+    ll_api::memory mem = load_printed_hex(blob);
+
+    EXPECT_EQ(mem.base(), blob.blob_sections.at(1).get_address()) << "The image starts at the first non-empty section";
+    const std::vector<uint32_t> image = blob.get_binary_image();
+    EXPECT_EQ(image, mem.get_content());
+    // Spot check the byte order against values appended as whole words
+    ASSERT_EQ(image.size(), (0x10400 - 0x10040) / sizeof(uint32_t) + 102);
+    EXPECT_EQ(image.at((0x10400 - 0x10040) / sizeof(uint32_t)), 0x01000193u);
+    EXPECT_EQ(image.back(), 0u);
+}
+
+TEST(OverlayBlobImage, EmptyBlobHasEmptyImage) {
+    blobgen2::BlobData blob;
+    blob.blob_sections.emplace_back(0x10000);
+    EXPECT_TRUE(blob.get_binary_image().empty());
+    EXPECT_EQ(load_printed_hex(blob).size(), 0u);
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <experimental/filesystem>
+
+#include "common/mem_lib.hpp"
+#include "common/size_lib.hpp"
+#include "gtest/gtest.h"
+#include "runtime/tilized_tensor_cache.hpp"
+#include "test_unit_common.hpp"
+
+namespace {
+
+std::string make_cache_dir(const std::string &name) {
+    const std::string dir = "/tmp/tilized_tensor_cache_test_" + name + "_" + std::to_string(getpid());
+    std::experimental::filesystem::remove_all(dir);
+    return dir;
+}
+
+tt::tt_dram_io_desc make_queue_desc() {
+    tt::tt_dram_io_desc q_desc;
+    q_desc.bufq_grid_dim_r = 1;
+    q_desc.bufq_grid_dim_c = 2;
+    q_desc.ublock_rt = 1;
+    q_desc.ublock_ct = 1;
+    q_desc.mblock_m = 1;
+    q_desc.mblock_n = 1;
+    q_desc.tile_height = 32;
+    q_desc.tile_width = 32;
+    q_desc.t = 1;
+    q_desc.bufq_target_format = tt::DataFormat::Float16_b;
+    return q_desc;
+}
+
+tt::tt_PytorchTensorDesc make_tensor_desc(const std::vector<float> &data) {
+    const std::uint32_t num_elements = data.size();
+    return tt::tt_PytorchTensorDesc(
+        data.data(), sizeof(float), tt::DataFormat::Float32, {1, 1, 1, num_elements}, {4 * num_elements, 4 * num_elements, 4 * num_elements, 4}, 4);
+}
+
+}  // namespace
+
+TEST(TilizedTensorCache, KeyTracksContentsAndLayout) {
+    tt::io::tt_tilized_tensor_cache cache(make_cache_dir("key"), 1 << 20);
+    std::vector<float> data(2048, 1.0f);
+    const tt::tt_dram_io_desc q_desc = make_queue_desc();
+    const std::string key = cache.get_key(q_desc, make_tensor_desc(data), "grayskull", "R");
+
+    EXPECT_EQ(key, cache.get_key(q_desc, make_tensor_desc(data), "grayskull", "R"));
+    EXPECT_NE(key, cache.get_key(q_desc, make_tensor_desc(data), "wormhole_b0", "R"));
+    EXPECT_NE(key, cache.get_key(q_desc, make_tensor_desc(data), "grayskull", "C"));
+
+    tt::tt_dram_io_desc other_format = q_desc;
+    other_format.bufq_target_format = tt::DataFormat::Bfp8_b;
+    EXPECT_NE(key, cache.get_key(other_format, make_tensor_desc(data), "grayskull", "R"));
+
+    data.back() = 2.0f;
+    EXPECT_NE(key, cache.get_key(q_desc, make_tensor_desc(data), "grayskull", "R"));
+}
+
+TEST(TilizedTensorCache, CachesOnlyTilizedQueuesWithoutPrestriding) {
+    tt::tt_dram_io_desc q_desc = make_queue_desc();
+    EXPECT_TRUE(tt::io::tt_tilized_tensor_cache::is_cacheable(q_desc));
+
+    tt::tt_dram_io_desc flat = q_desc;
+    flat.layout = tt::IO_LAYOUT::Flat;
+    EXPECT_FALSE(tt::io::tt_tilized_tensor_cache::is_cacheable(flat));
+
+    tt::tt_dram_io_desc prestrided = q_desc;
+    prestrided.s_descriptor.stride = 2;
+    EXPECT_FALSE(tt::io::tt_tilized_tensor_cache::is_cacheable(prestrided));
+}
+
+TEST(TilizedTensorCache, StoredTensorLoadsBack) {
+    tt::io::tt_tilized_tensor_cache cache(make_cache_dir("load"), 1 << 20);
+    std::vector<std::uint32_t> tilized_data(512);
+    for (std::uint32_t i = 0; i < tilized_data.size(); i++) {
+        tilized_data[i] = i * 0x01010101;
+    }
+    const tt::tt_TilizedTensorDesc tilized_tensor(tilized_data.data(), 2, 1024, tt::DataFormat::Float16_b);
+
+    EXPECT_FALSE(cache.load("missing", [](const tt::tt_TilizedTensorDesc &) { FAIL(); }));
+    cache.store("entry", tilized_tensor);
+    bool loaded = false;
+    EXPECT_TRUE(cache.load("entry", [&](const tt::tt_TilizedTensorDesc &cached) {
+        loaded = true;
+        EXPECT_EQ(cached.num_buffers, 2);
+        EXPECT_EQ(cached.buf_size_bytes, 1024);
+        EXPECT_EQ(cached.format, tt::DataFormat::Float16_b);
+        EXPECT_EQ(std::memcmp(cached.ptr, tilized_data.data(), tilized_data.size() * sizeof(std::uint32_t)), 0);
+    }));
+    EXPECT_TRUE(loaded);
+}
+
+TEST(TilizedTensorCache, EvictsLeastRecentlyUsedEntries) {
+    const std::string cache_dir = make_cache_dir("evict");
+    // Room for two 4KB entries
+    tt::io::tt_tilized_tensor_cache cache(cache_dir, 10 << 10);
+    std::vector<std::uint32_t> tilized_data(1024);
+    const tt::tt_TilizedTensorDesc tilized_tensor(tilized_data.data(), 1, 4096, tt::DataFormat::Float32);
+
+    cache.store("first", tilized_tensor);
+    cache.store("second", tilized_tensor);
+    // Make first the most recently used entry
+    std::experimental::filesystem::last_write_time(cache_dir + "/second.tilized", std::experimental::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+    cache.store("third", tilized_tensor);
+
+    const auto noop = [](const tt::tt_TilizedTensorDesc &) {};
+    EXPECT_TRUE(cache.load("first", noop));
+    EXPECT_FALSE(cache.load("second", noop));
+    EXPECT_TRUE(cache.load("third", noop));
+}
+
+TEST(TilizedTensorCache, PushedMissLeavesNoWorkloadAllocation) {
+    // The process wide cache is configured on first use, which has to be here
+    const std::string cache_dir = make_cache_dir("push");
+    setenv("TT_BACKEND_TILIZED_TENSOR_CACHE_DIR", cache_dir.c_str(), 1);
+    ASSERT_NE(tt::io::tt_tilized_tensor_cache::get(), nullptr);
+
+    mock_io_netlist netlist(tt::buda_home() + "/loader/tests/net_basic/netlist_binary_multi_buffer.yaml");
+    const tt::tt_dram_io_desc q_desc = netlist.get_queue_desc("q0");
+    // One entry of q0: 2x2 buffers of 2x2 tiles
+    std::vector<float> data(128 * 128);
+    for (std::uint32_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<float>(i % 97) * 0.25f;
+    }
+    const tt::tt_PytorchTensorDesc tensor(data.data(), sizeof(float), tt::DataFormat::Float32, {1, 1, 128, 128}, {4 * 128 * 128, 4 * 128 * 128, 4 * 128, 4}, 4);
+
+    const std::size_t num_host_allocations = tt::mem::host_shared_memory.size();
+    ASSERT_TRUE(tt::io::push_parameter_to_device(q_desc, tensor, 1));
+    EXPECT_EQ(tt::mem::host_shared_memory.size(), num_host_allocations) << "A miss must not keep a tilized copy in workload memory";
+    // Hit, pushed to the next slot of every buffer
+    ASSERT_TRUE(tt::io::push_parameter_to_device(q_desc, tensor, 1));
+    EXPECT_EQ(tt::mem::host_shared_memory.size(), num_host_allocations);
+
+    const std::uint32_t entry_size = tt::size::get_entry_size_in_bytes(
+        q_desc.bufq_target_format, true, q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width);
+    for (int buf_index = 0; buf_index < 4; buf_index++) {
+        const std::vector<std::uint32_t> miss_entry = netlist.read_queue_buffer("q0", buf_index, 0, entry_size);
+        EXPECT_NE(std::count(miss_entry.begin(), miss_entry.end(), 0), miss_entry.size()) << "buffer " << buf_index;
+        EXPECT_EQ(netlist.read_queue_buffer("q0", buf_index, entry_size, entry_size), miss_entry) << "buffer " << buf_index;
+    }
+    std::experimental::filesystem::remove_all(cache_dir);
+}
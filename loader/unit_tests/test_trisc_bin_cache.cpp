@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include "common/disk_cache_lib.hpp"
+#include "compile_trisc/trisc_bin_cache.hpp"
+#include "gtest/gtest.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void write_file(const fs::path &path, const std::string &contents) {
+    fs::create_directories(path.parent_path());
+    std::ofstream(path) << contents;
+}
+
+std::string read_file(const fs::path &path) {
+    std::ifstream file(path);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// A checkout root, op directories and the cache directory, all under one scratch directory
+class TriscBinCache : public ::testing::Test {
+   protected:
+    fs::path test_dir;
+    fs::path root;
+    fs::path cache_dir;
+    std::vector<std::string> build_cmds;
+
+    void SetUp() override {
+        const auto *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        test_dir = fs::temp_directory_path() / ("trisc_bin_cache_test_" + std::string(test_info->name()) + "_" + std::to_string(getpid()));
+        fs::remove_all(test_dir);
+        root = test_dir / "root";
+        cache_dir = test_dir / "cache";
+        write_file(root / "src/ckernels/ckernel.h", "ckernel");
+        write_file(root / "hlks/inc/hlk_api.h", "hlk_api");
+        if (!std::getenv("SFPI")) {
+            write_file(root / "third_party/sfpi/compiler/bin/riscv32-unknown-elf-g++", "riscv g++");
+        }
+        build_cmds = {"make -C " + root.string() + "/src/ckernels/gen/out KERNELS='" + root.string() + "/op/hlk.cpp'"};
+    }
+
+    void TearDown() override { fs::remove_all(test_dir); }
+
+    // Op directory holding the compile inputs, as it is before compiling
+    fs::path make_op_dir(const std::string &name, const std::string &hlk = "hlk") {
+        const fs::path op_path = test_dir / name;
+        write_file(op_path / "hlk.cpp", hlk);
+        write_file(op_path / "hlk_args_struct.h", "args");
+        return op_path;
+    }
+
+    // What compiling the op leaves in its directory
+    void compile(const fs::path &op_path, std::size_t elf_size = 16) {
+        for (int thread_id = 0; thread_id < 3; thread_id++) {
+            const fs::path thread_dir = op_path / ("tensix_thread" + std::to_string(thread_id));
+            write_file(thread_dir / ("tensix_thread" + std::to_string(thread_id) + ".elf"), std::string(elf_size, 'a' + thread_id));
+            write_file(thread_dir / "ckernel.o", "object");
+        }
+    }
+};
+
+}  // namespace
+
+TEST_F(TriscBinCache, StoredBinariesLoadIntoAnotherOp) {
+    tt::tt_trisc_bin_cache cache(cache_dir.string(), 1 << 20);
+    const fs::path op_path = make_op_dir("op0");
+    const std::string key = cache.get_key(root.string(), op_path.string(), build_cmds);
+
+    EXPECT_FALSE(cache.load(key, op_path.string()));
+    compile(op_path);
+    cache.store(key, op_path.string());
+
+    // Same compile inputs in another op directory
+    const fs::path other_op_path = make_op_dir("op1");
+    ASSERT_EQ(cache.get_key(root.string(), other_op_path.string(), build_cmds), key);
+    ASSERT_TRUE(cache.load(key, other_op_path.string()));
+    for (int thread_id = 0; thread_id < 3; thread_id++) {
+        const std::string thread_dir = "tensix_thread" + std::to_string(thread_id);
+        const std::string elf = thread_dir + "/" + thread_dir + ".elf";
+        EXPECT_EQ(read_file(other_op_path / elf), read_file(op_path / elf));
+        EXPECT_FALSE(fs::exists(other_op_path / thread_dir / "ckernel.o")) << "Build intermediates aren't cached";
+    }
+}
+
+TEST_F(TriscBinCache, KeyTracksCompileInputs) {
+    const std::string key = tt::tt_trisc_bin_cache(cache_dir.string(), 1 << 20).get_key(root.string(), make_op_dir("op0").string(), build_cmds);
+    // Every change below gets a fresh cache, which fingerprints the checkout again
+    const auto get_key = [&](const fs::path &op_path, const std::vector<std::string> &cmds) {
+        return tt::tt_trisc_bin_cache(cache_dir.string(), 1 << 20).get_key(root.string(), op_path.string(), cmds);
+    };
+
+    EXPECT_EQ(get_key(make_op_dir("op1"), build_cmds), key);
+    EXPECT_NE(get_key(make_op_dir("op2", "other hlk"), build_cmds), key);
+    EXPECT_NE(get_key(make_op_dir("op3"), {build_cmds.at(0) + " ARCH=wormhole_b0"}), key);
+
+    write_file(make_op_dir("op4") / "compile.log", "logs don't affect the key");
+    EXPECT_EQ(get_key(test_dir / "op4", build_cmds), key);
+
+    write_file(root / "hlks/inc/hlk_api.h", "edited hlk_api");
+    EXPECT_NE(get_key(make_op_dir("op5"), build_cmds), key);
+}
+
+TEST_F(TriscBinCache, IgnoresPartialStagingEntries) {
+    tt::tt_trisc_bin_cache cache(cache_dir.string(), 1 << 20);
+    const fs::path op_path = make_op_dir("op0");
+    const std::string key = cache.get_key(root.string(), op_path.string(), build_cmds);
+
+    // Another process died while staging this key
+    const fs::path stale_staging = tt::disk_cache::get_staging_path(cache_dir / key);
+    write_file(stale_staging / "tensix_thread0/tensix_thread0.elf", "partial");
+    fs::last_write_time(stale_staging, fs::file_time_type::clock::now() - tt::disk_cache::STALE_STAGING_AGE - std::chrono::minutes(1));
+    // And another is staging it right now
+    const fs::path live_staging = fs::path(stale_staging.string() + ".other");
+    write_file(live_staging / "tensix_thread0/tensix_thread0.elf", "partial");
+
+    EXPECT_FALSE(cache.load(key, op_path.string()));
+    EXPECT_FALSE(fs::exists(op_path / "tensix_thread0"));
+
+    cache.evict();
+    EXPECT_FALSE(fs::exists(stale_staging));
+    EXPECT_TRUE(fs::exists(live_staging)) << "Staging entries still being written must be left alone";
+
+    compile(op_path);
+    cache.store(key, op_path.string());
+    EXPECT_TRUE(cache.load(key, make_op_dir("op1").string()));
+}
+
+TEST_F(TriscBinCache, EvictsLeastRecentlyUsedEntries) {
+    // Room for two entries of three 4KB binaries
+    tt::tt_trisc_bin_cache cache(cache_dir.string(), 30 << 10);
+    std::vector<std::string> keys;
+    for (const std::string hlk : {"first", "second", "third"}) {
+        const fs::path op_path = make_op_dir(hlk, hlk);
+        keys.push_back(cache.get_key(root.string(), op_path.string(), build_cmds));
+        compile(op_path, 4 << 10);
+        cache.store(keys.back(), op_path.string());
+    }
+    // Make first more recently used than second
+    fs::last_write_time(cache_dir / keys.at(1), fs::file_time_type::clock::now() - std::chrono::hours(1));
+    fs::last_write_time(cache_dir / keys.at(0), fs::file_time_type::clock::now() - std::chrono::minutes(1));
+    cache.evict();
+
+    EXPECT_TRUE(cache.load(keys.at(0), make_op_dir("load0").string()));
+    EXPECT_FALSE(cache.load(keys.at(1), make_op_dir("load1").string()));
+    EXPECT_TRUE(cache.load(keys.at(2), make_op_dir("load2").string()));
+}
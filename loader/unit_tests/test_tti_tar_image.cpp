@@ -0,0 +1,234 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <cstring>
+#include <experimental/filesystem>
+#include <fstream>
+
+#include "common/tti_lib.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+constexpr std::size_t block_size = 512;
+
+struct tar_member {
+    std::string name;
+    char type = '0';
+    std::string contents = "";
+    std::string prefix = "";
+    std::string link_name = "";
+    // Size field in base-256 instead of octal
+    bool base256_size = false;
+    // Size field written as zero, for members whose size comes from a pax record
+    bool zero_size_field = false;
+};
+
+void write_octal(char *field, std::size_t size, std::uint64_t value) {
+    std::snprintf(field, size, "%0*llo", static_cast<int>(size - 1), static_cast<unsigned long long>(value));
+}
+
+// ustar header and contents, padded to whole blocks
+std::string make_tar_member(const tar_member &member) {
+    std::string block(block_size, '\0');
+    char *header = block.data();
+    std::memcpy(header, member.name.data(), std::min<std::size_t>(member.name.size(), 100));
+    write_octal(header + 100, 8, 0644);
+    write_octal(header + 108, 8, 0);
+    write_octal(header + 116, 8, 0);
+    const std::uint64_t size_field = member.zero_size_field ? 0 : member.contents.size();
+    if (member.base256_size) {
+        header[124] = static_cast<char>(0x80);
+        for (int i = 0; i < 8; i++) {
+            header[135 - i] = static_cast<char>((size_field >> (8 * i)) & 0xff);
+        }
+    } else {
+        write_octal(header + 124, 12, size_field);
+    }
+    write_octal(header + 136, 12, 0);
+    header[156] = member.type;
+    std::memcpy(header + 157, member.link_name.data(), member.link_name.size());
+    std::memcpy(header + 257, "ustar", 6);
+    std::memcpy(header + 263, "00", 2);
+    std::memcpy(header + 345, member.prefix.data(), member.prefix.size());
+
+    std::memset(header + 148, ' ', 8);
+    std::uint64_t checksum = 0;
+    for (std::size_t i = 0; i < block_size; i++) {
+        checksum += static_cast<std::uint8_t>(header[i]);
+    }
+    std::snprintf(header + 148, 8, "%06llo", static_cast<unsigned long long>(checksum));
+
+    const std::size_t padded_size = (member.contents.size() + block_size - 1) / block_size * block_size;
+    std::string contents = member.contents;
+    contents.resize(padded_size, '\0');
+    return block + contents;
+}
+
+std::string make_tar(const std::vector<tar_member> &members) {
+    std::string archive = "";
+    for (const tar_member &member : members) {
+        archive += make_tar_member(member);
+    }
+    return archive + std::string(2 * block_size, '\0');
+}
+
+// "<record length> <key>=<value>\n", the length counts its own digits
+std::string make_pax_record(const std::string &key, const std::string &value) {
+    const std::string body = " " + key + "=" + value + "\n";
+    std::size_t length = body.size() + 1;
+    while (std::to_string(length).size() + body.size() != length) {
+        length++;
+    }
+    return std::to_string(length) + body;
+}
+
+bool index_tar(const std::string &archive, std::vector<tt::tti_tar::tar_entry> &entries) {
+    return tt::tti_tar::index_tar_image(reinterpret_cast<const std::uint8_t *>(archive.data()), archive.size(), entries);
+}
+
+std::string entry_contents(const std::string &archive, const tt::tti_tar::tar_entry &entry) {
+    return archive.substr(entry.offset, entry.size);
+}
+
+std::string make_test_dir(const std::string &name) {
+    const std::string dir = "/tmp/tti_tar_image_test_" + name + "_" + std::to_string(getpid());
+    std::experimental::filesystem::remove_all(dir);
+    std::experimental::filesystem::create_directories(dir);
+    return dir;
+}
+
+const std::string device_json = R"({"compiled_graph_state": {
+    "ordered_input_names": [], "ordered_constant_node_names": [], "ordered_parameter_node_names": ["weights"],
+    "ordered_input_runtime_tensor_transforms": [], "post_const_eval_parameters": {"weights": {"bin": "tensors/weights.bin"}}}})";
+
+std::vector<tar_member> make_model_members() {
+    return {
+        {.name = "unzipped_tti/", .type = '5'},
+        {.name = "unzipped_tti/device.json", .contents = device_json},
+        {.name = "unzipped_tti/compile_and_runtime_config.json", .contents = "{}"},
+        {.name = "unzipped_tti/tensors/weights.bin", .contents = std::string(1500, 'w')},
+    };
+}
+
+}  // namespace
+
+TEST(TtiTarImage, UstarPrefixIsPrependedToName) {
+    const std::string archive = make_tar({{.name = "file.bin", .contents = "abc", .prefix = "model/tensors"}});
+    std::vector<tt::tti_tar::tar_entry> entries;
+    ASSERT_TRUE(index_tar(archive, entries));
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].name, "model/tensors/file.bin");
+    EXPECT_EQ(entry_contents(archive, entries[0]), "abc");
+}
+
+TEST(TtiTarImage, GnuLongNameAppliesToNextMemberOnly) {
+    const std::string long_name = std::string(150, 'n') + "/weights.bin";
+    const std::string archive = make_tar({
+        {.name = "././@LongLink", .type = 'L', .contents = long_name + std::string(1, '\0')},
+        {.name = "truncated", .contents = "long"},
+        {.name = "short.bin", .contents = "short"},
+    });
+    std::vector<tt::tti_tar::tar_entry> entries;
+    ASSERT_TRUE(index_tar(archive, entries));
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].name, long_name);
+    EXPECT_EQ(entry_contents(archive, entries[0]), "long");
+    EXPECT_EQ(entries[1].name, "short.bin");
+    EXPECT_EQ(entry_contents(archive, entries[1]), "short");
+}
+
+TEST(TtiTarImage, PaxPathAndSizeOverrideHeader) {
+    const std::string contents(1300, 'p');
+    const std::string pax = make_pax_record("mtime", "1700000000.5") + make_pax_record("path", "model/pax name.bin") +
+                            make_pax_record("size", std::to_string(contents.size()));
+    const std::string archive = make_tar({
+        {.name = "PaxHeaders/x", .type = 'x', .contents = pax},
+        {.name = "short", .contents = contents, .zero_size_field = true},
+        {.name = "next.bin", .contents = "next"},
+    });
+    std::vector<tt::tti_tar::tar_entry> entries;
+    ASSERT_TRUE(index_tar(archive, entries));
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].name, "model/pax name.bin");
+    EXPECT_EQ(entries[0].size, contents.size());
+    EXPECT_EQ(entry_contents(archive, entries[0]), contents);
+    EXPECT_EQ(entries[1].name, "next.bin");
+    EXPECT_EQ(entry_contents(archive, entries[1]), "next");
+}
+
+TEST(TtiTarImage, MalformedPaxRecordsAreRejected) {
+    for (const std::string &pax : {std::string("no length record\n"), std::string("12 path\n"), std::string("99 path=x\n"),
+                                   std::string("x5 a=b\n"), make_pax_record("size", "12abc")}) {
+        const std::string archive = make_tar({{.name = "PaxHeaders/x", .type = 'x', .contents = pax}, {.name = "file", .contents = "f"}});
+        std::vector<tt::tti_tar::tar_entry> entries;
+        EXPECT_FALSE(index_tar(archive, entries)) << pax;
+    }
+}
+
+TEST(TtiTarImage, Base256Size) {
+    const std::string contents(700, 'b');
+    const std::string archive = make_tar({{.name = "big.bin", .contents = contents, .base256_size = true}, {.name = "after", .contents = "a"}});
+    std::vector<tt::tti_tar::tar_entry> entries;
+    ASSERT_TRUE(index_tar(archive, entries));
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].size, contents.size());
+    EXPECT_EQ(entry_contents(archive, entries[0]), contents);
+    EXPECT_EQ(entry_contents(archive, entries[1]), "a");
+}
+
+TEST(TtiTarImage, PathsLeavingOutputDirAreRejected) {
+    const std::vector<tar_member> rejected = {
+        {.name = "../escape.bin", .contents = "e"},
+        {.name = "model/../../escape.bin", .contents = "e"},
+        {.name = "escape.bin", .contents = "e", .prefix = ".."},
+        {.name = "link", .type = '2', .link_name = "/etc/passwd"},
+        {.name = "model/link", .type = '2', .link_name = "../../escape"},
+    };
+    for (const tar_member &member : rejected) {
+        std::vector<tt::tti_tar::tar_entry> entries;
+        EXPECT_FALSE(index_tar(make_tar({member}), entries)) << member.name << " -> " << member.link_name;
+    }
+
+    std::vector<tt::tti_tar::tar_entry> entries;
+    ASSERT_TRUE(index_tar(make_tar({{.name = "./model/./link", .type = '2', .link_name = "tensors/weights.bin"}}), entries));
+    EXPECT_EQ(entries[0].name, "model/link");
+    EXPECT_EQ(entries[0].link_name, "tensors/weights.bin");
+}
+
+TEST(TtiTarImage, TensorsStayMapped) {
+    const std::string dir = make_test_dir("mapped");
+    const std::string tti_path = dir + "/model.tti";
+    std::ofstream(tti_path, std::ios::binary) << make_tar(make_model_members());
+    {
+        tt::tt_device_image image(tti_path, dir + "/out");
+        const std::string weights_path = image.get_model_path("tensors/weights.bin");
+        std::size_t size = 0;
+        const void *weights = image.get_mapped_file(weights_path, size);
+        ASSERT_NE(weights, nullptr);
+        EXPECT_EQ(std::string(static_cast<const char *>(weights), size), std::string(1500, 'w'));
+        EXPECT_FALSE(std::experimental::filesystem::exists(weights_path));
+        EXPECT_TRUE(std::experimental::filesystem::exists(image.get_model_path("device.json")));
+    }
+    std::experimental::filesystem::remove_all(dir);
+}
+
+TEST(TtiTarImage, UnsupportedArchiveFallsBackToExtraction) {
+    // Hard links are not indexed, the whole image goes through tar instead
+    std::vector<tar_member> members = make_model_members();
+    members.push_back({.name = "unzipped_tti/tensors/weights_link.bin", .type = '1', .link_name = "unzipped_tti/tensors/weights.bin"});
+    const std::string dir = make_test_dir("fallback");
+    const std::string tti_path = dir + "/model.tti";
+    std::ofstream(tti_path, std::ios::binary) << make_tar(members);
+    {
+        tt::tt_device_image image(tti_path, dir + "/out");
+        const std::string weights_path = image.get_model_path("tensors/weights.bin");
+        std::size_t size = 0;
+        EXPECT_EQ(image.get_mapped_file(weights_path, size), nullptr);
+        EXPECT_EQ(std::experimental::filesystem::file_size(weights_path), 1500);
+        EXPECT_TRUE(std::experimental::filesystem::exists(image.get_model_path("tensors/weights_link.bin")));
+    }
+    std::experimental::filesystem::remove_all(dir);
+}
@@ -8,8 +8,11 @@
 
 #include "gtest/gtest.h"
 
+#include "common/cache_lib.hpp"
 #include "loader/epoch_loader.hpp"
 #include "loader/tt_cluster.hpp"
+#include "loader/tt_mock_device.hpp"
+#include "runtime/runtime_io.hpp"
 #include "tt_backend_api.hpp"
 
 #include "tt_backend_api.hpp"
@@ -115,4 +118,44 @@ inline tt::ARCH get_machine_arch() {
         machine_arch = get_arch_name(get_param<std::string>("system-device0-type")); // assume all mmio devices are of the same arch
     }
     return machine_arch;
-}
\ No newline at end of file
+}
+
+// Runtime IO on the queues of a netlist, backed by a mock device instead of a compiled and launched runtime. The
+// cluster is registered in the object cache under the netlist path, which is where tt::io looks it up.
+//
+class mock_io_netlist {
+   public:
+    mock_io_netlist(const std::string &netlist_path) : netlist_path(netlist_path) {
+        cluster = quiet_call([&] {
+            return get_cluster(tt::ARCH::GRAYSKULL, tt::TargetDevice::Mock, {0}, test_path() + "device_descriptors/grayskull_1x1_arch.yaml");
+        });
+        tt_object_cache<tt_cluster>::set(netlist_path, cluster.get());
+    }
+    ~mock_io_netlist() {
+        tt_object_cache<tt_cluster>::clear(netlist_path);
+        // Tilizers cached for the queues hold the workload and cluster, they go along with the workload
+        tt::io::free_object_cache();
+    }
+
+    tt::tt_dram_io_desc get_queue_desc(const std::string &queue_name) {
+        tt::tt_dram_io_desc q_desc = get_workload()->get_io_desc_for_queue(queue_name);
+        q_desc.netlist_path = netlist_path;
+        q_desc.backend_type = tt::DEVICE::Mock;
+        return q_desc;
+    }
+    tt_runtime_workload *get_workload() { return tt::io::get_workload(netlist_path); }
+    tt_cluster *get_mock_cluster() { return cluster.get(); }
+    tt_mock_device *get_mock_device() { return dynamic_cast<tt_mock_device *>(cluster->get_device().get()); }
+
+    // Contents of buffer buf_index of a queue, past its header
+    std::vector<uint32_t> read_queue_buffer(const std::string &queue_name, int buf_index, uint32_t offset_bytes, uint32_t size_bytes) {
+        const tt_queue_allocation_info &alloc = get_workload()->queues.at(queue_name).my_queue_info.alloc_info.at(buf_index);
+        std::vector<uint32_t> data;
+        cluster->read_dram_vec(data, tt_target_dram{0, alloc.channel, 0}, alloc.address + tt::io::io_queue_header_size_bytes + offset_bytes, size_bytes);
+        return data;
+    }
+
+   private:
+    const std::string netlist_path;
+    std::unique_ptr<tt_cluster> cluster;
+};
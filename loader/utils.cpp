@@ -194,6 +194,7 @@ void print_binary_cache_report(const std::string &output_report, tt_epoch_binary
     cache_report[device_str]["program_binary_cache"]["cache-accesses"] = program_cache.profiler.num_cache_accesses;
     cache_report[device_str]["program_binary_cache"]["unique-cache-keys"] = program_cache.profiler.total_unique_cache_keys;
     cache_report[device_str]["program_binary_cache"]["num-preloads"] = program_cache.profiler.num_preloads;
+    cache_report[device_str]["program_binary_cache"]["policy"] = program_cache.get_policy_name();
 
     for (int i = 0; i < io_queue_update_cache.size(); i++) {
         if(std::find(sdesc.workers.begin(), sdesc.workers.end(), tt_xy_pair(i % epoch_queue::GridSizeRow, i / epoch_queue::GridSizeRow)) != sdesc.workers.end()) {
@@ -97,6 +97,9 @@ class tt_op
     virtual tt_buffer_grid* get_parameter_buffer_grid(uint32_t index);
 
     virtual void model(vector<tt_tensor*> &inputs, tt_tensor *out) {log_assert(false, "model function not implemented for op");}
+    // Whether model() may modify its input tensors in place. Callers can pass shared inputs without copying them
+    // to ops that return false.
+    virtual bool model_modifies_inputs() const { return true; }
 
     virtual DstSize get_dst_size() const { return DstSize::HalfSize; }
     
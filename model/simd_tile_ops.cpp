@@ -24,14 +24,19 @@ namespace tt {
     tt_tile tt_tile::transpose_xy() const
     {
         tt_tile tmp;
-        tmp.data_format = data_format;
-     
+        transpose_xy_to(tmp);
+        return(tmp);
+    }
+
+    void tt_tile::transpose_xy_to(tt_tile &dst) const
+    {
+        dst.data_format = data_format;
+
         for (int i=0; i<tt::constants::TILE_HEIGHT; i+=4) {
             for (int j=0; j<tt::constants::TILE_WIDTH; j+=4) {
-                fast_transpose_4x4(&t_vector[i*tt::constants::TILE_WIDTH + j], &tmp.t_vector[j*tt::constants::TILE_HEIGHT + i], tt::constants::TILE_WIDTH, tt::constants::TILE_HEIGHT);
+                fast_transpose_4x4(&t_vector[i*tt::constants::TILE_WIDTH + j], &dst.t_vector[j*tt::constants::TILE_HEIGHT + i], tt::constants::TILE_WIDTH, tt::constants::TILE_HEIGHT);
             }
         }
-        return(tmp);
     }
 
     tt_tile tt_tile::operator+(const tt_tile &rhs) const
@@ -74,9 +79,58 @@ namespace tt {
         return(tmp);
     }
 
+    // CPU implements reduction tree more efficiently than _mm256_hadd
+    inline float reduce_add_8(__m256 int_prod) {
+        // 8-to-4 reduction
+        __m128 hi_quad = _mm256_extractf128_ps(int_prod, 1);
+        __m128 lo_quad = _mm256_castps256_ps128(int_prod);
+        __m128 sum_quad = _mm_add_ps(lo_quad, hi_quad);
+        // 4-to-2 reduction
+        __m128 lo_dual = sum_quad;
+        __m128 hi_dual = _mm_movehl_ps(sum_quad, sum_quad);
+        __m128 sum_dual = _mm_add_ps(lo_dual, hi_dual);
+        // 4-to-1 reduction
+        __m128 lo = sum_dual;
+        __m128 hi = _mm_shuffle_ps(sum_dual, sum_dual, 0x1);
+        return _mm_cvtss_f32(_mm_add_ss(lo, hi));
+    }
+
+    // C += A * B, where B_T holds B transposed so both operands are read along rows.
+    // Four output columns are computed at once so each row of A is loaded once per four columns,
+    // but every output element keeps its own accumulator and reduction order.
+    inline void matmul_transposed_with_partial(const float *A, const float *B_T, float *C) {
+        constexpr int TILE_HEIGHT = tt::constants::TILE_HEIGHT;
+        constexpr int TILE_WIDTH = tt::constants::TILE_WIDTH;
+        static_assert(TILE_WIDTH % 8 == 0 && TILE_WIDTH % 4 == 0, "Tile width must be a multiple of the vector width");
+
+        for (int i = 0; i < TILE_HEIGHT; i++) {
+            const float *A_row = &A[i * TILE_WIDTH];
+            __m256 A_k[TILE_WIDTH / 8];
+            for (int k = 0; k < TILE_WIDTH; k += 8) {
+                A_k[k / 8] = _mm256_load_ps(&A_row[k]);
+            }
+            for (int j = 0; j < TILE_WIDTH; j += 4) {
+                __m256 int_prod_0 = _mm256_setzero_ps();
+                __m256 int_prod_1 = _mm256_setzero_ps();
+                __m256 int_prod_2 = _mm256_setzero_ps();
+                __m256 int_prod_3 = _mm256_setzero_ps();
+                for (int k = 0; k < TILE_WIDTH; k += 8) {
+                    int_prod_0 = _mm256_fmadd_ps(A_k[k / 8], _mm256_load_ps(&B_T[(j + 0) * TILE_HEIGHT + k]), int_prod_0);
+                    int_prod_1 = _mm256_fmadd_ps(A_k[k / 8], _mm256_load_ps(&B_T[(j + 1) * TILE_HEIGHT + k]), int_prod_1);
+                    int_prod_2 = _mm256_fmadd_ps(A_k[k / 8], _mm256_load_ps(&B_T[(j + 2) * TILE_HEIGHT + k]), int_prod_2);
+                    int_prod_3 = _mm256_fmadd_ps(A_k[k / 8], _mm256_load_ps(&B_T[(j + 3) * TILE_HEIGHT + k]), int_prod_3);
+                }
+                C[i * TILE_WIDTH + j + 0] += reduce_add_8(int_prod_0);
+                C[i * TILE_WIDTH + j + 1] += reduce_add_8(int_prod_1);
+                C[i * TILE_WIDTH + j + 2] += reduce_add_8(int_prod_2);
+                C[i * TILE_WIDTH + j + 3] += reduce_add_8(int_prod_3);
+            }
+        }
+    }
+
     void tt_tile::matmul_with_partial(const tt_tile &rhs, tt_tile &result) const
     {
-        int i,j,k;
+        int i,j;
 
         union alignas(32) {
             float t[tt::constants::TILE_HEIGHT][tt::constants::TILE_WIDTH];
@@ -91,32 +145,13 @@ namespace tt {
             }
         }
 
-        __m256 row_vector_A, row_vector_B, int_prod;
-
         // Vectorized matrix multiplication with reduction on partial result
-        for (i = 0; i < tt::constants::TILE_HEIGHT; i++) {
-            for (j = 0; j < tt::constants::TILE_WIDTH; j++) {
-                int_prod = _mm256_setzero_ps();
-                for (k = 0; k < tt::constants::TILE_WIDTH; k+=8) {
-                    row_vector_A = _mm256_load_ps(&t[i][k]);
-                    row_vector_B = _mm256_load_ps(&B_T.t[j][k]);
-                    int_prod = _mm256_fmadd_ps(row_vector_A, row_vector_B, int_prod);
-                }
-                // CPU implements reduction tree more efficiently than _mm256_hadd
-                // 8-to-4 reduction
-                __m128 hi_quad = _mm256_extractf128_ps(int_prod, 1);
-                __m128 lo_quad = _mm256_castps256_ps128(int_prod);
-                __m128 sum_quad = _mm_add_ps(lo_quad, hi_quad);
-                // 4-to-2 reduction
-                __m128 lo_dual = sum_quad;
-                __m128 hi_dual = _mm_movehl_ps(sum_quad, sum_quad);
-                __m128 sum_dual = _mm_add_ps(lo_dual, hi_dual);
-                // 4-to-1 reduction
-                __m128 lo = sum_dual;
-                __m128 hi = _mm_shuffle_ps(sum_dual, sum_dual, 0x1);
-                result.t[i][j] += _mm_cvtss_f32(_mm_add_ss(lo, hi));
-            }
-        }
+        matmul_transposed_with_partial(t_vector, B_T.t_vector, result.t_vector);
+    }
+
+    void tt_tile::matmul_with_partial_pretransposed(const tt_tile &rhs_transposed, tt_tile &result) const
+    {
+        matmul_transposed_with_partial(t_vector, rhs_transposed.t_vector, result.t_vector);
     }
 
     tt_tile& tt_tile::operator+=(const tt_tile& rhs)
@@ -183,17 +218,22 @@ namespace tt {
     tt_tile tt_tile::transpose_xy() const
     {
         tt_tile tmp;
-        tmp.data_format = data_format;
-     
+        transpose_xy_to(tmp);
+        return tmp;
+    }
+
+    void tt_tile::transpose_xy_to(tt_tile &dst) const
+    {
+        dst.data_format = data_format;
+
         uint32_t i,j;
         for(i=0;i<tt::constants::TILE_HEIGHT;++i)
         {
             for(j=0;j<tt::constants::TILE_WIDTH;++j)
             {
-                tmp.t[i][j] = t[j][i];
+                dst.t[i][j] = t[j][i];
             }
         }
-        return tmp;
     }
 
     tt_tile tt_tile::operator+(const tt_tile &rhs) const
@@ -250,6 +290,24 @@ namespace tt {
         }
     }
 
+    void tt_tile::matmul_with_partial_pretransposed(const tt_tile &rhs_transposed, tt_tile &result) const
+    {
+        float acc;
+
+        for (uint32_t i = 0; i < tt::constants::TILE_HEIGHT; ++i)
+        {
+            for (uint32_t j = 0; j < tt::constants::TILE_WIDTH; ++j)
+            {
+                acc = 0.0;
+                for(uint32_t k =0; k < tt::constants::TILE_WIDTH; ++k)
+                {
+                    acc += t[i][k] * rhs_transposed.t[j][k];
+                }
+                result.t[i][j] += acc;
+            }
+        }
+    }
+
     tt_tile& tt_tile::operator+=(const tt_tile& rhs)
     {
         int i,j;
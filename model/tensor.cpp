@@ -18,6 +18,7 @@
 #include "tile.hpp"
 #include "utils/scoped_timer.hpp"
 #include "common/tt_parallel_for.h"
+#include "model/tt_rnd_util.hpp"
 
 // Utils
 using std::cout;
@@ -35,6 +36,31 @@ using std::unordered_set;
 
 namespace tt
 {
+    namespace {
+    // Output tiles of the tensor matmuls are independent, so they are split across threads. Small matmuls
+    // stay on the calling thread since spawning threads would cost more than the tile products themselves.
+    constexpr int MATMUL_MIN_TILE_PRODUCTS_PER_THREAD = 64;
+    // Number of output tile columns that share one load of an lhs tile in tt_tensor::matmul.
+    constexpr int MATMUL_OUTPUT_COLUMN_BLOCK = 4;
+
+    int get_matmul_num_threads(int64_t num_tile_products) {
+        const int64_t max_useful_threads = std::max<int64_t>(1, num_tile_products / MATMUL_MIN_TILE_PRODUCTS_PER_THREAD);
+        return static_cast<int>(std::min<int64_t>(tt::cpuset::get_allowed_num_threads(), max_useful_threads));
+    }
+
+    template <typename Function>
+    void parallel_for_matmul_work(int num_work_items, int64_t num_tile_products, Function func) {
+        const int num_threads = get_matmul_num_threads(num_tile_products);
+        if (num_threads <= 1) {
+            for (int item = 0; item < num_work_items; ++item) {
+                func(item);
+            }
+        } else {
+            tt::parallel_for(0, num_work_items, func, num_threads);
+        }
+    }
+    }  // namespace
+
     // rti and cti are tensor dimensions in tiles
     // zi and wi are regular scalar dimensions
     tt_tensor::tt_tensor(tt_tensor_metadata const &metadata) : metadata(metadata) {}
@@ -182,6 +208,25 @@ namespace tt
     // Remember to free this memory to prevent leaks!
     tt_tensor *tt_tensor::allocate_on_heap(tt_tensor const &&tensor) { return tensor.copy_on_heap(); }
 
+    const tt_tensor &tt_cow_tensor::get() const {
+        log_assert(tensor_ptr != nullptr, "Accessing an empty copy-on-write tensor");
+        return *tensor_ptr;
+    }
+
+    tt_tensor &tt_cow_tensor::get_mutable() {
+        log_assert(tensor_ptr != nullptr, "Accessing an empty copy-on-write tensor");
+        if (borrowed) {
+            tensor_ptr = std::make_shared<tt_tensor>(*tensor_ptr);
+            borrowed = false;
+        }
+        return *tensor_ptr;
+    }
+
+    void tt_cow_tensor::reset(tt_tensor &&tensor) {
+        tensor_ptr = std::make_shared<tt_tensor>(std::move(tensor));
+        borrowed = false;
+    }
+
     // This method creates a copy of this tensor on the heap.
     // Remember to free this memory to prevent leaks!
     tt_tensor* tt_tensor::copy_on_heap() const
@@ -1391,6 +1436,10 @@ namespace tt
     }
 
     void tt_tensor::apply_parallel(function<void(tt_tile&)> tile_operation) {
+        apply_parallel_indexed([&tile_operation](int, tt_tile& tile) { tile_operation(tile); });
+    }
+
+    void tt_tensor::apply_parallel_indexed(function<void(int, tt_tile&)> tile_operation) {
         const int num_tiles = getw() * getz() * getrt() * getct();
 
         tt::parallel_for(
@@ -1402,7 +1451,7 @@ namespace tt
                 const int ri = (tile_index / getct()) % getrt();
                 const int ci = tile_index % getct();
                 auto& tile = tile_tensor[wi][zi][ri][ci];
-                tile_operation(tile);
+                tile_operation(tile_index, tile);
             },
             tt::cpuset::get_allowed_num_threads());
     }
@@ -1543,8 +1592,9 @@ namespace tt
     void tt_tensor::randomize(float mean, float stddev) {
         this->reserve_tile_tensor();
 
-        apply([mean, stddev](tt_tile& tile) {
-            tile.randomize(mean, stddev);
+        const std::uint64_t key = tt::test::tt_rnd_tensor_key();
+        apply_parallel_indexed([key, mean, stddev](int tile_index, tt_tile& tile) {
+            tt::test::tt_philox_fill_normal(key, tile_index, tile.t[0], tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH, mean, stddev);
         });
     }
 
@@ -1559,8 +1609,9 @@ namespace tt
     void tt_tensor::randomize_uniform(float lower_bound, float upper_bound) {
         this->reserve_tile_tensor();
 
-        apply([lower_bound, upper_bound](tt_tile& tile) {
-            tile.randomize_uniform(lower_bound, upper_bound);
+        const std::uint64_t key = tt::test::tt_rnd_tensor_key();
+        apply_parallel_indexed([key, lower_bound, upper_bound](int tile_index, tt_tile& tile) {
+            tt::test::tt_philox_fill_uniform(key, tile_index, tile.t[0], tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH, lower_bound, upper_bound);
         });
     }
 
@@ -1637,26 +1688,59 @@ namespace tt
         }
 
         result.reserve_tile_tensor();
-        int z, i, j, k;
 
-        for (z = 0; z < getz(); ++z)
-        {
-            for (i = 0; i < getrt(); ++i)
-            {
-                int j, k;
-                for (j = 0; j < rhs.getct(); ++j)
-                {
-                    result.tile_tensor[0][z][i][j] = 0.0;
-                    for (k = 0; k < getct(); ++k) {
-                        if (fast) {
-                            tile_tensor[0][z][i][k].matmul_with_partial(rhs.tile_tensor[0][z][k][j], result.tile_tensor[0][z][i][j]);
-                        } else {
-                            result.tile_tensor[0][z][i][j] += tile_tensor[0][z][i][k].matmul(rhs.tile_tensor[0][z][k][j]);
-                        }
-                    }
+        const int num_z = getz();
+        const int num_rt = getrt();
+        const int num_ct = rhs.getct();
+        const int num_kt = getct();
+        const int64_t num_tile_products = static_cast<int64_t>(num_z) * num_rt * num_ct * num_kt;
+
+        if (!fast) {
+            parallel_for_matmul_work(num_z * num_rt * num_ct, num_tile_products, [&](int tile_index) {
+                const int z = tile_index / (num_rt * num_ct);
+                const int i = (tile_index / num_ct) % num_rt;
+                const int j = tile_index % num_ct;
+                result.tile_tensor[0][z][i][j] = 0.0;
+                for (int k = 0; k < num_kt; ++k) {
+                    result.tile_tensor[0][z][i][j] += tile_tensor[0][z][i][k].matmul(rhs.tile_tensor[0][z][k][j]);
                 }
-            }
+            });
+            return(result);
         }
+
+        // Pack rhs into panels of pre-transposed tiles, laid out [z][j][k] so the k-loop for a block of
+        // output columns walks contiguous memory. Each rhs tile is transposed once instead of once per lhs row.
+        vector<tt_tile> rhs_panels(static_cast<size_t>(num_z) * num_ct * num_kt);
+        auto rhs_panel_tile = [&](int z, int j, int k) -> tt_tile& {
+            return rhs_panels[(static_cast<size_t>(z) * num_ct + j) * num_kt + k];
+        };
+        parallel_for_matmul_work(num_z * num_kt, num_tile_products, [&](int row_index) {
+            const int z = row_index / num_kt;
+            const int k = row_index % num_kt;
+            for (int j = 0; j < num_ct; ++j) {
+                rhs.tile_tensor[0][z][k][j].transpose_xy_to(rhs_panel_tile(z, j, k));
+            }
+        });
+
+        // Each work item produces a row-block of up to MATMUL_OUTPUT_COLUMN_BLOCK output tiles, reusing every lhs
+        // tile across the block. Tiles are accumulated in increasing k so results match the unblocked loop exactly.
+        const int num_column_blocks = (num_ct + MATMUL_OUTPUT_COLUMN_BLOCK - 1) / MATMUL_OUTPUT_COLUMN_BLOCK;
+        parallel_for_matmul_work(num_z * num_rt * num_column_blocks, num_tile_products, [&](int block_index) {
+            const int z = block_index / (num_rt * num_column_blocks);
+            const int i = (block_index / num_column_blocks) % num_rt;
+            const int j_start = (block_index % num_column_blocks) * MATMUL_OUTPUT_COLUMN_BLOCK;
+            const int j_end = std::min(j_start + MATMUL_OUTPUT_COLUMN_BLOCK, num_ct);
+
+            for (int j = j_start; j < j_end; ++j) {
+                result.tile_tensor[0][z][i][j] = 0.0;
+            }
+            for (int k = 0; k < num_kt; ++k) {
+                const tt_tile &lhs_tile = tile_tensor[0][z][i][k];
+                for (int j = j_start; j < j_end; ++j) {
+                    lhs_tile.matmul_with_partial_pretransposed(rhs_panel_tile(z, j, k), result.tile_tensor[0][z][i][j]);
+                }
+            }
+        });
         return(result);
     }
 
@@ -1688,20 +1772,19 @@ namespace tt
 
         int input_inner_dim = getct();
 
-        for (int b = 0; b < getz(); ++b)
-        {
-            for (int i = 0; i < getrt(); ++i)
+        const int num_rt = getrt();
+        const int num_ct = rhs.getct();
+        const int64_t num_tile_products = static_cast<int64_t>(getz()) * num_rt * num_ct * input_inner_dim;
+        parallel_for_matmul_work(getz() * num_rt * num_ct, num_tile_products, [&](int tile_index) {
+            const int b = tile_index / (num_rt * num_ct);
+            const int i = (tile_index / num_ct) % num_rt;
+            const int j = tile_index % num_ct;
+            result.tile_tensor[0][b][i][j] = 0.0;
+            for (int k = 0; k < input_inner_dim; ++k)
             {
-                for (int j = 0; j < rhs.getct(); ++j)
-                {
-                    result.tile_tensor[0][b][i][j] = 0.0;
-                    for (int k = 0; k < getct(); ++k)
-                    {
-                        result.tile_tensor[0][b][i][j] += tile_tensor[0][b][i][k].matmul(rhs.tile_tensor[0][b][k][j]);
-                    }
-                }
+                result.tile_tensor[0][b][i][j] += tile_tensor[0][b][i][k].matmul(rhs.tile_tensor[0][b][k][j]);
             }
-        }
+        });
         return result;
     }
 
@@ -1737,23 +1820,21 @@ namespace tt
 
         result.reserve_tile_tensor();
 
-        tt_tile acc(this->get_data_format());
-
-        for (int b = 0; b < rhs.getz(); ++b)
-        {
-            for (int i = 0; i < getrt(); ++i)
+        const int num_rt = getrt();
+        const int num_ct = rhs.getct();
+        const int64_t num_tile_products = static_cast<int64_t>(rhs.getz()) * num_rt * num_ct * input_inner_dim;
+        parallel_for_matmul_work(rhs.getz() * num_rt * num_ct, num_tile_products, [&](int tile_index) {
+            const int b = tile_index / (num_rt * num_ct);
+            const int i = (tile_index / num_ct) % num_rt;
+            const int j = tile_index % num_ct;
+            tt_tile acc(this->get_data_format());
+            acc = 0.0;
+            for (int k = 0; k < input_inner_dim; ++k)
             {
-                for (int j = 0; j < rhs.getct(); ++j)
-                {
-                    acc = 0.0;
-                    for (int k = 0; k < getct(); ++k)
-                    {
-                        acc += tile_tensor[0][0][i][k].matmul(rhs.tile_tensor[0][b][k][j]);
-                    }
-                    result.tile_tensor[0][b][i][j] = acc;
-                }
+                acc += tile_tensor[0][0][i][k].matmul(rhs.tile_tensor[0][b][k][j]);
             }
-        }
+            result.tile_tensor[0][b][i][j] = acc;
+        });
         /*cout << "tt_tensor math:" << endl;
         cout << "activations:" << endl;
         dump();
@@ -1793,16 +1874,15 @@ namespace tt
 
         result.reserve_tile_tensor();
 
-        for (int b = 0; b < rhs.getz(); ++b)
-        {
-            for (int i = 0; i < getrt(); ++i)
-            {
-                for (int j = 0; j < rhs.getct(); ++j)
-                {
-                    result.tile_tensor[0][b][i][j] = tile_tensor[0][0][i][j].matmul(rhs.tile_tensor[0][b][0][j]);
-                }
-            }
-        }
+        const int num_rt = getrt();
+        const int num_ct = rhs.getct();
+        const int64_t num_tile_products = static_cast<int64_t>(rhs.getz()) * num_rt * num_ct;
+        parallel_for_matmul_work(rhs.getz() * num_rt * num_ct, num_tile_products, [&](int tile_index) {
+            const int b = tile_index / (num_rt * num_ct);
+            const int i = (tile_index / num_ct) % num_rt;
+            const int j = tile_index % num_ct;
+            result.tile_tensor[0][b][i][j] = tile_tensor[0][0][i][j].matmul(rhs.tile_tensor[0][b][0][j]);
+        });
         /*std::cout << "tt_tensor depthwise math:" << std::endl;
         std::cout << "activations:" << std::endl;
         dump();
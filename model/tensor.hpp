@@ -4,6 +4,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include "model/op.hpp"
 #include "tile.hpp"
@@ -156,6 +157,8 @@ public:
     void fill_with_data(const vector<float>& source_data);
     void apply(function<void(tt_tile&)> tile_operation);
     void apply_parallel(function<void(tt_tile&)> tile_operation);
+    // Tiles are indexed in w, z, rt, ct order, eg. to key per tile random streams
+    void apply_parallel_indexed(function<void(int, tt_tile&)> tile_operation);
     void pack_data(int tile_height = 32, int tile_width = 32);
     void clear_packed_data();
     void clear_tile_values(int tile_dim_r, int tile_dim_c);
@@ -251,4 +254,27 @@ public:
     tt_tensor slice(Dim dim, uint32_t start, uint32_t end, bool shape_only = false) const;
 };
 
+// Copy-on-write handle to a tt_tensor.
+// Borrows a shared tensor for reading and only makes a private deep copy on the first mutable access,
+// so tensors that are never modified are never copied.
+class tt_cow_tensor
+{
+public:
+    tt_cow_tensor() {};
+    explicit tt_cow_tensor(std::shared_ptr<tt_tensor> source) : tensor_ptr(std::move(source)), borrowed(true) {};
+
+    const tt_tensor &get() const;
+    tt_tensor &get_mutable();
+    // Replace the contents with a newly produced tensor, which is owned by this handle
+    void reset(tt_tensor &&tensor);
+    // Shared pointer to the current contents, callers must not modify a borrowed tensor through it
+    std::shared_ptr<tt_tensor> get_shared() const { return tensor_ptr; }
+    bool is_borrowed() const { return borrowed; }
+    bool empty() const { return tensor_ptr == nullptr; }
+
+private:
+    std::shared_ptr<tt_tensor> tensor_ptr = nullptr;
+    bool borrowed = false;
+};
+
 } // end namespace tt
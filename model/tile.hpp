@@ -119,7 +119,7 @@ class tt_tile : public tt_dram_resident
     void unpack_fp32_and_fill_tile();
     void unpack_fp16_and_fill_tile();
     void unpack_fp16b_and_fill_tile();
-    void unpack_bfp8_and_fill_tile();
+    void unpack_bfp_and_fill_tile();
 
     bool packed_data_present() const;
     void pack_data(bool truncate_bfp_mantissa = false);
@@ -150,8 +150,13 @@ class tt_tile : public tt_dram_resident
     tt_tile broadcast(Dim dim) const;
     tt_tile eltwise_binary_with_broadcast(const tt_tile &rhs, BinaryOp binary_op, Dim dim) const;
     tt_tile transpose_xy() const;
+    //! Transposes into an existing tile, avoiding the copy through a temporary (dst must not alias this tile)
+    void transpose_xy_to(tt_tile &dst) const;
     tt_tile matmul(const tt_tile &rhs) const;
     void matmul_with_partial(const tt_tile &rhs, tt_tile &result) const;
+    //! Same as matmul_with_partial, but takes rhs already transposed (rhs.transpose_xy()) so callers
+    //! reusing one rhs tile against many lhs tiles only pay for the transpose once
+    void matmul_with_partial_pretransposed(const tt_tile &rhs_transposed, tt_tile &result) const;
     tt_tile reduce(ReduceFunc reduce_func, Dim dim, float coefficient) const;
     tt_tile &operator+=(const tt_tile& rhs);
     void operator = (float num);
@@ -276,5 +281,9 @@ namespace untilize_utils {
     void convert_device_int8_representation_to_host_vectorized(uint8_t* host_storage, uint32_t tensor_size);
     void convert_device_int32_representation_to_host(uint32_t* host_storage, uint32_t tensor_size);
     void convert_device_int32_representation_to_host_vectorized(uint32_t* host_storage, uint32_t tensor_size);
+    // Decodes a packed 32x32 Bfp8/Bfp4/Bfp2 (a or b exponent) tile, starting at its header, straight into row major
+    // storage with a pitch of dst_row_pitch elements. Float32 writes fp32 bits, Float16_b/Float16 write the same halves
+    // as tt_tensor::untilize_to_flat_tensor_data_half.
+    void unpack_bfp_tile_to_row_major(const uint32_t* packed_tile, DataFormat tile_format, DataFormat dst_format, void* dst, uint32_t dst_row_pitch);
 }
 } // end namespace tt
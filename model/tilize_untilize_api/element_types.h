@@ -196,3 +196,36 @@ struct Fp16_Bfp8b : SharedExponentOutput
     }
 
 };
+
+// Input formats accepted by the sub-8-bit shared exponent converters. All of them are widened to fp32 bit patterns
+// before the shared exponent and mantissas are extracted (see narrow_bfp.h).
+enum class NarrowBfpInput { Fp32, Fp16b, Fp16 };
+
+// Converters to Bfp4/Bfp4_b (3 mantissa bits) and Bfp2/Bfp2_b (1 mantissa bit). As for the Bfp8_all converters,
+// the a/b exponent flavour is selected at runtime through conversion_to_a_format.
+template <NarrowBfpInput Input, std::uint32_t MantissaBits>
+struct NarrowBfpConverter : SharedExponentOutput
+{
+    typedef std::conditional_t<Input == NarrowBfpInput::Fp32, float, std::uint16_t> in_type;
+    typedef std::uint8_t out_type;
+    static constexpr NarrowBfpInput input = Input;
+    static constexpr std::uint32_t mantissa_bits = MantissaBits;
+    // Each 16 datum face row packs (sign + mantissa) bits per datum into whole bytes
+    static constexpr std::uint32_t face_row_bytes = 16 * (MantissaBits + 1) / 8;
+
+    static out_type convert(in_type x) {
+        log_assert(false, "This function should not get executed for sub-8-bit bfp formats. An explicit templated tensor_to_tile function is implemented in tilecopy.cpp which must be used in hw-tilize.");
+        return uint8_t(0); // To suppress compilation warning
+    }
+    static void adjust_output_pointers(unsigned char** out_mantissa, void** out_exponent, uint32_t exp_section_size) {
+        *out_exponent = *out_mantissa;
+        *(out_type**)out_mantissa += exp_section_size; // A single-byte shared exponent exist for each row of each face in the tile
+    }
+};
+
+typedef NarrowBfpConverter<NarrowBfpInput::Fp32, 3> Fp32_Bfp4_all;
+typedef NarrowBfpConverter<NarrowBfpInput::Fp16b, 3> Fp16b_Bfp4_all;
+typedef NarrowBfpConverter<NarrowBfpInput::Fp16, 3> Fp16_Bfp4_all;
+typedef NarrowBfpConverter<NarrowBfpInput::Fp32, 1> Fp32_Bfp2_all;
+typedef NarrowBfpConverter<NarrowBfpInput::Fp16b, 1> Fp16b_Bfp2_all;
+typedef NarrowBfpConverter<NarrowBfpInput::Fp16, 1> Fp16_Bfp2_all;
@@ -9,6 +9,7 @@
 #define PREFETCH(addr) _mm_prefetch((addr), _MM_HINT_T0)
 #endif 
 
+#include <cstring>
 #include <stdexcept>
 
 // This file contains the implementation of the host unpacker and untilizer.
@@ -125,72 +126,10 @@ void tt_tile::unpack_fp16b_and_fill_tile(){
     }
 }
 
-void tt_tile::unpack_bfp8_and_fill_tile(){
-    // Strips tile headers and "converts" BFP8 and BFP8_b to FP32. Then fills tile with the data.
-    int data_index;
-    int tile_r;
-    int tile_c;
-    const vector<uint32_t> mask_vec = {0xff, 0xff00, 0xff0000, 0xff000000};
-    const vector<uint32_t> shift_vec = {0, 8, 16, 24};
-    const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_vec.data()));
-    const __m128i shift = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shift_vec.data()));
-    __m256i rebias_offset = _mm256_setzero_si256();
-    if(is_shared_exp_a_format()) rebias_offset = _mm256_set1_epi32(-112); // This rebias offset must be added if we are working with BFP8 format.
-    uint32_t exp_word, sub_word_index;
-
-    for(int tr=0;tr<2;++tr)
-    {
-        for(int tc=0;tc<2;++tc)
-        {
-            for(int i=0;i<16;++i)
-            {
-                tile_r = tr * 16 + i;
-                for(int j=0;j<16; j += 8)
-                {
-                    tile_c = tc * 16 + j;
-                    data_index = tr*128 + tc*64 + i*4 + j/4; // Each uint32_t contains 4 BFP8 values. Divide data index by 4.
-                    exp_word = packed_data.at(4 + (data_index >> 4)); // Extract the uint32_t value that stores the shared exponent for this set of data. Each 32 bit word is shared amongst 64 datums
-                    
-                    sub_word_index = (data_index >> 2) & 0x3; // Extract the byte in which the shared exponent is stored. Each byte is shared amongst 16 datums.
-                    __m256i exp_vector = _mm256_set1_epi32(tt_tile::get_byte(exp_word, sub_word_index)); // Replicate exp scalar in a vector
-                    // Take 2 uint32_t values. These are 8 BFP8 values
-                    __m128i first = _mm_set1_epi32(packed_data.at(20 + data_index)); // Replicate first uint32_t 4 times (one for each BFP8 value)
-                    __m128i second = _mm_set1_epi32(packed_data.at(20 + data_index + 1)); //  Replicate second uint32_t 4 times
-                    first = _mm_srlv_epi32(_mm_and_si128(first, mask), shift); // Extract each BFP8 from the first uint32_t
-                    second = _mm_srlv_epi32(_mm_and_si128(second, mask), shift); // Extract each BFP8 from the second uint32_t
-                    __m256i combined = _mm256_set_m128i(second, first); // Concatenate 2 128 vectors to 1 256
-                    // Extract sign and mantissa (expo extracted above)
-                    __m256i sign = _mm256_srl_epi32(combined,  _mm_set_epi64x(0, 7));
-                    __m256i man = _mm256_and_si256(combined, _mm256_set1_epi32(0x7f));
-                    // Initialize shift amount per datum to 0. This is incremented below.
-                    __m256i shift_cnt = _mm256_setzero_si256();
-                    __m256i select_mask = _mm256_cmpeq_epi32(man, shift_cnt); // This mask is used to set mantissa values to 0, if they start at 0.
-                    __m256i man_shifted = man; // Initialize updated mantissa
-                    for(int shift_val = 0; shift_val < 7; shift_val++){
-                        // Shift each mantissa and update the corresponding shift_cnt until the 6th bit of the 8 bit data is set.
-                        __m256i shift_mask = _mm256_or_si256(_mm256_cmpgt_epi32(man_shifted, _mm256_set1_epi32(0x40)), _mm256_cmpeq_epi32(man_shifted, _mm256_set1_epi32(0x40))); // If the 6th bit is set, propagate the current mantissa value. Else take the left shifted value
-                        man_shifted = _mm256_blendv_epi8(_mm256_sll_epi32(man_shifted, _mm_set_epi64x(0, 1)), man_shifted, shift_mask);
-                        shift_cnt = _mm256_blendv_epi8(_mm256_set1_epi32(shift_val + 1), shift_cnt, shift_mask); 
-                    }
-                    man_shifted = _mm256_and_si256(_mm256_sll_epi32(man_shifted, _mm_set_epi64x(0, 1)), _mm256_set1_epi32(0x7f)); // One more shift to clear 6th bit
-                    man = _mm256_blendv_epi8(man_shifted, man, select_mask); // Choose new mantissa or keep old mantissa based on 0 initial condition.
-                    // Assert if the exponent and corresponding mantissa for a datum are non-zero and the subtraction bias (shift_cnt) for that data is greater than the exponent value
-                    log_assert(skip_bfp8_check ||
-                                (!(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(exp_vector, _mm256_setzero_si256()))) & _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(shift_cnt, exp_vector))) & !_mm256_movemask_ps(_mm256_castsi256_ps(select_mask)))),
-                                "Device returned incorrect data for Bfp8 formats: The Shift Count for a non-zero exponent is greater than the exponent value.");
-                    exp_vector = _mm256_blendv_epi8(_mm256_sub_epi32(exp_vector, _mm256_add_epi32(rebias_offset, shift_cnt)),  _mm256_setzero_si256(), select_mask); // Choose new (rebiased exponent) or keep previous exponent based on mantissa intiial condition
-                    
-                    
-                    sign = _mm256_sll_epi32(sign, _mm_set_epi64x(0, 31)); // Shift sign
-                    exp_vector = _mm256_sll_epi32(exp_vector, _mm_set_epi64x(0, 23)); // Shift exp
-                    man = _mm256_sll_epi32(man, _mm_set_epi64x(0, 16)); // Shift mantissa
-                    man = _mm256_or_si256(sign, _mm256_or_si256(exp_vector, man)); // Store final value in mantissa register and save in tile memory
-                    _mm256_storeu_ps(t[tile_r] + tile_c,  _mm256_castsi256_ps(man));
-                }
-            
-            }
-        }
-    }
+void tt_tile::unpack_bfp_and_fill_tile(){
+    // Strips tile headers and "converts" BFP8/4/2 and BFP8/4/2_b to FP32. Then fills tile with the data.
+    log_assert(packed_data.size() * sizeof(uint32_t) >= size_bytes(true), "Packed data is smaller than a {} tile", data_format);
+    tt::untilize_utils::unpack_bfp_tile_to_row_major(packed_data.data(), data_format, DataFormat::Float32, &t[0][0], tt::constants::TILE_WIDTH);
 }
 
 void tt_tile::unpack_raw32_and_fill_tile(){
@@ -227,7 +166,7 @@ void tt_tile::unpack_raw16_and_fill_tile(){
 void tt_tile::packed_data_to_tile() {
     #ifdef __x86_64__
     // If using x86, vector based unpack functions can be used.
-    vector<DataFormat> formats_supporting_fast_unpack = {DataFormat::Float32, DataFormat::Float16_b, DataFormat::Float16, DataFormat::Bfp8, DataFormat::Bfp8_b, DataFormat::RawUInt32, DataFormat::RawUInt16};
+    vector<DataFormat> formats_supporting_fast_unpack = {DataFormat::Float32, DataFormat::Float16_b, DataFormat::Float16, DataFormat::Bfp8, DataFormat::Bfp8_b, DataFormat::Bfp4, DataFormat::Bfp4_b, DataFormat::Bfp2, DataFormat::Bfp2_b, DataFormat::RawUInt32, DataFormat::RawUInt16};
     if(tile_height == 32 and tile_width == 32 and std::find(formats_supporting_fast_unpack.begin(), formats_supporting_fast_unpack.end(), data_format) != formats_supporting_fast_unpack.end() and !force_slow_untilize){
         // TODO: Add fast unpack support for arbitrary tile sizes - AS
         log_trace(tt::LogIO, "Using Fast Unpack");
@@ -249,7 +188,7 @@ void tt_tile::packed_data_to_tile() {
             unpack_fp16_and_fill_tile();
         }
         else{
-            unpack_bfp8_and_fill_tile();
+            unpack_bfp_and_fill_tile();
         }
     }
     
@@ -403,6 +342,113 @@ namespace untilize_utils {
             _mm256_storeu_si256(reinterpret_cast<__m256i*>(host_storage + idx), _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(input_data), _mm256_castsi256_ps(negative_input), _mm256_castsi256_ps(is_negative))));
         } 
     }
+
+    // Widens one 16 datum face row of sign|mantissa bfp datums (datum 0 in the least significant bits) to two registers.
+    template <uint32_t MantissaBits>
+    inline void load_bfp_face_row(const uint8_t* in, __m256i& lo, __m256i& hi) {
+        if constexpr (MantissaBits == 7) {
+            lo = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in)));
+            hi = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + 8)));
+        } else if constexpr (MantissaBits == 3) {
+            uint32_t words[2];
+            std::memcpy(words, in, sizeof(words));
+            const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+            lo = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(words[0]), shifts), _mm256_set1_epi32(0xf));
+            hi = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(words[1]), shifts), _mm256_set1_epi32(0xf));
+        } else {
+            uint32_t word;
+            std::memcpy(&word, in, sizeof(word));
+            const __m256i shifts = _mm256_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14);
+            lo = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(word), shifts), _mm256_set1_epi32(0x3));
+            hi = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(word >> 16), shifts), _mm256_set1_epi32(0x3));
+        }
+    }
+
+    // Converts 8 datums sharing an exponent to fp32 bits, matching tt_tile::get_indexed_num. The mantissa is normalized
+    // through an int -> float conversion: its exponent field gives the leading one and its mantissa field is the
+    // normalized mantissa. Returns a movemask of datums whose shift count underflows a non-zero shared exponent.
+    template <uint32_t MantissaBits>
+    inline __m256i bfp_datums_to_fp32(__m256i datums, __m256i exp, __m256i rebias, int& invalid_mask) {
+        const __m256i man = _mm256_and_si256(datums, _mm256_set1_epi32((1 << MantissaBits) - 1));
+        const __m256i sign = _mm256_slli_epi32(_mm256_srli_epi32(datums, MantissaBits), 31);
+        const __m256i normalized = _mm256_castps_si256(_mm256_cvtepi32_ps(man));
+        // shift_cnt = (MantissaBits - 1) - floor(log2(man))
+        const __m256i shift_cnt = _mm256_sub_epi32(_mm256_set1_epi32(MantissaBits - 1 + 127), _mm256_srli_epi32(normalized, 23));
+        const __m256i is_zero = _mm256_cmpeq_epi32(man, _mm256_setzero_si256());
+        invalid_mask |= _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(is_zero,
+            _mm256_and_si256(_mm256_cmpgt_epi32(exp, _mm256_setzero_si256()), _mm256_cmpgt_epi32(shift_cnt, exp)))));
+        const __m256i out_exp = _mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(exp, shift_cnt), rebias), 23);
+        const __m256i exp_man = _mm256_or_si256(out_exp, _mm256_and_si256(normalized, _mm256_set1_epi32(0x7fffff)));
+        return _mm256_or_si256(sign, _mm256_andnot_si256(is_zero, exp_man));
+    }
+
+    // Same conversion as vectorized_copy_half_to_flat_vector_u16 (conv_u32_to_u16), result in the low 16 bits.
+    inline __m256i fp32_to_fp16_bits(__m256i in) {
+        const __m256i mantissa_mask = _mm256_set1_epi32(0x007fffff);
+        __m256i m = _mm256_and_si256(in, mantissa_mask);
+        __m256i e = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x7f800000)), 23), _mm256_set1_epi32(127));
+        const __m256i s = _mm256_srli_epi32(_mm256_and_si256(in, _mm256_set1_epi32(0x80000000)), 16);
+        __m256i cmp_mask = _mm256_cmpgt_epi32(e, _mm256_set1_epi32(-15));
+        e = _mm256_blendv_epi8(_mm256_set1_epi32(-15), e, cmp_mask);
+        m = _mm256_and_si256(m, cmp_mask);
+        cmp_mask = _mm256_cmpgt_epi32(e, _mm256_set1_epi32(16));
+        e = _mm256_blendv_epi8(e, _mm256_set1_epi32(16), cmp_mask);
+        m = _mm256_srli_epi32(_mm256_blendv_epi8(m, mantissa_mask, cmp_mask), 13);
+        e = _mm256_slli_epi32(_mm256_add_epi32(e, _mm256_set1_epi32(15)), 10);
+        return _mm256_or_si256(_mm256_or_si256(s, e), m);
+    }
+
+    template <uint32_t MantissaBits>
+    void unpack_bfp_tile_to_row_major(const uint32_t* packed_tile, bool is_exp_a, DataFormat dst_format, void* dst, uint32_t dst_row_pitch) {
+        constexpr uint32_t face_row_bytes = 16 * (MantissaBits + 1) / 8;
+        const uint8_t* exps = reinterpret_cast<const uint8_t*>(packed_tile + 4);
+        const uint8_t* mantissas = reinterpret_cast<const uint8_t*>(packed_tile + 20);
+        const __m256i rebias = _mm256_set1_epi32(is_exp_a ? 112 : 0);
+        int invalid_mask = 0;
+        for (uint32_t face = 0; face < 4; face++) {
+            for (uint32_t i = 0; i < 16; i++) {
+                const uint32_t face_row = face * 16 + i;
+                const size_t dst_index = size_t((face >> 1) * 16 + i) * dst_row_pitch + (face & 1) * 16;
+                const __m256i exp = _mm256_set1_epi32(exps[face_row]);
+                __m256i lo, hi;
+                load_bfp_face_row<MantissaBits>(mantissas + face_row * face_row_bytes, lo, hi);
+                lo = bfp_datums_to_fp32<MantissaBits>(lo, exp, rebias, invalid_mask);
+                hi = bfp_datums_to_fp32<MantissaBits>(hi, exp, rebias, invalid_mask);
+                if (dst_format == DataFormat::Float32) {
+                    uint32_t* out = static_cast<uint32_t*>(dst) + dst_index;
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), lo);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 8), hi);
+                    continue;
+                }
+                if (dst_format == DataFormat::Float16_b) {
+                    lo = _mm256_srli_epi32(lo, 16);
+                    hi = _mm256_srli_epi32(hi, 16);
+                } else {
+                    lo = fp32_to_fp16_bits(lo);
+                    hi = fp32_to_fp16_bits(hi);
+                }
+                const __m256i halves = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<uint16_t*>(dst) + dst_index), halves);
+            }
+        }
+        log_assert(tt_tile::skip_bfp8_check or !invalid_mask,
+            "Device returned incorrect data for Bfp formats: The Shift Count for a non-zero exponent is greater than the exponent value.");
+    }
+
+    void unpack_bfp_tile_to_row_major(const uint32_t* packed_tile, DataFormat tile_format, DataFormat dst_format, void* dst, uint32_t dst_row_pitch) {
+        log_assert(dst_format == DataFormat::Float32 or dst_format == DataFormat::Float16_b or dst_format == DataFormat::Float16,
+            "Unsupported destination format {} for bfp untilize", dst_format);
+        const bool is_exp_a = tile_format == DataFormat::Bfp8 or tile_format == DataFormat::Bfp4 or tile_format == DataFormat::Bfp2;
+        if (tile_format == DataFormat::Bfp8 or tile_format == DataFormat::Bfp8_b) {
+            unpack_bfp_tile_to_row_major<7>(packed_tile, is_exp_a, dst_format, dst, dst_row_pitch);
+        } else if (tile_format == DataFormat::Bfp4 or tile_format == DataFormat::Bfp4_b) {
+            unpack_bfp_tile_to_row_major<3>(packed_tile, is_exp_a, dst_format, dst, dst_row_pitch);
+        } else if (tile_format == DataFormat::Bfp2 or tile_format == DataFormat::Bfp2_b) {
+            unpack_bfp_tile_to_row_major<1>(packed_tile, is_exp_a, dst_format, dst, dst_row_pitch);
+        } else {
+            log_fatal("Unsupported tile format {} for bfp untilize", tile_format);
+        }
+    }
 }
 }
 
@@ -831,6 +877,26 @@ namespace untilize_utils {
         // Vectorized converter to go from sign|magnitude int8 representation to 2's complement.
         convert_device_int32_representation_to_host(host_storage, tensor_size);
     }
+
+    void unpack_bfp_tile_to_row_major(const uint32_t* packed_tile, DataFormat tile_format, DataFormat dst_format, void* dst, uint32_t dst_row_pitch) {
+        // Scalar fallback: decode through a tt_tile and copy its rows out.
+        tt_tile tile(tile_format);
+        tile.packed_data.assign(packed_tile, packed_tile + tile.size_bytes(true) / sizeof(uint32_t));
+        tile.packed_data_to_tile();
+        for (uint32_t row = 0; row < tt::constants::TILE_HEIGHT; row++) {
+            for (uint32_t col = 0; col < tt::constants::TILE_WIDTH; col++) {
+                const uint32_t bits = tt_tile::float_to_dword(tile.t[row][col]);
+                const size_t index = size_t(row) * dst_row_pitch + col;
+                if (dst_format == DataFormat::Float32) {
+                    static_cast<uint32_t*>(dst)[index] = bits;
+                } else if (dst_format == DataFormat::Float16_b) {
+                    static_cast<uint16_t*>(dst)[index] = tile.conv_u32_to_u16b(bits);
+                } else {
+                    static_cast<uint16_t*>(dst)[index] = tile.conv_u32_to_u16(bits);
+                }
+            }
+        }
+    }
 }
 }
 
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include <immintrin.h>
+
+#include "element_types.h"
+
+// Shared AVX2 kernels used by tilecopy.cpp and tilecopy_for_conv.cpp to tilize into Bfp4/Bfp4_b and Bfp2/Bfp2_b.
+// A face row of 16 datums is widened to two registers of fp32 bit patterns, the shared exponent is the max exponent
+// in the row, and each datum is packed as (sign << mantissa_bits) | mantissa with datum 0 in the least significant
+// bits. Rounding and saturation match conv_u32_to_bfp in model/tile.cpp bit for bit.
+namespace narrow_bfp {
+
+inline __m256i fp16b_to_fp32_bits(__m128i in) {
+    return _mm256_slli_epi32(_mm256_cvtepu16_epi32(in), 16);
+}
+
+// The build does not enable F16C, so fp16 is widened with integer ops: the exponent/mantissa field is moved into
+// fp32 position and rebiased through a multiply by 2^112, which also normalizes fp16 denormals. Inf/NaN keep an
+// all-ones exponent.
+inline __m256i fp16_to_fp32_bits(__m128i in) {
+    const __m256i h = _mm256_cvtepu16_epi32(in);
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+    const __m256i exp_man = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+    __m256i result = _mm256_castps_si256(_mm256_mul_ps(_mm256_castsi256_ps(exp_man), _mm256_castsi256_ps(_mm256_set1_epi32(0x77800000))));
+    const __m256i is_inf_nan = _mm256_cmpgt_epi32(exp_man, _mm256_set1_epi32(0x0f7fffff));
+    result = _mm256_or_si256(result, _mm256_and_si256(is_inf_nan, _mm256_set1_epi32(0x7f800000)));
+    return _mm256_or_si256(result, sign);
+}
+
+template <class Converter>
+inline void load_face_row(const typename Converter::in_type* in, __m256i& lo, __m256i& hi) {
+    if constexpr (Converter::input == NarrowBfpInput::Fp32) {
+        lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 8));
+    } else {
+        const __m256i row = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        if constexpr (Converter::input == NarrowBfpInput::Fp16b) {
+            lo = fp16b_to_fp32_bits(_mm256_castsi256_si128(row));
+            hi = fp16b_to_fp32_bits(_mm256_extracti128_si256(row, 1));
+        } else {
+            lo = fp16_to_fp32_bits(_mm256_castsi256_si128(row));
+            hi = fp16_to_fp32_bits(_mm256_extracti128_si256(row, 1));
+        }
+    }
+}
+
+template <std::uint32_t MantissaBits>
+inline __m256i to_datums(__m256i x, __m256i exp, __m256i man, __m256i max_exp, bool truncate_bfp_mantissa) {
+    constexpr int shift = 24 - MantissaBits;
+    man = _mm256_srlv_epi32(_mm256_or_si256(man, _mm256_set1_epi32(0x800000)), _mm256_sub_epi32(max_exp, exp));
+    if (truncate_bfp_mantissa) {
+        man = _mm256_srli_epi32(man, shift);
+    } else {
+        man = _mm256_srli_epi32(_mm256_add_epi32(man, _mm256_set1_epi32(1 << (shift - 1))), shift);
+        man = _mm256_min_epu32(man, _mm256_set1_epi32((1 << MantissaBits) - 1));
+    }
+    // Zeros (of either sign) and datums which lose all mantissa bits are encoded as +0
+    const __m256i is_zero = _mm256_cmpeq_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7fffffff)), _mm256_setzero_si256());
+    man = _mm256_andnot_si256(is_zero, man);
+    const __m256i sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(man, _mm256_setzero_si256()), _mm256_srli_epi32(x, 31));
+    return _mm256_or_si256(man, _mm256_slli_epi32(sign, MantissaBits));
+}
+
+// Packs one face row, writing face_row_bytes of datums to out and returning the shared exponent.
+template <std::uint32_t MantissaBits>
+inline std::uint8_t pack_face_row(__m256i lo, __m256i hi, bool conversion_to_a_format, bool truncate_bfp_mantissa, std::uint8_t* out) {
+    static_assert(MantissaBits == 3 or MantissaBits == 1, "Only Bfp4 and Bfp2 rows are packed here");
+    const __m256i exp_mask = _mm256_set1_epi32(0xff);
+    const __m256i man_mask = _mm256_set1_epi32(0x7fffff);
+    __m256i exp_lo = _mm256_and_si256(_mm256_srli_epi32(lo, 23), exp_mask);
+    __m256i exp_hi = _mm256_and_si256(_mm256_srli_epi32(hi, 23), exp_mask);
+    __m256i man_lo = _mm256_and_si256(lo, man_mask);
+    __m256i man_hi = _mm256_and_si256(hi, man_mask);
+
+    if (conversion_to_a_format) {
+        // Rebias to the 5 bit exponent, saturating to the largest magnitude or flushing to zero
+        const __m256i bias = _mm256_set1_epi32(112);
+        const __m256i max_a_exp = _mm256_set1_epi32(31);
+        exp_lo = _mm256_sub_epi32(exp_lo, bias);
+        exp_hi = _mm256_sub_epi32(exp_hi, bias);
+        man_lo = _mm256_or_si256(man_lo, _mm256_and_si256(_mm256_cmpgt_epi32(exp_lo, max_a_exp), man_mask));
+        man_hi = _mm256_or_si256(man_hi, _mm256_and_si256(_mm256_cmpgt_epi32(exp_hi, max_a_exp), man_mask));
+        man_lo = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), exp_lo), man_lo);
+        man_hi = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), exp_hi), man_hi);
+        exp_lo = _mm256_min_epi32(_mm256_max_epi32(exp_lo, _mm256_setzero_si256()), max_a_exp);
+        exp_hi = _mm256_min_epi32(_mm256_max_epi32(exp_hi, _mm256_setzero_si256()), max_a_exp);
+    }
+
+    __m256i max_exp = _mm256_max_epi32(exp_lo, exp_hi);
+    max_exp = _mm256_max_epi32(max_exp, _mm256_permute2x128_si256(max_exp, max_exp, 1));
+    max_exp = _mm256_max_epi32(max_exp, _mm256_shuffle_epi32(max_exp, _MM_SHUFFLE(1, 0, 3, 2)));
+    max_exp = _mm256_max_epi32(max_exp, _mm256_shuffle_epi32(max_exp, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    const __m256i datums_lo = to_datums<MantissaBits>(lo, exp_lo, man_lo, max_exp, truncate_bfp_mantissa);
+    const __m256i datums_hi = to_datums<MantissaBits>(hi, exp_hi, man_hi, max_exp, truncate_bfp_mantissa);
+
+    // Narrow the 16 datums to one byte each, in order
+    const __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(datums_lo, datums_hi), _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+    if constexpr (MantissaBits == 1) {
+        // Merge pairs of 2 bit datums into nibbles
+        bytes = _mm_or_si128(_mm_and_si128(bytes, _mm_set1_epi16(0x03)), _mm_and_si128(_mm_srli_epi16(bytes, 6), _mm_set1_epi16(0x0c)));
+        bytes = _mm_packus_epi16(bytes, _mm_setzero_si128());
+    }
+    // Merge pairs of nibbles into bytes
+    bytes = _mm_or_si128(_mm_and_si128(bytes, _mm_set1_epi16(0x0f)), _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi16(0xf0)));
+    bytes = _mm_packus_epi16(bytes, _mm_setzero_si128());
+    if constexpr (MantissaBits == 3) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), bytes);
+    } else {
+        const std::uint32_t packed = _mm_cvtsi128_si32(bytes);
+        std::memcpy(out, &packed, sizeof(packed));
+    }
+    return static_cast<std::uint8_t>(_mm256_cvtsi256_si32(max_exp));
+}
+
+// Linearizes a single face into a sub-8-bit bfp format. With DataShuffling, rows at or past num_rows_with_data are
+// left untouched (they were zero filled up front), matching the other conv tilecopy functions.
+template <class Converter, bool DataShuffling>
+inline std::uint8_t* tensor_to_face(const typename Converter::in_type* in, std::uint8_t* out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa) {
+    const auto row_stride = tensor_row_pitch / sizeof(*in);
+    for (std::uint32_t j = 0; j < quad_height; j++) {
+        if constexpr (DataShuffling) {
+            if (global_face_offset + j >= num_rows_with_data) break;
+        }
+        __m256i lo, hi;
+        load_face_row<Converter>(in, lo, hi);
+        (*(uint8_t**)out_exp)[j] = pack_face_row<Converter::mantissa_bits>(lo, hi, conversion_to_a_format, truncate_bfp_mantissa, out + j * Converter::face_row_bytes);
+        in += row_stride;
+    }
+    *(uint8_t**)out_exp += quad_height;
+    return out + quad_height * Converter::face_row_bytes;
+}
+
+} // namespace narrow_bfp
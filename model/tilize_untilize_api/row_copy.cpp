@@ -216,4 +216,10 @@ template void row_copy<32, Fp16_Bfp8>(const std::uint16_t* NO_PTR_ALIAS in, std:
 template void row_copy<32, Fp16_Bfp8b>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
 template void row_copy<32, Fp16_Fp32>(const std::uint16_t* NO_PTR_ALIAS in, float* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
 template void row_copy<32, Int8_Int8>(const std::int8_t*  NO_PTR_ALIAS in, std::int8_t*  NO_PTR_ALIAS out, uint32_t copy_size_bytes);
-template void row_copy<32, Int8_Bfp8>(const std::uint8_t*  NO_PTR_ALIAS in, std::uint8_t*  NO_PTR_ALIAS out, uint32_t copy_size_bytes);
\ No newline at end of file
+template void row_copy<32, Int8_Bfp8>(const std::uint8_t*  NO_PTR_ALIAS in, std::uint8_t*  NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp32_Bfp4_all>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp16b_Bfp4_all>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp16_Bfp4_all>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp32_Bfp2_all>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp16b_Bfp2_all>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
+template void row_copy<32, Fp16_Bfp2_all>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, uint32_t copy_size_bytes);
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 
 #include "tilecopy.h"
+#include "narrow_bfp.h"
 
 // Asserts that p is has (at least) a given alignment, must be a power of 2 and you must use the returned pointer.
 #define ASSUME_ALIGNED(p, alignment) static_cast<decltype(p)>(__builtin_assume_aligned((p), (alignment)))
@@ -1374,6 +1375,43 @@ std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp8b, false>(const std::uint16_t* NO_
     *(uint8_t**)out_exp += quad_height;
     return out;
 }
+
+// Sub-8-bit bfp outputs share one AVX2 row packer, see narrow_bfp.h
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp32_Bfp4_all, false>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp32_Bfp4_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16b_Bfp4_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16b_Bfp4_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp4_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16_Bfp4_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp32_Bfp2_all, false>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp32_Bfp2_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16b_Bfp2_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16b_Bfp2_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp2_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16_Bfp2_all, false>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
 } // anonymous namespace
 
 // Copy 4 16x16 tiles within a row-major tensor face to a linear output.
@@ -1445,6 +1483,12 @@ template void tensor_to_quad_tiles<16, 16, Fp16_Fp16b, false>(const std::uint16_
 template void tensor_to_quad_tiles<16, 16, Fp16_Fp32, false>(const std::uint16_t* NO_PTR_ALIAS in, float* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 template void tensor_to_quad_tiles<16, 16, Int8_Int8, false>(const int8_t* NO_PTR_ALIAS in, int8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 template void tensor_to_quad_tiles<16, 16, Int8_Bfp8, false>(const uint8_t* NO_PTR_ALIAS in, uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp32_Bfp4_all, false>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16b_Bfp4_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16_Bfp4_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp32_Bfp2_all, false>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16b_Bfp2_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16_Bfp2_all, false>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 
 
 /////////////////// The following are for pushing raw data (masks) to DRAM ///////////////////
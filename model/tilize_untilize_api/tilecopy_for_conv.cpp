@@ -10,6 +10,7 @@
 #include <thread>
 #include <mutex>
 #include "tilecopy.h"
+#include "narrow_bfp.h"
 #include "device/cpuset_lib.hpp"
 // Asserts that p is has (at least) a given alignment, must be a power of 2 and you must use the returned pointer.
 #define ASSUME_ALIGNED(p, alignment) static_cast<decltype(p)>(__builtin_assume_aligned((p), (alignment)))
@@ -1147,6 +1148,43 @@ std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp8b, true>(const std::uint16_t* NO_P
     *(uint8_t**)out_exp += quad_height;
     return out + quad_height*16;
 }
+
+// Sub-8-bit bfp outputs share one AVX2 row packer, see narrow_bfp.h
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp32_Bfp4_all, true>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp32_Bfp4_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16b_Bfp4_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16b_Bfp4_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp4_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16_Bfp4_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp32_Bfp2_all, true>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp32_Bfp2_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16b_Bfp2_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16b_Bfp2_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
+
+template <>
+std::uint8_t* tensor_to_tile<16, 16, Fp16_Bfp2_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, void** out_exp, bool conversion_to_a_format, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, bool truncate_bfp_mantissa)
+{
+    return narrow_bfp::tensor_to_face<Fp16_Bfp2_all, true>(in, out, tensor_row_pitch, out_exp, conversion_to_a_format, num_rows_with_data, global_face_offset, quad_height, truncate_bfp_mantissa);
+}
 } // anonymous namespace
 
 tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride1(const tt::tt_PytorchTensorDesc &py_tensor_desc, aligned_vector<std::uint32_t>& shuffled_data, uint32_t num_rows, uint32_t input_face_shape, uint32_t shuffled_row_size, TT_ThreadPool& thread_pool, const std::vector<uint32_t>& output_idx) {
@@ -1161,7 +1199,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride1(const tt::tt_PytorchTenso
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape;
@@ -1203,7 +1241,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride2(const tt::tt_PytorchTenso
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape;
@@ -1253,7 +1291,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride4(const tt::tt_PytorchTenso
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         for(int w_idx = 0; w_idx < py_tensor_desc.shape[0]; w_idx++) {
@@ -1291,7 +1329,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride1(const tt::tt_PytorchTenso
 
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         for(int idx = 0; idx < py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape; idx += 16) {
@@ -1348,7 +1386,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride2(const tt::tt_PytorchTenso
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape;
@@ -1415,7 +1453,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride4(const tt::tt_PytorchTenso
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * input_channel_count * input_face_shape;
@@ -1462,7 +1500,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride1_scalar_fallback(const tt:
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape;
@@ -1519,7 +1557,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride2_scalar_fallback(const tt:
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t num_faces = py_tensor_desc.shape[0] * py_tensor_desc.shape[1];
@@ -1575,7 +1613,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp32_stride4_scalar_fallback(const tt:
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         for(int w_idx = 0; w_idx < py_tensor_desc.shape[0]; w_idx++) {
@@ -1619,7 +1657,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride1_scalar_fallback(const tt:
 
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         for(int idx = 0; idx < py_tensor_desc.shape[0] * py_tensor_desc.shape[1] * input_face_shape;) {
@@ -1687,7 +1725,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride2_scalar_fallback(const tt:
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
 
@@ -1760,7 +1798,7 @@ tt::tt_PytorchTensorDesc shuffle_for_conv_fp16_stride4_scalar_fallback(const tt:
                 }
             });
         }
-        while(thread_pool.wait() || thread_pool.num_free != num_threads) {continue;}
+        thread_pool.wait_idle();
     }
     else{
         uint32_t idx_ub = py_tensor_desc.shape[0] * input_channel_count * input_face_shape;
@@ -1854,4 +1892,10 @@ template void tensor_to_quad_tiles<16, 16, Fp16_Fp16b, true>(const std::uint16_t
 template void tensor_to_quad_tiles<16, 16, Fp16_Fp32, true>(const std::uint16_t* NO_PTR_ALIAS in, float* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 template void tensor_to_quad_tiles<16, 16, Int8_Int8, true>(const int8_t* NO_PTR_ALIAS in, int8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 template void tensor_to_quad_tiles<16, 16, Int8_Bfp8, true>(const uint8_t* NO_PTR_ALIAS in, uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp32_Bfp4_all, true>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16b_Bfp4_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16_Bfp4_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp32_Bfp2_all, true>(const float* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16b_Bfp2_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
+template void tensor_to_quad_tiles<16, 16, Fp16_Bfp2_all, true>(const std::uint16_t* NO_PTR_ALIAS in, std::uint8_t* NO_PTR_ALIAS out, std::uint_fast32_t tensor_row_pitch, bool conversion_from_b_to_a_format, std::vector<bool>& fill_data_for_faces, int num_rows_with_data, uint32_t global_face_offset, uint32_t quad_height, uint32_t num_faces_y, uint32_t num_faces_x, uint8_t* exp_host, bool truncate_bfp_mantissa);
 
@@ -351,9 +351,27 @@ std::size_t DeviceTilizer<tilizer_backend>::format_size(tt::DataFormat f)
     }
 }
 
+// Bytes taken by num_elements datums of format f, excluding shared exponents. Sub-8-bit bfp formats pack several
+// sign + mantissa datums into each byte.
+template<Tilizer tilizer_backend>
+std::size_t DeviceTilizer<tilizer_backend>::data_size(tt::DataFormat f, std::size_t num_elements)
+{
+    switch (f)
+    {
+        case tt::DataFormat::Bfp4:
+        case tt::DataFormat::Bfp4_b: return num_elements / 2;
+
+        case tt::DataFormat::Bfp2:
+        case tt::DataFormat::Bfp2_b: return num_elements / 4;
+
+        default: return num_elements * format_size(f);
+    }
+}
+
 template<Tilizer tilizer_backend>
 std::size_t DeviceTilizer<tilizer_backend>::get_shared_exponent_size(tt::DataFormat f) {
-    if (f == tt::DataFormat::Bfp8 || f == tt::DataFormat::Bfp8_b) {
+    if (f == tt::DataFormat::Bfp8 || f == tt::DataFormat::Bfp8_b || f == tt::DataFormat::Bfp4 || f == tt::DataFormat::Bfp4_b ||
+        f == tt::DataFormat::Bfp2 || f == tt::DataFormat::Bfp2_b) {
         // Pack exponents based on the tile height and width
         return tt::io::align_up(quad_height * quad_width / tile_width, 16); // One exp for each row in a single face
     } else {
@@ -529,7 +547,7 @@ void DeviceTilizer<tilizer_backend>::init_from_grids(const std::array<std::uint3
         og.layout = g.layout;
         og.write_header = g.layout != IO_LAYOUT::Flat;
         og.quad_num_elements = quad_width * quad_height;
-        og.quad_data_size = og.quad_num_elements * format_size(g.bufq_target_format) + get_shared_exponent_size(g.bufq_target_format);
+        og.quad_data_size = data_size(g.bufq_target_format, og.quad_num_elements) + get_shared_exponent_size(g.bufq_target_format);
         og.quad_size = og.quad_data_size + quad_header_size;
 
         uint32_t aligned_quad_size = tt::io::align_up(og.quad_size, tt::io::tile_alignment_bytes);
@@ -538,7 +556,7 @@ void DeviceTilizer<tilizer_backend>::init_from_grids(const std::array<std::uint3
         og.dram_wr_address_update = og.quad_size;
         
         if(!og.write_header) {
-            log_assert(!(g.bufq_target_format == tt::DataFormat::Bfp8 or g.bufq_target_format == tt::DataFormat::Bfp8_b), "Bfp8/Bfp8_b flat tensor not supported!");
+            log_assert(get_shared_exponent_size(g.bufq_target_format) == 0, "Bfp flat tensor not supported!");
             og.dram_wr_address_update = quad_width * format_size(g.bufq_target_format) * g.ublock_ct * g.mblock_n;
             og.quad_size = og.quad_data_size;
         }
@@ -779,7 +797,7 @@ void DeviceTilizer<tilizer_backend>::init_from_tensors(const std::vector<tt_Pyto
 
             og.tensor_row_pitch = t.strides[2];
             og.tensor_face_pitch = t.strides[1];
-            og.block_size = block_width * block_height * block_depth * format_size(g.bufq_target_format);
+            og.block_size = data_size(g.bufq_target_format, block_width * block_height * block_depth);
             og.block_size += (get_shared_exponent_size(g.bufq_target_format)) * quads_per_block;
             
             if (og.write_header) {
@@ -867,6 +885,42 @@ void DeviceTilizer<tilizer_backend>::init_from_tensors(const std::vector<tt_Pyto
                 // The tilize function is identical for int8 -> both bfp8 formats
                 og.data_conversion = conversion::int8_bfp8;
                 init_data_copy_function<Int8_Bfp8>(og.layout);
+            } else if (t.format == tt::DataFormat::Float32 && g.bufq_target_format == tt::DataFormat::Bfp4) {
+                og.data_conversion = conversion::fp32_bfp4;
+                init_data_copy_function<Fp32_Bfp4_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float32 && g.bufq_target_format == tt::DataFormat::Bfp4_b) {
+                og.data_conversion = conversion::fp32_bfp4b;
+                init_data_copy_function<Fp32_Bfp4_all>(og.layout);
+            } else if (t.format == tt::DataFormat::Float32 && g.bufq_target_format == tt::DataFormat::Bfp2) {
+                og.data_conversion = conversion::fp32_bfp2;
+                init_data_copy_function<Fp32_Bfp2_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float32 && g.bufq_target_format == tt::DataFormat::Bfp2_b) {
+                og.data_conversion = conversion::fp32_bfp2b;
+                init_data_copy_function<Fp32_Bfp2_all>(og.layout);
+            } else if (t.format == tt::DataFormat::Float16_b && g.bufq_target_format == tt::DataFormat::Bfp4) {
+                og.data_conversion = conversion::fp16b_bfp4;
+                init_data_copy_function<Fp16b_Bfp4_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float16_b && g.bufq_target_format == tt::DataFormat::Bfp4_b) {
+                og.data_conversion = conversion::fp16b_bfp4b;
+                init_data_copy_function<Fp16b_Bfp4_all>(og.layout);
+            } else if (t.format == tt::DataFormat::Float16_b && g.bufq_target_format == tt::DataFormat::Bfp2) {
+                og.data_conversion = conversion::fp16b_bfp2;
+                init_data_copy_function<Fp16b_Bfp2_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float16_b && g.bufq_target_format == tt::DataFormat::Bfp2_b) {
+                og.data_conversion = conversion::fp16b_bfp2b;
+                init_data_copy_function<Fp16b_Bfp2_all>(og.layout);
+            } else if (t.format == tt::DataFormat::Float16 && g.bufq_target_format == tt::DataFormat::Bfp4) {
+                og.data_conversion = conversion::fp16_bfp4;
+                init_data_copy_function<Fp16_Bfp4_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float16 && g.bufq_target_format == tt::DataFormat::Bfp4_b) {
+                og.data_conversion = conversion::fp16_bfp4b;
+                init_data_copy_function<Fp16_Bfp4_all>(og.layout);
+            } else if (t.format == tt::DataFormat::Float16 && g.bufq_target_format == tt::DataFormat::Bfp2) {
+                og.data_conversion = conversion::fp16_bfp2;
+                init_data_copy_function<Fp16_Bfp2_all>(og.layout, true);
+            } else if (t.format == tt::DataFormat::Float16 && g.bufq_target_format == tt::DataFormat::Bfp2_b) {
+                og.data_conversion = conversion::fp16_bfp2b;
+                init_data_copy_function<Fp16_Bfp2_all>(og.layout);
             } else {
                 log_assert(false, "Must use a supported data conversion for Fast Tilize!");
             }
@@ -881,7 +935,7 @@ void DeviceTilizer<tilizer_backend>::init_from_tensors(const std::vector<tt_Pyto
                     if(num_threads_modified != num_threads) {
                         if(num_threads > 1) {
                             // Only wait for threads to complete if thread pool was actually started
-                            while(push_threads.wait() || push_threads.num_free != num_threads) continue;
+                            push_threads.wait_idle();
                             push_threads.stop();
                         }
                         
@@ -898,7 +952,8 @@ void DeviceTilizer<tilizer_backend>::init_from_tensors(const std::vector<tt_Pyto
                     bool multi_threaded_capable_formats =
                         (dc == conversion::fp32_bfp8b || dc == conversion::fp16b_bfp8b || dc == conversion::fp16_bfp8 ||
                          dc == conversion::fp32_bfp8 || dc == conversion::fp16b_bfp8 || dc == conversion::fp16_bfp8b ||
-                         dc == conversion::fp32_fp16b || dc == conversion::fp32_fp16 || dc == conversion::int8_bfp8);
+                         dc == conversion::fp32_fp16b || dc == conversion::fp32_fp16 || dc == conversion::int8_bfp8 ||
+                         get_shared_exponent_size(g.bufq_target_format) != 0);
 
                     if (tilizer_backend == Tilizer::FastTilizeDevicePush || !multi_threaded_capable_formats) {
                         // From this point on, num_threads is used to indicate the number of threads needed for tilize.
@@ -1282,9 +1337,7 @@ void DeviceTilizer<tilizer_backend>::do_tilize_and_push_with_timeout(const int t
                     });
                 }
                 
-                while(push_threads.wait() || push_threads.num_free != num_threads) {
-                    continue;
-                }
+                push_threads.wait_idle();
 
                 queue.update_wptr_local_by_offset(grid, grid.limit.w, offline_tilize);
             }
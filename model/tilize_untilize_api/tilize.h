@@ -157,6 +157,18 @@ private:
         raw8_raw8,
         int8_int8,
         int8_bfp8,
+        fp32_bfp4,
+        fp32_bfp4b,
+        fp16b_bfp4,
+        fp16b_bfp4b,
+        fp16_bfp4,
+        fp16_bfp4b,
+        fp32_bfp2,
+        fp32_bfp2b,
+        fp16b_bfp2,
+        fp16b_bfp2b,
+        fp16_bfp2,
+        fp16_bfp2b,
     };
 
     template <class T>
@@ -253,6 +265,7 @@ private:
     };
 
     TT_HIDDEN static std::size_t format_size(tt::DataFormat f);
+    TT_HIDDEN static std::size_t data_size(tt::DataFormat f, std::size_t num_elements);
     TT_HIDDEN std::size_t get_shared_exponent_size(tt::DataFormat f);
     TT_HIDDEN uint32_t set_num_tilize_threads(const std::array<std::uint32_t, 4>& tensor_shape,  const tt_queue_info& queue_info, tt::DataFormat tensor_format);
     TT_HIDDEN void init_from_grids(const std::array<std::uint32_t, 4>& tensor_shape, tt::DataFormat tensor_format);
@@ -353,5 +366,17 @@ const std::unordered_set<std::pair<DataFormat, DataFormat>, DataFormatPairHash>
         {DataFormat::Int8, DataFormat::Int8},
         {DataFormat::Int8, DataFormat::Bfp8},
         {DataFormat::Int8, DataFormat::Bfp8_b},
+        {DataFormat::Float32, DataFormat::Bfp4},
+        {DataFormat::Float32, DataFormat::Bfp4_b},
+        {DataFormat::Float32, DataFormat::Bfp2},
+        {DataFormat::Float32, DataFormat::Bfp2_b},
+        {DataFormat::Float16_b, DataFormat::Bfp4},
+        {DataFormat::Float16_b, DataFormat::Bfp4_b},
+        {DataFormat::Float16_b, DataFormat::Bfp2},
+        {DataFormat::Float16_b, DataFormat::Bfp2_b},
+        {DataFormat::Float16, DataFormat::Bfp4},
+        {DataFormat::Float16, DataFormat::Bfp4_b},
+        {DataFormat::Float16, DataFormat::Bfp2},
+        {DataFormat::Float16, DataFormat::Bfp2_b},
     };
 Tilizer get_tilizer_based_on_io_config(const tt_dram_io_desc &io, DataFormat host_data_format, DataFormat device_data_format, TargetDevice backend_type);
\ No newline at end of file
@@ -3,13 +3,30 @@
 // SPDX-License-Identifier: Apache-2.0
 #include <set>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #include "model/tt_rnd_util.hpp"
 
 namespace tt::test {
 
 std::mt19937 rand_gen(0);
-void tt_rnd_set_seed(int seed) { rand_gen.seed(seed); }
+static std::uint64_t rand_seed = 0;
+static thread_local std::uint64_t rand_tensor_id = 0;
+void tt_rnd_set_seed(int seed) {
+    rand_gen.seed(seed);
+    rand_seed = static_cast<std::uint32_t>(seed);
+    rand_tensor_id = 0;
+}
+
+bool tt_philox_force_scalar = false;
+
+std::uint64_t tt_rnd_tensor_key() { return tt_philox_key(rand_seed, rand_tensor_id++); }
 
 int tt_rnd_int(int min, int max) {
     log_assert((min <= max) ,  "min is greater than max!");
@@ -111,4 +128,137 @@ uint32_t tt_gen_seed(bool print_seed) {
     return ((uint32_t)seed);
 }
 
+namespace {
+constexpr std::uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr std::uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr std::uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr std::uint32_t PHILOX_W1 = 0xBB67AE85;
+constexpr int PHILOX_ROUNDS = 10;
+constexpr int PHILOX_BLOCKS_PER_GROUP = 8;
+constexpr int PHILOX_WORDS_PER_GROUP = 4 * PHILOX_BLOCKS_PER_GROUP;
+
+std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// Blocks of counters {first_block + lane, stream lo, stream hi, 0} into out[word * 8 + lane]
+#ifdef __AVX2__
+void philox_group_avx2(std::uint64_t key, std::uint64_t stream, std::uint32_t first_block, std::uint32_t *out) {
+    const __m256i m0 = _mm256_set1_epi32(PHILOX_M0);
+    const __m256i m1 = _mm256_set1_epi32(PHILOX_M1);
+    __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32(first_block), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i c1 = _mm256_set1_epi32(static_cast<std::uint32_t>(stream));
+    __m256i c2 = _mm256_set1_epi32(static_cast<std::uint32_t>(stream >> 32));
+    __m256i c3 = _mm256_setzero_si256();
+    std::uint32_t k0 = static_cast<std::uint32_t>(key);
+    std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        // 32x32->64 bit products of the even and odd lanes, split into their low and high words
+        const __m256i even0 = _mm256_mul_epu32(c0, m0);
+        const __m256i odd0 = _mm256_mul_epu32(_mm256_srli_epi64(c0, 32), m0);
+        const __m256i lo0 = _mm256_blend_epi32(even0, _mm256_slli_epi64(odd0, 32), 0xAA);
+        const __m256i hi0 = _mm256_blend_epi32(_mm256_srli_epi64(even0, 32), odd0, 0xAA);
+        const __m256i even1 = _mm256_mul_epu32(c2, m1);
+        const __m256i odd1 = _mm256_mul_epu32(_mm256_srli_epi64(c2, 32), m1);
+        const __m256i lo1 = _mm256_blend_epi32(even1, _mm256_slli_epi64(odd1, 32), 0xAA);
+        const __m256i hi1 = _mm256_blend_epi32(_mm256_srli_epi64(even1, 32), odd1, 0xAA);
+
+        c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32(k0));
+        c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32(k1));
+        c1 = lo1;
+        c3 = lo0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), c0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 8), c1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 16), c2);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 24), c3);
+}
+#endif
+
+void philox_group_scalar(std::uint64_t key, std::uint64_t stream, std::uint32_t first_block, std::uint32_t *out) {
+    for (int lane = 0; lane < PHILOX_BLOCKS_PER_GROUP; lane++) {
+        std::array<std::uint32_t, 4> c = {
+            first_block + lane, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32), 0};
+        std::uint32_t k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+        for (int round = 0; round < PHILOX_ROUNDS; round++) {
+            const std::uint64_t product0 = static_cast<std::uint64_t>(PHILOX_M0) * c[0];
+            const std::uint64_t product1 = static_cast<std::uint64_t>(PHILOX_M1) * c[2];
+            c = {static_cast<std::uint32_t>(product1 >> 32) ^ c[1] ^ k0,
+                 static_cast<std::uint32_t>(product1),
+                 static_cast<std::uint32_t>(product0 >> 32) ^ c[3] ^ k1,
+                 static_cast<std::uint32_t>(product0)};
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        for (int word = 0; word < 4; word++) {
+            out[word * PHILOX_BLOCKS_PER_GROUP + lane] = c[word];
+        }
+    }
+}
+
+void philox_group(std::uint64_t key, std::uint64_t stream, std::uint32_t first_block, std::uint32_t *out) {
+#ifdef __AVX2__
+    if (!tt_philox_force_scalar) {
+        philox_group_avx2(key, stream, first_block, out);
+        return;
+    }
+#endif
+    philox_group_scalar(key, stream, first_block, out);
+}
+
+// [0, 1) with 2^-32 resolution
+double word_to_unit(std::uint32_t word) { return word * (1.0 / 4294967296.0); }
+}  // namespace
+
+std::uint64_t tt_philox_key(std::uint64_t seed, std::uint64_t id) { return splitmix64(seed ^ splitmix64(id)); }
+
+void tt_philox_fill(std::uint64_t key, std::uint64_t stream, std::uint32_t *out, std::size_t num_words) {
+    const std::size_t num_groups = num_words / PHILOX_WORDS_PER_GROUP;
+    log_assert(
+        num_groups * PHILOX_BLOCKS_PER_GROUP < (std::size_t(1) << 32), "Philox stream of {} words is too long", num_words);
+    for (std::size_t group = 0; group < num_groups; group++) {
+        philox_group(key, stream, group * PHILOX_BLOCKS_PER_GROUP, out + group * PHILOX_WORDS_PER_GROUP);
+    }
+    const std::size_t num_tail_words = num_words - num_groups * PHILOX_WORDS_PER_GROUP;
+    if (num_tail_words > 0) {
+        std::array<std::uint32_t, PHILOX_WORDS_PER_GROUP> tail;
+        philox_group(key, stream, num_groups * PHILOX_BLOCKS_PER_GROUP, tail.data());
+        std::memcpy(out + num_groups * PHILOX_WORDS_PER_GROUP, tail.data(), num_tail_words * sizeof(std::uint32_t));
+    }
+}
+
+void tt_philox_fill_uniform(
+    std::uint64_t key, std::uint64_t stream, float *out, std::size_t num, double lower, double upper) {
+    log_assert((lower <= upper), "min is greater than max!");
+    std::vector<std::uint32_t> words(num);
+    tt_philox_fill(key, stream, words.data(), num);
+    const double range = upper - lower;
+    // Largest float below upper, values rounding up to it stay in [lower, upper)
+    const float below_upper = lower < upper ? std::nextafter(static_cast<float>(upper), static_cast<float>(lower)) : upper;
+    for (std::size_t i = 0; i < num; i++) {
+        out[i] = std::min(static_cast<float>(lower + range * word_to_unit(words[i])), below_upper);
+    }
+}
+
+void tt_philox_fill_normal(
+    std::uint64_t key, std::uint64_t stream, float *out, std::size_t num, double mean, double stddev) {
+    std::vector<std::uint32_t> words(num + num % 2);
+    tt_philox_fill(key, stream, words.data(), words.size());
+    for (std::size_t i = 0; i < num; i += 2) {
+        // u1 in (0, 1] keeps the log finite
+        const double radius = stddev * std::sqrt(-2.0 * std::log(1.0 - word_to_unit(words[i])));
+        const double angle = 2.0 * M_PI * word_to_unit(words[i + 1]);
+        out[i] = mean + radius * std::cos(angle);
+        if (i + 1 < num) {
+            out[i + 1] = mean + radius * std::sin(angle);
+        }
+    }
+}
+
 }  // namespace tt::test
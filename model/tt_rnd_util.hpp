@@ -5,6 +5,7 @@
 
 #include <random>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
@@ -34,4 +35,22 @@ T tt_rnd_pick(std::vector<T> items) {
 }
 
 uint32_t tt_gen_seed(bool print_seed = true);
+
+// Key of the next randomized tensor, from the seed and the number of tensors the calling thread randomized since it was set
+std::uint64_t tt_rnd_tensor_key();
+
+// Counter based Philox4x32-10 generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"). The words of
+// a stream only depend on the key and the stream index, eg. the seed and tensor id and the tile index, so tiles can be
+// generated in any order and on any number of threads with the same result.
+std::uint64_t tt_philox_key(std::uint64_t seed, std::uint64_t id);
+// Word i of a stream is word (i / 8) % 4 of the Philox block for counter (i / 32) * 8 + i % 8, 8 blocks are generated
+// at a time
+void tt_philox_fill(std::uint64_t key, std::uint64_t stream, std::uint32_t *out, std::size_t num_words);
+// Generate with the scalar rounds even in AVX2 builds, both give the same words
+extern bool tt_philox_force_scalar;
+// Uniform in [lower, upper) from one word, and normal from pairs of words with Box-Muller
+void tt_philox_fill_uniform(
+    std::uint64_t key, std::uint64_t stream, float *out, std::size_t num, double lower, double upper);
+void tt_philox_fill_normal(
+    std::uint64_t key, std::uint64_t stream, float *out, std::size_t num, double mean, double stddev);
 }  // namespace tt::test
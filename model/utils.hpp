@@ -106,6 +106,7 @@ const std::map<TargetDevice, std::string> TARGET_DEVICE_TO_STRING = {
         {TargetDevice::Silicon, "Silicon"},
         {TargetDevice::Golden, "Golden"},
         {TargetDevice::Emulation, "Emulation"},
+        {TargetDevice::Mock, "Mock"},
 };
 
 const std::map<Action, std::string> ACTION_TO_STRING = {
@@ -9,6 +9,7 @@
 #include "hlks/inc/hlk_api.h"
 #include "netlist_basic_info_types.hpp"
 #include "netlist_op_info_types.hpp"
+#include "netlist_snapshot.hpp"
 #include "netlist_utils.hpp"
 #include "size_lib.hpp"
 #include "tt_backend_api_types.hpp"
@@ -1300,14 +1301,16 @@ void netlist_parser::parse_fused_ops(const YAML::Node& fused_ops) {
     }
 }
 void netlist_parser::parse_string(string netlist) {
-    YAML::Node yaml_netlist = YAML::Load(netlist);
+    tt::tt_netlist_snapshot_cache *snapshot_cache = tt::tt_netlist_snapshot_cache::get();
+    YAML::Node yaml_netlist = snapshot_cache ? snapshot_cache->load_string(netlist) : YAML::Load(netlist);
     parse_yaml(yaml_netlist);
 }
 
 void netlist_parser::parse_file(string file) {
     log_debug(tt::LogNetlist, "Parsing Netlist from file: {}", file);
     try {
-        YAML::Node netlist = YAML::LoadFile(file);
+        tt::tt_netlist_snapshot_cache *snapshot_cache = tt::tt_netlist_snapshot_cache::get();
+        YAML::Node netlist = snapshot_cache ? snapshot_cache->load_file(file) : YAML::LoadFile(file);
         parse_yaml(netlist);
     } catch (const std::exception &e) {
         log_fatal("{}", e.what());
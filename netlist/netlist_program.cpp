@@ -54,27 +54,152 @@ int get_immediate(const string &input) {
 ////////////////////////////////
 // netlist_program
 ////////////////////////////////
+void netlist_program::compile() {
+    bytecode.clear();
+    bytecode.resize(program_trace.size());
+    graph_handle_names.clear();
+    queue_handle_names.clear();
+    std::unordered_map<string, int> graph_handle_ids = {};
+    std::unordered_map<string, int> queue_handle_ids = {};
+    const auto get_handle = [](const string &name, std::vector<std::string> &names, std::unordered_map<string, int> &ids) {
+        const auto [handle_it, inserted] = ids.insert({name, static_cast<int>(names.size())});
+        if (inserted) {
+            names.push_back(name);
+        }
+        return handle_it->second;
+    };
+    std::vector<int> open_loops = {};
+    for (int pc = 0; pc < program_trace.size(); pc++) {
+        const tt_instruction_info &instrn = program_trace.at(pc);
+        program_bytecode &op = bytecode.at(pc);
+        op.opcode = instrn.opcode;
+        op.varinst_opcode = instrn.varinst_opcode;
+        if (instrn.opcode == INSTRUCTION_OPCODE::Var or instrn.opcode == INSTRUCTION_OPCODE::StaticVar or
+            instrn.opcode == INSTRUCTION_OPCODE::Param) {
+            // Declarations carry the initial value along with the declared slot, names that are no variable are
+            // rejected by set_variable when the declaration runs
+            for (const auto &var : instrn.vars) {
+                op.operands.push_back({
+                    .slot = get_variable_slot(get_variable_name(std::get<0>(var))),
+                    .value = std::get<1>(var),
+                    .valid = is_variable(std::get<0>(var))});
+            }
+        } else if (instrn.opcode == INSTRUCTION_OPCODE::VarInst) {
+            for (const auto &var : instrn.vars) {
+                op.operands.push_back(compile_operand(std::get<0>(var)));
+            }
+        } else if (instrn.opcode == INSTRUCTION_OPCODE::Execute) {
+            op.graph_handle = get_handle(instrn.graph_name, graph_handle_names, graph_handle_ids);
+            for (const auto &queue_setting : instrn.queue_settings) {
+                op.queue_handles.push_back(get_handle(queue_setting.name, queue_handle_names, queue_handle_ids));
+            }
+        } else if (instrn.opcode == INSTRUCTION_OPCODE::Loop) {
+            op.operands.push_back(compile_operand(instrn.loop_count));
+            open_loops.push_back(pc);
+        } else if (instrn.opcode == INSTRUCTION_OPCODE::EndLoop and !open_loops.empty()) {
+            bytecode.at(open_loops.back()).end_loop_pc = pc;
+            open_loops.pop_back();
+        }
+    }
+
+    // Only variable arithmetic leaves the host nothing to do per iteration, anything touching graphs or queues does
+    for (int pc = 0; pc < bytecode.size(); pc++) {
+        program_bytecode &loop = bytecode.at(pc);
+        if (loop.opcode != INSTRUCTION_OPCODE::Loop or loop.end_loop_pc == PC::INVALID) {
+            continue;
+        }
+        loop.host_side_effect_free = true;
+        for (int body_pc = pc + 1; body_pc < loop.end_loop_pc; body_pc++) {
+            const tt_instruction_info &instrn = program_trace.at(body_pc);
+            if (instrn.opcode == INSTRUCTION_OPCODE::VarInst) {
+                loop.written_variables.push_back(std::get<0>(instrn.vars.at(0)));
+            } else if (
+                instrn.opcode != INSTRUCTION_OPCODE::Var and instrn.opcode != INSTRUCTION_OPCODE::StaticVar and
+                instrn.opcode != INSTRUCTION_OPCODE::Loop and instrn.opcode != INSTRUCTION_OPCODE::EndLoop) {
+                loop.host_side_effect_free = false;
+                break;
+            }
+        }
+    }
+}
+int netlist_program::get_variable_slot(const string &var_name) {
+    auto slot_it = variable_slot_ids.find(var_name);
+    if (slot_it != variable_slot_ids.end()) {
+        return slot_it->second;
+    }
+    variable_slots.push_back({});
+    variable_slot_ids.insert({var_name, variable_slots.size() - 1});
+    return variable_slots.size() - 1;
+}
+program_operand netlist_program::compile_operand(const string &operand) {
+    program_operand result = {};
+    if (is_variable(operand)) {
+        result.slot = get_variable_slot(get_variable_name(operand));
+    } else if (is_immediate(operand)) {
+        try {
+            result.value = get_immediate(operand);
+        } catch (const std::exception &e) {
+            result.valid = false;
+        }
+    } else {
+        result.valid = false;
+    }
+    return result;
+}
+const string &netlist_program::get_operand_source(int pc, std::size_t operand_index) const {
+    const tt_instruction_info &instrn = program_trace.at(pc);
+    return instrn.opcode == INSTRUCTION_OPCODE::Loop ? instrn.loop_count : std::get<0>(instrn.vars.at(operand_index));
+}
+int netlist_program::read_operand(int pc, std::size_t operand_index) const {
+    const program_operand &operand = bytecode[pc].operands[operand_index];
+    if (operand.slot < 0 and operand.valid) {
+        return operand.value;
+    }
+    if (operand.slot >= 0 and variable_slots[operand.slot].declared) {
+        return variable_slots[operand.slot].variable.value;
+    }
+    // Malformed and uninitialized operands go through the named lookup, which reports them
+    return get_variable(get_operand_source(pc, operand_index)).value;
+}
+void netlist_program::write_operand(int pc, std::size_t operand_index, int value) {
+    const program_operand &operand = bytecode[pc].operands[operand_index];
+    if (operand.slot < 0) {
+        set_variable(get_operand_source(pc, operand_index), value);
+        return;
+    }
+    program_variable_slot &slot = variable_slots[operand.slot];
+    if (!slot.declared) {
+        slot = {.variable = {.type = VARIABLE_TYPE::INVALID, .value = value}, .declared = true};
+    } else {
+        slot.variable.value = value;
+    }
+}
+
 void netlist_program::reset() {
     program_counter = PC::START;
     breakpoint_pc = PC::INVALID;
     loop_stack.clear();
     // We should only clear variables that are not static
-    std::vector<std::string> local_vars = {};
-    for (const auto &var_it : variables) {
-        if ((var_it.second.type == VARIABLE_TYPE::LOCAL) or (var_it.second.type == VARIABLE_TYPE::PARAM)) {
-            local_vars.push_back(var_it.first);
+    for (auto &slot : variable_slots) {
+        if ((slot.variable.type == VARIABLE_TYPE::LOCAL) or (slot.variable.type == VARIABLE_TYPE::PARAM)) {
+            slot.declared = false;
         }
     }
-    for (const auto &local_var : local_vars) {
-        variables.erase(local_var);
-    }
 }
 void netlist_program::clear() {
     this->reset();
     program_trace.clear();
-    variables.clear();
+    bytecode.clear();
+    variable_slots.clear();
+    variable_slot_ids.clear();
+    graph_handle_names.clear();
+    queue_handle_names.clear();
+}
+bool netlist_program::done() const {
+    if ((uint32_t)program_counter >= bytecode.size())
+        log_fatal("PC went beyond program instructions...");
+    return bytecode[program_counter].opcode == INSTRUCTION_OPCODE::EndProgram;
 }
-bool netlist_program::done() const {return get_current_instruction().opcode == INSTRUCTION_OPCODE::EndProgram; }
 bool netlist_program::breakpoint() const { return program_counter == breakpoint_pc; }
 const tt_instruction_info& netlist_program::get_current_instruction() const {
     if ((uint32_t)program_counter >= program_trace.size())
@@ -83,16 +208,26 @@ const tt_instruction_info& netlist_program::get_current_instruction() const {
 }
 const std::vector<tt_instruction_info> &netlist_program::get_program_trace() const { return program_trace; }
 std::string netlist_program::get_name() const { return name; }
+const std::vector<std::string> &netlist_program::get_graph_handle_names() const { return graph_handle_names; }
+const std::vector<std::string> &netlist_program::get_queue_handle_names() const { return queue_handle_names; }
+int netlist_program::get_current_graph_handle() const {
+    get_current_instruction();  // Checks the PC
+    return bytecode[program_counter].graph_handle;
+}
+const std::vector<int> &netlist_program::get_queue_handles(int pc) const { return bytecode.at(pc).queue_handles; }
 int netlist_program::get_current_pc() const { return program_counter; }
 int netlist_program::get_breakpoint_pc() const { return breakpoint_pc; }
 program_variable netlist_program::get_variable(const string& variable_string) const {
-    return get_variable_from_map(variable_string, variables);
+    if (has_variable(variable_string)) {
+        return variable_slots.at(variable_slot_ids.at(get_variable_name(variable_string))).variable;
+    }
+    // Immediates and errors are handled as for any other variable map
+    return get_variable_from_map(variable_string, std::unordered_map<string, program_variable>{});
 }
 VARIABLE_TYPE netlist_program::get_variable_type(const string& variable_string) const {
     VARIABLE_TYPE result = VARIABLE_TYPE::INVALID;
-    string var_name = get_variable_name(variable_string);
     if (has_variable(variable_string)) {
-        result = variables.at(var_name).type;
+        result = variable_slots.at(variable_slot_ids.at(get_variable_name(variable_string))).variable.type;
     } else {
         log_fatal("Accessing an uninitialized variable {}", variable_string);
     }
@@ -101,8 +236,8 @@ VARIABLE_TYPE netlist_program::get_variable_type(const string& variable_string)
 bool netlist_program::has_variable(const string& variable_string) const {
     bool result = false;
     if (is_variable(variable_string)) {
-        string var_name = get_variable_name(variable_string);
-        if (variables.find(var_name) != variables.end()) {
+        auto slot_it = variable_slot_ids.find(get_variable_name(variable_string));
+        if (slot_it != variable_slot_ids.end() and variable_slots.at(slot_it->second).declared) {
             result = true;
         }
     }
@@ -113,30 +248,34 @@ void netlist_program::set_variable(const string& variable_string, int value, VAR
         log_fatal(
             "Error Converting string {} to variable Missing Variable marker '$' ", variable_string);
     }
-    if (not has_variable(variable_string)) {
+    program_variable_slot &slot = variable_slots.at(get_variable_slot(get_variable_name(variable_string)));
+    if (not slot.declared) {
         // Not a global or a previous variable, just assign to local variables
-        variables.insert({get_variable_name(variable_string), {.type = type, .value = value}});
+        slot = {.variable = {.type = type, .value = value}, .declared = true};
     } else {
-        log_trace(tt::LogNetlist, "set_variable variable={} to value={}", variable_string, value);
         if (type != VARIABLE_TYPE::INVALID) {
-            variables.at(get_variable_name(variable_string)).type = type;
+            slot.variable.type = type;
         }
-        variables.at(get_variable_name(variable_string)).value = value;
+        slot.variable.value = value;
         log_trace(tt::LogNetlist, "set_variable variable={} to value={}", variable_string, value);
     }
 }
 std::unordered_map<string, int> netlist_program::get_variables() {
     std::unordered_map<string, int> variables_snapshot = {};
-    for (const auto &var_it : variables) {
-        variables_snapshot.insert({var_it.first, var_it.second.value});
+    for (const auto &slot_it : variable_slot_ids) {
+        const program_variable_slot &slot = variable_slots.at(slot_it.second);
+        if (slot.declared) {
+            variables_snapshot.insert({slot_it.first, slot.variable.value});
+        }
     }
     return variables_snapshot;
 }
 std::unordered_map<string, int> netlist_program::get_variables_of_type(VARIABLE_TYPE type) {
     std::unordered_map<string, int> variables_snapshot = {};
-    for (const auto &var_it : variables) {
-        if (type == var_it.second.type) {
-            variables_snapshot.insert({var_it.first, var_it.second.value});
+    for (const auto &slot_it : variable_slot_ids) {
+        const program_variable_slot &slot = variable_slots.at(slot_it.second);
+        if (slot.declared and type == slot.variable.type) {
+            variables_snapshot.insert({slot_it.first, slot.variable.value});
         }
     }
     return variables_snapshot;
@@ -221,7 +360,11 @@ netlist_program &netlist_program::operator=(const netlist_program &other) {
     program_counter = other.program_counter;
     program_trace = other.program_trace;
     breakpoint_pc = other.breakpoint_pc;
-    variables = other.variables;
+    bytecode = other.bytecode;
+    variable_slots = other.variable_slots;
+    variable_slot_ids = other.variable_slot_ids;
+    graph_handle_names = other.graph_handle_names;
+    queue_handle_names = other.queue_handle_names;
     return *this;
 }
 
@@ -230,9 +373,9 @@ netlist_program &netlist_program::operator=(const int pc) {
     return *this;
 }
 void netlist_program::operator++() {
-    const tt_instruction_info &current_instruction = get_current_instruction();
+    get_current_instruction();  // Checks the PC
     // Branching handler on PC increment
-    if (current_instruction.opcode == INSTRUCTION_OPCODE::EndLoop) {
+    if (bytecode[program_counter].opcode == INSTRUCTION_OPCODE::EndLoop) {
         log_assert(loop_stack.size() > 0, "Unexpected EndLoop at program: {} pc: {}", name, program_counter);
         program_loop_info &loop = loop_stack.back();
         if (loop++) {
@@ -275,166 +418,225 @@ ostream &operator<<(ostream &os, const netlist_program &t) {
 void netlist_program::run_instruction_with_execute_callback(std::function<void(netlist_program &)> execute_callback) {
     run_instruction_with_callbacks({}, execute_callback, {});
 }
+std::optional<std::vector<std::string>> netlist_program::get_execute_trace(std::size_t max_num_executes, std::size_t max_num_instructions) const {
+    // Dry run a copy of the program from its current state, so loops and variables resolve exactly as they will at runtime
+    netlist_program dry_run = *this;
+    std::vector<std::string> graph_names = {};
+    std::size_t num_instructions = 0;
+    while (!dry_run.done() and !dry_run.breakpoint()) {
+        if (num_instructions == max_num_instructions) {
+            return std::nullopt;
+        }
+        dry_run.run_instruction_with_execute_callback(
+            [&graph_names](netlist_program &program) { graph_names.push_back(program.get_current_instruction().graph_name); });
+        num_instructions++;
+        if (graph_names.size() > max_num_executes) {
+            return std::nullopt;
+        }
+    }
+    return graph_names;
+}
 void netlist_program::set_ignore_runtime_parameters(const bool &value) { this->ignore_runtime_parameters = value; }
+void netlist_program::set_loop_batching(std::function<bool(const string &)> is_host_visible_variable) {
+    this->is_host_visible_variable = is_host_visible_variable;
+}
+bool netlist_program::run_batched_loop() {
+    const program_bytecode &loop = bytecode[program_counter];
+    if (!is_host_visible_variable or loop.opcode != INSTRUCTION_OPCODE::Loop or !loop.host_side_effect_free or
+        (breakpoint_pc >= program_counter and breakpoint_pc <= loop.end_loop_pc)) {
+        return false;
+    }
+    for (const string &variable : loop.written_variables) {
+        if (is_host_visible_variable(variable)) {
+            return false;
+        }
+    }
+    const int end_loop_pc = loop.end_loop_pc;
+    run_compiled_instruction({});
+    (*this)++;
+    const std::size_t loop_depth = loop_stack.size();
+    // Stops at the EndLoop of the last iteration, left for the caller to step through with its callbacks
+    while (!(program_counter == end_loop_pc and loop_stack.size() == loop_depth and
+             loop_stack.back().curr_iter == loop_stack.back().last_iter)) {
+        run_compiled_instruction({});
+        (*this)++;
+    }
+    return true;
+}
 void netlist_program::run_instruction_with_callbacks(
     std::function<void(netlist_program &)> pre_instrn_callback,
     std::function<void(netlist_program &)> execute_callback,
     std::function<void(netlist_program &)> post_instrn_callback) {
-    const tt_instruction_info& instrn = get_current_instruction();
+    [[maybe_unused]] const tt_instruction_info& instrn = get_current_instruction();
     if (breakpoint()) {
         log_warning(tt::LogNetlist, "Hit Breakpoint -- Looping on break");
         return;
     }
     log_trace(tt::LogNetlist, "Running {}", instrn);
+    if (run_batched_loop()) {
+        return;
+    }
 
     // Pre instruction
     if (pre_instrn_callback)
         pre_instrn_callback(*this);
     // Run instruction
-    if (instrn.opcode == INSTRUCTION_OPCODE::Var) {
-        for (const auto &var : instrn.vars) {
-            if (has_variable(std::get<0>(var))) {
-                if ((get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::LOCAL) or
-                    (get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::PARAM) or
-                    (get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::STATIC)) {
-                    log_fatal(
-                        "Local Variable={} declaration masks a previous param/static/local variable declaration",
-                        std::get<0>(var));
-                } else {
-                    log_fatal("Internal Error -- Not Supported Variable Type detected");
+    run_compiled_instruction(execute_callback);
+
+    // Post instruction
+    if (post_instrn_callback)
+        post_instrn_callback(*this);
+   
+    // Increment Program Counter
+    (*this)++;
+}
+void netlist_program::run_compiled_instruction(const std::function<void(netlist_program &)> &execute_callback) {
+    const int pc = program_counter;
+    const program_bytecode &op = bytecode[pc];
+    const tt_instruction_info &instrn = program_trace[pc];
+    switch (op.opcode) {
+        case INSTRUCTION_OPCODE::Var:
+            for (std::size_t i = 0; i < op.operands.size(); i++) {
+                if (!op.operands[i].valid) {
+                    set_variable(std::get<0>(instrn.vars[i]), op.operands[i].value, VARIABLE_TYPE::LOCAL);
+                    continue;
+                }
+                program_variable_slot &slot = variable_slots[op.operands[i].slot];
+                if (slot.declared) {
+                    if ((slot.variable.type == VARIABLE_TYPE::LOCAL) or (slot.variable.type == VARIABLE_TYPE::PARAM) or
+                        (slot.variable.type == VARIABLE_TYPE::STATIC)) {
+                        log_fatal(
+                            "Local Variable={} declaration masks a previous param/static/local variable declaration",
+                            std::get<0>(instrn.vars[i]));
+                    } else {
+                        log_fatal("Internal Error -- Not Supported Variable Type detected");
+                    }
                 }
+                slot = {.variable = {.type = VARIABLE_TYPE::LOCAL, .value = op.operands[i].value}, .declared = true};
             }
-            set_variable(std::get<0>(var), std::get<1>(var), VARIABLE_TYPE::LOCAL);
-        }
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::StaticVar) {
-        for (const auto &var : instrn.vars) {
-            if (not has_variable(std::get<0>(var))) {
-                set_variable(std::get<0>(var), std::get<1>(var), VARIABLE_TYPE::STATIC);
-            } else {
-                if ((get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::LOCAL) or
-                    (get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::PARAM)) {
+            break;
+        case INSTRUCTION_OPCODE::StaticVar:
+            for (std::size_t i = 0; i < op.operands.size(); i++) {
+                if (!op.operands[i].valid) {
+                    set_variable(std::get<0>(instrn.vars[i]), op.operands[i].value, VARIABLE_TYPE::STATIC);
+                    continue;
+                }
+                program_variable_slot &slot = variable_slots[op.operands[i].slot];
+                if (not slot.declared) {
+                    slot = {.variable = {.type = VARIABLE_TYPE::STATIC, .value = op.operands[i].value}, .declared = true};
+                } else if ((slot.variable.type == VARIABLE_TYPE::LOCAL) or (slot.variable.type == VARIABLE_TYPE::PARAM)) {
                     log_fatal(
                         "Static Variable={} declaration masks a previous local/param variable declaration",
-                        std::get<0>(var));
-                } else if (get_variable_type(std::get<0>(var)) == VARIABLE_TYPE::STATIC) {
+                        std::get<0>(instrn.vars[i]));
+                } else if (slot.variable.type == VARIABLE_TYPE::STATIC) {
                     log_trace(
-                        tt::LogNetlist,
-                        "Static Variable={} exists and is {}",
-                        std::get<0>(var),
-                        get_variable(std::get<0>(var)).value);
+                        tt::LogNetlist, "Static Variable={} exists and is {}", std::get<0>(instrn.vars[i]), slot.variable.value);
                 } else {
                     log_fatal("Internal Error -- Not Supported Variable Type detected");
                 }
             }
-        }
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::Param) {
-        for (const auto &var : instrn.vars) {
-            string variable_string = std::get<0>(var);
-            if (this->ignore_runtime_parameters) {
-                // Ignore runtime parameters --> Make it all initialized to a default value
-                set_variable(variable_string, 1, VARIABLE_TYPE::PARAM);
-            } else if (not has_variable(variable_string)) {
-                if (this->parameters.find(variable_string) != this->parameters.end()) {
-                    if (is_immediate(parameters.at(variable_string))) {
-                        int param_value = get_immediate(parameters.at(variable_string));
-                        log_trace(tt::LogNetlist, "Program {} param {}={}", this->name, variable_string, param_value);
-                        set_variable(variable_string, param_value, VARIABLE_TYPE::PARAM);
+            break;
+        case INSTRUCTION_OPCODE::Param:
+            for (std::size_t i = 0; i < op.operands.size(); i++) {
+                const string &variable_string = std::get<0>(instrn.vars[i]);
+                if (!op.operands[i].valid) {
+                    set_variable(variable_string, 1, VARIABLE_TYPE::PARAM);
+                    continue;
+                }
+                program_variable_slot &slot = variable_slots[op.operands[i].slot];
+                if (this->ignore_runtime_parameters) {
+                    // Ignore runtime parameters --> Make it all initialized to a default value
+                    slot = {.variable = {.type = VARIABLE_TYPE::PARAM, .value = 1}, .declared = true};
+                } else if (not slot.declared) {
+                    if (this->parameters.find(variable_string) != this->parameters.end()) {
+                        if (is_immediate(parameters.at(variable_string))) {
+                            int param_value = get_immediate(parameters.at(variable_string));
+                            log_trace(tt::LogNetlist, "Program {} param {}={}", this->name, variable_string, param_value);
+                            slot = {.variable = {.type = VARIABLE_TYPE::PARAM, .value = param_value}, .declared = true};
+                        } else {
+                            log_fatal(
+                                "Param Variable={} has a non-immediate value={} passed in during run_program for "
+                                "program={}",
+                                variable_string,
+                                parameters.at(variable_string),
+                                this->name);
+                        }
                     } else {
                         log_fatal(
-                            "Param Variable={} has a non-immediate value={} passed in during run_program for "
-                            "program={}",
+                            "Param Variable={} is declared as a param for program={} but is not passed in during "
+                            "run_program",
                             variable_string,
-                            parameters.at(variable_string),
                             this->name);
                     }
                 } else {
-                    log_fatal(
-                        "Param Variable={} is declared as a param for program={} but is not passed in during "
-                        "run_program",
-                        variable_string,
-                        this->name);
+                    if ((slot.variable.type == VARIABLE_TYPE::LOCAL) or (slot.variable.type == VARIABLE_TYPE::PARAM) or
+                        (slot.variable.type == VARIABLE_TYPE::STATIC)) {
+                        log_fatal(
+                            "Param Variable={} declaration masks a previous param/static/local variable declaration",
+                            variable_string);
+                    } else {
+                        log_fatal("Internal Error -- Not Supported Variable Type detected");
+                    }
                 }
-            } else {
-                if ((get_variable_type(variable_string) == VARIABLE_TYPE::LOCAL) or
-                    (get_variable_type(variable_string) == VARIABLE_TYPE::PARAM) or
-                    (get_variable_type(variable_string) == VARIABLE_TYPE::STATIC)) {
-                    log_fatal(
-                        "Param Variable={} declaration masks a previous param/static/local variable declaration",
-                        variable_string);
-                } else {
-                    log_fatal("Internal Error -- Not Supported Variable Type detected");
+            }
+            break;
+        case INSTRUCTION_OPCODE::VarInst:
+            if (op.varinst_opcode == VAR_INSTRUCTION_OPCODE::Set) {
+                log_assert(op.operands.size() == 2, "Expected 2 variables for Load varinst");
+                write_operand(pc, 0, read_operand(pc, 1));
+            } else if (op.varinst_opcode == VAR_INSTRUCTION_OPCODE::Add) {
+                log_assert(op.operands.size() == 3, "Expected 3 variables for + varinst");
+                write_operand(pc, 0, read_operand(pc, 1) + read_operand(pc, 2));
+            } else if (op.varinst_opcode == VAR_INSTRUCTION_OPCODE::Mul) {
+                log_assert(op.operands.size() == 3, "Expected 3 variables for * varinst");
+                write_operand(pc, 0, read_operand(pc, 1) * read_operand(pc, 2));
+            } else if (op.varinst_opcode == VAR_INSTRUCTION_OPCODE::Inc) {
+                log_assert(op.operands.size() == 2, "Expected 2 variables for increment varinst");
+                write_operand(pc, 0, read_operand(pc, 0) + read_operand(pc, 1));
+            } else if (op.varinst_opcode == VAR_INSTRUCTION_OPCODE::IncWrap) {
+                log_assert(op.operands.size() == 3, "Expected 3 variables for increment varinst");
+                int old_val = read_operand(pc, 0);
+                int increment = read_operand(pc, 1);
+                int mod_wrap = read_operand(pc, 2);
+                // Offset needs to account for when we go below 0, so we will wrap, it is the LCM that is > increment but
+                // multiple of mod_wrap
+                int offset = 0;
+                while ((offset + increment) < 0) {
+                    offset += mod_wrap;
                 }
+                int result = (old_val + increment + offset) % mod_wrap;
+                log_trace(tt::LogNetlist, "IncWrap: {}=({}+{})\%{}", result, old_val, increment, mod_wrap);
+                write_operand(pc, 0, result);
             }
-        }
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::VarInst) {
-        if (instrn.varinst_opcode == VAR_INSTRUCTION_OPCODE::Set) {
-            log_assert(instrn.vars.size() == 2, "Expected 2 variables for Load varinst");
-            set_variable(std::get<0>(instrn.vars[0]), get_variable(std::get<0>(instrn.vars[1])).value);
-        }
-        if (instrn.varinst_opcode == VAR_INSTRUCTION_OPCODE::Add) {
-            log_assert(instrn.vars.size() == 3, "Expected 3 variables for + varinst");
-            set_variable(
-                std::get<0>(instrn.vars[0]),
-                get_variable(std::get<0>(instrn.vars[1])).value + get_variable(std::get<0>(instrn.vars[2])).value);
-        }
-        if (instrn.varinst_opcode == VAR_INSTRUCTION_OPCODE::Mul) {
-            log_assert(instrn.vars.size() == 3, "Expected 3 variables for * varinst");
-            set_variable(
-                std::get<0>(instrn.vars[0]),
-                get_variable(std::get<0>(instrn.vars[1])).value * get_variable(std::get<0>(instrn.vars[2])).value);
-        }
-        if (instrn.varinst_opcode == VAR_INSTRUCTION_OPCODE::Inc) {
-            log_assert(instrn.vars.size() == 2, "Expected 2 variables for increment varinst");
-            set_variable(
-                std::get<0>(instrn.vars[0]),
-                get_variable(std::get<0>(instrn.vars[0])).value + get_variable(std::get<0>(instrn.vars[1])).value);
-        }
-        if (instrn.varinst_opcode == VAR_INSTRUCTION_OPCODE::IncWrap) {
-            log_assert(instrn.vars.size() == 3, "Expected 3 variables for increment varinst");
-            int old_val = get_variable(std::get<0>(instrn.vars[0])).value;
-            int increment = get_variable(std::get<0>(instrn.vars[1])).value;
-            int mod_wrap = get_variable(std::get<0>(instrn.vars[2])).value;
-            // Offset needs to account for when we go below 0, so we will wrap, it is the LCM that is > increment but
-            // multiple of mod_wrap
-            int offset = 0;
-            while ((offset + increment) < 0) {
-                offset += mod_wrap;
+            break;
+        case INSTRUCTION_OPCODE::AllocateQueue:
+        case INSTRUCTION_OPCODE::DeallocateQueue: {
+            std::vector<std::string> queues;
+            for (const auto &var : instrn.vars) {
+                queues.push_back(std::get<0>(var));
             }
-            int result = (old_val + increment + offset) % mod_wrap;
-            log_trace(tt::LogNetlist, "IncWrap: {}=({}+{})\%{}", result, old_val, increment, mod_wrap);
-            set_variable(std::get<0>(instrn.vars[0]), result);
-        }
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::AllocateQueue) {
-        std::vector<std::string> queues;
-        for (const auto &var : instrn.vars) {
-            string variable_string = std::get<0>(var);
-            queues.push_back(variable_string);
-        }
-        log_trace(tt::LogNetlist, "AllocateQueue: {}", fmt::join(queues, ", "));
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::DeallocateQueue) {
-        std::vector<std::string> queues;
-        for (const auto &var : instrn.vars) {
-            string variable_string = std::get<0>(var);
-            queues.push_back(variable_string);
+            if (op.opcode == INSTRUCTION_OPCODE::AllocateQueue) {
+                log_trace(tt::LogNetlist, "AllocateQueue: {}", fmt::join(queues, ", "));
+            } else {
+                log_trace(tt::LogNetlist, "DeallocateQueue: {}", fmt::join(queues, ", "));
+            }
+            break;
         }
-        log_trace(tt::LogNetlist, "DeallocateQueue: {}", fmt::join(queues, ", "));
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::Loop) {
-        // push return trace index on loop stack
-        int loop_count = get_variable(instrn.loop_count).value;
-        log_trace(tt::LogNetlist, "Loop Start: PC={} loop_count:{} = {}", program_counter, instrn.loop_count, loop_count);
-        if (loop_count < 1) {
-            log_fatal("Loop count needs to be >= 1 -- loop_count:{} = {}", instrn.loop_count, loop_count);
+        case INSTRUCTION_OPCODE::Loop: {
+            // push return trace index on loop stack
+            int loop_count = read_operand(pc, 0);
+            log_trace(tt::LogNetlist, "Loop Start: PC={} loop_count:{} = {}", program_counter, instrn.loop_count, loop_count);
+            if (loop_count < 1) {
+                log_fatal("Loop count needs to be >= 1 -- loop_count:{} = {}", instrn.loop_count, loop_count);
+            }
+            // push loop info to stack
+            loop_stack.push_back({0, loop_count - 1, program_counter + 1});
+            break;
         }
-        // push loop info to stack
-        loop_stack.push_back({0, loop_count - 1, program_counter + 1});
-    } else if (instrn.opcode == INSTRUCTION_OPCODE::Execute) {
-        execute_callback(*this);
+        case INSTRUCTION_OPCODE::Execute:
+            execute_callback(*this);
+            break;
+        default:
+            break;
     }
-    
-    // Post instruction
-    if (post_instrn_callback)
-        post_instrn_callback(*this);
-   
-    // Increment Program Counter
-    (*this)++;
 }
@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <map>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -27,6 +28,33 @@ struct program_variable {
     int value = 0;
 };
 
+// Operand of a compiled instruction, an immediate value or the slot of a variable
+struct program_operand {
+    int slot = -1;
+    int value = 0;
+    bool valid = true;  // Malformed immediates are reported when the operand is first read
+};
+
+// Instruction lowered for dispatch, with variable names resolved to slots, graph and queue names to handles and loops
+// to their matching EndLoop
+struct program_bytecode {
+    INSTRUCTION_OPCODE opcode = INSTRUCTION_OPCODE::Invalid;
+    VAR_INSTRUCTION_OPCODE varinst_opcode = VAR_INSTRUCTION_OPCODE::Invalid;
+    std::vector<program_operand> operands = {};
+    // Execute only: handle of the graph and of each queue in queue_settings, in the same order
+    int graph_handle = -1;
+    std::vector<int> queue_handles = {};
+    int end_loop_pc = PC::INVALID;
+    // Loop only: the body does nothing the host has to act on but arithmetic on the written variables
+    bool host_side_effect_free = false;
+    std::vector<string> written_variables = {};
+};
+
+struct program_variable_slot {
+    program_variable variable = {};
+    bool declared = false;
+};
+
 struct program_loop_info {
     int curr_iter = 0;
     int last_iter = 0;
@@ -94,6 +122,18 @@ class netlist_program {
         std::function<void(netlist_program&)> pre_instrn_callback,
         std::function<void(netlist_program&)> execute_callback,
         std::function<void(netlist_program&)> post_instrn_callback);
+    //! Graphs and queues referred to by execute instructions, indexed by the handles assigned when the program is compiled
+    const std::vector<std::string>& get_graph_handle_names() const;
+    const std::vector<std::string>& get_queue_handle_names() const;
+    //! Handles of the graph and the queue settings of the current execute instruction
+    int get_current_graph_handle() const;
+    const std::vector<int>& get_queue_handles(int pc) const;
+    //! Graph names of the execute instructions the program will run from its current state, with loops unrolled.
+    //! No trace if the program runs more than max_num_executes executes or max_num_instructions instructions.
+    std::optional<std::vector<std::string>> get_execute_trace(std::size_t max_num_executes, std::size_t max_num_instructions) const;
+    //! Lets loops that only do arithmetic on variables run all their iterations in one step, callbacks only see their
+    //! last EndLoop. Loops writing a variable is_host_visible_variable returns true for step through every instruction.
+    void set_loop_batching(std::function<bool(const string&)> is_host_visible_variable);
 
     //! Operators that control assignment of PC etc.
     netlist_program& operator=(const netlist_program& other);
@@ -105,7 +145,9 @@ class netlist_program {
 
     //! Constructors
     netlist_program(std::string name, std::vector<tt_instruction_info> program_trace) :
-        program_trace(program_trace), name(name){};
+        program_trace(program_trace), name(name) {
+        compile();
+    };
     netlist_program(){};
 
     // This is so that backends that don't care about runtime_parameters can treat them as DC.
@@ -119,9 +161,25 @@ class netlist_program {
     int breakpoint_pc = PC::INVALID;
     std::vector<program_loop_info> loop_stack = {};
     std::unordered_map<string, string> parameters = {};
-    std::unordered_map<string, program_variable> variables = {};
     std::vector<tt_instruction_info> program_trace = {};
     std::string name;
+
+    // Compiled form of program_trace, variables live in slots assigned when the program is compiled
+    std::vector<program_bytecode> bytecode = {};
+    std::vector<program_variable_slot> variable_slots = {};
+    std::unordered_map<string, int> variable_slot_ids = {};
+    std::vector<std::string> graph_handle_names = {};
+    std::vector<std::string> queue_handle_names = {};
+    std::function<bool(const string&)> is_host_visible_variable = {};
+
+    void compile();
+    int get_variable_slot(const string& var_name);
+    program_operand compile_operand(const string& operand);
+    const string& get_operand_source(int pc, std::size_t operand_index) const;
+    int read_operand(int pc, std::size_t operand_index) const;
+    void write_operand(int pc, std::size_t operand_index, int value);
+    void run_compiled_instruction(const std::function<void(netlist_program&)>& execute_callback);
+    bool run_batched_loop();
 };
 string get_variable_name(const string& input);
 bool is_variable(const string& input);
@@ -0,0 +1,386 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "netlist_snapshot.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "common/disk_cache_lib.hpp"
+#include "common/env_lib.hpp"
+#include "utils/logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tt {
+
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[8] = {'T', 'T', 'N', 'L', 'S', 'N', 'A', 'P'};
+// Bump whenever the encoding changes, old snapshots are then ignored
+constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+const std::string SNAPSHOT_EXTENSION = ".nlsnap";
+
+struct snapshot_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t key_size;
+    std::uint64_t num_strings;
+    std::uint64_t num_nodes;
+    std::uint64_t strings_size;
+    std::uint64_t nodes_size;
+};
+
+// Every node starts with a byte holding its type, emitter style and whether a tag id follows. Scalars then hold the id
+// of their value in the string table, sequences and maps their number of children. Children follow their parent in
+// pre-order, map children alternate between keys and values. All integers are LEB128 varints.
+constexpr std::uint8_t NODE_TYPE_MASK = 0x7;
+constexpr int NODE_STYLE_SHIFT = 3;
+constexpr std::uint8_t NODE_STYLE_MASK = 0x3;
+constexpr std::uint8_t NODE_HAS_TAG = 0x20;
+
+void write_varint(std::string &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+class snapshot_writer {
+   public:
+    void add(const YAML::Node &node) {
+        const bool has_tag = !node.Tag().empty();
+        nodes.push_back(static_cast<char>(
+            (node.Type() & NODE_TYPE_MASK) | ((node.Style() & NODE_STYLE_MASK) << NODE_STYLE_SHIFT) | (has_tag ? NODE_HAS_TAG : 0)));
+        if (has_tag) {
+            write_varint(nodes, get_string_id(node.Tag()));
+        }
+        num_nodes++;
+        if (node.IsScalar()) {
+            write_varint(nodes, get_string_id(node.Scalar()));
+        } else if (node.IsSequence()) {
+            write_varint(nodes, node.size());
+            for (const YAML::Node &child : node) {
+                add(child);
+            }
+        } else if (node.IsMap()) {
+            write_varint(nodes, node.size());
+            for (YAML::const_iterator it = node.begin(); it != node.end(); ++it) {
+                add(it->first);
+                add(it->second);
+            }
+        }
+    }
+
+    std::vector<std::uint8_t> finish(const std::string &key) const {
+        snapshot_header header = {};
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = SNAPSHOT_VERSION;
+        header.key_size = key.size();
+        header.num_strings = string_ids.size();
+        header.num_nodes = num_nodes;
+        header.strings_size = strings.size();
+        header.nodes_size = nodes.size();
+
+        std::vector<std::uint8_t> snapshot(sizeof(header) + key.size() + strings.size() + nodes.size());
+        std::uint8_t *out = snapshot.data();
+        for (const auto &[data, size] : std::initializer_list<std::pair<const void *, std::size_t>>{
+                 {&header, sizeof(header)}, {key.data(), key.size()}, {strings.data(), strings.size()}, {nodes.data(), nodes.size()}}) {
+            std::memcpy(out, data, size);
+            out += size;
+        }
+        return snapshot;
+    }
+
+   private:
+    std::string strings;
+    std::string nodes;
+    std::uint64_t num_nodes = 0;
+    // Netlists repeat the same keys and values all over, so every distinct string is stored once
+    std::unordered_map<std::string, std::uint64_t> string_ids;
+
+    std::uint64_t get_string_id(const std::string &str) {
+        auto [it, inserted] = string_ids.insert({str, string_ids.size()});
+        if (inserted) {
+            write_varint(strings, str.size());
+            strings += str;
+        }
+        return it->second;
+    }
+};
+
+class snapshot_reader {
+   public:
+    snapshot_reader(const std::uint8_t *data, const std::uint8_t *end) : data(data), end(end) {}
+
+    // Returns false on a truncated or corrupted snapshot
+    bool read_strings(std::uint64_t num_strings) {
+        strings.reserve(num_strings);
+        for (std::uint64_t i = 0; i < num_strings; i++) {
+            std::uint64_t size;
+            if (!read_varint(size) or size > std::uint64_t(end - data)) {
+                return false;
+            }
+            strings.emplace_back(reinterpret_cast<const char *>(data), size);
+            data += size;
+        }
+        return true;
+    }
+
+    // Nodes are attached to their parent before their own children are read. yaml-cpp merges the node memory of a
+    // child into its parent's on insertion, so building bottom-up would copy every subtree once per level.
+    bool read(YAML::Node &node, std::uint64_t &num_children) {
+        std::uint8_t header;
+        std::string_view tag, value;
+        if (!read_byte(header) or ((header & NODE_HAS_TAG) and !read_string(tag))) {
+            return false;
+        }
+        num_children = 0;
+        switch (static_cast<YAML::NodeType::value>(header & NODE_TYPE_MASK)) {
+            case YAML::NodeType::Undefined:
+            case YAML::NodeType::Null: node = YAML::Node(YAML::NodeType::Null); break;
+            case YAML::NodeType::Scalar:
+                if (!read_string(value)) {
+                    return false;
+                }
+                node = YAML::Node(std::string(value));
+                break;
+            case YAML::NodeType::Sequence:
+                node = YAML::Node(YAML::NodeType::Sequence);
+                if (!read_varint(num_children)) {
+                    return false;
+                }
+                break;
+            case YAML::NodeType::Map:
+                node = YAML::Node(YAML::NodeType::Map);
+                if (!read_varint(num_children)) {
+                    return false;
+                }
+                break;
+            default: return false;
+        }
+        if (!tag.empty()) {
+            node.SetTag(std::string(tag));
+        }
+        // Only affects how the document is emitted again, eg. for dumps of the netlist
+        node.SetStyle(static_cast<YAML::EmitterStyle::value>((header >> NODE_STYLE_SHIFT) & NODE_STYLE_MASK));
+        return true;
+    }
+
+    bool read_children(YAML::Node &node, std::uint64_t num_children) {
+        for (std::uint64_t i = 0; i < num_children; i++) {
+            YAML::Node child;
+            std::uint64_t num_grandchildren;
+            if (node.IsSequence()) {
+                if (!read(child, num_grandchildren)) {
+                    return false;
+                }
+                node.push_back(child);
+            } else {
+                YAML::Node key;
+                std::uint64_t num_key_children;
+                if (!read(key, num_key_children) or !read_children(key, num_key_children) or !read(child, num_grandchildren)) {
+                    return false;
+                }
+                // Keys are unique in the source document, skip the lookup operator[] would do
+                node.force_insert(key, child);
+            }
+            if (!read_children(child, num_grandchildren)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const std::uint8_t *position() const { return data; }
+    bool done() const { return data == end; }
+
+   private:
+    const std::uint8_t *data;
+    const std::uint8_t *end;
+    std::vector<std::string_view> strings;
+
+    bool read_byte(std::uint8_t &byte) {
+        if (data == end) {
+            return false;
+        }
+        byte = *data++;
+        return true;
+    }
+
+    bool read_varint(std::uint64_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            std::uint8_t byte;
+            if (!read_byte(byte)) {
+                return false;
+            }
+            value |= std::uint64_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool read_string(std::string_view &str) {
+        std::uint64_t id;
+        if (!read_varint(id) or id >= strings.size()) {
+            return false;
+        }
+        str = strings[id];
+        return true;
+    }
+};
+
+std::string read_file(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        throw YAML::BadFile(path);
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+}  // namespace
+
+std::vector<std::uint8_t> serialize_yaml_snapshot(const YAML::Node &document, const std::string &key) {
+    snapshot_writer writer;
+    writer.add(document);
+    return writer.finish(key);
+}
+
+YAML::Node deserialize_yaml_snapshot(const std::uint8_t *data, std::size_t size, const std::string &key) {
+    snapshot_header header;
+    if (size < sizeof(header)) {
+        return YAML::Node(YAML::NodeType::Null);
+    }
+    std::memcpy(&header, data, sizeof(header));
+    const bool valid_header = std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) == 0 and
+                              header.version == SNAPSHOT_VERSION and header.key_size == key.size() and
+                              sizeof(header) + header.key_size + header.strings_size + header.nodes_size == size and
+                              std::memcmp(data + sizeof(header), key.data(), key.size()) == 0;
+    if (!valid_header) {
+        return YAML::Node(YAML::NodeType::Null);
+    }
+
+    // The node records directly follow the string table they refer to
+    const std::uint8_t *strings = data + sizeof(header) + header.key_size;
+    snapshot_reader reader(strings, data + size);
+    YAML::Node document;
+    std::uint64_t num_children;
+    const bool valid = reader.read_strings(header.num_strings) and reader.position() == strings + header.strings_size and
+                       reader.read(document, num_children) and reader.read_children(document, num_children) and reader.done();
+    return valid ? document : YAML::Node(YAML::NodeType::Null);
+}
+
+tt_netlist_snapshot_cache::tt_netlist_snapshot_cache(const std::string &cache_dir, std::uint64_t max_size_bytes) :
+    cache_dir(cache_dir), max_size_bytes(max_size_bytes) {
+    fs::create_directories(cache_dir);
+}
+
+tt_netlist_snapshot_cache *tt_netlist_snapshot_cache::get() {
+    static std::unique_ptr<tt_netlist_snapshot_cache> cache = []() -> std::unique_ptr<tt_netlist_snapshot_cache> {
+        const std::string cache_dir = parse_env<std::string>("TT_BACKEND_NETLIST_SNAPSHOT_DIR", "");
+        if (cache_dir.empty()) {
+            return nullptr;
+        }
+        const std::uint64_t max_size_mb = parse_env<std::uint64_t>("TT_BACKEND_NETLIST_SNAPSHOT_MAX_MB", 1024);
+        log_debug(tt::LogNetlist, "Netlist snapshot cache at {}, limited to {} MB", cache_dir, max_size_mb);
+        return std::make_unique<tt_netlist_snapshot_cache>(cache_dir, max_size_mb << 20);
+    }();
+    return cache.get();
+}
+
+std::string tt_netlist_snapshot_cache::get_key(const std::string &netlist_contents) {
+    disk_cache::content_hasher hasher;
+    hasher.update(netlist_contents);
+    return hasher.hex();
+}
+
+std::string tt_netlist_snapshot_cache::get_snapshot_path(const std::string &key) const {
+    return (fs::path(cache_dir) / (key + ".v" + std::to_string(SNAPSHOT_VERSION) + SNAPSHOT_EXTENSION)).string();
+}
+
+YAML::Node tt_netlist_snapshot_cache::load_file(const std::string &netlist_path) {
+    return load_string(read_file(netlist_path));
+}
+
+YAML::Node tt_netlist_snapshot_cache::load_string(const std::string &netlist_contents) {
+    const std::string key = get_key(netlist_contents);
+    YAML::Node document = load_snapshot(key);
+    if (!document.IsNull()) {
+        log_debug(tt::LogNetlist, "Netlist snapshot cache hit for {}", key);
+        return document;
+    }
+    document = YAML::Load(netlist_contents);
+    store_snapshot(key, document);
+    return document;
+}
+
+YAML::Node tt_netlist_snapshot_cache::load_snapshot(const std::string &key) {
+    const std::string path = get_snapshot_path(key);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return YAML::Node(YAML::NodeType::Null);
+    }
+    YAML::Node document(YAML::NodeType::Null);
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0 and file_stat.st_size > 0) {
+        void *data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            document = deserialize_yaml_snapshot(static_cast<const std::uint8_t *>(data), file_stat.st_size, key);
+            munmap(data, file_stat.st_size);
+        }
+    }
+    close(fd);
+    if (document.IsNull()) {
+        log_warning(tt::LogNetlist, "Ignoring invalid netlist snapshot {}", path);
+    } else {
+        disk_cache::touch(path);
+    }
+    return document;
+}
+
+void tt_netlist_snapshot_cache::store_snapshot(const std::string &key, const YAML::Node &document) {
+    const std::vector<std::uint8_t> snapshot = serialize_yaml_snapshot(document, key);
+    // Written under a unique name and renamed into place, so concurrent readers never see a partial snapshot
+    const std::string path = get_snapshot_path(key);
+    const std::string staging_path = disk_cache::get_staging_path(path).string();
+    {
+        std::ofstream file(staging_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(snapshot.data()), snapshot.size());
+        if (!file.good()) {
+            log_warning(tt::LogNetlist, "Failed to write netlist snapshot {}", staging_path);
+            file.close();
+            std::error_code ec;
+            fs::remove(staging_path, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    fs::rename(staging_path, path, ec);
+    if (ec) {
+        log_warning(tt::LogNetlist, "Failed to publish netlist snapshot {}: {}", path, ec.message());
+        fs::remove(staging_path, ec);
+        return;
+    }
+    log_debug(tt::LogNetlist, "Stored netlist snapshot {} ({} bytes)", path, snapshot.size());
+    disk_cache::evict_least_recently_used(cache_dir, max_size_bytes, [](const fs::directory_entry &entry) {
+        return entry.is_regular_file() and entry.path().extension() == SNAPSHOT_EXTENSION;
+    }, tt::LogNetlist);
+}
+
+}  // namespace tt
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "yaml-cpp/yaml.h"
+
+namespace tt {
+
+// Compact binary encoding of a yaml document: a table of the distinct scalar and tag strings followed by the nodes in
+// pre-order. Decoding rebuilds the node tree without running the yaml scanner/parser, which dominates netlist load
+// times. Aliased nodes are encoded (and decoded) as copies.
+std::vector<std::uint8_t> serialize_yaml_snapshot(const YAML::Node &document, const std::string &key);
+// Returns a Null node if data is not a valid snapshot for key
+YAML::Node deserialize_yaml_snapshot(const std::uint8_t *data, std::size_t size, const std::string &key);
+
+// Persistent cache of parsed netlist documents, shared across runs and processes.
+//
+// Enabled by pointing TT_BACKEND_NETLIST_SNAPSHOT_DIR at a directory. Snapshots are keyed by a hash of the netlist
+// contents, so edited netlists never hit stale entries. The runtime, net2pipe, golden and their child processes all
+// parse the same netlist through netlist_parser::parse_file, so only the first of them pays for yaml parsing. Least
+// recently used snapshots are evicted once the cache grows past TT_BACKEND_NETLIST_SNAPSHOT_MAX_MB (1024 by default).
+class tt_netlist_snapshot_cache {
+   public:
+    tt_netlist_snapshot_cache(const std::string &cache_dir, std::uint64_t max_size_bytes);
+
+    // Returns the process wide cache configured through the environment, or nullptr if caching is disabled
+    static tt_netlist_snapshot_cache *get();
+    static std::string get_key(const std::string &netlist_contents);
+
+    // Memory maps the snapshot of the netlist, or parses the yaml and stores a snapshot on a miss
+    YAML::Node load_file(const std::string &netlist_path);
+    YAML::Node load_string(const std::string &netlist_contents);
+
+   private:
+    std::string cache_dir;
+    std::uint64_t max_size_bytes;
+
+    std::string get_snapshot_path(const std::string &key) const;
+    YAML::Node load_snapshot(const std::string &key);
+    void store_snapshot(const std::string &key, const YAML::Node &document);
+};
+
+}  // namespace tt
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares yaml parsing against snapshot loading for netlists, and checks that both produce the same document.
+// Usage: test_netlist_snapshot_bench [netlist or directory ...] [--iterations N]
+// Defaults to every netlist under verif/.
+#include <algorithm>
+#include <chrono>
+#include <experimental/filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "netlist/netlist_snapshot.hpp"
+#include "utils/logger.hpp"
+
+namespace fs = std::experimental::filesystem;
+
+namespace {
+
+struct bench_result {
+    double yaml_ms = 0;
+    double snapshot_ms = 0;
+    std::uint64_t yaml_bytes = 0;
+    std::uint64_t snapshot_bytes = 0;
+};
+
+std::vector<std::string> find_netlists(const std::vector<std::string> &paths) {
+    std::vector<std::string> netlists;
+    for (const auto &path : paths) {
+        if (!fs::is_directory(path)) {
+            netlists.push_back(path);
+            continue;
+        }
+        for (const auto &entry : fs::recursive_directory_iterator(path)) {
+            const std::string file = entry.path().string();
+            // Only netlists, verif/ also holds test configs and stimulus descriptors
+            if (fs::is_regular_file(entry.path()) and entry.path().extension() == ".yaml" and file.find("netlist") != std::string::npos) {
+                netlists.push_back(file);
+            }
+        }
+    }
+    std::sort(netlists.begin(), netlists.end());
+    return netlists;
+}
+
+template <typename F>
+double time_ms(int iterations, F &&func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        func();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::vector<std::string> paths;
+    int iterations = 3;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" and i + 1 < argc) {
+            iterations = std::stoi(argv[++i]);
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.empty()) {
+        paths.push_back("verif/");
+    }
+
+    const fs::path snapshot_path = fs::temp_directory_path() / ("netlist_snapshot_bench." + std::to_string(getpid()));
+    bench_result total;
+    int num_netlists = 0;
+    int num_mismatches = 0;
+    for (const auto &netlist : find_netlists(paths)) {
+        std::ifstream file(netlist, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+
+        YAML::Node yaml_document;
+        try {
+            yaml_document = YAML::Load(contents.str());
+        } catch (const std::exception &e) {
+            log_debug(tt::LogTest, "Skipping {}, not valid yaml: {}", netlist, e.what());
+            continue;
+        }
+        const std::string key = tt::tt_netlist_snapshot_cache::get_key(contents.str());
+        const std::vector<std::uint8_t> snapshot = tt::serialize_yaml_snapshot(yaml_document, key);
+        std::ofstream(snapshot_path, std::ios::binary).write(reinterpret_cast<const char *>(snapshot.data()), snapshot.size());
+
+        // Both sides include reading the file, as a cold load would
+        bench_result result;
+        result.yaml_ms = time_ms(iterations, [&] { YAML::LoadFile(netlist); });
+        YAML::Node snapshot_document;
+        result.snapshot_ms = time_ms(iterations, [&] {
+            std::ifstream snapshot_file(snapshot_path, std::ios::binary);
+            std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(snapshot_file)), std::istreambuf_iterator<char>());
+            snapshot_document = tt::deserialize_yaml_snapshot(data.data(), data.size(), key);
+        });
+        result.yaml_bytes = contents.str().size();
+        result.snapshot_bytes = snapshot.size();
+
+        if (YAML::Dump(yaml_document) != YAML::Dump(snapshot_document)) {
+            log_error("Snapshot of {} does not match its yaml document", netlist);
+            num_mismatches++;
+        }
+        log_debug(tt::LogTest, "{}: yaml {:.3f} ms, snapshot {:.3f} ms ({:.1f}x)", netlist, result.yaml_ms, result.snapshot_ms, result.yaml_ms / result.snapshot_ms);
+
+        total.yaml_ms += result.yaml_ms;
+        total.snapshot_ms += result.snapshot_ms;
+        total.yaml_bytes += result.yaml_bytes;
+        total.snapshot_bytes += result.snapshot_bytes;
+        num_netlists++;
+    }
+    fs::remove(snapshot_path);
+
+    log_info(tt::LogTest, "Netlists: {}, yaml: {} KB, snapshots: {} KB", num_netlists, total.yaml_bytes / 1024, total.snapshot_bytes / 1024);
+    log_info(tt::LogTest, "Yaml parse: {:.1f} ms, snapshot load: {:.1f} ms, speedup {:.1f}x", total.yaml_ms, total.snapshot_ms, total.yaml_ms / std::max(total.snapshot_ms, 1e-6));
+    log_assert(num_mismatches == 0, "{} snapshots did not match their yaml documents", num_mismatches);
+    return 0;
+}
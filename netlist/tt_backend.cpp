@@ -63,6 +63,7 @@ std::shared_ptr<tt_backend> tt_backend::create(const std::string &netlist_path,
         case tt::DEVICE::Versim:
         case tt::DEVICE::Silicon: 
         case tt::DEVICE::Emulation:
+        case tt::DEVICE::Mock:
             backend = std::make_shared<tt_runtime>(get_runtime_config(config, netlist_path)); 
             break;
         default: 
@@ -77,6 +78,7 @@ std::shared_ptr<tt_backend> tt_backend::create_eager_backend(const tt::tt_backen
     std::shared_ptr<tt_backend> backend;
     switch (config.type) {
         case tt::DEVICE::Versim:
+        case tt::DEVICE::Mock:
         case tt::DEVICE::Silicon: backend = std::make_shared<tt_runtime>(get_runtime_config(config, ""), target_devices); break;
         default: log_fatal("Not Supported Yet"); break;
     }
@@ -11,6 +11,7 @@
 #include "common/error_types.hpp"
 #include "common/mem_lib.hpp"
 #include "common/size_lib.hpp"
+#include "common/wait_lib.hpp"
 #include "compile_trisc/compile_trisc.hpp"
 #include "golden/golden_io.hpp"
 #include "netlist_utils.hpp"
@@ -35,6 +36,7 @@ tt::DEVICE_STATUS_CODE push_input(
             case tt::DEVICE::Versim:
             case tt::DEVICE::Silicon:
             case tt::DEVICE::Emulation:
+            case tt::DEVICE::Mock:
                 tt::io::push_input_to_device(q_desc, tilized_tensor_desc, timeout_in_seconds, ptr);
                 break;
             case tt::DEVICE::Golden:
@@ -74,6 +76,7 @@ tt::DEVICE_STATUS_CODE push_input(
             case tt::DEVICE::Versim:
             case tt::DEVICE::Silicon:
             case tt::DEVICE::Emulation:
+            case tt::DEVICE::Mock:
                 tt::io::push_input_to_device(q_desc, py_tensor_desc, push_one, timeout_in_seconds_override, ptr);
                 break;
             default: 
@@ -101,6 +104,51 @@ tt::DEVICE_STATUS_CODE push_input(
     }
 }
 
+tt::DEVICE_STATUS_CODE push_inputs(
+    const std::vector<tt::tt_dram_io_desc> &q_descs,
+    const std::vector<tt::tt_PytorchTensorDesc> &py_tensor_descs_in,
+    const bool push_one,
+    const int timeout_in_seconds) {
+    int timeout_in_seconds_override = parse_env("TT_BACKEND_PUSH_TIMEOUT", timeout_in_seconds);
+    try {
+        log_assert(q_descs.size() == py_tensor_descs_in.size(), "push_inputs in tt_backend_api.cpp expects one tensor per queue");
+        if (q_descs.empty()) {
+            return tt::DEVICE_STATUS_CODE::Success;
+        }
+        std::vector<tt::tt_PytorchTensorDesc> py_tensor_descs;
+        for (const tt::tt_PytorchTensorDesc &py_tensor_desc : py_tensor_descs_in) {
+            py_tensor_descs.push_back(tt::io::expand_pytorch_tensor_dims(py_tensor_desc));
+        }
+        for (const tt::tt_dram_io_desc &q_desc : q_descs) {
+            log_assert(q_desc.io_type == tt::IO_TYPE::Queue, "push_inputs in tt_backend_api.cpp only supports queues, use push_input for {}", q_desc.queue_name);
+            log_assert(q_desc.backend_type == q_descs.front().backend_type, "All queues of push_inputs must target the same backend");
+        }
+        switch (q_descs.front().backend_type) {
+            case tt::DEVICE::Golden:
+                for (std::size_t i = 0; i < q_descs.size(); i++) {
+                    tt::golden::io::push_input(q_descs.at(i), py_tensor_descs.at(i), push_one, timeout_in_seconds_override, -1);
+                }
+                break;
+            case tt::DEVICE::Versim:
+            case tt::DEVICE::Silicon:
+            case tt::DEVICE::Emulation:
+            case tt::DEVICE::Mock:
+                tt::io::push_inputs_to_device(q_descs, py_tensor_descs, push_one, timeout_in_seconds_override);
+                break;
+            default: 
+                log_fatal("Not Supported Yet"); 
+                break;
+        }
+        return tt::DEVICE_STATUS_CODE::Success;
+    } catch (tt::error_types::timeout_error &e) {
+        log_debug(tt::LogBackend, "{}", e.what());
+        return tt::DEVICE_STATUS_CODE::TimeoutError;
+    } catch (const std::exception &e) {
+        log_error("{}", e.what());
+        return tt::DEVICE_STATUS_CODE::RuntimeError;
+    }
+}
+
 tt::DEVICE_STATUS_CODE pop_output(
     const tt::tt_dram_io_desc &q_desc, const bool pop_one, const int timeout_in_seconds) {
     int timeout_in_seconds_override = parse_env("TT_BACKEND_POP_TIMEOUT", timeout_in_seconds);
@@ -112,6 +160,7 @@ tt::DEVICE_STATUS_CODE pop_output(
             case tt::DEVICE::Versim:
             case tt::DEVICE::Silicon: 
             case tt::DEVICE::Emulation:
+            case tt::DEVICE::Mock:
                 tt::io::pop_output_from_device(q_desc, pop_one, timeout_in_seconds_override); 
                 break;
             default: 
@@ -147,6 +196,7 @@ tt::DEVICE_STATUS_CODE get_output(
             case tt::DEVICE::Versim:
             case tt::DEVICE::Silicon:
             case tt::DEVICE::Emulation:
+            case tt::DEVICE::Mock:
                 tt::io::get_output_from_device(q_desc, py_tensor_desc, get_one, timeout_in_seconds_override, ptr);
                 break;
             default: 
@@ -175,6 +225,76 @@ tt::DEVICE_STATUS_CODE get_output(
     }
 }
 
+bool tt_io_request::poll() {
+    if (completed) {
+        return true;
+    }
+    try {
+        if (!is_ready()) {
+            return false;
+        }
+        status = issue();
+    } catch (const std::exception &e) {
+        // Queue checks throw on device errors, the request fails like the transfer itself would
+        log_error("{}", e.what());
+        status = tt::DEVICE_STATUS_CODE::RuntimeError;
+    }
+    completed = true;
+    return true;
+}
+
+tt::DEVICE_STATUS_CODE tt_io_request::wait(const int timeout_in_seconds) {
+    bool request_done = tt::wait::wait_with_backoff(
+        [this] { return poll(); }, std::chrono::steady_clock::now(), std::chrono::seconds{timeout_in_seconds});
+    return request_done ? status : tt::DEVICE_STATUS_CODE::TimeoutError;
+}
+
+// Golden transfers never wait on the device, they are issued on the first poll
+static bool is_async_io_on_device(const tt::DEVICE backend_type) {
+    return backend_type == tt::DEVICE::Versim or backend_type == tt::DEVICE::Silicon or
+           backend_type == tt::DEVICE::Emulation or backend_type == tt::DEVICE::Mock;
+}
+
+std::shared_ptr<tt_io_request> push_input_async(
+    const tt::tt_dram_io_desc &q_desc,
+    const tt::tt_PytorchTensorDesc &py_tensor_desc,
+    const bool push_one,
+    const int ptr) {
+    const int push_count = push_one ? 1 : tt::io::expand_pytorch_tensor_dims(py_tensor_desc).shape[0];
+    return std::make_shared<tt_io_request>(
+        [q_desc, push_count] { return !is_async_io_on_device(q_desc.backend_type) or tt::io::is_input_queue_freed(q_desc, push_count); },
+        [q_desc, py_tensor_desc, push_one, ptr] { return push_input(q_desc, py_tensor_desc, push_one, 1, ptr); });
+}
+
+std::shared_ptr<tt_io_request> push_input_async(
+    const tt::tt_dram_io_desc &q_desc,
+    const tt::tt_TilizedTensorDesc &tilized_tensor_desc,
+    const int ptr) {
+    const int block_size = tt::size::get_entry_size_in_bytes(q_desc.bufq_target_format, q_desc.layout == IO_LAYOUT::Tilized,
+        q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width);
+    const int push_count = tilized_tensor_desc.buf_size_bytes / block_size;
+    return std::make_shared<tt_io_request>(
+        [q_desc, push_count] { return !is_async_io_on_device(q_desc.backend_type) or tt::io::is_input_queue_freed(q_desc, push_count); },
+        [q_desc, tilized_tensor_desc, ptr] { return push_input(q_desc, tilized_tensor_desc, 1, ptr); });
+}
+
+std::shared_ptr<tt_io_request> get_output_async(
+    const tt::tt_dram_io_desc &q_desc,
+    tt::tt_PytorchTensorDesc &py_tensor_desc,
+    const bool get_one,
+    const int ptr) {
+    return std::make_shared<tt_io_request>(
+        [q_desc, get_one] {
+            if (!is_async_io_on_device(q_desc.backend_type)) {
+                return true;
+            }
+            tt_runtime_workload &workload = *tt::io::get_workload(q_desc.netlist_path);
+            const int num_entries = get_one ? 1 : workload.queues.at(q_desc.queue_name).my_queue_info.input_count;
+            return tt::io::is_output_queue_populated(q_desc, num_entries);
+        },
+        [q_desc, &py_tensor_desc, get_one, ptr] { return get_output(q_desc, py_tensor_desc, get_one, 1, ptr); });
+}
+
 tt::DEVICE_STATUS_CODE translate_addresses(tt::tt_dram_io_desc &q_desc) {
     try {
         switch (q_desc.backend_type) {
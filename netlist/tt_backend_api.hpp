@@ -3,6 +3,9 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "tt_backend_api_types.hpp"
 #include "perf_lib/op_model/op_model.hpp"
 #include "common/param_lib.hpp"
@@ -43,6 +46,22 @@ tt::DEVICE_STATUS_CODE push_input(
     const int timeout_in_seconds,
     const int ptr = -1);
 
+/**
+ * @brief Write the Pytorch Tensor inputs of a step to their queues
+ * Tilizing of later inputs overlaps with the writes of earlier ones and the write pointers of all queues are updated
+ * together at the end, a failed push publishes none of its pipelined inputs. Each queue may only appear once.
+ * \param q_descs Queue descriptors
+ * \param py_tensor_descs Pytorch Tensor descriptors, one per queue descriptor
+ * \param push_one Push one entry or a batch of entries, batch size is the outer most dimension of the tensor
+ * \param timeout_in_seconds Timeout in seconds for the whole push
+ * @return DEVICE_STATUS_CODE indicating success/failure/timeout
+ */
+tt::DEVICE_STATUS_CODE push_inputs(
+    const std::vector<tt::tt_dram_io_desc> &q_descs,
+    const std::vector<tt::tt_PytorchTensorDesc> &py_tensor_descs,
+    const bool push_one,
+    const int timeout_in_seconds);
+
 /**
  * @brief Popping output from queue
  * Only frees entries from a queue, for reading data use get_output. Cannot be performed on ram.
@@ -69,6 +88,79 @@ tt::DEVICE_STATUS_CODE get_output(
     const int timeout_in_seconds,
     const int ptr = -1);
 
+/**
+ * @brief Completion handle of an asynchronous push/get
+ * The transfer is issued by whichever thread polls the handle once the queue has room/data, so a single thread can
+ * service many queues by polling their handles in turn. Tensors referenced by the request must stay alive until done.
+ */
+class tt_io_request {
+   public:
+    tt_io_request(std::function<bool()> is_ready, std::function<tt::DEVICE_STATUS_CODE()> issue) :
+        is_ready(std::move(is_ready)), issue(std::move(issue)) {}
+
+    /**
+     * @brief Non-blocking, issues the transfer if the queue is ready
+     * @return true once the request completed, successfully or not. Errors while checking the queue or issuing the
+     * transfer complete the request with RuntimeError.
+     */
+    bool poll();
+
+    /**
+     * @brief Polls with backoff until the request completes or the timeout expires
+     * @return Status of the transfer, or TimeoutError if still pending. A timed out request can be polled again.
+     */
+    tt::DEVICE_STATUS_CODE wait(const int timeout_in_seconds);
+
+    bool done() const { return completed; }
+    tt::DEVICE_STATUS_CODE get_status() const { return status; }
+
+   private:
+    std::function<bool()> is_ready;
+    std::function<tt::DEVICE_STATUS_CODE()> issue;
+    bool completed = false;
+    tt::DEVICE_STATUS_CODE status = tt::DEVICE_STATUS_CODE::TimeoutError;
+};
+
+/**
+ * @brief Asynchronous variant of push_input, the push is issued once the queue has space for all entries
+ * \param q_desc Queue descriptor
+ * \param py_tensor_desc Pytorch Tensor descriptor, its data must stay alive until the request is done
+ * \param push_one Push one entry or a batch of entries, batch size is the outer most dimension of the tensor
+ * \param ptr Pointer to the ram address, must be provided when accessing ram type memory. Ignored for queue type memory
+ * @return Completion handle
+ */
+std::shared_ptr<tt_io_request> push_input_async(
+    const tt::tt_dram_io_desc &q_desc,
+    const tt::tt_PytorchTensorDesc &py_tensor_desc,
+    const bool push_one,
+    const int ptr = -1);
+
+/**
+ * @brief Asynchronous variant of push_input for Tilized Tensors
+ * \param q_desc Queue descriptor
+ * \param tilized_tensor_desc Tilized Tensor descriptor, its data must stay alive until the request is done
+ * \param ptr Pointer to the ram address, must be provided when accessing ram type memory. Ignored for queue type memory
+ * @return Completion handle
+ */
+std::shared_ptr<tt_io_request> push_input_async(
+    const tt::tt_dram_io_desc &q_desc,
+    const tt::tt_TilizedTensorDesc &tilized_tensor_desc,
+    const int ptr = -1);
+
+/**
+ * @brief Asynchronous variant of get_output, the read is issued once the queue holds all entries
+ * \param q_desc Queue descriptor
+ * \param py_tensor_desc Tensor descriptor, filled in once the request is done and must stay alive until then
+ * \param get_one Get one entry or a batch of entries, batch size is the outer most dimension of the tensor
+ * \param ptr Pointer to the ram address, must be provided when accessing ram type memory. Ignored for queue type memory
+ * @return Completion handle
+ */
+std::shared_ptr<tt_io_request> get_output_async(
+    const tt::tt_dram_io_desc &q_desc,
+    tt::tt_PytorchTensorDesc &py_tensor_desc,
+    const bool get_one,
+    const int ptr = -1);
+
 /**
  * @brief Address translation API for queues
  * Translates from a local device relative address to a system level user-space address
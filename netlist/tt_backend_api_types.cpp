@@ -175,6 +175,7 @@ std::string get_string(DEVICE device) {
         case DEVICE::Silicon: return "Silicon"; break;
         case DEVICE::Golden: return "Golden"; break;
         case DEVICE::StaticAnalyzer: return "StaticAnalyzer"; break;
+        case DEVICE::Mock: return "Mock"; break;
         case DEVICE::Invalid: return "Invalid"; break;
         default: return "Invalid"; break;
     }
@@ -191,6 +192,8 @@ DEVICE get_device_from_string(const std::string &device_string) {
         return DEVICE::Golden;
     }  else if (device_string == "StaticAnalyzer") {
         return DEVICE::StaticAnalyzer;
+    } else if (device_string == "Mock") {
+        return DEVICE::Mock;
     } else {
         return DEVICE::Invalid;
     }
@@ -335,10 +338,10 @@ std::string get_string(const IO_TYPE &io_type) {
     }
 }
 
-bool tensor_meta_to_tensor_desc(const tt_device_image::tensor_meta &meta, std::vector<float> &tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format) {
+namespace {
+bool fill_tensor_desc(const tt_device_image::tensor_meta &meta, const void *tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format) {
     bool tilized;
-    std::string tensor_bin = std::get<0>(meta);
-    tt::data_binary::read_file(tensor_bin, tensor_data);
+    const std::string &tensor_bin = std::get<0>(meta);
     tt::DataFormat tensor_df = get_format_from_string(std::get<2>(meta));
     // Ambiguity between Int32/Int8 and RawUint32/RawUInt8 when tensor metadata is generated 
     // Temprorarily resolve this by inferring the tensor format from the queue descriptor target format, 
@@ -356,7 +359,7 @@ bool tensor_meta_to_tensor_desc(const tt_device_image::tensor_meta &meta, std::v
 
     if(tensor_bin.find(".tbin") == std::string::npos) {
         
-        pytorch_tensor = tt_PytorchTensorDesc(tensor_data.data(), std::get<1>(meta), tensor_df, {}, {}, std::get<5>(meta));
+        pytorch_tensor = tt_PytorchTensorDesc(tensor_data, std::get<1>(meta), tensor_df, {}, {}, std::get<5>(meta));
         for (int i = 0; i < PY_TENSOR_DIMS; i++) {
             pytorch_tensor.shape[i] = std::get<3>(meta)[i];
             pytorch_tensor.strides[i] = std::get<4>(meta)[i];
@@ -365,11 +368,27 @@ bool tensor_meta_to_tensor_desc(const tt_device_image::tensor_meta &meta, std::v
     }
     else {
         // Expects the following order: {bin_name, num_bufs, format, empty, empty, buf_size_bytes}
-        tilized_tensor = tt_TilizedTensorDesc(tensor_data.data(), std::get<1>(meta), std::get<5>(meta), tensor_df);
+        tilized_tensor = tt_TilizedTensorDesc(tensor_data, std::get<1>(meta), std::get<5>(meta), tensor_df);
         tilized = true;
     }
 
     return tilized;
 }
+}  // namespace
+
+bool tensor_meta_to_tensor_desc(const tt_device_image::tensor_meta &meta, std::vector<float> &tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format) {
+    tt::data_binary::read_file(std::get<0>(meta), tensor_data);
+    return fill_tensor_desc(meta, tensor_data.data(), pytorch_tensor, tilized_tensor, buf_target_format);
+}
+
+bool tensor_meta_to_tensor_desc(const tt_device_image &tti, const std::string &name, std::vector<float> &tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format) {
+    const tt_device_image::tensor_meta meta = tti.get_tensor_meta(name);
+    std::size_t mapped_size = 0;
+    const void *mapped_data = tti.get_mapped_file(std::get<0>(meta), mapped_size);
+    if (mapped_data == nullptr) {
+        return tensor_meta_to_tensor_desc(meta, tensor_data, pytorch_tensor, tilized_tensor, buf_target_format);
+    }
+    return fill_tensor_desc(meta, mapped_data, pytorch_tensor, tilized_tensor, buf_target_format);
+}
 
 }  // namespace tt
@@ -189,6 +189,7 @@ enum class DEVICE {
     Golden = 3,
     StaticAnalyzer = 4,
     Emulation = 5,
+    Mock = 6,
     Invalid = 0xFF,
 };
 std::string get_string(DEVICE device);
@@ -509,6 +510,12 @@ struct tt_PytorchTensorDesc {
  */
 bool tensor_meta_to_tensor_desc(const tt_device_image::tensor_meta &meta, std::vector<float> &tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format);
 
+/**
+ * @brief Adapter function to describe a parameter or constant of a pre-compiled image. Tensors left memory mapped in the
+ * image are described in place, tensor_data is only filled for tensors that were extracted to disk.
+ */
+bool tensor_meta_to_tensor_desc(const tt_device_image &tti, const std::string &name, std::vector<float> &tensor_data, tt_PytorchTensorDesc& pytorch_tensor, tt_TilizedTensorDesc& tilized_tensor, DataFormat buf_target_format);
+
 /**
  * @brief Descriptor used in Buda OP perf modeling
  */
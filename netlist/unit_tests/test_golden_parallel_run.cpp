@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <unistd.h>
+
+#include <cstring>
+#include <experimental/filesystem>
+#include <fstream>
+
+#include "golden/tt_golden.hpp"
+#include "gtest/gtest.h"
+#include "model/tt_rnd_util.hpp"
+#include "netlist/netlist_info_types.hpp"
+
+namespace {
+
+// exp0 and gelu0 only depend on q0 and share the first level, sum0 and mm0 make up the next two
+const std::string forked_netlist = R"(devices:
+  arch: [grayskull, wormhole, wormhole_b0]
+
+queues:
+  q0    : {type: queue, input: HOST, entries: 1, grid_size: [1, 1], t: 2, mblock: [2, 2], ublock: [2, 2], df: Float16_b, target_device: 0, loc: dram, dram: [[0, 0x11000000]]}
+  output: {type: queue, input: mm0 , entries: 1, grid_size: [1, 1], t: 2, mblock: [2, 2], ublock: [2, 2], df: Float16_b, target_device: 0, loc: dram, dram: [[0, 0x13000000]]}
+
+graphs:
+  test_fork:
+    target_device: 0
+    input_count: 1
+    exp0:  {type: exp, grid_loc: [0, 0], grid_size: [1, 1], inputs: [q0], in_df: [Float16_b], acc_df: Float16_b, out_df: Float16_b, intermed_df: Float16_b, ublock_order: r, buf_size_mb: 2, math_fidelity: HiFi3, untilize_output: false, t: 2, mblock: [2, 2], ublock: [2, 2]}
+    gelu0: {type: gelu, grid_loc: [0, 1], grid_size: [1, 1], inputs: [q0], in_df: [Float16_b], acc_df: Float16_b, out_df: Float16_b, intermed_df: Float16_b, ublock_order: r, buf_size_mb: 2, math_fidelity: HiFi3, untilize_output: false, t: 2, mblock: [2, 2], ublock: [2, 2]}
+    sum0:  {type: add, grid_loc: [0, 2], grid_size: [1, 1], inputs: [exp0, gelu0], in_df: [Float16_b, Float16_b], acc_df: Float16_b, out_df: Float16_b, intermed_df: Float16_b, ublock_order: r, buf_size_mb: 2, math_fidelity: HiFi3, untilize_output: false, t: 2, mblock: [2, 2], ublock: [2, 2]}
+    mm0:   {type: matmul, grid_loc: [0, 3], grid_size: [1, 1], inputs: [sum0, gelu0], in_df: [Float16_b, Float16_b], acc_df: Float16_b, out_df: Float16_b, intermed_df: Float16_b, ublock_order: r, buf_size_mb: 2, math_fidelity: HiFi3, untilize_output: false, t: 2, mblock: [2, 2], ublock: [2, 2], attributes: {m_k: 2, u_kt: 2}}
+
+programs:
+  - program0:
+      - staticvar: {$q_rdptr0: 0}
+      - var: {$c_num_loops: 1, $c_incr: 1}
+      - loop: $c_num_loops
+      - execute: {graph_name: test_fork, queue_settings: {
+          q0: {prologue: false, epilogue: false, zero: false, rd_ptr_local: $q_rdptr0, rd_ptr_global: $q_rdptr0}}}
+      - varinst: [$q_rdptr0, incwrap, $c_incr, 2]
+      - endloop
+)";
+
+std::string write_forked_netlist() {
+    const std::string path =
+        std::experimental::filesystem::temp_directory_path().string() + "/golden_parallel_run_" + std::to_string(getpid()) + ".yaml";
+    std::ofstream(path) << forked_netlist;
+    return path;
+}
+
+// Every run reseeds, so all of them see the same input
+std::vector<float> run_golden(const std::string &netlist_path, int num_threads) {
+    tt::golden::tt_golden_config config;
+    config.type = tt::DEVICE::Golden;
+    config.num_threads = num_threads;
+    tt::golden::tt_golden golden(netlist_path, config);
+    golden.initialize();
+    tt_rnd_set_seed(0);
+    auto input = std::make_shared<tt_tensor>(get_tensor_metadata_from_tt_queue_info(golden.get_queue_info("q0"), false));
+    input->randomize_uniform(-1.0f, 1.0f);
+    golden.push_input(golden.get_queue_info("q0"), input);
+    golden.run_program("program0", {});
+    std::shared_ptr<tt_tensor> output = golden.pop_output(golden.get_queue_info("output"));
+    std::vector<float> output_data;
+    output->untilize_to_flat_tensor_data(true, false, false, output_data);
+    return output_data;
+}
+
+}  // namespace
+
+TEST(GoldenParallelRun, MatchesSerialRunBitForBit) {
+    const std::string netlist_path = write_forked_netlist();
+    const std::vector<float> serial_output = run_golden(netlist_path, 1);
+    for (const int num_threads : {2, 8}) {
+        const std::vector<float> parallel_output = run_golden(netlist_path, num_threads);
+        ASSERT_EQ(parallel_output.size(), serial_output.size());
+        EXPECT_EQ(std::memcmp(parallel_output.data(), serial_output.data(), serial_output.size() * sizeof(float)), 0)
+            << "Output of a run on " << num_threads << " threads differs from the serial run";
+    }
+    std::experimental::filesystem::remove(netlist_path);
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "gtest/gtest.h"
+#include "tt_backend_api.hpp"
+
+TEST(IoRequest, IssuedOnceWhenReady) {
+    int num_polls_until_ready = 3;
+    int num_issues = 0;
+    tt::backend::tt_io_request request(
+        [&] { return --num_polls_until_ready <= 0; },
+        [&] { num_issues++; return tt::DEVICE_STATUS_CODE::Success; });
+
+    EXPECT_FALSE(request.poll());
+    EXPECT_FALSE(request.poll());
+    EXPECT_FALSE(request.done());
+    EXPECT_EQ(num_issues, 0);
+
+    EXPECT_TRUE(request.poll());
+    EXPECT_TRUE(request.poll());
+    EXPECT_EQ(num_issues, 1);
+    EXPECT_EQ(request.get_status(), tt::DEVICE_STATUS_CODE::Success);
+}
+
+TEST(IoRequest, WaitTimesOutAndCanBeResumed) {
+    bool ready = false;
+    tt::backend::tt_io_request request(
+        [&] { return ready; },
+        [&] { return tt::DEVICE_STATUS_CODE::Success; });
+
+    EXPECT_EQ(request.wait(1), tt::DEVICE_STATUS_CODE::TimeoutError);
+    EXPECT_FALSE(request.done());
+
+    ready = true;
+    EXPECT_EQ(request.wait(1), tt::DEVICE_STATUS_CODE::Success);
+    EXPECT_TRUE(request.done());
+}
+
+TEST(IoRequest, FailedIssueCompletesWithError) {
+    tt::backend::tt_io_request request(
+        [] { return true; },
+        [] { return tt::DEVICE_STATUS_CODE::RuntimeError; });
+
+    EXPECT_EQ(request.wait(1), tt::DEVICE_STATUS_CODE::RuntimeError);
+    EXPECT_TRUE(request.done());
+}
+
+TEST(IoRequest, ErrorAfterBackoffCompletesWithError) {
+    int num_polls = 0;
+    tt::backend::tt_io_request request(
+        [&] {
+            if (++num_polls > 3) {
+                throw std::runtime_error("Queue check failed");
+            }
+            return false;
+        },
+        [] { return tt::DEVICE_STATUS_CODE::Success; });
+
+    EXPECT_EQ(request.wait(1), tt::DEVICE_STATUS_CODE::RuntimeError);
+    EXPECT_TRUE(request.done());
+    EXPECT_EQ(num_polls, 4);
+}
+
+TEST(IoRequest, FailingDeviceReadCompletesWithError) {
+    // The device queue check has no workload to find the queue in
+    tt::tt_dram_io_desc q_desc;
+    q_desc.netlist_path = "netlist/unit_tests/missing_netlist.yaml";
+    q_desc.queue_name = "output";
+    q_desc.backend_type = tt::DEVICE::Mock;
+    tt::tt_PytorchTensorDesc py_tensor_desc;
+    const std::shared_ptr<tt::backend::tt_io_request> read = tt::backend::get_output_async(q_desc, py_tensor_desc, true);
+
+    EXPECT_TRUE(read->poll());
+    EXPECT_EQ(read->get_status(), tt::DEVICE_STATUS_CODE::RuntimeError);
+    EXPECT_EQ(read->wait(1), tt::DEVICE_STATUS_CODE::RuntimeError);
+}
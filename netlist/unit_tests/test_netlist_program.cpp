@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "gtest/gtest.h"
+#include "netlist/netlist_program.hpp"
+
+namespace {
+
+tt_instruction_info var(INSTRUCTION_OPCODE opcode, std::vector<std::pair<string, int>> vars) {
+    return {.opcode = opcode, .vars = vars};
+}
+
+tt_instruction_info varinst(VAR_INSTRUCTION_OPCODE varinst_opcode, std::vector<string> operands) {
+    tt_instruction_info instrn = {.opcode = INSTRUCTION_OPCODE::VarInst, .varinst_opcode = varinst_opcode};
+    for (const string &operand : operands) {
+        instrn.vars.push_back({operand, 0});
+    }
+    return instrn;
+}
+
+tt_instruction_info loop(const string &loop_count) { return {.opcode = INSTRUCTION_OPCODE::Loop, .loop_count = loop_count}; }
+tt_instruction_info end_loop() { return {.opcode = INSTRUCTION_OPCODE::EndLoop}; }
+tt_instruction_info execute(const string &graph_name) { return {.opcode = INSTRUCTION_OPCODE::Execute, .graph_name = graph_name}; }
+tt_instruction_info end_program() { return {.opcode = INSTRUCTION_OPCODE::EndProgram}; }
+
+// Runs the program to its end, returning the number of instructions the callbacks saw
+int run(netlist_program &program, std::vector<string> &executed_graphs) {
+    int num_steps = 0;
+    while (!program.done()) {
+        program.run_instruction_with_callbacks(
+            [&num_steps](netlist_program &) { num_steps++; },
+            [&executed_graphs](netlist_program &program) { executed_graphs.push_back(program.get_current_instruction().graph_name); },
+            {});
+    }
+    return num_steps;
+}
+
+// Outer loop executing a graph, with an inner loop that only does arithmetic on $acc
+netlist_program make_nested_program() {
+    return netlist_program(
+        "nested",
+        {var(INSTRUCTION_OPCODE::StaticVar, {{"$sptr", 0}}),
+         var(INSTRUCTION_OPCODE::Var, {{"$acc", 0}, {"$ptr", 0}}),
+         loop("3"),
+         execute("graph"),
+         varinst(VAR_INSTRUCTION_OPCODE::IncWrap, {"$ptr", "1", "2"}),
+         loop("4"),
+         varinst(VAR_INSTRUCTION_OPCODE::Add, {"$acc", "$acc", "$ptr"}),
+         varinst(VAR_INSTRUCTION_OPCODE::Inc, {"$sptr", "1"}),
+         end_loop(),
+         end_loop(),
+         end_program()});
+}
+
+}  // namespace
+
+TEST(NetlistProgram, RunsLoopsAndVariableInstructions) {
+    netlist_program program = make_nested_program();
+    std::vector<string> executed_graphs;
+    run(program, executed_graphs);
+
+    EXPECT_EQ(executed_graphs, std::vector<string>(3, "graph"));
+    // ptr steps through 1, 0, 1 and is added to acc four times per outer iteration
+    EXPECT_EQ(program.get_variable("$ptr").value, 1);
+    EXPECT_EQ(program.get_variable("$acc").value, 8);
+    EXPECT_EQ(program.get_variable("$sptr").value, 12);
+    EXPECT_EQ(program.get_variable("7").value, 7);
+    EXPECT_EQ(program.get_variable_type("$sptr"), VARIABLE_TYPE::STATIC);
+
+    // Static variables survive a reset, local ones are declared again
+    program.reset();
+    EXPECT_FALSE(program.has_variable("$acc"));
+    EXPECT_EQ(program.get_variables(), (std::unordered_map<string, int>{{"sptr", 12}}));
+    run(program, executed_graphs);
+    EXPECT_EQ(program.get_variable("$sptr").value, 24);
+}
+
+TEST(NetlistProgram, BatchesLoopsWithoutHostVisibleSideEffects) {
+    netlist_program stepped = make_nested_program();
+    netlist_program batched = make_nested_program();
+    batched.set_loop_batching([](const string &) { return false; });
+    std::vector<string> stepped_graphs;
+    std::vector<string> batched_graphs;
+    const int num_stepped = run(stepped, stepped_graphs);
+    const int num_batched = run(batched, batched_graphs);
+
+    EXPECT_EQ(stepped_graphs, batched_graphs);
+    EXPECT_EQ(stepped.get_variables(), batched.get_variables());
+    // Per outer iteration the callbacks only see the last EndLoop of the inner loop, not its Loop and 4 * 3 body steps
+    EXPECT_EQ(num_stepped - num_batched, 3 * 12);
+
+    // Loops writing a variable the host tracks are stepped through
+    netlist_program tracked = make_nested_program();
+    tracked.set_loop_batching([](const string &variable) { return variable == "$sptr"; });
+    std::vector<string> tracked_graphs;
+    EXPECT_EQ(run(tracked, tracked_graphs), num_stepped);
+}
+
+TEST(NetlistProgram, ExecuteTraceUnrollsLoops) {
+    netlist_program program(
+        "trace",
+        {var(INSTRUCTION_OPCODE::Var, {{"$count", 2}}),
+         loop("$count"),
+         execute("fwd"),
+         execute("bwd"),
+         end_loop(),
+         end_program()});
+    EXPECT_EQ(program.get_execute_trace(16, 64), (std::vector<string>{"fwd", "bwd", "fwd", "bwd"}));
+    EXPECT_EQ(program.get_execute_trace(4, 64), (std::vector<string>{"fwd", "bwd", "fwd", "bwd"}));
+    // Truncated traces are dropped rather than returned in part
+    EXPECT_FALSE(program.get_execute_trace(3, 64).has_value());
+    // Dry runs leave the program untouched
+    EXPECT_EQ(program.get_current_pc(), 0);
+    EXPECT_FALSE(program.has_variable("$count"));
+}
+
+TEST(NetlistProgram, ExecuteTraceCapsInstructions) {
+    // Long loop doing only arithmetic between two executes
+    netlist_program program(
+        "trace",
+        {var(INSTRUCTION_OPCODE::Var, {{"$count", 1 << 30}, {"$acc", 0}}),
+         execute("fwd"),
+         loop("$count"),
+         varinst(VAR_INSTRUCTION_OPCODE::Add, {"$acc", "$acc", "$count"}),
+         end_loop(),
+         execute("bwd"),
+         end_program()});
+    EXPECT_FALSE(program.get_execute_trace(16, 1000).has_value());
+    EXPECT_EQ(program.get_current_pc(), 0);
+}
+
+TEST(NetlistProgram, ResolvesGraphAndQueueHandles) {
+    tt_instruction_info fwd = execute("fwd");
+    fwd.queue_settings = {{.name = "act"}, {.name = "weights"}};
+    tt_instruction_info bwd = execute("bwd");
+    bwd.queue_settings = {{.name = "grad"}, {.name = "act"}};
+    netlist_program program("handles", {loop("2"), fwd, bwd, end_loop(), execute("fwd"), end_program()});
+
+    EXPECT_EQ(program.get_graph_handle_names(), (std::vector<string>{"fwd", "bwd"}));
+    EXPECT_EQ(program.get_queue_handle_names(), (std::vector<string>{"act", "weights", "grad"}));
+    EXPECT_EQ(program.get_queue_handles(1), (std::vector<int>{0, 1}));
+    EXPECT_EQ(program.get_queue_handles(2), (std::vector<int>{2, 0}));
+    EXPECT_TRUE(program.get_queue_handles(4).empty());
+
+    std::vector<int> executed_handles;
+    while (!program.done()) {
+        program.run_instruction_with_execute_callback(
+            [&executed_handles](netlist_program &program) { executed_handles.push_back(program.get_current_graph_handle()); });
+    }
+    EXPECT_EQ(executed_handles, (std::vector<int>{0, 1, 0, 1, 0}));
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "common/tt_parallel_for.h"
+#include "gtest/gtest.h"
+
+TEST(TaskScheduler, ParallelForVisitsEveryIndexOnce) {
+    std::vector<std::atomic<int>> visits(1000);
+    tt::parallel_for(0, static_cast<int>(visits.size()), [&](int index) { visits[index]++; }, 8);
+    for (const auto &count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(TaskScheduler, ParallelForWalksNonRandomAccessIterators) {
+    std::list<int> items(257);
+    std::iota(items.begin(), items.end(), 0);
+    std::atomic<int> sum = 0;
+    tt::parallel_for(items.begin(), items.end(), [&](int item) { sum += item; }, 4);
+    EXPECT_EQ(sum.load(), 256 * 257 / 2);
+}
+
+TEST(TaskScheduler, NestedParallelForCompletes) {
+    std::atomic<int> num_inner = 0;
+    tt::parallel_for(0, 16, [&](int) {
+        tt::parallel_for(0, 64, [&](int) { num_inner++; }, 8);
+    }, 8);
+    EXPECT_EQ(num_inner.load(), 16 * 64);
+}
+
+TEST(TaskScheduler, NestedParallelForSharesOnePool) {
+    // Inner loops of a parallel outer loop must not add threads on top of the scheduler's workers
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    tt::parallel_for(0, 16, [&](int) {
+        tt::parallel_for(0, 64, [&](int) {
+            std::lock_guard<std::mutex> lock(mutex);
+            thread_ids.insert(std::this_thread::get_id());
+        }, 8);
+    }, 8);
+    EXPECT_LE(thread_ids.size(), tt::tt_task_scheduler::get().get_num_threads() + 1);
+}
+
+TEST(TaskScheduler, ParallelForRethrowsFirstException) {
+    EXPECT_THROW(
+        tt::parallel_for(0, 100, [](int index) {
+            if (index == 42) {
+                throw std::runtime_error("failed item");
+            }
+        }, 8),
+        std::runtime_error);
+}
+
+TEST(TaskScheduler, WaitIdleRunsAllSubmittedTasks) {
+    tt::tt_task_scheduler scheduler(3);
+    std::atomic<int> num_runs = 0;
+    for (int i = 0; i < 100; i++) {
+        scheduler.submit([&] {
+            num_runs++;
+        });
+    }
+    scheduler.wait_idle();
+    EXPECT_FALSE(scheduler.busy());
+    EXPECT_EQ(num_runs.load(), 100);
+
+    scheduler.submit([] { throw std::runtime_error("failed task"); });
+    EXPECT_THROW(scheduler.wait_idle(), std::runtime_error);
+    // Exceptions are only reported once
+    scheduler.wait_idle();
+}
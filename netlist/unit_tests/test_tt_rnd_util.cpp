@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "model/tensor.hpp"
+#include "model/tt_rnd_util.hpp"
+
+namespace {
+
+// Flips the Philox rounds to scalar for the scope, restores them on exit so a failing assert doesn't leak it
+struct force_scalar_philox {
+    force_scalar_philox() { tt::test::tt_philox_force_scalar = true; }
+    ~force_scalar_philox() { tt::test::tt_philox_force_scalar = false; }
+};
+
+std::vector<std::uint32_t> philox_words(std::uint64_t key, std::uint64_t stream, std::size_t num_words) {
+    std::vector<std::uint32_t> words(num_words);
+    tt::test::tt_philox_fill(key, stream, words.data(), num_words);
+    return words;
+}
+
+// Philox4x32-10 known answer from Random123 (kat_vectors), counter and key all zero. Its 4 words are words 0, 8, 16
+// and 24 of stream 0 for key 0
+void check_philox_known_answer() {
+    const std::vector<std::uint32_t> words = philox_words(0, 0, 32);
+    EXPECT_EQ(words[0], 0x6627e8d5u);
+    EXPECT_EQ(words[8], 0xe169c58du);
+    EXPECT_EQ(words[16], 0xbc57ac4cu);
+    EXPECT_EQ(words[24], 0x9b00dbd8u);
+}
+
+}  // namespace
+
+TEST(PhiloxRng, KnownAnswer) { check_philox_known_answer(); }
+
+TEST(PhiloxRng, ScalarKnownAnswer) {
+    force_scalar_philox scalar;
+    check_philox_known_answer();
+}
+
+TEST(PhiloxRng, ScalarMatchesVectorized) {
+    // Lengths off the 32 word group, and streams and keys using both halves
+    for (const std::uint64_t key : std::vector<std::uint64_t>{0, 1, 0x0123456789abcdef, tt::test::tt_philox_key(7, 3)}) {
+        for (const std::uint64_t stream : std::vector<std::uint64_t>{0, 5, 0xfedcba9876543210}) {
+            for (const std::size_t num_words : std::vector<std::size_t>{1, 31, 32, 33, 1024, 1031}) {
+                const std::vector<std::uint32_t> vectorized = philox_words(key, stream, num_words);
+                force_scalar_philox scalar;
+                ASSERT_EQ(philox_words(key, stream, num_words), vectorized)
+                    << "key " << key << " stream " << stream << " num_words " << num_words;
+            }
+        }
+    }
+}
+
+TEST(PhiloxRng, TensorRandomizeMatchesSerialFill) {
+    // randomize spreads the tiles over all allowed threads, every tile must hold its own stream as drawn on one thread
+    tt::tt_tensor tensor(tt::tt_shape{.rt = 3, .ct = 5, .z = 2, .w = 2}, tt::DataFormat::Float32);
+    tt::test::tt_rnd_set_seed(11);
+    tensor.randomize(0.0f, 1.0f);
+    tt::test::tt_rnd_set_seed(11);
+    const std::uint64_t key = tt::test::tt_rnd_tensor_key();
+
+    constexpr std::size_t tile_datums = tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH;
+    int tile_index = 0;
+    for (std::uint32_t wi = 0; wi < tensor.getw(); wi++) {
+        for (std::uint32_t zi = 0; zi < tensor.getz(); zi++) {
+            for (std::uint32_t ri = 0; ri < tensor.getrt(); ri++) {
+                for (std::uint32_t ci = 0; ci < tensor.getct(); ci++, tile_index++) {
+                    std::vector<float> expected(tile_datums);
+                    tt::test::tt_philox_fill_normal(key, tile_index, expected.data(), tile_datums, 0.0, 1.0);
+                    ASSERT_EQ(std::memcmp(tensor.tile_tensor[wi][zi][ri][ci].t[0], expected.data(), tile_datums * sizeof(float)), 0)
+                        << "tile " << tile_index;
+                }
+            }
+        }
+    }
+}
@@ -623,6 +623,25 @@ void Chip::mapGrid(std::string grid_name, std::shared_ptr<Grid> grid) {
     grid->map(*this);
 }
 
+std::unordered_map<const Link*, std::string> Chip::getQualifiedLinkNames() const {
+    std::unordered_map<const Link*, std::string> link_names;
+    for (int y = 0; y < grid_size.y; y++) {
+        for (int x = 0; x < grid_size.x; x++) {
+            auto node = getNode(y, x);
+            if (auto dram_node = std::dynamic_pointer_cast<DramNode>(node)) {
+                for (const auto &link : dram_node->dram_internal->getInternalLinks()) {
+                    link_names[link.get()] = "dram_channel_" + std::to_string(dram_node->channel) + "_" + link->getName();
+                }
+            } else if (node->node_type == "pcie") {
+                for (const auto &link : node->getInternalLinks()) {
+                    link_names.emplace(link.get(), "pcie_" + link->getName());
+                }
+            }
+        }
+    }
+    return link_names;
+}
+
 std::shared_ptr<Link> Chip::getWorstLink(int longest_op_cycles) const {
     std::vector<std::shared_ptr<Link>> links_sorted_by_percent_capacity = this->links_sorted_by_percent_capacity;
     std::sort(links_sorted_by_percent_capacity.begin(), links_sorted_by_percent_capacity.end(),
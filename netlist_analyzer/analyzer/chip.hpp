@@ -50,6 +50,11 @@ namespace analyzer {
             Shape getGridSize() const {
                 return grid_size;
             };
+            Shape getCoreGridSize() const {
+                return core_grid_size;
+            };
+            // Names of the links inside dram and pcie nodes qualified by their channel, these share names across channels
+            std::unordered_map<const Link*, std::string> getQualifiedLinkNames() const;
 
             enum class CoreType {
                 ARC,
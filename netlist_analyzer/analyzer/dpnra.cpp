@@ -96,24 +96,63 @@ void Analyzer::load_pipes_for_chips(const std::string &pipegen_yaml_path) {
     // Load pipes
     log_debug(tt::LogAnalyzer, "Loading pipes from {}", pipegen_yaml_path);
     EpochPipes epoch_pipes = load_pipegen_yaml(m_chips, pipegen_yaml_path);
+    chip_id_to_placement_explorer.clear();
     
     // map Pipes
     for (auto &p : epoch_pipes.pipes) {
         auto & chip = m_chips.at(p->chip_location);
-        mapGenericPipe(chip, p.get());
+        RoutedPipe routed_pipe = {.pipe_id = p->pipe_id, .location = p->location, .outputs = p->outputs, .tile_size = p->tile_size};
+        mapGenericPipe(chip, p.get(), &routed_pipe.transfers);
+        chip_id_to_routed_pipes[p->chip_location].push_back(std::move(routed_pipe));
+        chip_id_to_pipes[p->chip_location].push_back(p);
     }
 
     // map ethernet Pipes
     for (auto &p : epoch_pipes.ethernet_pipes) {
         auto & input_chip = m_chips.at(p->input_chip_id);
-        mapEthernetPipe(input_chip, p->input_chip_id, p.get());
+        RoutedPipe input_routed_pipe = {.pipe_id = p->pipe_id, .tile_size = p->tile_size};
+        mapEthernetPipe(input_chip, p->input_chip_id, p.get(), &input_routed_pipe.transfers);
         if(p->input_chip_id != p->output_chip_id) { // Avoid double mapping
             auto & output_chip = m_chips.at(p->output_chip_id);
-            mapEthernetPipe(output_chip, p->output_chip_id, p.get());
+            RoutedPipe output_routed_pipe = {.pipe_id = p->pipe_id, .tile_size = p->tile_size};
+            mapEthernetPipe(output_chip, p->output_chip_id, p.get(), &output_routed_pipe.transfers);
+            chip_id_to_routed_pipes[p->output_chip_id].push_back(std::move(output_routed_pipe));
         }
+        chip_id_to_routed_pipes[p->input_chip_id].push_back(std::move(input_routed_pipe));
     }
 }
 
+NocSimulationReport Analyzer::simulate_chip(int chip_id, const NocSimulatorConfig& config) const {
+    log_info(tt::LogAnalyzer, "Simulating Chip: {}", chip_id);
+    NocSimulator simulator(m_chips.at(chip_id), config);
+    if (chip_id_to_routed_pipes.find(chip_id) != chip_id_to_routed_pipes.end()) {
+        for (const auto& routed_pipe : chip_id_to_routed_pipes.at(chip_id)) {
+            simulator.addPipe(routed_pipe);
+        }
+    }
+    return simulator.run();
+}
+
+PlacementMetrics Analyzer::evaluate_placement(int chip_id, const std::vector<GridChange>& changes) {
+    auto it = chip_id_to_placement_explorer.find(chip_id);
+    if (it == chip_id_to_placement_explorer.end()) {
+        log_assert(
+            chip_id_to_grids.find(chip_id) != chip_id_to_grids.end(), "Cannot find any grids for chip_id={}", chip_id);
+        std::vector<PipeTransfer> ethernet_transfers;
+        for (const auto& routed_pipe : chip_id_to_routed_pipes[chip_id]) {
+            for (const auto& transfer : routed_pipe.transfers) {
+                if (transfer.kind == PipeTransfer::Kind::Ethernet) {
+                    ethernet_transfers.push_back(transfer);
+                }
+            }
+        }
+        auto explorer = std::make_shared<PlacementExplorer>(
+            m_chips.at(chip_id), chip_id_to_grids.at(chip_id), chip_id_to_pipes[chip_id], ethernet_transfers);
+        it = chip_id_to_placement_explorer.emplace(chip_id, explorer).first;
+    }
+    return it->second->evaluate(changes);
+}
+
 void Analyzer::route_chip(int chip_id) {
     log_debug(tt::LogAnalyzer, "Routing Chip: {}", chip_id);
     //log_assert(chip_id >= 0 && chip_id < m_chips.size(), "Cannot find chip_id={}", chip_id);
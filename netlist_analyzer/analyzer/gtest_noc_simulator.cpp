@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+// gtests
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+
+#include <filesystem>
+
+#include "chip.hpp"
+#include "noc_simulator.hpp"
+#include "op.hpp"
+#include "pipe_mapper.hpp"
+
+using namespace analyzer;
+
+namespace {
+constexpr int TILE_SIZE = 2080;
+
+Op make_op(int grid_loc_x, int estimated_cycles) {
+    return Op({
+        .name = "op_" + std::to_string(grid_loc_x),
+        .type = "datacopy",
+        .grid_size_y = 1,
+        .grid_size_x = 1,
+        .grid_loc_y = 0,
+        .grid_loc_x = grid_loc_x,
+        .grid_transpose = false,
+        .estimated_cycles = estimated_cycles,
+    });
+}
+
+// Pipe of num_tiles tiles per input from input to output, located at the consumer for reads and at the producer otherwise
+RoutedPipe route_pipe(Chip &chip, std::uint64_t pipe_id, GridLoc input, GridLoc output, int num_tiles) {
+    GridLoc location = chip.getNode(input)->node_type == "dram" ? output : input;
+    Pipe pipe(pipe_id, {input}, {num_tiles}, 1, {output}, TILE_SIZE, location, 0, 0, 0, 0, 0, false, 0);
+    RoutedPipe routed_pipe = {.pipe_id = pipe_id, .location = location, .outputs = {output}, .tile_size = TILE_SIZE};
+    mapGenericPipe(chip, &pipe, &routed_pipe.transfers);
+    return routed_pipe;
+}
+
+NocSimulationReport simulate(const Chip &chip, const std::vector<RoutedPipe> &routed_pipes) {
+    NocSimulator simulator(chip, NocSimulatorConfig{});
+    for (const auto &routed_pipe : routed_pipes) {
+        simulator.addPipe(routed_pipe);
+    }
+    return simulator.run();
+}
+
+double dram_cycles(int num_tiles) {
+    return num_tiles * TILE_SIZE / GS_DRAM_BYTES_PER_CYCLE;
+}
+}  // namespace
+
+TEST(NocSimulator, ComputeBoundDramUnaryDram) {
+    Chip chip("grayskull");
+    Op op = make_op(0, 20000);
+    op.map(chip);
+    const GridLoc core = chip.getCoreNode(0, 0)->soc_location;
+
+    const auto report = simulate(chip, {
+        route_pipe(chip, 0, chip.getDramNode(0)->soc_location, core, 16),
+        route_pipe(chip, 1, core, chip.getDramNode(1)->soc_location, 16),
+    });
+
+    EXPECT_TRUE(report.completed);
+    EXPECT_NEAR(report.cycles_per_input, 20000, 1);
+    ASSERT_FALSE(report.critical_path.empty());
+    EXPECT_EQ(report.critical_path.back().kind, "pipe");
+    EXPECT_EQ(report.critical_path.at(report.critical_path.size() - 2).kind, "op");
+}
+
+TEST(NocSimulator, DramBoundDramUnaryDram) {
+    Chip chip("grayskull");
+    Op op = make_op(0, 100);
+    op.map(chip);
+    const GridLoc core = chip.getCoreNode(0, 0)->soc_location;
+
+    const auto report = simulate(chip, {
+        route_pipe(chip, 0, chip.getDramNode(0)->soc_location, core, 32),
+        route_pipe(chip, 1, core, chip.getDramNode(1)->soc_location, 32),
+    });
+
+    EXPECT_TRUE(report.completed);
+    EXPECT_GT(report.cycles_per_input, 0.99 * dram_cycles(32));
+    EXPECT_LT(report.cycles_per_input, 1.1 * dram_cycles(32));
+}
+
+TEST(NocSimulator, ReadersShareDramChannel) {
+    Chip chip("grayskull");
+    Op op0 = make_op(0, 100);
+    Op op1 = make_op(1, 100);
+    op0.map(chip);
+    op1.map(chip);
+    const GridLoc dram = chip.getDramNode(0)->soc_location;
+
+    const auto report = simulate(chip, {
+        route_pipe(chip, 0, dram, chip.getCoreNode(0, 0)->soc_location, 32),
+        route_pipe(chip, 1, dram, chip.getCoreNode(0, 1)->soc_location, 32),
+    });
+
+    // Static analysis sees one full channel, the readers queue behind each other on the dram bank
+    EXPECT_TRUE(report.completed);
+    EXPECT_GT(report.cycles_per_input, 1.98 * dram_cycles(32));
+    EXPECT_LT(report.cycles_per_input, 2.2 * dram_cycles(32));
+    ASSERT_FALSE(report.most_contended_links.empty());
+    EXPECT_EQ(report.most_contended_links.front().name, "dram_channel_0_dram_inout");
+}
+
+TEST(NocSimulator, SlowConsumerIsCriticalPath) {
+    Chip chip("grayskull");
+    Op producer = make_op(0, 100);
+    Op consumer = make_op(1, 5000);
+    producer.map(chip);
+    consumer.map(chip);
+    const GridLoc producer_core = chip.getCoreNode(0, 0)->soc_location;
+    const GridLoc consumer_core = chip.getCoreNode(0, 1)->soc_location;
+
+    const auto report = simulate(chip, {
+        route_pipe(chip, 0, chip.getDramNode(0)->soc_location, producer_core, 1),
+        route_pipe(chip, 1, producer_core, consumer_core, 1),
+    });
+
+    EXPECT_TRUE(report.completed);
+    EXPECT_NEAR(report.cycles_per_input, 5000, 1);
+    int consumer_steps = 0;
+    for (const auto &step : report.critical_path) {
+        consumer_steps += step.kind == "op" and step.name.find("op_1") == 0;
+    }
+    EXPECT_EQ(consumer_steps, report.num_inputs);
+}
+
+TEST(NocSimulator, ReportOutputYaml) {
+    Chip chip("grayskull");
+    Op op = make_op(0, 20000);
+    op.map(chip);
+    const GridLoc core = chip.getCoreNode(0, 0)->soc_location;
+
+    const auto report = simulate(chip, {
+        route_pipe(chip, 0, chip.getDramNode(0)->soc_location, core, 16),
+        route_pipe(chip, 1, core, chip.getDramNode(1)->soc_location, 16),
+    });
+
+    const std::filesystem::path yaml_path =
+        std::filesystem::temp_directory_path() / ("noc_simulator_report." + std::to_string(getpid()) + ".yaml");
+    report.outputYaml(yaml_path.string());
+    const YAML::Node yaml = YAML::LoadFile(yaml_path.string());
+    std::filesystem::remove(yaml_path);
+
+    EXPECT_EQ(yaml["num_inputs"].as<int>(), report.num_inputs);
+    EXPECT_TRUE(yaml["completed"].as<bool>());
+    EXPECT_NEAR(yaml["cycles_per_input"].as<double>(), report.cycles_per_input, 1);
+    EXPECT_EQ(yaml["critical_path"].size(), report.critical_path.size());
+    EXPECT_EQ(yaml["most_contended_links"].size(), report.most_contended_links.size());
+}
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+// gtests
+#include <gtest/gtest.h>
+
+#include "chip.hpp"
+#include "op.hpp"
+#include "placement_explorer.hpp"
+
+using namespace analyzer;
+
+namespace {
+constexpr int TILE_SIZE = 2080;
+
+std::shared_ptr<Grid> make_op(const std::string &name, int grid_loc_y, int grid_loc_x, int estimated_cycles) {
+    return std::make_shared<Op>(OpParams{
+        .name = name,
+        .type = "datacopy",
+        .grid_size_y = 1,
+        .grid_size_x = 2,
+        .grid_loc_y = grid_loc_y,
+        .grid_loc_x = grid_loc_x,
+        .grid_transpose = false,
+        .estimated_cycles = estimated_cycles,
+    });
+}
+
+std::shared_ptr<Pipe> make_pipe(std::uint64_t pipe_id, GridLoc input, GridLoc output, GridLoc location) {
+    return std::make_shared<Pipe>(
+        pipe_id, std::vector<GridLoc>{input}, std::vector<int>{8}, 1, std::vector<GridLoc>{output}, TILE_SIZE, location,
+        0, 0, 0, 0, 0, false, 0);
+}
+
+// DRAM -> producer -> consumer -> DRAM with 1x2 ops
+std::vector<std::shared_ptr<Pipe>> make_pipes(const Chip &chip, GridLoc producer_loc, GridLoc consumer_loc) {
+    std::vector<std::shared_ptr<Pipe>> pipes;
+    for (int i = 0; i < 2; i++) {
+        const GridLoc dram = chip.getDramNode(i)->soc_location;
+        const GridLoc producer = chip.getCoreNode(producer_loc.y, producer_loc.x + i)->soc_location;
+        const GridLoc consumer = chip.getCoreNode(consumer_loc.y, consumer_loc.x + i)->soc_location;
+        pipes.push_back(make_pipe(3 * i, dram, producer, producer));
+        pipes.push_back(make_pipe(3 * i + 1, producer, consumer, producer));
+        pipes.push_back(make_pipe(3 * i + 2, consumer, chip.getDramNode(i + 2)->soc_location, consumer));
+    }
+    return pipes;
+}
+
+std::unordered_map<std::string, std::shared_ptr<Grid>> make_grids(GridLoc producer_loc, GridLoc consumer_loc) {
+    return {
+        {"producer", make_op("producer", producer_loc.y, producer_loc.x, 2000)},
+        {"consumer", make_op("consumer", consumer_loc.y, consumer_loc.x, 1000)},
+    };
+}
+}  // namespace
+
+TEST(PlacementExplorer, MoveMatchesFullAnalysis) {
+    Chip chip("grayskull");
+    const GridLoc producer_loc(0, 0);
+    PlacementExplorer explorer(
+        chip, make_grids(producer_loc, GridLoc(1, 0)), make_pipes(chip, producer_loc, GridLoc(1, 0)), {});
+
+    for (const GridLoc &consumer_loc : {GridLoc(1, 0), GridLoc(7, 9), GridLoc(0, 4)}) {
+        const PlacementMetrics incremental = explorer.evaluate({{.name = "consumer", .loc = consumer_loc}});
+        const PlacementMetrics full =
+            PlacementExplorer(
+                chip, make_grids(producer_loc, consumer_loc), make_pipes(chip, producer_loc, consumer_loc), {})
+                .baseline();
+        EXPECT_EQ(incremental.longest_op, full.longest_op);
+        EXPECT_EQ(incremental.longest_op_cycles, full.longest_op_cycles);
+        // Equally loaded links may tie for the worst link
+        EXPECT_FLOAT_EQ(incremental.worst_link_percent_capacity, full.worst_link_percent_capacity);
+        EXPECT_EQ(incremental.bw_limited_op_cycles, full.bw_limited_op_cycles);
+    }
+}
+
+TEST(PlacementExplorer, ResizeSpreadsCyclesAndData) {
+    Chip chip("grayskull");
+    PlacementExplorer explorer(
+        chip, make_grids(GridLoc(0, 0), GridLoc(1, 0)), make_pipes(chip, GridLoc(0, 0), GridLoc(1, 0)), {});
+    EXPECT_EQ(explorer.baseline().longest_op, "producer");
+
+    // Twice the cores halve the producer cycles, its dram reads stay on the same channels
+    const PlacementMetrics resized = explorer.evaluate({{.name = "producer", .loc = GridLoc(4, 0), .shape = Shape(2, 2)}});
+    EXPECT_EQ(resized.longest_op, "consumer");
+    EXPECT_EQ(resized.longest_op_cycles, 1000);
+    EXPECT_EQ(resized.worst_link, explorer.baseline().worst_link);
+    EXPECT_FLOAT_EQ(
+        resized.worst_link_percent_capacity, 2 * explorer.baseline().worst_link_percent_capacity);
+}
+
+TEST(PlacementExplorer, RejectsInvalidPlacements) {
+    Chip chip("grayskull");
+    PlacementExplorer explorer(
+        chip, make_grids(GridLoc(0, 0), GridLoc(1, 0)), make_pipes(chip, GridLoc(0, 0), GridLoc(1, 0)), {});
+
+    EXPECT_THROW(explorer.evaluate({{.name = "consumer", .loc = GridLoc(0, 1)}}), std::runtime_error);
+    EXPECT_THROW(explorer.evaluate({{.name = "consumer", .loc = GridLoc(0, 11)}}), std::runtime_error);
+    EXPECT_THROW(explorer.evaluate({{.name = "unknown", .loc = GridLoc(5, 5)}}), std::runtime_error);
+    // Ops may swap places
+    EXPECT_NO_THROW(explorer.evaluate({
+        {.name = "producer", .loc = GridLoc(1, 0)},
+        {.name = "consumer", .loc = GridLoc(0, 0)},
+    }));
+}
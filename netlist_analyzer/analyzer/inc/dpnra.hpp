@@ -9,6 +9,8 @@
 #include "netlist_analyzer/analyzer/common/analyzer_api_types.hpp"
 #include "netlist_analyzer/analyzer/chip.hpp"
 #include "netlist_analyzer/analyzer/grid.hpp"
+#include "netlist_analyzer/analyzer/noc_simulator.hpp"
+#include "netlist_analyzer/analyzer/placement_explorer.hpp"
 
 // data flow, place and route analyzer
 
@@ -26,6 +28,11 @@ class Analyzer {
     void test_chip(int chip_id);
     void analyze_chip(int chip_id);
     void serialize_chip(int chip_id, const std::string& filename);
+    // Replays the pipes loaded for the chip over time, see analyzer::NocSimulator
+    analyzer::NocSimulationReport simulate_chip(int chip_id, const analyzer::NocSimulatorConfig& config) const;
+    // Metrics of the chip with some ops moved or resized, against the placement its pipes were loaded for, see
+    // analyzer::PlacementExplorer
+    analyzer::PlacementMetrics evaluate_placement(int chip_id, const std::vector<analyzer::GridChange>& changes);
     void run_per_core_checks();
     void run_grid_checks();
 
@@ -35,6 +42,9 @@ class Analyzer {
     std::unordered_map<int, std::unordered_map<std::string, std::shared_ptr<analyzer::Grid>>> chip_id_to_grids;
 
     std::unordered_map<int, std::set<std::pair<std::string, std::string>>> chip_id_to_grid_pairs;
+    std::unordered_map<int, std::vector<analyzer::RoutedPipe>> chip_id_to_routed_pipes;
+    std::unordered_map<int, std::vector<std::shared_ptr<analyzer::Pipe>>> chip_id_to_pipes;
+    std::unordered_map<int, std::shared_ptr<analyzer::PlacementExplorer>> chip_id_to_placement_explorer;
 };
 
 }
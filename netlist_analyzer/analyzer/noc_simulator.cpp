@@ -0,0 +1,562 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "noc_simulator.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+#include <yaml-cpp/yaml.h>
+
+#include "op.hpp"
+#include "utils/logger.hpp"
+
+namespace analyzer {
+
+namespace {
+std::string locString(const GridLoc &loc) {
+    return "(" + std::to_string(loc.y) + ", " + std::to_string(loc.x) + ")";
+}
+}
+
+NocSimulator::NocSimulator(const Chip &chip, const NocSimulatorConfig &config) : chip(chip), config(config) {
+    log_assert(config.num_inputs > 0, "Noc simulation needs at least one input");
+    log_assert(config.input_buffer_depth > 0, "Noc simulation needs an input buffer depth of at least one");
+
+    link_names = chip.getQualifiedLinkNames();
+}
+
+int NocSimulator::getCore(const GridLoc &loc) {
+    auto node = chip.getNode(loc);
+    if (node->mapped_op == nullptr) {
+        return -1;
+    }
+    auto it = core_index.find(loc);
+    if (it != core_index.end()) {
+        return it->second;
+    }
+    cores.push_back({
+        .name = node->mapped_op->name + locString(loc),
+        .loc = loc,
+        .cycles = static_cast<double>(std::max(0, node->mapped_op->estimated_cycles)),
+    });
+    core_index.emplace(loc, cores.size() - 1);
+    return cores.size() - 1;
+}
+
+int NocSimulator::getLink(const std::shared_ptr<Link> &link) {
+    auto it = link_index.find(link.get());
+    if (it != link_index.end()) {
+        return it->second;
+    }
+    auto name_it = link_names.find(link.get());
+    LinkState state;
+    state.name = name_it != link_names.end() ? name_it->second : link->getName();
+    state.bytes_per_cycle = link->getTotalCapacity();
+    links.push_back(std::move(state));
+    link_index.emplace(link.get(), links.size() - 1);
+    return links.size() - 1;
+}
+
+void NocSimulator::addPipe(const RoutedPipe &routed_pipe) {
+    const int pipe = pipes.size();
+    SimPipe sim_pipe = {.pipe_id = routed_pipe.pipe_id, .tile_size = routed_pipe.tile_size};
+
+    for (const auto &transfer : routed_pipe.transfers) {
+        SimTransfer sim_transfer = {
+            .pipe = pipe, .kind = transfer.kind, .src = transfer.src, .data_size = transfer.data_size};
+        for (const auto &hop : transfer.hops) {
+            sim_transfer.hops.push_back({getLink(hop.link), hop.vc < 0 ? 0 : hop.vc % 16, hop.vc >= 0});
+        }
+        if (transfer.kind != PipeTransfer::Kind::Ethernet) {
+            const std::string &src_type = chip.getNode(transfer.src)->node_type;
+            if (src_type == "dram" or src_type == "pcie") {
+                sim_transfer.start_latency = config.dram_read_latency_cycles;
+            }
+        }
+        if (transfer.kind == PipeTransfer::Kind::Gather) {
+            sim_transfer.producer_core = getCore(transfer.src);
+            sim_pipe.gather_transfers.push_back(transfers.size());
+        } else {
+            sim_pipe.output_transfers.push_back(transfers.size());
+        }
+        transfers.push_back(std::move(sim_transfer));
+    }
+
+    for (const auto &output : routed_pipe.outputs) {
+        const int core = getCore(output);
+        if (core >= 0 and std::find(sim_pipe.consumer_cores.begin(), sim_pipe.consumer_cores.end(), core) == sim_pipe.consumer_cores.end()) {
+            sim_pipe.consumer_cores.push_back(core);
+            cores.at(core).inbound_pipes.push_back(pipe);
+        }
+    }
+
+    // Without a gather the data is produced at the pipe location, otherwise each gathered input waits for its producer.
+    // Ethernet pipes have no location on the chip.
+    if (sim_pipe.gather_transfers.empty()) {
+        sim_pipe.producer_core = routed_pipe.outputs.empty() ? -1 : getCore(routed_pipe.location);
+        if (sim_pipe.producer_core >= 0) {
+            cores.at(sim_pipe.producer_core).outbound.push_back({pipe, -1});
+        }
+    } else {
+        for (int transfer : sim_pipe.gather_transfers) {
+            const int producer = transfers.at(transfer).producer_core;
+            if (producer >= 0) {
+                cores.at(producer).outbound.push_back({pipe, transfer});
+            }
+        }
+    }
+    pipes.push_back(std::move(sim_pipe));
+}
+
+void NocSimulator::schedule(double time, EventType type, int a, int b) {
+    events.push({.time = time, .seq = event_seq++, .type = type, .a = a, .b = b});
+}
+
+void NocSimulator::finish(int input, double time, const Cause &cause) {
+    input_done.at(input) = std::max(input_done.at(input), time);
+    if (time >= last_end) {
+        last_end = time;
+        last_cause = cause;
+    }
+}
+
+void NocSimulator::release(Instance &inst, const Cause &cause) {
+    // Events are processed in time order, so the last release is the one the instance waited on
+    inst.pending--;
+    inst.gate = cause;
+}
+
+void NocSimulator::releaseFirstStage(int pipe, int input, double now, const Cause &cause) {
+    if (pipes.at(pipe).gather_transfers.empty()) {
+        releaseStage(pipe, input, now, cause);
+        return;
+    }
+    for (int transfer : pipes.at(pipe).gather_transfers) {
+        releaseTransfer(transfer, input, now, cause);
+    }
+}
+
+void NocSimulator::releaseTransfer(int transfer, int input, double now, const Cause &cause) {
+    Instance &inst = transfer_instances.at(instance(transfer, input));
+    release(inst, cause);
+    if (inst.pending == 0) {
+        startTransfer(transfer, input, now);
+    }
+}
+
+void NocSimulator::releaseStage(int pipe, int input, double now, const Cause &cause) {
+    Instance &inst = stage_instances.at(instance(pipe, input));
+    release(inst, cause);
+    if (inst.pending == 0) {
+        startStage(pipe, input, now);
+    }
+}
+
+void NocSimulator::releaseCompute(int core, int input, double now, const Cause &cause) {
+    Instance &inst = compute_instances.at(instance(core, input));
+    release(inst, cause);
+    if (inst.pending == 0) {
+        startCompute(core, input, now);
+    }
+}
+
+void NocSimulator::releaseOutputBuffer(int core, int input, double now, const Cause &cause) {
+    // Sending an input frees an output buffer of the producer for a later input
+    const int freed_input = input + config.input_buffer_depth;
+    if (core >= 0 and freed_input < config.num_inputs) {
+        releaseCompute(core, freed_input, now, cause);
+    }
+}
+
+void NocSimulator::startTransfer(int transfer, int input, double now) {
+    const SimTransfer &sim_transfer = transfers.at(transfer);
+    const int id = instance(transfer, input);
+    Instance &inst = transfer_instances.at(id);
+    inst.start = now;
+    if (sim_transfer.data_size == 0 or sim_transfer.hops.empty()) {
+        transferDone(transfer, input, now);
+        return;
+    }
+
+    const int tile_size = pipes.at(sim_transfer.pipe).tile_size;
+    const std::uint32_t packet_size = config.packet_size_bytes > 0 ? config.packet_size_bytes : (tile_size > 0 ? tile_size : sim_transfer.data_size);
+    inst.remaining = (sim_transfer.data_size + packet_size - 1) / packet_size;
+    for (std::uint32_t offset = 0; offset < sim_transfer.data_size; offset += packet_size) {
+        packets.push_back({.transfer_instance = id, .bytes = std::min(packet_size, sim_transfer.data_size - offset)});
+        schedule(now + sim_transfer.start_latency, EventType::Request, packets.size() - 1);
+    }
+}
+
+void NocSimulator::startStage(int pipe, int input, double now) {
+    Instance &inst = stage_instances.at(instance(pipe, input));
+    inst.start = now;
+    if (pipes.at(pipe).output_transfers.empty()) {
+        // Data is already at the output
+        stageDone(pipe, input, now, {Cause::Kind::Stage, pipe, input});
+        return;
+    }
+    for (int transfer : pipes.at(pipe).output_transfers) {
+        transfer_instances.at(instance(transfer, input)).gate = inst.gate;
+        startTransfer(transfer, input, now);
+    }
+}
+
+void NocSimulator::startCompute(int core, int input, double now) {
+    compute_instances.at(instance(core, input)).start = now;
+    // Starting an input frees a buffer for a later input of every pipe feeding the core
+    const int freed_input = input + config.input_buffer_depth;
+    if (freed_input < config.num_inputs) {
+        for (int pipe : cores.at(core).inbound_pipes) {
+            releaseFirstStage(pipe, freed_input, now, {Cause::Kind::ComputeStart, core, input});
+        }
+    }
+    schedule(now + cores.at(core).cycles, EventType::ComputeDone, core, input);
+}
+
+void NocSimulator::transferDone(int transfer, int input, double now) {
+    transfer_instances.at(instance(transfer, input)).end = now;
+    const Cause cause = {Cause::Kind::Transfer, transfer, input};
+    finish(input, now, cause);
+
+    const int pipe = transfers.at(transfer).pipe;
+    if (transfers.at(transfer).kind == PipeTransfer::Kind::Gather) {
+        releaseOutputBuffer(transfers.at(transfer).producer_core, input, now, cause);
+        releaseStage(pipe, input, now, cause);
+        return;
+    }
+    Instance &stage = stage_instances.at(instance(pipe, input));
+    stage.remaining--;
+    if (stage.remaining == 0) {
+        stageDone(pipe, input, now, cause);
+    }
+}
+
+void NocSimulator::stageDone(int pipe, int input, double now, const Cause &cause) {
+    stage_instances.at(instance(pipe, input)).end = now;
+    finish(input, now, cause);
+    releaseOutputBuffer(pipes.at(pipe).producer_core, input, now, cause);
+    // Forwarding an input frees the gather buffer at the pipe location for a later input
+    if (input + config.input_buffer_depth < config.num_inputs) {
+        for (int transfer : pipes.at(pipe).gather_transfers) {
+            releaseTransfer(transfer, input + config.input_buffer_depth, now, cause);
+        }
+    }
+    for (int core : pipes.at(pipe).consumer_cores) {
+        releaseCompute(core, input, now, cause);
+    }
+}
+
+void NocSimulator::computeDone(int core, int input, double now) {
+    compute_instances.at(instance(core, input)).end = now;
+    const Cause cause = {Cause::Kind::Compute, core, input};
+    finish(input, now, cause);
+
+    if (input + 1 < config.num_inputs) {
+        releaseCompute(core, input + 1, now, cause);
+    }
+    for (const auto &[pipe, transfer] : cores.at(core).outbound) {
+        if (transfer >= 0) {
+            releaseTransfer(transfer, input, now, cause);
+        } else {
+            releaseStage(pipe, input, now, cause);
+        }
+    }
+}
+
+void NocSimulator::request(int packet, double now) {
+    Packet &pk = packets.at(packet);
+    const Hop &hop = transfers.at(pk.transfer_instance / config.num_inputs).hops.at(pk.hop);
+    pk.request_time = now;
+    links.at(hop.link).queues.at(hop.vc_slot).push_back(packet);
+    tryGrant(hop.link, now);
+}
+
+void NocSimulator::tryGrant(int link, double now) {
+    LinkState &state = links.at(link);
+    if (state.busy_until > now) {
+        // Arbitration resumes on the pending LinkFree event
+        return;
+    }
+    for (int i = 0; i < 16; i++) {
+        const int vc = (state.next_vc + i) % 16;
+        if (state.queues[vc].empty() or state.held[vc]) {
+            continue;
+        }
+        const int packet = state.queues[vc].front();
+        state.queues[vc].pop_front();
+        state.next_vc = (vc + 1) % 16;
+
+        Packet &pk = packets.at(packet);
+        const SimTransfer &transfer = transfers.at(pk.transfer_instance / config.num_inputs);
+        const Hop &hop = transfer.hops.at(pk.hop);
+        const double serialization = pk.bytes / state.bytes_per_cycle;
+        const double wait = now - pk.request_time;
+        state.wait_cycles += wait;
+        state.busy_cycles += serialization;
+        state.busy_until = now + serialization;
+        transfer_hop_waits.at(pk.transfer_instance).at(pk.hop) += wait;
+        schedule(state.busy_until, EventType::LinkFree, link);
+
+        // The previous hop keeps its virtual channel until the head of the packet moves on
+        if (pk.hop > 0) {
+            const Hop &prev = transfer.hops.at(pk.hop - 1);
+            if (prev.has_vc) {
+                schedule(std::max(now, pk.grant_time + pk.serialization), EventType::VcRelease, prev.link, prev.vc_slot);
+            }
+        }
+        const bool last_hop = pk.hop + 1 == static_cast<int>(transfer.hops.size());
+        if (hop.has_vc) {
+            state.held[vc] = true;
+            if (last_hop) {
+                schedule(state.busy_until, EventType::VcRelease, link, vc);
+            }
+        }
+        pk.grant_time = now;
+        pk.serialization = serialization;
+        if (last_hop) {
+            schedule(state.busy_until, EventType::Deliver, packet);
+        } else {
+            pk.hop++;
+            schedule(now + config.hop_latency_cycles, EventType::Request, packet);
+        }
+        return;
+    }
+}
+
+NocSimulationReport NocSimulator::run() {
+    const int num_inputs = config.num_inputs;
+    compute_instances.assign(cores.size() * num_inputs, {});
+    stage_instances.assign(pipes.size() * num_inputs, {});
+    transfer_instances.assign(transfers.size() * num_inputs, {});
+    transfer_hop_waits.assign(transfers.size() * num_inputs, {});
+    input_done.assign(num_inputs, 0);
+
+    for (std::size_t transfer = 0; transfer < transfers.size(); transfer++) {
+        for (int input = 0; input < num_inputs; input++) {
+            transfer_hop_waits.at(instance(transfer, input)).assign(transfers.at(transfer).hops.size(), 0);
+        }
+    }
+    for (std::size_t pipe = 0; pipe < pipes.size(); pipe++) {
+        const SimPipe &sim_pipe = pipes.at(pipe);
+        for (int input = 0; input < num_inputs; input++) {
+            const int credits = input >= config.input_buffer_depth ? sim_pipe.consumer_cores.size() : 0;
+            const int gather_buffers = input >= config.input_buffer_depth;
+            for (int transfer : sim_pipe.gather_transfers) {
+                transfer_instances.at(instance(transfer, input)).pending = (transfers.at(transfer).producer_core >= 0) + credits + gather_buffers;
+            }
+            Instance &stage = stage_instances.at(instance(pipe, input));
+            stage.pending = sim_pipe.gather_transfers.empty() ? (sim_pipe.producer_core >= 0) + credits : sim_pipe.gather_transfers.size();
+            stage.remaining = sim_pipe.output_transfers.size();
+        }
+    }
+    for (std::size_t core = 0; core < cores.size(); core++) {
+        for (int input = 0; input < num_inputs; input++) {
+            const int output_buffers = input >= config.input_buffer_depth ? cores.at(core).outbound.size() : 0;
+            compute_instances.at(instance(core, input)).pending = cores.at(core).inbound_pipes.size() + (input > 0) + output_buffers;
+        }
+    }
+
+    // Collect everything ready at the start first, starting an instance releases others
+    std::vector<std::pair<int, int>> ready_transfers, ready_stages, ready_computes;
+    for (std::size_t transfer = 0; transfer < transfers.size(); transfer++) {
+        for (int input = 0; input < num_inputs; input++) {
+            if (transfers.at(transfer).kind == PipeTransfer::Kind::Gather and transfer_instances.at(instance(transfer, input)).pending == 0) {
+                ready_transfers.push_back({transfer, input});
+            }
+        }
+    }
+    for (std::size_t pipe = 0; pipe < pipes.size(); pipe++) {
+        for (int input = 0; input < num_inputs; input++) {
+            if (stage_instances.at(instance(pipe, input)).pending == 0) {
+                ready_stages.push_back({pipe, input});
+            }
+        }
+    }
+    for (std::size_t core = 0; core < cores.size(); core++) {
+        if (compute_instances.at(instance(core, 0)).pending == 0) {
+            ready_computes.push_back({core, 0});
+        }
+    }
+    for (const auto &[transfer, input] : ready_transfers) {
+        startTransfer(transfer, input, 0);
+    }
+    for (const auto &[pipe, input] : ready_stages) {
+        startStage(pipe, input, 0);
+    }
+    for (const auto &[core, input] : ready_computes) {
+        startCompute(core, input, 0);
+    }
+
+    while (not events.empty()) {
+        const Event event = events.top();
+        events.pop();
+        switch (event.type) {
+            case EventType::Request: request(event.a, event.time); break;
+            case EventType::LinkFree: tryGrant(event.a, event.time); break;
+            case EventType::VcRelease:
+                links.at(event.a).held.at(event.b) = false;
+                tryGrant(event.a, event.time);
+                break;
+            case EventType::Deliver: {
+                const int id = packets.at(event.a).transfer_instance;
+                Instance &inst = transfer_instances.at(id);
+                inst.remaining--;
+                if (inst.remaining == 0) {
+                    transferDone(id / num_inputs, id % num_inputs, event.time);
+                }
+                break;
+            }
+            case EventType::ComputeDone: computeDone(event.a, event.b, event.time); break;
+        }
+    }
+
+    NocSimulationReport report;
+    report.num_inputs = num_inputs;
+    const auto unfinished = [](const Instance &inst) { return inst.end < 0; };
+    report.completed = std::none_of(compute_instances.begin(), compute_instances.end(), unfinished) and
+                       std::none_of(stage_instances.begin(), stage_instances.end(), unfinished) and
+                       std::none_of(transfer_instances.begin(), transfer_instances.end(), unfinished);
+    report.total_cycles = last_end;
+    report.input_done_cycles = input_done;
+    // Measured over the second half of the inputs, once the pipeline filled up
+    const int first_measured_input = (num_inputs - 1) / 2;
+    report.cycles_per_input = num_inputs > 1 ? (input_done.back() - input_done.at(first_measured_input)) / (num_inputs - 1 - first_measured_input) : input_done.front();
+    report.critical_path = walkCriticalPath();
+
+    std::vector<const LinkState *> contended_links;
+    for (const auto &state : links) {
+        if (state.wait_cycles > 0) {
+            contended_links.push_back(&state);
+        }
+    }
+    std::sort(contended_links.begin(), contended_links.end(), [](auto lhs, auto rhs) { return lhs->wait_cycles > rhs->wait_cycles; });
+    contended_links.resize(std::min<std::size_t>(contended_links.size(), 10));
+    for (const auto state : contended_links) {
+        report.most_contended_links.push_back({state->name, state->busy_cycles, state->wait_cycles});
+    }
+    return report;
+}
+
+std::string NocSimulator::transferName(int transfer) const {
+    const SimTransfer &sim_transfer = transfers.at(transfer);
+    const std::string pipe = "pipe " + std::to_string(pipes.at(sim_transfer.pipe).pipe_id);
+    switch (sim_transfer.kind) {
+        case PipeTransfer::Kind::Gather: return pipe + " gather from " + locString(sim_transfer.src);
+        case PipeTransfer::Kind::Unicast: return pipe + " unicast from " + locString(sim_transfer.src);
+        case PipeTransfer::Kind::Multicast: return pipe + " mcast from " + locString(sim_transfer.src);
+        case PipeTransfer::Kind::Ethernet: return pipe + " ethernet at " + locString(sim_transfer.src);
+    }
+    return pipe;
+}
+
+std::vector<NocSimulationReport::Step> NocSimulator::walkCriticalPath() const {
+    std::vector<NocSimulationReport::Step> steps;
+    Cause cause = last_cause;
+    while (cause.kind != Cause::Kind::None) {
+        switch (cause.kind) {
+            case Cause::Kind::Compute: {
+                const Instance &inst = compute_instances.at(instance(cause.entity, cause.input));
+                steps.push_back({"op", cores.at(cause.entity).name, cause.input, inst.start, inst.end});
+                cause = inst.gate;
+                break;
+            }
+            case Cause::Kind::ComputeStart: {
+                const Instance &inst = compute_instances.at(instance(cause.entity, cause.input));
+                steps.push_back({"buffer", cores.at(cause.entity).name + " frees an input buffer", cause.input, inst.start, inst.start});
+                cause = inst.gate;
+                break;
+            }
+            case Cause::Kind::Stage: cause = stage_instances.at(instance(cause.entity, cause.input)).gate; break;
+            case Cause::Kind::Transfer: {
+                const int id = instance(cause.entity, cause.input);
+                const Instance &inst = transfer_instances.at(id);
+                NocSimulationReport::Step step = {"pipe", transferName(cause.entity), cause.input, inst.start, inst.end};
+                const auto &waits = transfer_hop_waits.at(id);
+                const auto worst = std::max_element(waits.begin(), waits.end());
+                if (worst != waits.end() and *worst > 0) {
+                    step.bottleneck_link = links.at(transfers.at(cause.entity).hops.at(worst - waits.begin()).link).name;
+                    step.bottleneck_wait_cycles = *worst;
+                }
+                steps.push_back(step);
+                cause = inst.gate;
+                break;
+            }
+            case Cause::Kind::None: break;
+        }
+    }
+    std::reverse(steps.begin(), steps.end());
+    return steps;
+}
+
+void NocSimulationReport::report() const {
+    if (not completed) {
+        log_warning(tt::LogAnalyzer, "Noc simulation did not finish all transfers, results are partial");
+    }
+    log_info(
+        tt::LogAnalyzer,
+        "Noc simulation: {} inputs in {:.0f} cycles, {:.0f} cycles per input",
+        num_inputs,
+        total_cycles,
+        cycles_per_input);
+    log_info(tt::LogAnalyzer, "Critical path:");
+    for (const auto &step : critical_path) {
+        if (step.bottleneck_link.empty()) {
+            log_info(tt::LogAnalyzer, "  [{:.0f}, {:.0f}] input {} {}: {}", step.start_cycle, step.end_cycle, step.input, step.kind, step.name);
+        } else {
+            log_info(
+                tt::LogAnalyzer,
+                "  [{:.0f}, {:.0f}] input {} {}: {}, waited {:.0f} cycles on {}",
+                step.start_cycle,
+                step.end_cycle,
+                step.input,
+                step.kind,
+                step.name,
+                step.bottleneck_wait_cycles,
+                step.bottleneck_link);
+        }
+    }
+    log_info(tt::LogAnalyzer, "Most contended links:");
+    for (const auto &link : most_contended_links) {
+        log_info(tt::LogAnalyzer, "  {}: {:.0f} cycles busy, {:.0f} cycles waited", link.name, link.busy_cycles, link.wait_cycles);
+    }
+}
+
+void NocSimulationReport::outputYaml(const std::string &filename) const {
+    std::ofstream ostrm(filename, std::ios::binary);
+    YAML::Emitter out;
+    out << YAML::BeginMap;
+    out << YAML::Key << "num_inputs" << YAML::Value << num_inputs;
+    out << YAML::Key << "completed" << YAML::Value << completed;
+    out << YAML::Key << "total_cycles" << YAML::Value << total_cycles;
+    out << YAML::Key << "cycles_per_input" << YAML::Value << cycles_per_input;
+    out << YAML::Key << "input_done_cycles" << YAML::Value << YAML::Flow << input_done_cycles;
+    out << YAML::Key << "critical_path" << YAML::Value << YAML::BeginSeq;
+    for (const auto &step : critical_path) {
+        out << YAML::BeginMap;
+        out << YAML::Key << "kind" << YAML::Value << step.kind;
+        out << YAML::Key << "name" << YAML::Value << step.name;
+        out << YAML::Key << "input" << YAML::Value << step.input;
+        out << YAML::Key << "start_cycle" << YAML::Value << step.start_cycle;
+        out << YAML::Key << "end_cycle" << YAML::Value << step.end_cycle;
+        if (not step.bottleneck_link.empty()) {
+            out << YAML::Key << "bottleneck_link" << YAML::Value << step.bottleneck_link;
+            out << YAML::Key << "bottleneck_wait_cycles" << YAML::Value << step.bottleneck_wait_cycles;
+        }
+        out << YAML::EndMap;
+    }
+    out << YAML::EndSeq;
+    out << YAML::Key << "most_contended_links" << YAML::Value << YAML::BeginSeq;
+    for (const auto &link : most_contended_links) {
+        out << YAML::BeginMap;
+        out << YAML::Key << "name" << YAML::Value << link.name;
+        out << YAML::Key << "busy_cycles" << YAML::Value << link.busy_cycles;
+        out << YAML::Key << "wait_cycles" << YAML::Value << link.wait_cycles;
+        out << YAML::EndMap;
+    }
+    out << YAML::EndSeq;
+    out << YAML::EndMap;
+    ostrm << out.c_str();
+}
+
+}  // namespace analyzer
@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+// noc_simulator.hpp
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chip.hpp"
+#include "pipe_mapper.hpp"
+
+namespace analyzer {
+
+struct NocSimulatorConfig {
+    // Inputs replayed back to back, cycles per input are measured over the second half of them
+    int num_inputs = 8;
+    // Inputs an op can buffer on each of its inputs and outputs, a producer can run this many inputs ahead of its
+    // consumers and of the data it sent out
+    int input_buffer_depth = 2;
+    // Bytes per noc packet, 0 sends every tile as its own packet like the streams do
+    int packet_size_bytes = 0;
+    int hop_latency_cycles = 9;
+    // Latency before the first packet of a DRAM/PCIe read is returned
+    int dram_read_latency_cycles = 300;
+};
+
+struct NocSimulationReport {
+    struct Step {
+        std::string kind;  // op, buffer or pipe
+        std::string name;
+        int input;
+        double start_cycle;
+        double end_cycle;
+        std::string bottleneck_link;  // link a pipe transfer waited on the longest
+        double bottleneck_wait_cycles = 0;
+    };
+    struct LinkContention {
+        std::string name;
+        double busy_cycles;
+        double wait_cycles;
+    };
+
+    int num_inputs = 0;
+    // False if some transfers never finished, eg. on a routing deadlock
+    bool completed = true;
+    double total_cycles = 0;
+    double cycles_per_input = 0;
+    std::vector<double> input_done_cycles;
+    std::vector<Step> critical_path;
+    std::vector<LinkContention> most_contended_links;
+
+    void report() const;
+    void outputYaml(const std::string &filename) const;
+};
+
+// Discrete event simulation of the pipes of one chip and epoch over time.
+//
+// Every pipe transfer is replayed per input as packets over the links it was routed on by mapGenericPipe. Each link
+// serializes packets at its bandwidth and arbitrates round robin between its virtual channels, a packet holds its
+// virtual channel until its head is granted the next hop, so blocked packets stall the packets behind them on the same
+// virtual channel only. DRAM and PCIe channels are modelled by their noc2axi and bank links, which queue all requests
+// of the channel. Gather pipes forward their data once all inputs are gathered at the pipe location and multicasts
+// occupy the whole multicast path once. Ops compute one input at a time per core for their estimated cycles once all
+// their input pipes delivered it and their output buffers have space for it, and pipes only start an input once their
+// consumers have buffer space for it.
+class NocSimulator {
+  public:
+    NocSimulator(const Chip &chip, const NocSimulatorConfig &config);
+
+    void addPipe(const RoutedPipe &pipe);
+    NocSimulationReport run();
+
+  private:
+    enum class EventType { Request, LinkFree, VcRelease, Deliver, ComputeDone };
+    struct Event {
+        double time;
+        std::uint64_t seq;
+        EventType type;
+        int a;
+        int b;
+        bool operator>(const Event &other) const {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+
+    // What released an op or transfer to start, used to walk back the critical path
+    struct Cause {
+        enum class Kind { None, Compute, ComputeStart, Stage, Transfer };
+        Kind kind = Kind::None;
+        int entity = -1;
+        int input = -1;
+    };
+
+    struct Hop {
+        int link;
+        int vc_slot;
+        bool has_vc;
+    };
+    struct SimTransfer {
+        int pipe;
+        PipeTransfer::Kind kind;
+        GridLoc src;
+        std::uint32_t data_size;
+        std::vector<Hop> hops;
+        int producer_core = -1;
+        double start_latency = 0;
+    };
+    struct SimPipe {
+        std::uint64_t pipe_id;
+        int tile_size;
+        std::vector<int> gather_transfers;
+        std::vector<int> output_transfers;
+        std::vector<int> consumer_cores;
+        int producer_core = -1;
+    };
+    struct Core {
+        std::string name;
+        GridLoc loc;
+        double cycles;
+        std::vector<int> inbound_pipes;
+        // Pipes whose first stage waits for this core, as (pipe, gather transfer) with -1 for the output stage
+        std::vector<std::pair<int, int>> outbound;
+    };
+    struct Instance {
+        int pending = 0;
+        double start = -1;
+        double end = -1;
+        Cause gate;
+        int remaining = 0;  // packets of a transfer, transfers of a stage
+    };
+    struct LinkState {
+        std::string name;
+        double bytes_per_cycle;
+        double busy_until = 0;
+        double busy_cycles = 0;
+        double wait_cycles = 0;
+        int next_vc = 0;
+        std::array<bool, 16> held = {};
+        std::array<std::deque<int>, 16> queues;
+    };
+    struct Packet {
+        int transfer_instance;
+        std::uint32_t bytes;
+        int hop = 0;
+        double request_time = 0;
+        double grant_time = 0;
+        double serialization = 0;
+    };
+
+    const Chip &chip;
+    NocSimulatorConfig config;
+
+    std::vector<SimPipe> pipes;
+    std::vector<SimTransfer> transfers;
+    std::vector<Core> cores;
+    std::unordered_map<GridLoc, int> core_index;
+    std::vector<LinkState> links;
+    std::unordered_map<const Link *, int> link_index;
+    std::unordered_map<const Link *, std::string> link_names;
+
+    // Indexed by entity * num_inputs + input
+    std::vector<Instance> compute_instances;
+    std::vector<Instance> stage_instances;
+    std::vector<Instance> transfer_instances;
+    std::vector<std::vector<double>> transfer_hop_waits;
+    std::vector<Packet> packets;
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+    std::uint64_t event_seq = 0;
+    std::vector<double> input_done;
+    double last_end = 0;
+    Cause last_cause;
+
+    int getCore(const GridLoc &loc);
+    int getLink(const std::shared_ptr<Link> &link);
+    int instance(int entity, int input) const { return entity * config.num_inputs + input; }
+    void schedule(double time, EventType type, int a, int b = 0);
+    void finish(int input, double time, const Cause &cause);
+
+    void release(Instance &inst, const Cause &cause);
+    void releaseFirstStage(int pipe, int input, double now, const Cause &cause);
+    void releaseTransfer(int transfer, int input, double now, const Cause &cause);
+    void releaseStage(int pipe, int input, double now, const Cause &cause);
+    void releaseCompute(int core, int input, double now, const Cause &cause);
+    void releaseOutputBuffer(int core, int input, double now, const Cause &cause);
+
+    void startTransfer(int transfer, int input, double now);
+    void startStage(int pipe, int input, double now);
+    void startCompute(int core, int input, double now);
+    void transferDone(int transfer, int input, double now);
+    void stageDone(int pipe, int input, double now, const Cause &cause);
+    void computeDone(int core, int input, double now);
+
+    void request(int packet, double now);
+    void tryGrant(int link, double now);
+
+    std::string transferName(int transfer) const;
+    std::vector<NocSimulationReport::Step> walkCriticalPath() const;
+};
+
+}  // namespace analyzer
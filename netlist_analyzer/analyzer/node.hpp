@@ -57,14 +57,27 @@ class Node {
 
     float getNocBandwidth(int id);
     
-    virtual void routeFromNodeToNoc0(Pipe* p, int data_size) {
+    // Links inside the node that data of a pipe crosses between the node and the given noc, eg. noc2axi and dram bank
+    virtual std::vector<std::shared_ptr<Link>> getNocEndpointLinks(int noc_id, const Pipe* p) const {
+        return {};
     }
-    virtual void routeToNodeFromNoc0(Pipe* p, int data_size) {
+
+    void routeFromNodeToNoc0(Pipe* p, int data_size) {
+        for (const auto& link : getNocEndpointLinks(0, p)) {
+            link->addPipeWithoutVC(p->pipe_id, data_size);
+        }
+    }
+    void routeToNodeFromNoc0(Pipe* p, int data_size) {
+        routeFromNodeToNoc0(p, data_size);
     }
 
-    virtual void routeFromNodeToNoc1(Pipe* p, int data_size) {
+    void routeFromNodeToNoc1(Pipe* p, int data_size) {
+        for (const auto& link : getNocEndpointLinks(1, p)) {
+            link->addPipeWithoutVC(p->pipe_id, data_size);
+        }
     }
-    virtual void routeToNodeFromNoc1(Pipe* p, int data_size) {
+    void routeToNodeFromNoc1(Pipe* p, int data_size) {
+        routeFromNodeToNoc1(p, data_size);
     }
     
     void registerInternalLink(std::shared_ptr<Link> link) {
@@ -116,9 +129,17 @@ class CoreNode : public Node {
 class DramInternal {
     public:
         DramInternal() = default;
-        virtual void routeToDram(int noc_id, int subchan_id, int dram_id, Pipe* p, int data_size) = 0;
-        virtual void routeFromDram(int noc_id, int subchan_id, int dram_id, Pipe* p, int data_size) = 0;
+        virtual std::vector<std::shared_ptr<Link>> getRouteLinks(int noc_id, int subchan_id, const Pipe* p) const = 0;
         virtual ~DramInternal() = default;
+
+        void routeToDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) {
+            for (const auto& link : getRouteLinks(noc_id, subchan_id, p)) {
+                link->addPipeWithoutVC(p->pipe_id, data_size);
+            }
+        }
+        void routeFromDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) {
+            routeToDram(noc_id, dram_id, subchan_id, p, data_size);
+        }
         
         std::vector<std::shared_ptr<Link>> getInternalLinks() const {
             return links;
@@ -140,24 +161,19 @@ class gs_dram_channel : public DramInternal {
         }
         ~gs_dram_channel() = default;
 
-        void routeToDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) override {
+        std::vector<std::shared_ptr<Link>> getRouteLinks(int noc_id, int subchan_id, const Pipe* p) const override {
             if(noc_id == 0) {
-                this->noc0_noc2axi->addPipeWithoutVC(p->pipe_id, data_size);
-                this->dram_inout->addPipeWithoutVC(p->pipe_id, data_size);
+                return {this->noc0_noc2axi, this->dram_inout};
             }
             else if (noc_id == 1) {
-                this->noc1_noc2axi->addPipeWithoutVC(p->pipe_id, data_size);
-                this->dram_inout->addPipeWithoutVC(p->pipe_id, data_size);
+                return {this->noc1_noc2axi, this->dram_inout};
             }
             else {
                 // TODO: assert
+                return {};
             }
         }
 
-        void routeFromDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) override {
-            routeToDram( noc_id, dram_id, subchan_id, p, data_size);
-        }
-
         std::shared_ptr<Link> noc0_noc2axi;
         std::shared_ptr<Link> noc1_noc2axi;
         std::shared_ptr<Link> dram_inout;
@@ -184,18 +200,15 @@ class wh_dram_channel  : public DramInternal {
 
         ~wh_dram_channel() = default;
 
-        void routeToDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) override {
-            this->noc2axi.at(subchan_id).at(noc_id)->addPipeWithoutVC(p->pipe_id, data_size);
+        std::vector<std::shared_ptr<Link>> getRouteLinks(int noc_id, int subchan_id, const Pipe* p) const override {
+            std::vector<std::shared_ptr<Link>> route_links = {this->noc2axi.at(subchan_id).at(noc_id)};
             if(p->dram_bank == 0) {
-                this->dram0_inout->addPipeWithoutVC(p->pipe_id, data_size);
+                route_links.push_back(this->dram0_inout);
             }
             else if(p->dram_bank == 1) {
-                this->dram1_inout->addPipeWithoutVC(p->pipe_id, data_size);
+                route_links.push_back(this->dram1_inout);
             }
-        }
-
-        void routeFromDram(int noc_id, int dram_id, int subchan_id, Pipe* p, int data_size) override {
-            routeToDram( noc_id, dram_id, subchan_id, p, data_size);
+            return route_links;
         }
 
         std::vector<std::vector<std::shared_ptr<Link>>> noc2axi;
@@ -218,18 +231,8 @@ class DramNode : public Node {
         int subchannel = 0;
         std::shared_ptr<DramInternal> dram_internal;
 
-        void routeFromNodeToNoc0(Pipe* p, int data_size) override {
-            dram_internal->routeFromDram(0, this->channel, this->subchannel, p, data_size);
-        }
-        void routeToNodeFromNoc0(Pipe* p, int data_size) override {
-            routeFromNodeToNoc0(p, data_size);
-        }
-
-        void routeFromNodeToNoc1(Pipe* p, int data_size) override {
-            dram_internal->routeFromDram(1, this->channel, this->subchannel, p, data_size);
-        }
-        void routeToNodeFromNoc1(Pipe* p, int data_size) override {
-            routeFromNodeToNoc1(p, data_size);
+        std::vector<std::shared_ptr<Link>> getNocEndpointLinks(int noc_id, const Pipe* p) const override {
+            return dram_internal->getRouteLinks(noc_id, this->subchannel, p);
         }
 };
 
@@ -246,22 +249,8 @@ class PcieNode : public Node {
         };
         ~PcieNode() = default;
 
-        void routeFromNodeToNoc0(Pipe* p, int data_size) override {
-            this->noc0_noc2axi->addPipeWithoutVC(p->pipe_id, data_size);
-            this->pcie_inout->addPipeWithoutVC(p->pipe_id, data_size);
-        }
-
-        void routeToNodeFromNoc0(Pipe* p, int data_size) override {
-            routeFromNodeToNoc0(p, data_size);
-        }
-
-        void routeFromNodeToNoc1(Pipe* p, int data_size) override {
-            this->noc1_noc2axi->addPipeWithoutVC(p->pipe_id, data_size);
-            this->pcie_inout->addPipeWithoutVC(p->pipe_id, data_size);
-        }
-
-        void routeToNodeFromNoc1(Pipe* p, int data_size) override {
-            routeFromNodeToNoc1(p, data_size);
+        std::vector<std::shared_ptr<Link>> getNocEndpointLinks(int noc_id, const Pipe* p) const override {
+            return {noc_id == 1 ? this->noc1_noc2axi : this->noc0_noc2axi, this->pcie_inout};
         }
         
         std::shared_ptr<Link> noc0_noc2axi;
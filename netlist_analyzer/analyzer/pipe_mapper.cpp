@@ -12,11 +12,18 @@
 
 namespace analyzer {
 
-// Pipe routing / mapping
-// increment statistics / link usage
+namespace {
+void recordHops(PipeTransfer& transfer, const std::vector<std::shared_ptr<Link>>& links) {
+    for(const auto& link : links) {
+        transfer.hops.push_back({link});
+    }
+}
+}
+
+// Pipe routing
+// record the links a transfer crosses, accounted on the links by mapTransfers
 // Noc0: Direction order East then South
-void routeNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t data_size, uint32_t vc) {
-    uint64_t pipe_id = p->pipe_id;
+void routeNoc0(const Chip & chip, const Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t vc, PipeTransfer& transfer) {
     int cur_x = src->soc_location.x;
     int cur_y = src->soc_location.y;
     const int end_x = dst->soc_location.x;
@@ -24,13 +31,8 @@ void routeNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
 
     // handle source point
     auto src_node = chip.getNode(cur_y, cur_x);
-    src_node->routeFromNodeToNoc0(p, data_size);
-    src_node->noc0_link_out->addPipeWithoutVC(pipe_id, data_size);
-
-    // handle sink point
-    auto end_node = chip.getNode(end_y, end_x);
-    end_node->noc0_link_in->addPipeWithoutVC(pipe_id, data_size);
-    end_node->routeToNodeFromNoc0(p, data_size);
+    recordHops(transfer, src_node->getNocEndpointLinks(0, p));
+    transfer.hops.push_back({src_node->noc0_link_out});
 
     // Map east
     while(cur_x != end_x) {
@@ -39,7 +41,7 @@ void routeNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
         if(cur_x == 0) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc0_out_east->addPipe(pipe_id, data_size, vc); 
+        transfer.hops.push_back({cur_node->external_links.noc0_out_east, static_cast<int>(vc)});
         // increment node
         cur_x = (cur_x + 1 ) % chip.getGridSize().x;
     }
@@ -51,16 +53,18 @@ void routeNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
         if(cur_y == 0) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc0_out_south->addPipe(pipe_id, data_size, vc);
+        transfer.hops.push_back({cur_node->external_links.noc0_out_south, static_cast<int>(vc)});
         // increment node
         cur_y = (cur_y + 1 ) % chip.getGridSize().y;
     }
 
-    
+    // handle sink point
+    auto end_node = chip.getNode(end_y, end_x);
+    transfer.hops.push_back({end_node->noc0_link_in});
+    recordHops(transfer, end_node->getNocEndpointLinks(0, p));
 }
 
-void routeMcastRowNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> start, std::shared_ptr<Node> end, uint32_t data_size, uint32_t vc) {
-    uint64_t pipe_id = p->pipe_id;
+void routeMcastRowNoc0(const Chip & chip, std::shared_ptr<Node> start, std::shared_ptr<Node> end, uint32_t vc, PipeTransfer& transfer) {
     int cur_x = start->soc_location.x;
     int cur_y = start->soc_location.y;
     const int end_x = end->soc_location.x;
@@ -70,11 +74,11 @@ void routeMcastRowNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> start, std::s
     auto src_node = chip.getNode(cur_y, cur_x);
 
     // Loopback  
-    src_node->noc0_link_out->addPipeWithoutVC(pipe_id, data_size);
-    //src_node->noc0_link_in->addPipeWithoutVC(pipe_id, data_size);
+    transfer.hops.push_back({src_node->noc0_link_out});
+    //transfer.hops.push_back({src_node->noc0_link_in});
 
     // Mcast to external
-    src_node->noc0_link_out->addPipeWithoutVC(pipe_id, data_size);
+    transfer.hops.push_back({src_node->noc0_link_out});
 
     // Map east
     while(cur_x != end_x) {
@@ -83,10 +87,10 @@ void routeMcastRowNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> start, std::s
         if(cur_x == 0) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc0_out_east->addPipe(pipe_id, data_size, vc);
+        transfer.hops.push_back({cur_node->external_links.noc0_out_east, static_cast<int>(vc)});
 
         if(cur_node->node_type == "core") {
-            cur_node->noc0_link_in->addPipeWithoutVC(pipe_id, data_size);
+            transfer.hops.push_back({cur_node->noc0_link_in});
         }
 
         // increment node
@@ -94,12 +98,11 @@ void routeMcastRowNoc0(Chip & chip, Pipe* p, std::shared_ptr<Node> start, std::s
     }
     auto cur_node = chip.getNode(cur_y, cur_x);
     log_assert(cur_node->node_type == "core", "Incorrect node type");
-    cur_node->noc0_link_in->addPipeWithoutVC(pipe_id, data_size); 
+    transfer.hops.push_back({cur_node->noc0_link_in});
 }
 
 // Noc1: Direction order North then West
-void routeNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t data_size, uint32_t vc) {
-    uint64_t pipe_id = p->pipe_id;
+void routeNoc1(const Chip & chip, const Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t vc, PipeTransfer& transfer) {
     int cur_x = src->soc_location.x;
     int cur_y = src->soc_location.y;
     const int end_x = dst->soc_location.x;
@@ -107,14 +110,9 @@ void routeNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
 
     // handle source point
     auto src_node = chip.getNode(cur_y, cur_x);
-    src_node->routeFromNodeToNoc1(p, data_size);
-    src_node->noc1_link_out->addPipeWithoutVC(pipe_id, data_size);
+    recordHops(transfer, src_node->getNocEndpointLinks(1, p));
+    transfer.hops.push_back({src_node->noc1_link_out});
 
-    // handle sink point
-    auto end_node = chip.getNode(end_y, end_x);
-    end_node->routeToNodeFromNoc1(p, data_size);
-    end_node->noc1_link_in->addPipeWithoutVC(pipe_id, data_size);
-    
     // Map north
     while(cur_y != end_y) {
         // map outgoing link
@@ -122,7 +120,7 @@ void routeNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
         if(cur_y == (chip.getGridSize().y - 1)) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc1_out_north->addPipe(pipe_id, data_size, vc);
+        transfer.hops.push_back({cur_node->external_links.noc1_out_north, static_cast<int>(vc)});
         // increment node
         cur_y = (cur_y + (chip.getGridSize().y - 1)) % chip.getGridSize().y;
     }
@@ -134,15 +132,19 @@ void routeNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<
         if(cur_x ==(chip.getGridSize().x - 1)) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc1_out_west->addPipe(pipe_id, data_size, vc);
+        transfer.hops.push_back({cur_node->external_links.noc1_out_west, static_cast<int>(vc)});
         // increment node
         cur_x = (cur_x + (chip.getGridSize().x - 1)) % chip.getGridSize().x;
     }
+
+    // handle sink point
+    auto end_node = chip.getNode(end_y, end_x);
+    transfer.hops.push_back({end_node->noc1_link_in});
+    recordHops(transfer, end_node->getNocEndpointLinks(1, p));
 }
 
 // Noc1: Direction order North then West
-void routeMcastColNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t data_size, uint32_t vc) {
-    uint64_t pipe_id = p->pipe_id;
+void routeMcastColNoc1(const Chip & chip, std::shared_ptr<Node> src, std::shared_ptr<Node> dst, uint32_t vc, PipeTransfer& transfer) {
     int cur_x = src->soc_location.x;
     int cur_y = src->soc_location.y;
     //const int end_x = dst->soc_location.x;
@@ -152,11 +154,11 @@ void routeMcastColNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::sha
     auto src_node = chip.getNode(cur_y, cur_x);
     
     // Loopback
-    src_node->noc1_link_out->addPipeWithoutVC(pipe_id, data_size);
-    //src_node->noc1_link_in->addPipeWithoutVC(pipe_id, data_size);
+    transfer.hops.push_back({src_node->noc1_link_out});
+    //transfer.hops.push_back({src_node->noc1_link_in});
 
     // Mcast to external
-    src_node->noc1_link_out->addPipeWithoutVC(pipe_id, data_size);
+    transfer.hops.push_back({src_node->noc1_link_out});
     
     // Map north
     while(cur_y != end_y) {
@@ -165,10 +167,10 @@ void routeMcastColNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::sha
         if(cur_y == (chip.getGridSize().y - 1)) {
             vc = (vc + 8) % 16;
         }
-        cur_node->external_links.noc1_out_north->addPipe(pipe_id, data_size, vc);
+        transfer.hops.push_back({cur_node->external_links.noc1_out_north, static_cast<int>(vc)});
 
         if(cur_node->node_type == "core") {
-            cur_node->noc1_link_in->addPipeWithoutVC(pipe_id, data_size);
+            transfer.hops.push_back({cur_node->noc1_link_in});
         }
 
         // increment node
@@ -176,7 +178,7 @@ void routeMcastColNoc1(Chip & chip, Pipe* p, std::shared_ptr<Node> src, std::sha
     }
     auto cur_node = chip.getNode(cur_y, cur_x);
     log_assert(cur_node->node_type == "core", "Incorrect node type");
-    cur_node->noc1_link_in->addPipeWithoutVC(pipe_id, data_size);
+    transfer.hops.push_back({cur_node->noc1_link_in});
 }
 
 // Pipe routing / mapping
@@ -191,13 +193,16 @@ void mapPipe(Chip & chip, Pipe* p) {
     auto src_node = chip.getNode(p->inputs.at(0));
     auto dst_node = chip.getNode(p->outputs.at(0));
 
-    routeNoc0(chip, p, src_node, dst_node, 1, 1);
+    PipeTransfer transfer = {.kind = PipeTransfer::Kind::Unicast, .src = p->inputs.at(0), .dsts = {p->outputs.at(0)}, .data_size = 1};
+    routeNoc0(chip, p, src_node, dst_node, 1, transfer);
+    mapTransfers(p->pipe_id, {transfer});
 
 }
 
-// Pipe routing / mapping
-void mapGenericPipe(Chip & chip, Pipe* p) {
+// Pipe routing
+std::vector<PipeTransfer> routeGenericPipe(const Chip & chip, const Pipe* p) {
 
+    std::vector<PipeTransfer> transfers;
     const bool mcast = p->outputs.size() > 1; // output scatter handled by creating multiple pipes
     //auto gather_dst_node = chip.getNode(mcast ? p->location : p->outputs.at(0));
     auto gather_dst_node = chip.getNode(p->location);
@@ -217,11 +222,12 @@ void mapGenericPipe(Chip & chip, Pipe* p) {
             auto src_node = chip.getNode(in);
             uint32_t input_bw = p->post_tm_prolog ? 0 : num_tiles * tile_size;
             uint32_t vc = is_dram_read ? DRAM_READ_VC : p->incoming_vc;
+            auto & transfer = transfers.emplace_back(PipeTransfer{.kind = PipeTransfer::Kind::Gather, .src = in, .dsts = {p->location}, .data_size = input_bw});
             if(p->incoming_noc_id == 1) {
-                routeNoc1(chip, p, src_node, gather_dst_node, input_bw, vc);
+                routeNoc1(chip, p, src_node, gather_dst_node, vc, transfer);
             }
             else { // if default (-1) or 0
-                routeNoc0(chip, p, src_node, gather_dst_node, input_bw, vc);
+                routeNoc0(chip, p, src_node, gather_dst_node, vc, transfer);
             }
         }
     }
@@ -234,11 +240,12 @@ void mapGenericPipe(Chip & chip, Pipe* p) {
         auto dst_node = chip.getNode(p->outputs.at(0));
         
         const uint32_t vc = p->outgoing_vc;
+        auto & transfer = transfers.emplace_back(PipeTransfer{.kind = PipeTransfer::Kind::Unicast, .src = p->location, .dsts = {p->outputs.at(0)}, .data_size = pipe_output_bw});
         if(p->outgoing_noc_id == 1) {
-            routeNoc1(chip, p, src_node, dst_node, pipe_output_bw, vc);
+            routeNoc1(chip, p, src_node, dst_node, vc, transfer);
         }
         else { // if default (-1) or 0
-            routeNoc0(chip, p, src_node, dst_node, pipe_output_bw, vc);
+            routeNoc0(chip, p, src_node, dst_node, vc, transfer);
         }
     }
 
@@ -249,6 +256,7 @@ void mapGenericPipe(Chip & chip, Pipe* p) {
         const bool row_not_col_mcast = p->outputs.at(0).y == p->outputs.at(1).y;
         // use mcast vc
         const uint32_t vc = MCAST_VC;
+        auto & transfer = transfers.emplace_back(PipeTransfer{.kind = PipeTransfer::Kind::Multicast, .src = p->location, .dsts = p->outputs, .data_size = pipe_output_bw});
         // If we are row mcast, must use noc0 and assert that the pipe->location is the left most bound of the mcast box
         if(row_not_col_mcast) {
             int x_min = chip.getGridSize().x;
@@ -265,7 +273,7 @@ void mapGenericPipe(Chip & chip, Pipe* p) {
             }
             // Assert pipe location is within the mcast box at the correct corner
             // Not true with new optimizations // assert(p->location.x == x_min and p->location.y == y);
-            routeMcastRowNoc0(chip, p, gather_dst_node, chip.getNode(y, x_max), pipe_output_bw, vc);
+            routeMcastRowNoc0(chip, gather_dst_node, chip.getNode(y, x_max), vc, transfer);
         }
         else { // col mcast, must use noc1 and assert hat the pipe->location is the bottom most bound of the mcast box
             int y_min = chip.getGridSize().y;
@@ -282,21 +290,50 @@ void mapGenericPipe(Chip & chip, Pipe* p) {
             }
             // Assert pipe location is within the mcast box at the correct corner
             // Not true with new optimizations // assert(p->location.y == y_max and p->location.x == x);
-            routeMcastColNoc1(chip, p, gather_dst_node, chip.getNode(y_min, x), pipe_output_bw, vc);
+            routeMcastColNoc1(chip, gather_dst_node, chip.getNode(y_min, x), vc, transfer);
         }
     }
+    return transfers;
 }
 
-void mapEthernetPipe(Chip & chip, int chip_id, EthernetPipe * p) {
+// Pipe mapping
+// increment statistics / link usage
+void mapTransfers(std::uint64_t pipe_id, const std::vector<PipeTransfer>& transfers) {
+    for(const auto & transfer : transfers) {
+        for(const auto & hop : transfer.hops) {
+            if(hop.vc < 0) {
+                hop.link->addPipeWithoutVC(pipe_id, transfer.data_size);
+            }
+            else {
+                hop.link->addPipe(pipe_id, transfer.data_size, hop.vc);
+            }
+        }
+    }
+}
+
+void mapGenericPipe(Chip & chip, Pipe* p, std::vector<PipeTransfer>* transfers) {
+    std::vector<PipeTransfer> pipe_transfers = routeGenericPipe(chip, p);
+    mapTransfers(p->pipe_id, pipe_transfers);
+    if(transfers != nullptr) {
+        *transfers = std::move(pipe_transfers);
+    }
+}
+
+void mapEthernetPipe(Chip & chip, int chip_id, EthernetPipe * p, std::vector<PipeTransfer>* transfers) {
     const int data_size = p->num_tiles * p->tile_size;
+    std::vector<PipeTransfer> pipe_transfers;
     if(p->input_chip_id == chip_id) {
         auto eth_node = std::dynamic_pointer_cast<EthNode>(chip.getEthNode(p->input_eth_chan));
-        eth_node->to_ethernet->addPipeWithoutVC(p->pipe_id, data_size);
+        pipe_transfers.push_back({.kind = PipeTransfer::Kind::Ethernet, .src = eth_node->soc_location, .dsts = {}, .data_size = static_cast<uint32_t>(data_size), .hops = {{eth_node->to_ethernet}}});
     }
 
     if(p->output_chip_id == chip_id) {
         auto eth_node = std::dynamic_pointer_cast<EthNode>(chip.getEthNode(p->output_eth_chan));
-        eth_node->from_ethernet->addPipeWithoutVC(p->pipe_id, data_size);
+        pipe_transfers.push_back({.kind = PipeTransfer::Kind::Ethernet, .src = eth_node->soc_location, .dsts = {eth_node->soc_location}, .data_size = static_cast<uint32_t>(data_size), .hops = {{eth_node->from_ethernet}}});
+    }
+    mapTransfers(p->pipe_id, pipe_transfers);
+    if(transfers != nullptr) {
+        *transfers = std::move(pipe_transfers);
     }
 }
 
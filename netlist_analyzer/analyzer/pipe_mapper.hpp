@@ -8,9 +8,44 @@
 
 namespace analyzer {
 
+// One link crossed by a pipe transfer, vc is -1 for links without virtual channels
+struct RouteHop {
+    std::shared_ptr<Link> link;
+    int vc = -1;
+};
+
+// Data moved by one leg of a pipe per input, with the links it crosses in order from source to destination
+struct PipeTransfer {
+    enum class Kind {
+        Gather,     // input of a gather pipe to the pipe location
+        Unicast,    // pipe location to the output
+        Multicast,  // pipe location to all outputs of a row/column mcast
+        Ethernet,   // ethernet link of an ethernet pipe
+    };
+    Kind kind;
+    GridLoc src;
+    std::vector<GridLoc> dsts;
+    uint32_t data_size;
+    std::vector<RouteHop> hops;
+};
+
+// A mapped pipe with its transfers, as replayed by the noc simulator
+struct RoutedPipe {
+    std::uint64_t pipe_id;
+    GridLoc location;
+    std::vector<GridLoc> outputs;
+    int tile_size;
+    std::vector<PipeTransfer> transfers;
+};
+
 void mapPipe(Chip & chip, Pipe* p);
 void mapPipe(Chip & chip, std::shared_ptr<Pipe> p);
-void mapGenericPipe(Chip & chip, Pipe* p);
-void mapEthernetPipe(Chip & chip, int chip_id, EthernetPipe * p);
+// Routes of the transfers of a pipe, without accounting them on the links
+std::vector<PipeTransfer> routeGenericPipe(const Chip & chip, const Pipe* p);
+// Accounts the data of the transfers of a pipe on the links they cross
+void mapTransfers(std::uint64_t pipe_id, const std::vector<PipeTransfer>& transfers);
+// Transfers, if given, are filled with the routes the pipe was mapped to
+void mapGenericPipe(Chip & chip, Pipe* p, std::vector<PipeTransfer>* transfers = nullptr);
+void mapEthernetPipe(Chip & chip, int chip_id, EthernetPipe * p, std::vector<PipeTransfer>* transfers = nullptr);
 
 }
\ No newline at end of file
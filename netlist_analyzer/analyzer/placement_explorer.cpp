@@ -0,0 +1,328 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "placement_explorer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <unordered_set>
+
+#include "op.hpp"
+#include "utils/logger.hpp"
+
+namespace analyzer {
+
+namespace {
+bool overlaps(const GridLoc &loc0, int rows0, int cols0, const GridLoc &loc1, int rows1, int cols1) {
+    return loc0.y < loc1.y + rows1 and loc1.y < loc0.y + rows0 and loc0.x < loc1.x + cols1 and loc1.x < loc0.x + cols0;
+}
+
+int ceilDiv(int a, int b) {
+    return (a + b - 1) / b;
+}
+}
+
+PlacementExplorer::PlacementExplorer(
+    const Chip &chip,
+    const std::unordered_map<std::string, std::shared_ptr<Grid>> &grids,
+    const std::vector<std::shared_ptr<Pipe>> &pipes,
+    const std::vector<PipeTransfer> &ethernet_transfers) :
+    chip(chip), pipes(pipes), link_names(chip.getQualifiedLinkNames()) {
+    for (const auto &[grid_name, grid] : grids) {
+        if (auto op = dynamic_cast<const Op *>(grid.get())) {
+            ops.emplace(grid_name, OpPlacement{
+                .loc = op->core_grid_location,
+                .rows = op->grid_transpose ? op->dims.x : op->dims.y,
+                .cols = op->grid_transpose ? op->dims.y : op->dims.x,
+                .grid_transpose = op->grid_transpose,
+                .estimated_cycles = op->estimated_cycles,
+            });
+            ops_by_cycles.push_back(grid_name);
+        }
+    }
+    std::sort(ops_by_cycles.begin(), ops_by_cycles.end(), [this](const auto &lhs, const auto &rhs) {
+        const int lhs_cycles = ops.at(lhs).estimated_cycles;
+        const int rhs_cycles = ops.at(rhs).estimated_cycles;
+        return lhs_cycles != rhs_cycles ? lhs_cycles > rhs_cycles : lhs < rhs;
+    });
+
+    std::unordered_map<const Link *, double> link_bytes;
+    pipe_link_bytes.reserve(pipes.size());
+    for (std::size_t i = 0; i < pipes.size(); i++) {
+        const auto &pipe = pipes.at(i);
+        auto &bytes = pipe_link_bytes.emplace_back();
+        for (const auto &transfer : routeGenericPipe(chip, pipe.get())) {
+            for (const auto &hop : transfer.hops) {
+                bytes[hop.link.get()] += transfer.data_size;
+            }
+        }
+        for (const auto &[link, link_pipe_bytes] : bytes) {
+            link_bytes[link] += link_pipe_bytes;
+        }
+
+        std::unordered_set<GridLoc> nodes(pipe->inputs.begin(), pipe->inputs.end());
+        nodes.insert(pipe->outputs.begin(), pipe->outputs.end());
+        nodes.insert(pipe->location);
+        for (const auto &node : nodes) {
+            pipes_by_node[node].push_back(i);
+        }
+    }
+    for (const auto &transfer : ethernet_transfers) {
+        for (const auto &hop : transfer.hops) {
+            link_bytes[hop.link.get()] += transfer.data_size;
+        }
+    }
+
+    for (const auto &[link, bytes] : link_bytes) {
+        links.push_back({link, bytes});
+    }
+    std::sort(links.begin(), links.end(), [](const LinkLoad &lhs, const LinkLoad &rhs) {
+        return lhs.bytes / lhs.link->getTotalCapacity() > rhs.bytes / rhs.link->getTotalCapacity();
+    });
+    for (std::size_t i = 0; i < links.size(); i++) {
+        link_index.emplace(links.at(i).link, i);
+    }
+
+    baseline_metrics = metrics({}, {});
+}
+
+double PlacementExplorer::baselineBytes(const Link *link) const {
+    auto it = link_index.find(link);
+    return it != link_index.end() ? links.at(it->second).bytes : 0;
+}
+
+std::string PlacementExplorer::linkName(const Link *link) const {
+    auto it = link_names.find(link);
+    return it != link_names.end() ? it->second : link->getName();
+}
+
+PlacementMetrics PlacementExplorer::evaluate(const std::vector<GridChange> &changes) const {
+    if (changes.empty()) {
+        return baseline_metrics;
+    }
+
+    // Candidate placement of the changed ops
+    const Shape core_grid_size = chip.getCoreGridSize();
+    std::unordered_map<std::string, OpPlacement> placed;
+    std::unordered_map<std::string, int> op_cycles;
+    for (const auto &change : changes) {
+        auto it = ops.find(change.name);
+        log_assert(it != ops.end(), "Cannot find op={} to place", change.name);
+        log_assert(placed.find(change.name) == placed.end(), "op={} is placed more than once", change.name);
+        OpPlacement op = it->second;
+        if (change.loc.has_value()) {
+            op.loc = change.loc.value();
+        }
+        if (change.shape.has_value()) {
+            op.rows = op.grid_transpose ? change.shape->x : change.shape->y;
+            op.cols = op.grid_transpose ? change.shape->y : change.shape->x;
+            log_assert(op.rows > 0 and op.cols > 0, "op={} must be placed on at least one core", change.name);
+            op.estimated_cycles = std::lround(
+                static_cast<double>(op.estimated_cycles) * (it->second.rows * it->second.cols) / (op.rows * op.cols));
+        }
+        log_assert(
+            op.loc.y >= 0 and op.loc.x >= 0 and op.loc.y + op.rows <= core_grid_size.y and
+                op.loc.x + op.cols <= core_grid_size.x,
+            "op={} of {}x{} cores at ({}, {}) does not fit the core grid",
+            change.name,
+            op.rows,
+            op.cols,
+            op.loc.y,
+            op.loc.x);
+        placed.emplace(change.name, op);
+        op_cycles.emplace(change.name, op.estimated_cycles);
+    }
+    for (const auto &[name, op] : placed) {
+        for (const auto &[other_name, other_op] : ops) {
+            auto other_it = placed.find(other_name);
+            const OpPlacement &other = other_it != placed.end() ? other_it->second : other_op;
+            log_assert(
+                other_name == name or not overlaps(op.loc, op.rows, op.cols, other.loc, other.rows, other.cols),
+                "op={} overlaps op={}",
+                name,
+                other_name);
+        }
+    }
+
+    // Cores of the changed ops to the cores covering the same part of their new grid
+    std::unordered_map<GridLoc, std::vector<GridLoc>> node_remap;
+    std::set<int> affected_pipes;
+    for (const auto &[name, op] : placed) {
+        const OpPlacement &baseline_op = ops.at(name);
+        for (int j = 0; j < baseline_op.rows; j++) {
+            for (int i = 0; i < baseline_op.cols; i++) {
+                const GridLoc node = chip.getCoreNode(baseline_op.loc.y + j, baseline_op.loc.x + i)->soc_location;
+                auto &remapped_nodes = node_remap[node];
+                for (int y = j * op.rows / baseline_op.rows; y < ceilDiv((j + 1) * op.rows, baseline_op.rows); y++) {
+                    for (int x = i * op.cols / baseline_op.cols; x < ceilDiv((i + 1) * op.cols, baseline_op.cols); x++) {
+                        remapped_nodes.push_back(chip.getCoreNode(op.loc.y + y, op.loc.x + x)->soc_location);
+                    }
+                }
+                auto pipes_it = pipes_by_node.find(node);
+                if (pipes_it != pipes_by_node.end()) {
+                    affected_pipes.insert(pipes_it->second.begin(), pipes_it->second.end());
+                }
+            }
+        }
+    }
+
+    // Swap the data of the affected pipes for the data of their re-routed pipes on the links either crosses
+    std::unordered_map<const Link *, double> link_bytes;
+    auto bytes_on = [this, &link_bytes](const Link *link) -> double & {
+        auto it = link_bytes.find(link);
+        if (it == link_bytes.end()) {
+            it = link_bytes.emplace(link, baselineBytes(link)).first;
+        }
+        return it->second;
+    };
+    for (const int pipe : affected_pipes) {
+        for (const auto &[link, bytes] : pipe_link_bytes.at(pipe)) {
+            bytes_on(link) -= bytes;
+        }
+        for (const auto &remapped_pipe : remapPipe(*pipes.at(pipe), node_remap)) {
+            for (const auto &transfer : routeGenericPipe(chip, &remapped_pipe)) {
+                for (const auto &hop : transfer.hops) {
+                    bytes_on(hop.link.get()) += transfer.data_size;
+                }
+            }
+        }
+    }
+
+    return metrics(op_cycles, link_bytes);
+}
+
+std::vector<Pipe> PlacementExplorer::remapPipe(
+    const Pipe &pipe, const std::unordered_map<GridLoc, std::vector<GridLoc>> &node_remap) const {
+    auto remapped = [&node_remap](const GridLoc &node) -> const std::vector<GridLoc> * {
+        auto it = node_remap.find(node);
+        return it != node_remap.end() ? &it->second : nullptr;
+    };
+
+    int input_tiles = 0;
+    for (const int num_tiles : pipe.inputs_num_tiles) {
+        input_tiles += num_tiles;
+    }
+    const int t_factor = input_tiles > 0 ? pipe.total_tiles / input_tiles : 1;
+
+    // Inputs on a changed core split their tiles over its new cores
+    Pipe base = pipe;
+    base.inputs.clear();
+    base.inputs_num_tiles.clear();
+    for (std::size_t i = 0; i < pipe.inputs.size(); i++) {
+        if (auto nodes = remapped(pipe.inputs.at(i))) {
+            for (const auto &node : *nodes) {
+                base.inputs.push_back(node);
+                base.inputs_num_tiles.push_back(ceilDiv(pipe.inputs_num_tiles.at(i), nodes->size()));
+            }
+        } else {
+            base.inputs.push_back(pipe.inputs.at(i));
+            base.inputs_num_tiles.push_back(pipe.inputs_num_tiles.at(i));
+        }
+    }
+    if (auto nodes = remapped(pipe.location)) {
+        base.location = nodes->front();
+    }
+
+    // Outputs on changed cores: every new core of a unicast output and every new row/column of a multicast takes its
+    // own share of the data
+    const bool consumer_located = std::find(pipe.outputs.begin(), pipe.outputs.end(), pipe.location) != pipe.outputs.end();
+    bool outputs_remapped = false;
+    std::vector<GridLoc> outputs;
+    for (const auto &output : pipe.outputs) {
+        const auto nodes = remapped(output);
+        outputs_remapped |= nodes != nullptr;
+        for (const auto &node : nodes != nullptr ? *nodes : std::vector<GridLoc>{output}) {
+            if (std::find(outputs.begin(), outputs.end(), node) == outputs.end()) {
+                outputs.push_back(node);
+            }
+        }
+    }
+    std::vector<std::vector<GridLoc>> output_groups;
+    if (not outputs_remapped) {
+        output_groups.push_back(pipe.outputs);
+    } else if (pipe.outputs.size() == 1) {
+        for (const auto &output : outputs) {
+            output_groups.push_back({output});
+        }
+    } else {
+        const bool row_not_col_mcast = pipe.outputs.at(0).y == pipe.outputs.at(1).y;
+        std::map<int, std::vector<GridLoc>> lines;
+        for (const auto &output : outputs) {
+            lines[row_not_col_mcast ? output.y : output.x].push_back(output);
+        }
+        for (auto &[line, line_outputs] : lines) {
+            output_groups.push_back(std::move(line_outputs));
+        }
+    }
+
+    std::vector<Pipe> remapped_pipes;
+    for (const auto &group : output_groups) {
+        Pipe &remapped_pipe = remapped_pipes.emplace_back(base);
+        remapped_pipe.outputs = group;
+        if (outputs_remapped and consumer_located) {
+            // Multicasts leave from the west end of a row and from the south end of a column
+            remapped_pipe.location = *std::min_element(group.begin(), group.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.y != rhs.y ? lhs.y > rhs.y : lhs.x < rhs.x;
+            });
+        }
+        if (output_groups.size() > 1) {
+            for (auto &num_tiles : remapped_pipe.inputs_num_tiles) {
+                num_tiles = ceilDiv(num_tiles, output_groups.size());
+            }
+        }
+        remapped_pipe.unique_inputs_total_tiles.clear();
+        remapped_pipe.evaluateGather(t_factor);
+    }
+    return remapped_pipes;
+}
+
+PlacementMetrics PlacementExplorer::metrics(
+    const std::unordered_map<std::string, int> &op_cycles,
+    const std::unordered_map<const Link *, double> &link_bytes) const {
+    PlacementMetrics result;
+
+    // Unchanged ops and links keep their baseline order, so the slowest of them is the first one not overridden
+    for (const auto &name : ops_by_cycles) {
+        if (op_cycles.find(name) == op_cycles.end()) {
+            result.longest_op = name;
+            result.longest_op_cycles = ops.at(name).estimated_cycles;
+            break;
+        }
+    }
+    for (const auto &[name, cycles] : op_cycles) {
+        if (cycles > result.longest_op_cycles) {
+            result.longest_op = name;
+            result.longest_op_cycles = cycles;
+        }
+    }
+
+    const Link *worst_link = nullptr;
+    double worst_link_cycles = 0;
+    for (const auto &load : links) {
+        if (link_bytes.find(load.link) == link_bytes.end()) {
+            worst_link = load.link;
+            worst_link_cycles = load.bytes / load.link->getTotalCapacity();
+            break;
+        }
+    }
+    for (const auto &[link, bytes] : link_bytes) {
+        const double cycles = bytes / link->getTotalCapacity();
+        if (cycles > worst_link_cycles) {
+            worst_link = link;
+            worst_link_cycles = cycles;
+        }
+    }
+    if (worst_link != nullptr) {
+        result.worst_link = linkName(worst_link);
+    }
+
+    if (result.longest_op_cycles > 0) {
+        result.worst_link_percent_capacity = worst_link_cycles / result.longest_op_cycles;
+        result.bw_limited_op_cycles = std::max(result.longest_op_cycles, static_cast<int>(worst_link_cycles));
+    }
+    return result;
+}
+
+}  // namespace analyzer
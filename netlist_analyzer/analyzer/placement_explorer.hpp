@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+// placement_explorer.hpp
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chip.hpp"
+#include "pipe_mapper.hpp"
+
+namespace analyzer {
+
+// Candidate placement of one op, in worker core coordinates like the netlist grid_loc and grid_size
+struct GridChange {
+    std::string name;
+    std::optional<GridLoc> loc;
+    std::optional<Shape> shape;
+};
+
+struct PlacementMetrics {
+    std::string longest_op;
+    int longest_op_cycles = 0;
+    std::string worst_link;
+    // Data of the worst link per input over the data it can move in the longest op cycles
+    float worst_link_percent_capacity = 0;
+    int bw_limited_op_cycles = 0;
+};
+
+// What-if analysis of op placements for one chip and epoch.
+//
+// The pipes of the epoch are routed once into per link data. A candidate moves or resizes ops, only the pipes with an
+// input, output or location on the moved ops are re-routed and the data they move is swapped on the links they cross,
+// so evaluating a candidate costs the pipes of the moved ops rather than the whole epoch. Neither the chip links nor the
+// grids are touched, every candidate is evaluated against the baseline placement.
+//
+// Moves translate the pipe endpoints on the op cores. Resizes spread the endpoints of each core over the cores covering
+// the same part of the new grid: inputs and unicast outputs split their tiles evenly, row/column multicasts stay
+// multicasts per new row/column, and the estimated op cycles scale with the inverse of the number of cores.
+class PlacementExplorer {
+  public:
+    // Ethernet transfers are accounted as they are, no op placement moves them
+    PlacementExplorer(
+        const Chip &chip,
+        const std::unordered_map<std::string, std::shared_ptr<Grid>> &grids,
+        const std::vector<std::shared_ptr<Pipe>> &pipes,
+        const std::vector<PipeTransfer> &ethernet_transfers);
+
+    const PlacementMetrics &baseline() const { return baseline_metrics; }
+    PlacementMetrics evaluate(const std::vector<GridChange> &changes) const;
+
+  private:
+    // Op grid on the core grid, rows and cols after grid_transpose
+    struct OpPlacement {
+        GridLoc loc;
+        int rows;
+        int cols;
+        bool grid_transpose;
+        int estimated_cycles;
+    };
+    struct LinkLoad {
+        const Link *link;
+        double bytes;
+    };
+
+    // Shares the nodes and links of the chip it was built for
+    const Chip chip;
+    std::unordered_map<std::string, OpPlacement> ops;
+    std::vector<std::shared_ptr<Pipe>> pipes;
+    // Bytes every pipe moves over each link it crosses
+    std::vector<std::unordered_map<const Link *, double>> pipe_link_bytes;
+    std::unordered_map<GridLoc, std::vector<int>> pipes_by_node;
+
+    // Links crossed by the pipes, ordered by the cycles per input their data takes, slowest first
+    std::vector<LinkLoad> links;
+    std::unordered_map<const Link *, int> link_index;
+    std::unordered_map<const Link *, std::string> link_names;
+    std::vector<std::string> ops_by_cycles;
+
+    PlacementMetrics baseline_metrics;
+
+    double baselineBytes(const Link *link) const;
+    std::string linkName(const Link *link) const;
+    std::vector<Pipe> remapPipe(const Pipe &pipe, const std::unordered_map<GridLoc, std::vector<GridLoc>> &node_remap) const;
+    PlacementMetrics metrics(
+        const std::unordered_map<std::string, int> &op_cycles,
+        const std::unordered_map<const Link *, double> &link_bytes) const;
+};
+
+}  // namespace analyzer
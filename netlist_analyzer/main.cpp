@@ -13,6 +13,8 @@ struct test_args {
     std::string arch = "";
     std::string cluster_file = "";
     std::string out_dir = "";
+    bool simulate = false;
+    int simulate_inputs = 0;
     bool help = false;
 };
 namespace {
@@ -65,6 +67,8 @@ test_args parse_test_args(std::vector<std::string> input_args) {
     help_string += "--arch                      : grayskull, wormhole_b0\n";
     help_string += "--cluster-desc              : Specifies the path to the cluster descriptor yaml\n";
     help_string += "--out-dir                   : Specifies the base output directory\n";
+    help_string += "--simulate                  : Replays each epoch in the noc simulator and reports cycles per input and the critical path\n";
+    help_string += "--simulate-inputs           : Number of inputs to simulate (default 8)\n";
     help_string += "--help                      : Prints this message\n";
 
     try {
@@ -74,6 +78,10 @@ test_args parse_test_args(std::vector<std::string> input_args) {
         std::tie(args.arch, input_args) = ::get_command_option_and_remaining_args(input_args, "--arch", "grayskull");
         std::tie(args.cluster_file, input_args) = ::get_command_option_and_remaining_args(input_args, "--cluster-desc", "");
         std::tie(args.out_dir, input_args) = ::get_command_option_and_remaining_args(input_args, "--out-dir", "");
+        std::tie(args.simulate, input_args) = ::has_command_option_and_remaining_args(input_args, "--simulate");
+        std::string simulate_inputs;
+        std::tie(simulate_inputs, input_args) = ::get_command_option_and_remaining_args(input_args, "--simulate-inputs", "0");
+        args.simulate_inputs = std::stoi(simulate_inputs);
         std::tie(args.help, input_args) = ::has_command_option_and_remaining_args(input_args, "--help");
         ::validate_remaining_args(input_args);
     } catch (const std::exception& e) {
@@ -167,6 +175,13 @@ int main(int argc, char** argv) {
     }
 
     auto netlist_analyzer = tt_netlist_analyzer(args.arch, args.netlist_path, args.cluster_file);
+    if (args.simulate) {
+        analyzer::NocSimulatorConfig simulation_config;
+        if (args.simulate_inputs > 0) {
+            simulation_config.num_inputs = args.simulate_inputs;
+        }
+        netlist_analyzer.enable_simulation(simulation_config);
+    }
     
     netlist_analyzer.run_net2pipe_flow(analyzer_output_dir_path);
 
@@ -240,6 +240,35 @@ void tt_netlist_analyzer::run_analyzer_checks_for_epoch(const int& epoch_id) {
     }
 }
 
+void tt_netlist_analyzer::simulate_epoch(const int& epoch_id, const string &build_dir_path) {
+    log_assert(
+        m_analyzer_per_epoch.find(epoch_id) != m_analyzer_per_epoch.end(),
+        "Need to configure analyzer for epoch_id={} first before simulate_epoch",
+        epoch_id);
+    log_assert(m_simulation_config.has_value(), "Simulation must be enabled before simulate_epoch");
+    for (const auto& chip_id : m_chips_per_epoch.at(epoch_id)) {
+        const auto report = m_analyzer_per_epoch.at(epoch_id).simulate_chip(chip_id, m_simulation_config.value());
+        report.report();
+        const string simulation_yaml_path = build_dir_path + "/netlist_analyzer/simulation_output_temporal_epoch_" + std::to_string(epoch_id) + "_chip_" + std::to_string(chip_id) + ".yaml";
+        log_info(tt::LogAnalyzer, "Exporting simulation: {}", simulation_yaml_path);
+        report.outputYaml(simulation_yaml_path);
+    }
+}
+
+analyzer::PlacementMetrics tt_netlist_analyzer::evaluate_placement(
+    const int& epoch_id, const int& chip_id, const std::vector<analyzer::GridChange>& changes) {
+    log_assert(
+        m_analyzer_per_epoch.find(epoch_id) != m_analyzer_per_epoch.end(),
+        "Need to run the net2pipe flow for epoch_id={} first before evaluate_placement",
+        epoch_id);
+    log_assert(
+        m_chips_per_epoch.at(epoch_id).find(chip_id) != m_chips_per_epoch.at(epoch_id).end(),
+        "Epoch epoch_id={} does not use chip_id={}",
+        epoch_id,
+        chip_id);
+    return m_analyzer_per_epoch.at(epoch_id).evaluate_placement(chip_id, changes);
+}
+
 [[deprecated]]
 void tt_netlist_analyzer::run_default_flow(){
     for (int e = 0; e < m_netlist_parser.get_number_of_temporal_graphs(); e++) {
@@ -269,6 +298,9 @@ void tt_netlist_analyzer::run_net2pipe_flow(const string &build_dir_path){
         place_for_epoch(e);
         load_pipes_for_epoch(e, build_dir_path);
         run_analyzer_checks_for_epoch(e);
+        if (m_simulation_config.has_value()) {
+            simulate_epoch(e, build_dir_path);
+        }
         //for (const auto& chip_id : m_chips_per_epoch.at(e)) {
         for (size_t chip_id = 0; chip_id < m_chips.size(); chip_id++) {
             if (m_chips_per_epoch.at(e).find(chip_id) == m_chips_per_epoch.at(e).end()) {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <unordered_map>
 #include <string>
 
@@ -52,6 +53,12 @@ class tt_netlist_analyzer : public tt_backend {
     // Analyzer flows
     void run_default_flow();
     void run_net2pipe_flow(const string &build_dir_path);
+    // Also replay every epoch of the net2pipe flow in the noc simulator
+    void enable_simulation(const analyzer::NocSimulatorConfig &config) { m_simulation_config = config; }
+    // Bottleneck metrics of an epoch of the net2pipe flow with some ops moved or resized, only the pipes of those ops
+    // are re-routed. Candidates are independent, each is evaluated against the placement of the netlist
+    analyzer::PlacementMetrics evaluate_placement(
+        const int &epoch_id, const int &chip_id, const std::vector<analyzer::GridChange> &changes);
 
     // parse cluster description file
     void parse_cluster_desc(const string &cluster_desc_path);
@@ -69,6 +76,7 @@ class tt_netlist_analyzer : public tt_backend {
     std::unordered_map<int, std::unordered_set<std::string>> m_ops_used_per_epoch = {};
     std::unordered_map<int, std::unordered_set<int>> m_chips_per_epoch = {};
     std::unordered_map<int, std::unordered_map<string, std::pair<bool, bool>>> m_queue_settings_used_per_epoch = {};
+    std::optional<analyzer::NocSimulatorConfig> m_simulation_config = std::nullopt;
 
     std::pair<bool, bool> determine_queue_setting_for_queue_and_epoch (const string queue_name, const int& epoch_id);
     void configure_analyzer_for_epoch (const int& epoch_id);
@@ -78,6 +86,7 @@ class tt_netlist_analyzer : public tt_backend {
     void route_for_epoch (const int& epoch_id);
     void load_pipes_for_epoch (const int& epoch_id, const string &build_dir_path);
     void run_analyzer_checks_for_epoch(const int& epoch_id);
+    void simulate_epoch(const int& epoch_id, const string &build_dir_path);
 
     //XXX: Temp Model functions to be moved
     int get_estimated_op_cycles(const tt_op_info& op) const;
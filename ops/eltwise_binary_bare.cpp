@@ -190,6 +190,9 @@ void tt_eltwise_binary_bare_op::model(vector<tt_tensor *> &inputs, tt_tensor *ou
     tt_eltwise_binary::utils::golden_model(m_config, inputs, out);
 }
 
+// Only the in-place tile transpose of input 0 writes to the inputs
+bool tt_eltwise_binary_bare_op::model_modifies_inputs() const { return m_config.transpose; }
+
 string tt_eltwise_binary::utils::binary_op_to_string(BinaryOp binary_op) {
     switch (binary_op) {
         case BinaryOp::Add: return "add";
@@ -176,6 +176,9 @@ void tt_eltwise_unary_sfpu_bare_op::model(vector<tt_tensor*>& inputs, tt_tensor*
     tt_eltwise_unary::utils::golden_model(m_config, inputs, out);
 }
 
+// Only the in-place tile transpose writes to the input
+bool tt_eltwise_unary_sfpu_bare_op::model_modifies_inputs() const { return m_config.transpose; }
+
 string tt_eltwise_unary::utils::sfpu_op_to_string(SfpuOp sfpu_op) {
     switch (sfpu_op) {
         case SfpuOp::Exp: return "sfpu_exp";
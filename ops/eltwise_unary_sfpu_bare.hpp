@@ -68,6 +68,7 @@ class tt_eltwise_unary_sfpu_bare_op : public tt_op {
 
     //! Model Implementation
     void model(vector<tt_tensor*>& inputs, tt_tensor* out) override;
+    bool model_modifies_inputs() const override;
 
    private:
     tt_eltwise_unary_config m_config = {};
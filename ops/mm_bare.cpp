@@ -362,6 +362,20 @@ void tt_mm_bare_op::model(vector<tt_tensor*>& inputs, tt_tensor* out) {
      tt_matmul::utils::golden_model(m_config, inputs, out);
  }
 
+// Golden transposes input 1 in place and clears the values of input 0/1 outside of their tile dims
+bool tt_mm_bare_op::model_modifies_inputs() const {
+    if (m_config.transpose) {
+        return true;
+    }
+    for (int input = 0; input < 2 and input < static_cast<int>(m_config.input_tile_dims.size()); input++) {
+        const auto &tile_dims = m_config.input_tile_dims.at(input);
+        if (tile_dims.at(0) != constants::TILE_HEIGHT or tile_dims.at(1) != constants::TILE_WIDTH) {
+            return true;
+        }
+    }
+    return false;
+}
+
 ostream& operator<<(ostream& os, const CompressedIndexControlEntry& t) {
     os << "CompressedIndexControlEntry{";
     os << " .push_tiles=" << t.push_tiles << ",";
@@ -112,6 +112,7 @@ class tt_mm_bare_op : public tt_op {
     ~tt_mm_bare_op();
 
     void model(vector<tt_tensor*>& inputs, tt_tensor* out) override;
+    bool model_modifies_inputs() const override;
     
    private:
     tt_matmul_config m_config;
@@ -157,6 +157,8 @@ void tt_reduce_bare_op::model(vector<tt_tensor*>& inputs, tt_tensor* out) {
     tt_reduce::utils::golden_model(m_config, inputs, out);
 }
 
+bool tt_reduce_bare_op::model_modifies_inputs() const { return false; }
+
 string tt_reduce::utils::reduce_func_to_string(ReduceFunc reduce_func) {
     switch (reduce_func) {
         case ReduceFunc::Avg: return "avg";
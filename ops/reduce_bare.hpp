@@ -53,6 +53,7 @@ class tt_reduce_bare_op : public tt_op {
 
     //! Model Implementation
     void model(vector<tt_tensor*>& inputs, tt_tensor* out) override;
+    bool model_modifies_inputs() const override;
 
    private:
     tt_reduce_config m_config;
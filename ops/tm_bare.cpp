@@ -22,6 +22,8 @@ void tt_tm_bare_op::model(vector<tt_tensor*>& inputs, tt_tensor* out) {
     tt_tm::utils::golden_model(m_config, inputs, out);
 }
 
+bool tt_tm_bare_op::model_modifies_inputs() const { return false; }
+
 string tt_tm::utils::tm_op_to_string(TmOp tm_op) {
     switch (tm_op) {
         case TmOp::rBroadcast: return "r_broadcast";
@@ -25,6 +25,7 @@ class tt_tm_bare_op : public tt_op {
 
     //! Model Implementation
     void model(vector<tt_tensor *> &inputs, tt_tensor *out) override;
+    bool model_modifies_inputs() const override;
 
    private:
     tt_tm_config m_config;
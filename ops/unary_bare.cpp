@@ -153,6 +153,9 @@ void tt_unary_bare_op::model(vector<tt_tensor *> &inputs, tt_tensor *out) {
     tt_unary::utils::golden_model(m_config, inputs, out);
 }
 
+// Only the in-place tile transpose writes to the input
+bool tt_unary_bare_op::model_modifies_inputs() const { return m_config.transpose; }
+
 string tt_unary::utils::unary_op_to_string(UnaryOp unary_op) {
     switch (unary_op) {
         case UnaryOp::Datacopy: return "datacopy";
@@ -58,6 +58,7 @@ class tt_unary_bare_op : public tt_op {
     //    per_block_m_tiles, int per_block_k_tiles);
 
     void model(vector<tt_tensor *> &inputs, tt_tensor *out) override;
+    bool model_modifies_inputs() const override;
 
    private:
     tt_unary_config m_config;
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace perf {
+
+struct host_event_record {
+    // Global recording order across all threads, used to merge the per thread buffers
+    uint64_t sequence;
+    uint64_t event_id;
+    uint64_t event_value;
+};
+
+// Append only event buffer written by a single host thread and drained by the profiler.
+// Storage is pre-allocated in fixed size chunks that never move, so the owning thread records without taking any lock
+// while the profiler drains concurrently. Chunks are chained rather than reused as a ring, since dropping the oldest
+// events would unpair the start/end events the postprocessor matches up. Fully drained chunks are released on drain,
+// and a buffer whose owner retired it is done with, tail chunk included, once drained after the retire.
+class host_event_buffer {
+   public:
+    static constexpr std::size_t events_per_chunk = 4096;
+
+    host_event_buffer() : head(new chunk), tail(head), drain_chunk(head) {}
+    ~host_event_buffer() {
+        while (head != nullptr) {
+            chunk *next = head->next.load(std::memory_order_relaxed);
+            delete head;
+            head = next;
+        }
+    }
+    host_event_buffer(const host_event_buffer &) = delete;
+    host_event_buffer &operator=(const host_event_buffer &) = delete;
+
+    // Owning thread only
+    inline void push(uint64_t sequence, uint64_t event_id, uint64_t event_value) {
+        if (tail_size == events_per_chunk) {
+            chunk *next = new chunk;
+            tail->next.store(next, std::memory_order_release);
+            tail = next;
+            tail_size = 0;
+        }
+        tail->events[tail_size++] = {sequence, event_id, event_value};
+        num_events.store(num_events.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Owning thread only, once it records nothing more into this buffer, eg. on thread exit
+    inline void retire() { retired.store(true, std::memory_order_release); }
+
+    // Single consumer. Read before a drain, true means that drain visits the last of the events
+    inline bool is_retired() const { return retired.load(std::memory_order_acquire); }
+
+    // Single consumer. Visits all events recorded since the previous drain, in recording order.
+    template <typename Func>
+    void drain(Func &&func) {
+        const uint64_t end = num_events.load(std::memory_order_acquire);
+        for (; num_drained < end; num_drained++) {
+            if (num_drained - drain_chunk_start == events_per_chunk) {
+                drain_chunk = drain_chunk->next.load(std::memory_order_acquire);
+                drain_chunk_start += events_per_chunk;
+            }
+            func(drain_chunk->events[num_drained - drain_chunk_start]);
+        }
+        // The producer is at or past drain_chunk, so all chunks in front of it are done with
+        while (head != drain_chunk) {
+            chunk *next = head->next.load(std::memory_order_relaxed);
+            delete head;
+            head = next;
+        }
+    }
+
+    // Custom event label to index lookups already resolved by the owning thread, owning thread only
+    std::unordered_map<std::string, uint32_t> label_cache;
+
+   private:
+    struct chunk {
+        host_event_record events[events_per_chunk];
+        std::atomic<chunk *> next = nullptr;
+    };
+
+    chunk *head;
+    // Producer side
+    chunk *tail;
+    std::size_t tail_size = 0;
+    alignas(64) std::atomic<uint64_t> num_events = 0;
+    std::atomic<bool> retired = false;
+    // Consumer side
+    alignas(64) chunk *drain_chunk;
+    uint64_t drain_chunk_start = 0;
+    uint64_t num_drained = 0;
+};
+
+}  // namespace perf
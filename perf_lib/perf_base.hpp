@@ -179,6 +179,12 @@ enum class HostEventType {
     QUEUE_UPDATE_VARINST,
     QUEUE_CHECK_VARINST,
     CUSTOM,
+    EPOCH_BINARY_WRITE_BYTES,
+    EPOCH_BINARY_WRITE_COUNT,
+    EPOCH_BINARY_WRITE_BANDWIDTH,
+    PUSH_INPUTS_CONVERT,
+    PUSH_INPUTS_WRITE,
+    PUSH_INPUTS_FLUSH,
 };
 
 enum class ThreadType {
@@ -195,6 +201,16 @@ const unordered_set<uint> host_single_value_events = {
     uint(HostEventType::DEVICE_END_CYCLE),
     uint(HostEventType::DEVICE_START_CYCLE_ALIGNED),
     uint(HostEventType::DEVICE_END_CYCLE_ALIGNED),
+    uint(HostEventType::EPOCH_BINARY_WRITE_BYTES),
+    uint(HostEventType::EPOCH_BINARY_WRITE_COUNT),
+    uint(HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH),
+};
+
+// Single value events recorded once per epoch binary write, where every record is a separate value
+const unordered_set<uint> host_per_write_value_events = {
+    uint(HostEventType::EPOCH_BINARY_WRITE_BYTES),
+    uint(HostEventType::EPOCH_BINARY_WRITE_COUNT),
+    uint(HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH),
 };
 
 const unordered_map<int, string> host_event_labels = {
@@ -227,6 +243,12 @@ const unordered_map<int, string> host_event_labels = {
     {uint(HostEventType::QUEUE_UPDATE_VARINST),      "send-queue-update-varinst-command"},
     {uint(HostEventType::QUEUE_CHECK_VARINST),       "check-queue-update-varinst-command"},
     {uint(HostEventType::CUSTOM),                    ""},
+    {uint(HostEventType::EPOCH_BINARY_WRITE_BYTES),  "send-epoch-binary-bytes"},
+    {uint(HostEventType::EPOCH_BINARY_WRITE_COUNT),  "send-epoch-binary-num-writes"},
+    {uint(HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH), "send-epoch-binary-bytes-per-second"},
+    {uint(HostEventType::PUSH_INPUTS_CONVERT),       "push-inputs-convert"},
+    {uint(HostEventType::PUSH_INPUTS_WRITE),         "push-inputs-write"},
+    {uint(HostEventType::PUSH_INPUTS_FLUSH),         "push-inputs-flush-wptrs"},
 };
 
 const vector<string> thread_names = {"T0", "T1", "T2", "NCRISC", "BRISC"};
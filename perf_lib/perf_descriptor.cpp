@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 #include "perf_descriptor.hpp"
+#include <algorithm>
 #include "model/utils.hpp"
 #include "yaml-cpp/yaml.h"
 #include "dram_address_map.h"
@@ -763,9 +764,37 @@ void tt_backend_perf::setup_host_perf_profiler(string in_test_output_dir, string
     }
 }
 
+std::shared_ptr<host_event_buffer> tt_backend_perf::register_thread_event_buffer() {
+    const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
+    return thread_event_buffers.emplace_back(std::make_shared<host_event_buffer>());
+}
+
+void tt_backend_perf::merge_thread_event_buffers() {
+    vector<host_event_record> events;
+    // Buffers of threads that exited hold no more events once drained, dropping them frees all their chunks
+    const auto drain_and_check_retired = [&events](const std::shared_ptr<host_event_buffer> &buffer) {
+        const bool retired = buffer->is_retired();
+        buffer->drain([&events](const host_event_record &event) { events.push_back(event); });
+        return retired;
+    };
+    thread_event_buffers.erase(
+        std::remove_if(thread_event_buffers.begin(), thread_event_buffers.end(), drain_and_check_retired),
+        thread_event_buffers.end());
+    // Each buffer is already in order, restore the interleaving between threads
+    std::sort(events.begin(), events.end(), [](const host_event_record &a, const host_event_record &b) {
+        return a.sequence < b.sequence;
+    });
+    perf_buffer.reserve(perf_buffer.size() + 2 * events.size());
+    for (const host_event_record &event : events) {
+        perf_buffer.push_back(event.event_id);
+        perf_buffer.push_back(event.event_value);
+    }
+}
+
 void tt_backend_perf::finish_host_perf_profiler(bool called_by_destructor) {
     if (en) {
         const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
+        merge_thread_event_buffers();
         uint thread_id = get_thread_id();
         log_info(tt::LogPerfPostProcess, "Generating backend profiler report for process_id {} thread {}", process_id, thread_id);
         if (last_thread_processing() || called_by_destructor) {
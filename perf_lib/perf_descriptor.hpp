@@ -11,7 +11,10 @@
 #include <chrono>
 #include <boost/functional/hash.hpp>
 #include <thread>
+#include <memory>
+#include <atomic>
 #include "scratch_api.h"
+#include "host_event_buffer.hpp"
 #include "perf_base.hpp"
 #include "netlist/netlist_workload_data.hpp"
 #include "common/env_lib.hpp"
@@ -309,7 +312,46 @@ struct tt_backend_perf {
 private:
     const bool en = parse_env("TT_BACKEND_PROFILER", false);
 
+    // Every recording thread appends to its own buffer without locking, buffers are merged in
+    // global recording order into perf_buffer when the profiler finishes
+    inline static std::atomic<uint64_t> next_instance_id = 0;
+    const uint64_t instance_id = next_instance_id++;
+    std::atomic<uint64_t> event_sequence = 0;
+    // Shared with the owning thread, which retires its buffer on exit so the next merge frees it
+    vector<std::shared_ptr<host_event_buffer>> thread_event_buffers;
+
+    struct thread_event_buffer_handle {
+        std::shared_ptr<host_event_buffer> buffer;
+        uint64_t instance_id = ~uint64_t(0);
+        ~thread_event_buffer_handle() {
+            if (buffer) {
+                buffer->retire();
+            }
+        }
+    };
+    std::shared_ptr<host_event_buffer> register_thread_event_buffer();
+    inline host_event_buffer &get_thread_event_buffer() {
+        thread_local thread_event_buffer_handle handle;
+        if (handle.instance_id != instance_id) {
+            if (handle.buffer) {
+                handle.buffer->retire();
+            }
+            handle.buffer = register_thread_event_buffer();
+            handle.instance_id = instance_id;
+        }
+        return *handle.buffer;
+    }
+    inline uint get_label_index(const string &event_label) {
+        host_event_buffer &buffer = get_thread_event_buffer();
+        auto label_it = buffer.label_cache.find(event_label);
+        if (label_it == buffer.label_cache.end()) {
+            label_it = buffer.label_cache.insert({event_label, check_and_insert_new_label(event_label)}).first;
+        }
+        return label_it->second;
+    }
+
 public:
+    // Merged events, filled in by merge_thread_event_buffers()
     vector<uint64_t> perf_buffer;
     vector<uint64_t> device_start_end_buffer;
     
@@ -371,9 +413,8 @@ public:
     inline void record_loader_event(const uint64_t &event_id, const uint64_t &event_value) {
         if constexpr (uint(level) <= uint(backend_profiler_level)) {
             if (en) {
-                const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
-                perf_buffer.push_back(event_id);
-                perf_buffer.push_back(event_value);
+                const uint64_t sequence = event_sequence.fetch_add(1, std::memory_order_relaxed);
+                get_thread_event_buffer().push(sequence, event_id, event_value);
             }
         }
     }
@@ -401,8 +442,7 @@ public:
     inline void record_loader_event(const string &event_label) {
         if constexpr (uint(level) <= uint(backend_profiler_level)) {
             if (en) {
-                uint label_idx = check_and_insert_new_label(event_label);
-                uint64_t event_id = get_event_id(HostEventType::CUSTOM, 0, 0, 0, label_idx);
+                uint64_t event_id = get_event_id(HostEventType::CUSTOM, 0, 0, 0, get_label_index(event_label));
                 record_loader_event(event_id);
             }
         }
@@ -411,11 +451,8 @@ public:
     inline void record_loader_event(const string &event_label, const uint64_t &event_value) {
         if constexpr (uint(level) <= uint(backend_profiler_level)) {
             if (en) {
-                const std::lock_guard<std::mutex> lock(backend_profiler_mutex);
-                uint label_idx = check_and_insert_new_label(event_label);
-                uint64_t event_id = get_event_id(HostEventType::CUSTOM, 0, 0, 0, label_idx);
-                perf_buffer.push_back(event_id);
-                perf_buffer.push_back(event_value);
+                uint64_t event_id = get_event_id(HostEventType::CUSTOM, 0, 0, 0, get_label_index(event_label));
+                record_loader_event(event_id, event_value);
             }
         }
     }
@@ -439,6 +476,11 @@ public:
         uint64_t duration_ns = std::chrono::duration_cast<ns>(duration).count();
         return duration_ns;
     }
+    // Moves all events recorded so far by any thread into perf_buffer and frees the buffers of threads that exited.
+    // Caller must hold backend_profiler_mutex.
+    void merge_thread_event_buffers();
+    // Caller must hold backend_profiler_mutex
+    inline size_t get_num_thread_event_buffers() const { return thread_event_buffers.size(); }
     void dump_perf_buffer() {
         std::cout << "All perf events recorded for host runtime: " << std::endl;
         for (uint64_t event: perf_buffer) {
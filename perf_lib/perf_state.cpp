@@ -216,11 +216,11 @@ void PerfState::update_executed_instr(string program_name, int pc) {
     const std::lock_guard<std::recursive_mutex> lock(perf_state_mutex);
     log_assert(program_name_to_instructions.find(program_name) != program_name_to_instructions.end(),
                 "program name {} does not exist in device_perf_light", program_name);
-    const tt_instruction_info instr = program_name_to_instructions.at(program_name).at(pc);
-    const std::shared_ptr<tt_instruction_info> instr_ptr = std::make_shared<tt_instruction_info>(instr);
+    const tt_instruction_info &instr = program_name_to_instructions.at(program_name).at(pc);
     if (instr.opcode != INSTRUCTION_OPCODE::Execute) {
         return;
     }
+    const std::shared_ptr<tt_instruction_info> instr_ptr = std::make_shared<tt_instruction_info>(instr);
 
     const string &graph_name = instr.graph_name;
     if (!get_perf_desc().is_perf_enabled_for_graph(graph_name)) {
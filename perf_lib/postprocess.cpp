@@ -9,6 +9,8 @@
 #include "common/model/tt_core.hpp"
 #include "utils/scoped_timer.hpp"
 #include "netlist/netlist_utils.hpp"
+#include "device/cpuset_lib.hpp"
+#include "common/tt_parallel_for.h"
 
 extern perf::tt_backend_perf backend_profiler;
 
@@ -62,13 +64,26 @@ string decode_host_event_name(uint64_t event_id, int pid, uint thread_id, const
             event_description += "-program-id-" + to_string(event_properties.program_id);
             event_description += "-epoch-id-" + to_string(event_properties.epoch_id);
         }
+        if (event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_BYTES) ||
+            event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_COUNT) ||
+            event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH)) {
+            event_description += "-epoch-id-" + to_string(event_properties.epoch_id);
+        }
+        // Inputs of a batched push are converted concurrently, each gets its own event
+        if (event_properties.event_type == uint(HostEventType::PUSH_INPUTS_CONVERT) ||
+            event_properties.event_type == uint(HostEventType::PUSH_INPUTS_WRITE)) {
+            event_description += "-input-" + to_string(event_properties.epoch_id);
+        }
         if (event_properties.event_type == uint(HostEventType::DEVICE_START_CYCLE) || 
             event_properties.event_type == uint(HostEventType::DEVICE_END_CYCLE) || 
             event_properties.event_type == uint(HostEventType::DEVICE_START_CYCLE_ALIGNED) || 
             event_properties.event_type == uint(HostEventType::DEVICE_END_CYCLE_ALIGNED) || 
             event_properties.event_type == uint(HostEventType::DEVICE_RUNTIME) ||
             event_properties.event_type == uint(HostEventType::WAIT_FOR_EPOCH_COMPLETE) ||
-            event_properties.event_type == uint(HostEventType::DEVICE_EPOCH_FIRST_UNPACK_LAST_PACK)) {
+            event_properties.event_type == uint(HostEventType::DEVICE_EPOCH_FIRST_UNPACK_LAST_PACK) ||
+            event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_BYTES) ||
+            event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_COUNT) ||
+            event_properties.event_type == uint(HostEventType::EPOCH_BINARY_WRITE_BANDWIDTH)) {
                 event_description += "-device-" + to_string(event_properties.device_id);
         }
     }
@@ -267,23 +282,6 @@ void set_core_id(core_events &current_core, const string& core_id_str) {
     current_core.core_y = std::stoi(core_id_str.substr(delimiter_pos + 1, core_y_dim_num_chars));
 }
 
-// In the current yaml from versim/silicon, only the core-id's have both '-' and ':' character
-// TODO: Properly detect #-# sequence to verify this is a core-id, regex is too slow
-bool is_core_id(const string &current_line) {
-    bool dash_exists = current_line.find('-') != string::npos;
-    bool colon_exists = current_line.find(':') != string::npos;
-    return dash_exists and colon_exists;
-}
-
-bool is_thread_id(const string &current_line) {
-    for (const string &thread_name : thread_names) {
-        if (current_line.find(thread_name) != string::npos) {
-            return true;
-        }
-    }
-    return false;
-}
-
 pair<uint64_t, uint64_t> get_epoch_q_empty_largest_delay(const json &all_events) {
     uint64_t largest_delay = 0;
     uint64_t largest_delay_start = 0;
@@ -329,23 +327,6 @@ uint64_t find_stream_handler_loop_event_val(const vector<uint32_t> &current_thre
     return UINT64_MAX;
 }
 
-void process_new_thread(thread_events& current_thread, string current_line, bool &skip_to_next_thread) {
-
-    current_thread = thread_events();
-    current_line.pop_back();
-    int thread_id = -1;
-    for (int i = 0; i < thread_names.size(); i++) {
-        if (current_line.find(thread_names.at(i)) != string::npos) {
-            thread_id = i;
-            break;
-        }
-    }
-    log_assert(thread_id >= 0 and thread_id < thread_names.size(), "thread_id out of range");
-
-    current_thread.thread_type = ThreadType(thread_id);
-    skip_to_next_thread = false;
-}
-
 // Populates <current_thread> with events we extracted from device dram stored in <current_thread_events>
 void process_thread_main(vector<uint32_t> &current_thread_events, thread_events &current_thread, bool concurrent) {
     
@@ -619,9 +600,8 @@ void process_thread_end(
 
 }
 
-void process_new_core(core_events &current_core, string core_id_str, const unordered_map<string, core_descriptor> &cores_to_ops, ofstream &output_log, bool &skip_to_next_core, bool &skip_to_next_thread) {
+void process_new_core(core_events &current_core, const string &core_id_str, const unordered_map<string, core_descriptor> &cores_to_ops, ofstream &output_log, bool &skip_to_next_core, bool &skip_to_next_thread) {
     current_core = core_events();
-    core_id_str.pop_back(); // Last character is a ':'
     set_core_id(current_core, core_id_str);
 
     string op_name;
@@ -1194,6 +1174,125 @@ void populate_output_directory_paths(vector<InstructionInfo> &all_instructions,
     }
 }
 
+// Splits the perf buffers of the workers dumping into one dram bank between epochs and threads.
+// Core dumps are appended to epoch_dumps, which is indexed the same as the instructions in cores_to_instr.
+void extract_core_events_from_dram_bank(
+    const tt_xy_pair &dram_core_coord,
+    const vector<uint32_t> &dram_events,
+    const vector<tt_xy_pair> &workers,
+    const unordered_map<tt_xy_pair, vector<int>> &cores_to_instr,
+    const perf::PerfDesc &perf_desc,
+    const buda_SocDescriptor *soc_descriptor,
+    vector<device_epoch_dump> &epoch_dumps) {
+
+    log_debug(tt::LogPerfPostProcess, "Dram core id: {}-{}", dram_core_coord.x, dram_core_coord.y);
+    // As descriped in the comments above extract_core_events_from_device_dram_dump, number of events per worker is determined by
+    // Total perf buffer space per bank divided by number of workers that dump their perf-events in that bank. And each event is 4B.
+    uint32_t num_events_per_thread[l1_mem::address_map::PERF_NUM_THREADS];
+    for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
+        num_events_per_thread[thread_id] = get_num_events_per_threads_in_dram(soc_descriptor, dram_core_coord, perf_desc, thread_id);
+        log_debug(tt::LogPerfPostProcess, "num_events_per_thread: {}", num_events_per_thread[thread_id]);
+    }
+    log_debug(tt::LogPerfPostProcess, "Number of Workers for the current dram bank: {}", workers.size());
+
+    int event_idx = 0;
+    for (const tt_xy_pair &worker_core_coord : workers) {
+        if (cores_to_instr.find(worker_core_coord) == cores_to_instr.end()) {
+            log_debug(tt::LogPerfPostProcess, "Skipping worker core id: {}-{} since it is not active for any of the epochs", worker_core_coord.x, worker_core_coord.y);
+            for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
+                event_idx += num_events_per_thread[thread_id];
+                if (thread_id < l1_mem::address_map::PERF_NUM_THREADS - 1) {
+                    event_idx += get_num_events_to_skip_between_threads(soc_descriptor, dram_core_coord, perf_desc, thread_id);
+                } else {
+                    event_idx += get_num_events_to_skip_between_workers(soc_descriptor, dram_core_coord, perf_desc);
+                }
+            }
+            continue;
+        }
+        const vector<int> &dram_all_instructions = cores_to_instr.at(worker_core_coord);
+        const uint num_instructions = dram_all_instructions.size();
+        log_debug(tt::LogPerfPostProcess, "Extracting events for worker core id: {}-{} with {} active instructions", worker_core_coord.x, worker_core_coord.y, num_instructions);
+        // Index of this worker's core dump within each epoch it is active in
+        vector<int> core_dump_idx;
+        for (int instr_idx : dram_all_instructions) {
+            epoch_dumps.at(instr_idx).push_back({worker_core_coord, vector<vector<uint32_t>>(thread_names.size())});
+            core_dump_idx.push_back(epoch_dumps.at(instr_idx).size() - 1);
+        }
+
+        for (int thread_idx = 0; thread_idx < thread_names.size(); thread_idx++) {
+            const auto get_thread_dump = [&](uint instr_idx) -> vector<uint32_t>& {
+                return epoch_dumps.at(dram_all_instructions.at(instr_idx)).at(core_dump_idx.at(instr_idx)).thread_events.at(thread_idx);
+            };
+            uint instr_idx = 0;
+            int thread_event_idx = 0;
+            bool found_start_signal_epoch = false;
+
+            while (thread_event_idx < num_events_per_thread[thread_idx]) {
+                // The first event in each epoch must be equal to PerfValFirst.
+                // This flag gets set in the beginning of epoch, if PerfValFirst is observed.
+                // And it will get reset at the end of the epoch if PerfValLast is observed.
+                thread_event_idx++;
+                uint32_t event_num = dram_events.at(event_idx);
+                event_idx++;
+                if (!found_start_signal_epoch) {
+                    if (event_num != PerfValFirst) {
+                        // None of the remaining epochs were recorded by this thread
+                        for (uint i = instr_idx; i < num_instructions; i++) {
+                            get_thread_dump(i).push_back(0);
+                        }
+                        event_idx += num_events_per_thread[thread_idx] - thread_event_idx;
+                        break;
+                    } else {
+                        log_assert(instr_idx < num_instructions, "instr_idx out of range");
+                        get_thread_dump(instr_idx).push_back(event_num);
+                        found_start_signal_epoch = true;
+                    }
+                } else {
+                    log_assert(instr_idx < num_instructions, "instr_idx out of range");
+                    get_thread_dump(instr_idx).push_back(event_num);
+                    if (event_num == PerfValLast) {
+                        instr_idx++;
+                        if (instr_idx == num_instructions) {
+                            event_idx += num_events_per_thread[thread_idx] - thread_event_idx;
+                            break;
+                        } else if (thread_event_idx == num_events_per_thread[thread_idx]) {
+                            break;
+                        } else {
+                            uint smallest_aligned_event = find_beginning_of_next_l1_dump(thread_event_idx, num_events_per_thread[thread_idx], perf_desc, thread_idx);
+                            log_debug(tt::LogPerfPostProcess, "Skipping to beginning of next dump by number of events: {}", smallest_aligned_event - thread_event_idx);
+                            event_idx += smallest_aligned_event - thread_event_idx;
+                            thread_event_idx = smallest_aligned_event;
+                        }
+                        found_start_signal_epoch = false;
+                    }
+                }
+            }
+            for (int epoch_with_no_dump = instr_idx; epoch_with_no_dump < num_instructions; epoch_with_no_dump++) {
+                if (thread_event_idx >= num_events_per_thread[thread_idx]) {
+                    get_thread_dump(epoch_with_no_dump).push_back(PerfOutOfMem);
+                }
+            }
+            // Because ncrisc dumps 2KB chunks of perf buffers and also because of 32B alignment, there are paddings between threads and cores that ncrisc skips.
+            if (thread_idx < thread_names.size() - 1) {
+                uint num_padded_events = get_num_events_to_skip_between_threads(soc_descriptor, dram_core_coord, perf_desc, thread_idx);
+                log_debug(tt::LogPerfPostProcess, "Skipping {} number of padded events between worker threads", num_padded_events);
+                event_idx += num_padded_events;
+            } else {
+                uint num_padded_events = get_num_events_to_skip_between_workers(soc_descriptor, dram_core_coord, perf_desc);
+                log_debug(tt::LogPerfPostProcess, "Skipping {} number of padded events between worker cores", num_padded_events);
+                event_idx += num_padded_events;
+            }
+        }
+    }
+}
+
+// Dram banks and epochs are postprocessed on up to TT_BACKEND_PERF_POSTPROCESS_THREADS threads, all allowed cores by
+// default. Reports don't depend on the number of threads.
+int get_postprocess_num_threads(int num_items) {
+    const int max_threads = parse_env<int>("TT_BACKEND_PERF_POSTPROCESS_THREADS", tt::cpuset::get_allowed_num_threads());
+    return std::max(std::min(max_threads, num_items), 1);
+}
+
 // Parses the perf dump from dram and splits the events between worker cores, epochs and threads.
 // The events in dram are partitioned as follows:
 // The buffer size reserved for perf in each dram bank is DRAM_EACH_BANK_PERF_BUFFER_SIZE.
@@ -1204,155 +1303,52 @@ void populate_output_directory_paths(vector<InstructionInfo> &all_instructions,
 // Space allocated to each one of these threads is equal to perf-buffer-size-per-worker / 4.
 // Epochs are densely stored in this space. Each epoch starts with PerfValFirst and ends with PerfValLast.
 // If we run out of space in dram for each thread, the last PerfValLast might have not been recorded.
-unordered_map<string, std::shared_ptr<stringstream>> extract_core_events_from_device_dram_dump(const vector<InstructionInfo*> &instructions_on_device, const map<tt_cxy_pair, vector<uint32_t>> &all_dram_events, const perf::PerfDesc &perf_desc, const buda_SocDescriptor* soc_descriptor) {
+// Dram banks are independent, so they are split in parallel. Returns one dump for each of instructions_on_device.
+vector<device_epoch_dump> extract_core_events_from_device_dram_dump(const vector<InstructionInfo*> &instructions_on_device, const map<tt_cxy_pair, vector<uint32_t>> &all_dram_events, const perf::PerfDesc &perf_desc, const buda_SocDescriptor* soc_descriptor) {
     if (instructions_on_device.empty()) {
         return {};
     }
     int device_id = instructions_on_device.at(0)->device_id;
     log_debug(tt::LogPerfPostProcess, "Extracting worker core events from dram dump of device {}", device_id);
-    std::unordered_map<tt_xy_pair, vector<tt_xy_pair>> dram_core_to_workers = soc_descriptor->get_perf_dram_bank_to_workers();
-    unordered_map<string, std::shared_ptr<stringstream>> device_intermed_dumps;
-    // We dump one output string stream for each epoch.
-    vector<std::shared_ptr<stringstream>> output_streams;
-    log_debug(tt::LogPerfPostProcess, "Dumping the extracted perf events for each worker core to the following output keys:");
     for (const InstructionInfo* instr : instructions_on_device) {
         log_assert(instr->device_id == device_id, "Expected all instructions to be on the same device {}", device_id);
-        log_debug(tt::LogPerfPostProcess, "    {}", instr->intermed_dump_key);
-        if (device_intermed_dumps.find(instr->intermed_dump_key) == device_intermed_dumps.end()) {
-            device_intermed_dumps.emplace(instr->intermed_dump_key, std::make_shared<stringstream>());
-        }
-        output_streams.push_back(device_intermed_dumps.at(instr->intermed_dump_key));
     }
+    const std::unordered_map<tt_xy_pair, vector<tt_xy_pair>> dram_core_to_workers = soc_descriptor->get_perf_dram_bank_to_workers();
+    const unordered_map<tt_xy_pair, vector<int>> cores_to_instr = get_cores_to_instr_idx_from_model(instructions_on_device, soc_descriptor);
 
-    bool skip_to_next_dram_core = true;
-
-    unordered_map<tt_xy_pair, vector<int>> cores_to_instr = get_cores_to_instr_idx_from_model(instructions_on_device, soc_descriptor);
+    vector<const pair<const tt_cxy_pair, vector<uint32_t>>*> device_dram_events;
     for (const auto &dram_events: all_dram_events) {
-        if (dram_events.first.chip != device_id) {
-            continue;
+        if (dram_events.first.chip == device_id) {
+            device_dram_events.push_back(&dram_events);
         }
-        int event_idx = 0;
-
-        log_debug(tt::LogPerfPostProcess, "Dram core id: {}", dram_events.first.str());
-
-        core_events current_core;
-        set_core_id(current_core, to_string(dram_events.first.x) + "-" + to_string(dram_events.first.y));
-        tt_xy_pair dram_core_coord(current_core.core_x, current_core.core_y);
+    }
+    if (device_dram_events.empty()) {
+        return vector<device_epoch_dump>(instructions_on_device.size());
+    }
 
+    vector<vector<device_epoch_dump>> dram_bank_epoch_dumps(device_dram_events.size(), vector<device_epoch_dump>(instructions_on_device.size()));
+    const auto extract_dram_bank = [&](int dram_bank_idx) {
+        const tt_cxy_pair &dram_core = device_dram_events.at(dram_bank_idx)->first;
+        const tt_xy_pair dram_core_coord(dram_core.x, dram_core.y);
         // all dram cores dumped from dram must exist in soc_descriptor.perf_dram_bank_to_workers map.
         log_assert(dram_core_to_workers.find(dram_core_coord) != dram_core_to_workers.end(), "Could not find DRAM core");
+        extract_core_events_from_dram_bank(
+            dram_core_coord, device_dram_events.at(dram_bank_idx)->second, dram_core_to_workers.at(dram_core_coord), cores_to_instr, perf_desc, soc_descriptor, dram_bank_epoch_dumps.at(dram_bank_idx));
+    };
+    tt::parallel_for(0, int(device_dram_events.size()), extract_dram_bank, get_postprocess_num_threads(device_dram_events.size()));
 
-        int num_workers_current_dram_core = dram_core_to_workers.at(dram_core_coord).size();
-        // As descriped in the comments above for this function, number of events per worker is determined by
-        // Total perf buffer space per bank divided by number of workers that dump their perf-events in that bank. And each event is 4B.
-        uint32_t num_events_per_thread[l1_mem::address_map::PERF_NUM_THREADS];
-        for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
-            num_events_per_thread[thread_id] = get_num_events_per_threads_in_dram(soc_descriptor, dram_core_coord, perf_desc, thread_id);
-            log_debug(tt::LogPerfPostProcess, "num_events_per_thread: {}", num_events_per_thread[thread_id]);
-        }
-        log_debug(tt::LogPerfPostProcess, "Number of Workers for the current dram bank: {}", num_workers_current_dram_core);
-
-        for (int worker_idx = 0; worker_idx < num_workers_current_dram_core; worker_idx++) {
-            tt_xy_pair worker_core_coord = dram_core_to_workers[dram_core_coord][worker_idx];
-            vector<int> dram_all_instructions;
-            if (cores_to_instr.find(worker_core_coord) != cores_to_instr.end()) {
-                dram_all_instructions = cores_to_instr.at(worker_core_coord);
-            }
-            string worker_core_id = to_string(worker_core_coord.x) + "-" + to_string(worker_core_coord.y);
-            uint num_instructions = dram_all_instructions.size();
-            if (num_instructions > 0) {
-                log_debug(tt::LogPerfPostProcess, "Extracting events for worker core id: {} with active instructions:", worker_core_id);
-                for (int instr_idx: dram_all_instructions) {
-                    log_debug(tt::LogPerfPostProcess, "    {},", instr_idx);
-                    *(output_streams.at(instr_idx)) << worker_core_id << ":" << endl;
-                }
-            } else {
-                log_debug(tt::LogPerfPostProcess, "Skipping worker core id: {} since it is not active for any of the epochs", worker_core_id);
-                for (int thread_id = 0; thread_id < l1_mem::address_map::PERF_NUM_THREADS; thread_id++) {
-                    event_idx += num_events_per_thread[thread_id];
-                    if (thread_id < l1_mem::address_map::PERF_NUM_THREADS - 1) {
-                        uint num_padded_events_between_threads = get_num_events_to_skip_between_threads(soc_descriptor, dram_core_coord, perf_desc, thread_id);
-                        event_idx += num_padded_events_between_threads;
-                    } else {
-                        uint num_padded_events_between_cores = get_num_events_to_skip_between_workers(soc_descriptor, dram_core_coord, perf_desc);
-                        event_idx += num_padded_events_between_cores;
-                    }
-                }
-                continue;
-            }
-            for (int thread_idx = 0; thread_idx < postprocess::thread_names.size(); thread_idx++) {
-                for (int instr_idx: dram_all_instructions) {
-                    string thread_name = postprocess::thread_names[thread_idx] + ":";
-                    *(output_streams.at(instr_idx)) << "    " << thread_name << endl;
-                }
-                uint instr_idx = 0;
-                int thread_event_idx = 0;
-                bool found_start_signal_epoch = false;
-
-                while (thread_event_idx < num_events_per_thread[thread_idx]) {
-                    // The first event in each epoch must be equal to PerfValFirst.
-                    // This flag gets set in the beginning of epoch, if PerfValFirst is observed.
-                    // And it will get reset at the end of the epoch if PerfValLast is observed.
-                    thread_event_idx++;
-                    if (!found_start_signal_epoch) {
-                        uint32_t event_num = dram_events.second.at(event_idx);
-                        event_idx++;
-                        if (event_num != PerfValFirst) {
-                            for (uint i = instr_idx; i < num_instructions; i++) {
-                                *(output_streams.at(dram_all_instructions.at(i))) << "        " << "- 0" << endl;
-                            }
-                            event_idx += num_events_per_thread[thread_idx] - thread_event_idx;
-                            break;
-                        } else {
-                            log_assert(instr_idx < num_instructions, "instr_idx out of range");
-                            *(output_streams.at(dram_all_instructions.at(instr_idx))) << "        " << "- 0x" << std::hex << std::setw(8) << std::setfill('0') << event_num << endl;
-                            found_start_signal_epoch = true;
-                        }
-                    } else {
-                        uint event_num = dram_events.second.at(event_idx);
-                        event_idx++;
-                        log_assert(instr_idx < num_instructions, "instr_idx out of range");
-                        *(output_streams.at(dram_all_instructions.at(instr_idx))) << "        " << "- 0x" << std::hex << std::setw(8) << std::setfill('0') << event_num << endl;
-                        if (event_num == PerfValLast) {
-                            instr_idx++;
-                            if (instr_idx == num_instructions) {
-                                event_idx += num_events_per_thread[thread_idx] - thread_event_idx;
-                                break;
-                            } else if (thread_event_idx == num_events_per_thread[thread_idx]) {
-                                break;
-                            } else {
-                                uint smallest_aligned_event = find_beginning_of_next_l1_dump(thread_event_idx, num_events_per_thread[thread_idx], perf_desc, thread_idx);
-                                log_debug(tt::LogPerfPostProcess, "Skipping to beginning of next dump by number of lines: {}", smallest_aligned_event - thread_event_idx);
-                                event_idx += smallest_aligned_event - thread_event_idx;
-                                thread_event_idx = smallest_aligned_event;
-                            }
-                            found_start_signal_epoch = false;
-                        }
-                    }
-                }
-                for (int epoch_with_no_dump = instr_idx; epoch_with_no_dump < num_instructions; epoch_with_no_dump++) {
-                    if (thread_event_idx >= num_events_per_thread[thread_idx]) {
-                        *(output_streams.at(dram_all_instructions.at(epoch_with_no_dump))) << "        " << "- 0x" << std::hex << std::setw(8) << std::setfill('0') << PerfOutOfMem << endl;
-                    }
-                }
-                // Because ncrisc dumps 2KB chunks of perf buffers and also because of 32B alignment, there are paddings between threads and cores that ncrisc skips.
-                if (thread_idx < postprocess::thread_names.size() - 1) {
-                    uint num_padded_events = get_num_events_to_skip_between_threads(soc_descriptor, dram_core_coord, perf_desc, thread_idx);
-                    log_debug(tt::LogPerfPostProcess, "Skipping {} number of padded events between worker threads", num_padded_events);
-                    event_idx += num_padded_events;
-                } else {
-                    uint num_padded_events = get_num_events_to_skip_between_workers(soc_descriptor, dram_core_coord, perf_desc);
-                    log_debug(tt::LogPerfPostProcess, "Skipping {} number of padded events between worker cores", num_padded_events);
-                    event_idx += num_padded_events;
-                }
-            }
+    // Keep the cores of each epoch in dram bank order
+    vector<device_epoch_dump> epoch_dumps(instructions_on_device.size());
+    for (vector<device_epoch_dump> &dram_bank_dumps : dram_bank_epoch_dumps) {
+        for (int instr_idx = 0; instr_idx < instructions_on_device.size(); instr_idx++) {
+            device_epoch_dump &epoch_dump = epoch_dumps.at(instr_idx);
+            std::move(dram_bank_dumps.at(instr_idx).begin(), dram_bank_dumps.at(instr_idx).end(), std::back_inserter(epoch_dump));
         }
-        skip_to_next_dram_core = true;
     }
-    return device_intermed_dumps;
+    return epoch_dumps;
 }
 
-void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, InstructionInfo &instr, const PerfState &perf_state, bool versim) {
+void process_device_epoch_dump_and_create_reports(const device_epoch_dump &epoch_dump, InstructionInfo &instr, const PerfState &perf_state, bool versim) {
     ofstream output_log(instr.output_dir_path + "/output_log.txt");
     output_log << "Reading perf events from " << instr.intermed_dump_key << endl;
     output_log << "Dumping cores_to_ops_map into " << instr.output_dir_path + cores_to_ops_json_name << endl;
@@ -1361,111 +1357,61 @@ void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, Instruc
     const unordered_map<string, PostprocessModelDesc> &op_to_perf_model_desc = perf_state.get_all_perf_model_desc();
     const unordered_map<string, core_descriptor> &cores_to_ops = perf_state.get_core_to_desc_map(graph.my_graph_info.name);
 
-    string current_line;
     core_events current_core;
     thread_events current_thread;
     vector<core_events> all_core_events;
     vector<string> all_core_ids;
-    // If this flag is set, the parser will ignore lines until it finds a core-id.
-    bool skip_to_next_core = true;
-    // If this flag is set, the parser will ignore lines until it finds a thread-id.
-    bool skip_to_next_thread = false;
-    // If this flag is set, the parser expects PerfValFirst event.
-    bool is_first_event_in_thread = true;
     string core_id_str;
     vector<uint32_t> current_thread_events;
-    int event_idx_within_thread = 0;
-    int line_idx = 0;
-
-    // The parser below keeps reading all the lines in the device output.
-    // This parser can operate in three different modes, which changes based on skip_to_next_core and skip_to_next_thread flags.
-    // 1- skip_to_next_core = true, skip_to_next_thread = false
-    //      Parser will keep ignoring lines until it finds a core-id.
-    //      Then it initially sets up the new-core in process_new_core and sets skip_to_next_core = false, and skip_to_next_thread = true.
-    //          There is a special case where the op-name is not found in cores_to_ops (meaning no ops are assigned to this core), in this case we won't change the flags,
-    //          and the parser will ignore the entire dump for this core, and ignores lines to find the next core.
-    //
-    // 2- skip_to_next_core = false, skip_to_next_thread = true
-    //      In this mode, parser searches for a thread-id.
-    //      When it finds one, it sets up the new-thread in process_new_thread first.
-    //      Sets the is_first_event_in_thread flag to indicate the next event we read must be PerfValFirst.
-    //      Resets event_idx_within_thread which counts the number of events we have read in the current thread.
-    //
-    // 3- skip_to_next_core = false, skip_to_next_thread = false
-    //      In this mode, the parser will keep pushing events into current_thread_events until either
-    //          a) It sees the PerfValLast event. In this case it signals completion of thread.
-    //          b) It reads a new thread-id or core-id. In this situation it processes the remaining events in vector for previous thread/core and starts working on the new thread/core.
+    // process_new_core sets skip_to_next_core for cores with no op assigned to them in this graph
+    bool skip_to_next_core = false;
+    bool skip_to_next_thread = false;
+
+    // Each thread of each core is processed as follows:
+    //      The first event must be PerfValFirst. If not, the thread was not active in this epoch and it gets wrapped up
+    //      with no events, flagged as out of memory if the first event is PerfOutOfMem.
+    //      Otherwise, events are pushed into current_thread_events until either
+    //          a) PerfValLast is found. In this case the thread is complete.
+    //          b) PerfOutOfMem is found. The thread is wrapped up and flagged as out of memory.
+    //          c) The recorded events run out. The thread is wrapped up when the next thread or core starts.
     //
     // process_thread_end:
-    //      This function wraps up one thread and adjusts the skip_to_next_core, and skip_to_next_thread signals for parser to parse either next thread or next core (in case we
-    //      have processed all threads in the current core).
-    //      The wrapping up of the thread includes:
-    //      1- Inserting the current thread into the current core list of threads
-    //      2- Pushing the current core into the vector of all the cores if all threads have been processed.
-    while (std::getline(intermed_dump, current_line)) {
-        line_idx++;
-        // Only one of these flags must be set at any time.
-        log_assert(!(skip_to_next_core && skip_to_next_thread), "cannot set skip_to_next_core and skip_to_next_thread simultaneously");
-        // If skip_to_next_core flag is set, skip until finding a core-id.
-        if (skip_to_next_core && !is_core_id(current_line)) {
-            continue;
-        }
-        // If skip_to_next_thread flag is set, skip until finding a thread-id.
-        if (skip_to_next_thread && !is_thread_id(current_line)) {
+    //      Wraps up one thread by inserting it into the current core. Once the last thread of a core is wrapped up the
+    //      core is pushed into all_core_events.
+    const auto wrap_up_unterminated_thread = [&]() {
+        if (!current_thread_events.empty()) {
+            perf_warning(perf_desc, tt::LogPerfPostProcess, "Last signal in thread not found");
+            process_thread_end(
+                current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, false, false);
+        }
+    };
+    for (const device_core_dump &core_dump : epoch_dump) {
+        wrap_up_unterminated_thread();
+        core_id_str = to_string(core_dump.core.x) + "-" + to_string(core_dump.core.y);
+        process_new_core(current_core, core_id_str, cores_to_ops, output_log, skip_to_next_core, skip_to_next_thread);
+        if (skip_to_next_core) {
             continue;
         }
-
-        // If a new core is found try to find the op-name assigned to this core in cores_to_ops map.
-        // If op was found, turn skip_to_next_thread on and skip_to_next_core off to find the first thread in this core.
-        // If op was not found, do not change these flags, to skip all lines until finding the next core.
-        if (is_core_id(current_line)) {
-            // If parser sees a core-id when skip_to_next_core flag is not set, it means the previous thread did not have the end signal.
-            if (!current_thread_events.empty()) {
-                perf_warning(perf_desc, tt::LogPerfPostProcess, "Last signal in thread not found");
-                process_thread_end(
-                    current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, false, false);
-            }
-            process_new_core(current_core, current_line, cores_to_ops, output_log, skip_to_next_core, skip_to_next_thread);
-            core_id_str = current_line;
-            core_id_str.pop_back(); // The last character in current_line for core-id is a ':'.
-            continue;
-        }
-
-        // If a new thread is found, set the thread_id member of the current_thread obj and turn skip_to_next_thread off to start pushing events in current_thread_events.
-        // Set the is_first_event_in_thread flag to look for PerfValFirst.
-        if (is_thread_id(current_line)) {
-            // If parser sees a thread-id when skip_to_next_thread flag is not set, it means the previous thread did not have the end signal.
-            if (!current_thread_events.empty()) {
-                perf_warning(perf_desc, tt::LogPerfPostProcess, "Last signal in thread not found");
-                process_thread_end(
-                    current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, false, false);
-            }
-            process_new_thread(current_thread, current_line, skip_to_next_thread);
-            is_first_event_in_thread = true;
-            event_idx_within_thread = 0;
-            continue;
-        }
-
-        // The third mode of the parser. We keep pushing all events for the current thread in current_thread_events, to later process all of them.
-        if (!skip_to_next_thread && !skip_to_next_core) {
-            uint event_val = convert_string_line_to_hex(current_line);
-            event_idx_within_thread++;
-            // If is_first_event_in_thread is set the first event we see must be PerfValFirst. If not, skip this thread.
-            // Hardware will always record PerfValFirst as its first thread. If we don't find that, it means this thread was not active.
-            if (is_first_event_in_thread) {
-                if (event_val != PerfValFirst) {
-                    // If first event was not PerfValFirst skip this thread.
-                    process_thread_end(
-                        current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, true, event_val == PerfOutOfMem);
-                } else {
-                    // If first event was PerfValFirst, set is_first_event_in_thread to false to start pushing events in current_thread_events.
-                    is_first_event_in_thread = false;
+        for (int thread_idx = 0; thread_idx < thread_names.size(); thread_idx++) {
+            wrap_up_unterminated_thread();
+            current_thread = thread_events();
+            current_thread.thread_type = ThreadType(thread_idx);
+            const vector<uint32_t> &thread_dump = core_dump.thread_events.at(thread_idx);
+            for (int event_idx_within_thread = 1; event_idx_within_thread <= thread_dump.size(); event_idx_within_thread++) {
+                const uint32_t event_val = thread_dump.at(event_idx_within_thread - 1);
+                // Hardware will always record PerfValFirst as its first thread. If we don't find that, it means this thread was not active.
+                if (event_idx_within_thread == 1) {
+                    if (event_val != PerfValFirst) {
+                        process_thread_end(
+                            current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, true, event_val == PerfOutOfMem);
+                        break;
+                    }
+                    continue;
                 }
-            } else {
                 if (event_val == PerfOutOfMem) {
                     process_thread_end(
                         current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, true, true);
-                    continue;
+                    break;
                 }
                 // The first four events in the math thread should be skipped.
                 if (current_thread.thread_type == ThreadType::MATH and event_idx_within_thread <= 4) {
@@ -1473,12 +1419,11 @@ void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, Instruc
                 }
                 // The first two events in the unpacker/packer/brisc threads should be skipped.
                 // If event val is 0xffffffff, skip
-                if ((current_thread.thread_type == ThreadType::UNPACK or current_thread.thread_type == ThreadType::PACK or current_thread.thread_type == ThreadType::BRISC) 
+                if ((current_thread.thread_type == ThreadType::UNPACK or current_thread.thread_type == ThreadType::PACK or current_thread.thread_type == ThreadType::BRISC)
                     and (event_idx_within_thread <= 2 or event_val == 0xffffffff)) {
                     continue;
                 }
 
-                // If at any point after finding PerfValFirst, the parser sees a PerfValLast event value, it finishes the process for this thread.
                 // Hardware will always push a PerfValLast at the end of each thread.
                 // If not pushed, it means that thread has run out of memory.
                 // The reverse is not always valid, meaning if we do have PerfValLast it does not indicate the hardware has not run out of memory.
@@ -1486,18 +1431,13 @@ void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, Instruc
                 if (event_val == PerfValLast) {
                     process_thread_end(
                         current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, true, false);
-                } else {
-                    current_thread_events.push_back(event_val);
+                    break;
                 }
+                current_thread_events.push_back(event_val);
             }
         }
     }
-    // If there are no more lines for parser to read and the last signal has not been found process the remaining events in the vector.
-    if (!current_thread_events.empty()) {
-        perf_warning(perf_desc, tt::LogPerfPostProcess, "Last signal in thread not found");
-        process_thread_end(
-            current_thread, current_core, all_core_events, all_core_ids, current_thread_events, core_id_str, perf_desc, skip_to_next_core, skip_to_next_thread, false, false);
-    }
+    wrap_up_unterminated_thread();
     json dump_events_aligned = create_postprocess_report(all_core_events, all_core_ids, instr, perf_desc, perf_state.get_device_alignment_info(), graph, op_to_perf_model_desc, true, versim);
 
     pair<uint64_t, uint64_t> largest_delay_start_and_end = get_epoch_q_empty_largest_delay(dump_events_aligned);
@@ -1531,10 +1471,10 @@ void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, Instruc
     create_runtime_table(runtime_table, instr.output_dir_path);
 }
 
-// For each device, we will extract all core events its perf buffers in dram 
-// then, we will create divide the raw dram perf dumps into intermediate dumps
-// intermediate dumps will be created for each instruction, and contain information about events of each worker core for that instruction
-// finally, we will parse the intermediate dumps and create reports (perf_postprocess.json, runtime_table.json etc.) for each instruction
+// For each device, we will extract all core events its perf buffers in dram
+// then, we will divide the raw dram perf dumps into one epoch dump for each instruction
+// epoch dumps contain the events of each worker core and thread for that instruction
+// finally, we will process the epoch dumps and create reports (perf_postprocess.json, runtime_table.json etc.) for each instruction, in parallel
 void process_all_instructions_and_create_reports(
     vector<InstructionInfo> &all_instructions,
     const map<tt_cxy_pair, vector<uint32_t>> &all_dram_events,
@@ -1542,7 +1482,7 @@ void process_all_instructions_and_create_reports(
     const std::unordered_map<chip_id_t, buda_SocDescriptor>& sdesc_per_chip,
     bool versim
 ) {
-    log_debug(tt::LogPerfPostProcess, "Extracting intermediate yamls from dram dump.");
+    log_debug(tt::LogPerfPostProcess, "Extracting worker core events from dram dump.");
     log_info(tt::LogPerfPostProcess, "Processing all instructions...");
     for (const auto &[device_id, device_start_cycle] : perf_state.get_device_alignment_info().device_id_to_start_cycle) {
         vector<int> instruction_idxs;
@@ -1555,16 +1495,20 @@ void process_all_instructions_and_create_reports(
             instruction_idxs.push_back(instr_idx);
             device_instructions.push_back(&instr);
         }
+        if (device_instructions.empty()) {
+            continue;
+        }
         log_assert(sdesc_per_chip.find(device_id) != sdesc_per_chip.end(), "Could not find soc descriptor for device id {}", device_id);
-        std::unordered_map<string, std::shared_ptr<stringstream>> device_intermed_dumps = extract_core_events_from_device_dram_dump(device_instructions, all_dram_events, perf_state.get_perf_desc(), &sdesc_per_chip.at(device_id));
-        for (int device_instr_idx = 0; device_instr_idx < device_instructions.size(); device_instr_idx++) {
+        vector<device_epoch_dump> epoch_dumps = extract_core_events_from_device_dram_dump(device_instructions, all_dram_events, perf_state.get_perf_desc(), &sdesc_per_chip.at(device_id));
+        // Each instruction writes its reports into its own output directory
+        const auto create_reports = [&](int device_instr_idx) {
             InstructionInfo *instr = device_instructions.at(device_instr_idx);
-            log_assert(instr->intermed_dump_key  != "", "All intermediate yaml files must be dumped.");
-            log_assert(instr->output_dir_path    != "", "All output directory paths must have been set.");
-            log_assert(device_intermed_dumps.find(instr->intermed_dump_key) != device_intermed_dumps.end(), "Could not find intermed dump for instruction {}", instr->intermed_dump_key);
-            parse_intermed_dump_and_create_reports(*(device_intermed_dumps.at(instr->intermed_dump_key)), *instr, perf_state, versim);
+            log_assert(instr->output_dir_path != "", "All output directory paths must have been set.");
+            process_device_epoch_dump_and_create_reports(epoch_dumps.at(device_instr_idx), *instr, perf_state, versim);
+            epoch_dumps.at(device_instr_idx) = device_epoch_dump();
             log_info(tt::LogPerfPostProcess, "Finished perf-postprocess for program {}, graph {}, epoch {}/{}", instr->program_name, instr->graph_name, instruction_idxs.at(device_instr_idx), all_instructions.size() - 1);
-        }
+        };
+        tt::parallel_for(0, int(device_instructions.size()), create_reports, get_postprocess_num_threads(device_instructions.size()));
     }
 }
 
@@ -1743,11 +1687,13 @@ void process_host_profiler_entry(uint64_t event_id, uint64_t event_val, thread_e
     auto event_ref = current_thread.events.find(event_id);
     device_perf_event current_event = {.id = event_id, .first_val = event_val};
     current_event.description = decode_host_event_name(event_id, process_id, thread_id, all_labels);
+    const bool is_per_write_value = perf::host_per_write_value_events.find(HostEventProperties(event_id).event_type) != perf::host_per_write_value_events.end();
     if (event_ref == current_thread.events.end()) {
         
         current_thread.events.insert({event_id, {current_event}});
     } else {
-        if (event_ref->second.back().second_val == ULLONG_MAX) {
+        // Every epoch binary write records its own stats, other events recorded twice are folded into start/end pairs
+        if (!is_per_write_value and event_ref->second.back().second_val == ULLONG_MAX) {
             event_ref->second.back().second_val = event_val;
         } else {
             event_ref->second.push_back(current_event);
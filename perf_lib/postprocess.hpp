@@ -459,15 +459,22 @@ struct BriscEventProperties {
 };
 
 
+// Events of one worker core in one epoch, decoded straight from the device dram perf buffers.
+// thread_events is indexed by ThreadType and holds the words each thread recorded for the epoch, starting with
+// PerfValFirst. Threads without a dump for the epoch hold a single word which is not PerfValFirst.
+struct device_core_dump {
+    tt_xy_pair core;
+    vector<vector<uint32_t>> thread_events;
+};
+// Core dumps of all worker cores active in one epoch, in the order they are stored in dram
+using device_epoch_dump = vector<device_core_dump>;
+
 ////////////////////////////////////////////////////////
 //////////// Perf-Postprocess apis
 ////////////////////////////////////////////////////////
 void set_core_id(core_events &current_core, const string& core_id_str);
-bool is_core_id(const string &current_line);
-bool is_thread_id(const string &current_line);
 pair<uint64_t, uint64_t> get_epoch_q_empty_largest_delay(const json& all_events);
 uint64_t find_stream_handler_loop_event_val(const vector<uint32_t> &current_thread_events);
-void process_new_thread(thread_events& current_thread, string current_line, bool &skip_to_next_thread);
 void process_thread_main(vector<uint32_t> &current_thread_events, thread_events &current_thread, bool concurrent);
 void process_thread_end(
     thread_events &current_thread,
@@ -481,7 +488,7 @@ void process_thread_end(
     bool &skip_to_next_thread,
     bool modify_skip_flags,
     bool out_of_memory);
-void process_new_core(core_events &current_core, string core_id_str, const unordered_map<string, core_descriptor> &cores_to_ops, ofstream &output_log, bool &skip_to_next_core, bool &skip_to_next_thread);
+void process_new_core(core_events &current_core, const string &core_id_str, const unordered_map<string, core_descriptor> &cores_to_ops, ofstream &output_log, bool &skip_to_next_core, bool &skip_to_next_thread);
 void check_end_time_recorded(core_events &current_core, const perf::PerfDesc &perf_desc);
 void check_end_time_recorded_host(thread_events &current_thread);
 void combine_ncrisc_events(thread_events &thread_events);
@@ -501,14 +508,15 @@ void set_unpack_pack_num_tiles(core_events& current_core);
 
 // Device postprocess
 vector<InstructionInfo> populate_all_instructions(PerfState &perf_state, const string& perf_out_dir, std::shared_ptr<tt_device> device);
-unordered_map<string, std::shared_ptr<stringstream>> extract_core_events_from_device_dram_dump(
-    const vector<const InstructionInfo*> &instructions_on_device, 
+int get_postprocess_num_threads(int num_items);
+vector<device_epoch_dump> extract_core_events_from_device_dram_dump(
+    const vector<InstructionInfo*> &instructions_on_device,
     const map<tt_cxy_pair, vector<uint32_t>> &all_dram_events, 
     const perf::PerfDesc &perf_desc, 
     const buda_SocDescriptor* soc_descriptor
 );
 void populate_output_directory_paths(vector<InstructionInfo> &all_instructions, const perf::PerfDesc &perf_desc, const string& output_dir);
-void parse_intermed_dump_and_create_reports(stringstream &intermed_dump, InstructionInfo &instr, const PerfState &perf_state, bool versim);
+void process_device_epoch_dump_and_create_reports(const device_epoch_dump &epoch_dump, InstructionInfo &instr, const PerfState &perf_state, bool versim);
 void process_all_instructions_and_create_reports(
     vector<InstructionInfo> &all_instructions,
     const map<tt_cxy_pair, vector<uint32_t>> &all_dram_events,
@@ -8,6 +8,7 @@ RUNTIME_INCLUDES = \
 	-I$(BUDA_HOME)/runtime \
 	-I$(BUDA_HOME)/src/pipegen2/lib/inc \
 	-I$(BUDA_HOME)/src/blobgen2/lib/inc \
+	-I$(BUDA_HOME)/src/net2pipe/inc \
 	-I$(BUDA_HOME)/dbd/server/lib/inc
 
 RUNTIME_LDFLAGS = -L$(BUDA_HOME) -lcommon -lhwloc -lnetlist -lloader
@@ -16,6 +17,7 @@ RUNTIME_CFLAGS = $(CFLAGS) -Werror -Wno-int-to-pointer-cast
 RUNTIME_SRCS = \
 	runtime/tt_log_server.cpp \
 	runtime/runtime_io.cpp \
+	runtime/tilized_tensor_cache.cpp \
 	runtime/runtime_eager_io.cpp \
 	runtime/runtime_utils.cpp \
 	runtime/runtime_workload.cpp \
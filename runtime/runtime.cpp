@@ -7,6 +7,7 @@
 #include "common/cache_lib.hpp"
 #include "common/param_lib.hpp"
 #include "common/tt_parallel_for.h"
+#include "runtime/tilized_tensor_cache.hpp"
 #include "compile_trisc/compile_trisc.hpp"
 #include "netlist_utils.hpp"
 #include "runtime_utils.hpp"
@@ -21,6 +22,7 @@
 #include "common/model/tt_core.hpp"
 #include "perf_lib/perf_base.hpp"
 #include "perf_lib/memory_profiler.hpp"
+#include "io/pipe_graph_description.h"
 
 namespace fs = std::experimental::filesystem; // see comment above
 
@@ -360,25 +362,16 @@ tt::DEVICE_STATUS_CODE tt_runtime::initialize(tt_compile_result *result) {
             log_info(tt::LogRuntime, "Compiling Firmware for TT device");
         }
 
-        // Firmware compilation data (thread, compile_result).
-        std::thread fw_compilation_thread;
+        // Firmware and overlay compile concurrently on the task scheduler, each with nested per-epoch loops
         tt_fw_compile_result fw_compile_result;
-
-        fw_compilation_thread = std::thread([&] {
-            compile_firmware(fw_compile_result);
-        });
-        
-        // Overlay compilation data (thread, compile_result).
-        std::thread overlay_compilation_thread;
         tt_overlay_compile_result overlay_compile_result;
-
-        overlay_compilation_thread = std::thread([&] {
-            compile_overlay(overlay_compile_result);
-        });
-
-        fw_compilation_thread.join();
-
-        overlay_compilation_thread.join();
+        tt::parallel_for(0, 2, [&](int compile_step) {
+            if (compile_step == 0) {
+                compile_firmware(fw_compile_result);
+            } else {
+                compile_overlay(overlay_compile_result);
+            }
+        }, 2);
 
         merge_compile_results(result, fw_compile_result, overlay_compile_result);
 
@@ -679,6 +672,11 @@ tt_overlay_compile_result tt_runtime::create_graph_overlay_binaries() {
     std::unordered_map<chip_id_t, buda_soc_description> sdesc_per_chip = load_soc_descriptors_per_chip();
 
     std::vector<tt_compile_result_per_epoch> compile_results_per_epoch(num_temporal_epochs);
+    // Entries are created up front, so each epoch fills its own without locking
+    this->overlay_blobs.clear();
+    for (int temporal_epoch = 0; temporal_epoch < num_temporal_epochs; temporal_epoch++) {
+        this->overlay_blobs[compiled_epochs + temporal_epoch];
+    }
     tt::parallel_for(0, num_temporal_epochs, [=, &sdesc_per_chip, &compile_results_per_epoch](int temporal_epoch) {
         tt_compile_result_per_epoch &compile_result_for_current_epoch = compile_results_per_epoch[temporal_epoch];
         this->create_temporal_epoch_overlay_binaries(temporal_epoch, sdesc_per_chip, compile_result_for_current_epoch);
@@ -715,6 +713,7 @@ void tt_runtime::update_graph_overlay_binaries() {
     tt::parallel_for(0, num_temporal_epochs, [=, &sdesc_per_chip](int temporal_epoch) {
         this->update_temporal_epoch_overlay_binaries(temporal_epoch, sdesc_per_chip);
     }, num_threads);
+    this->overlay_blobs.clear();
 }
 
 std::unordered_map<chip_id_t, buda_soc_description> tt_runtime::load_soc_descriptors_per_chip(bool runtime_descriptor) const
@@ -752,8 +751,19 @@ void tt_runtime::create_temporal_epoch_overlay_binaries(
                          tt::io::info.output_dir + "/device_descs_for_pipegen.yaml" :
                          soc_descriptor_path;
 
+    // The map is not modified while epochs are compiled in parallel and each epoch only touches its own graph, so
+    // no lock is needed
+    const auto pipegen_graph = this->pipegen_graphs.find(global_epoch_id);
+    pipegen2::PipeGraphDescription *pipe_graph_description =
+        pipegen_graph != this->pipegen_graphs.end() ? &pipegen_graph->second : nullptr;
+
     run_pipegen_and_blobgen(config.output_dir, *(graph_names.begin()), global_epoch_id, chip_ids, config.perf_desc,
-                            file_to_use, sdesc_per_chip, compile_result, memory_profiler.get(), this->global_epoch_device_to_graph);
+                            file_to_use, sdesc_per_chip, compile_result, memory_profiler.get(), this->global_epoch_device_to_graph,
+                            this->overlay_blobs.at(global_epoch_id), pipe_graph_description);
+    // Release the graph now rather than once all epochs are compiled
+    if (pipe_graph_description) {
+        pipegen2::PipeGraphDescription().swap(*pipe_graph_description);
+    }
 }
 
 void tt_runtime::update_temporal_epoch_overlay_binaries(int temporal_epoch, const std::unordered_map<chip_id_t, buda_soc_description>& sdesc_per_chip) {
@@ -761,8 +771,10 @@ void tt_runtime::update_temporal_epoch_overlay_binaries(int temporal_epoch, cons
         tt_epoch_program_info &epoch_info = loader->get_epoch_program_info(graph_name);
         int chip_id = this->workload.get_graph_chip(graph_name);
         epoch_info.epoch_id = graph_to_epoch_id.at(graph_name);
+        // Blobs compiled by this process skip the round trip through the build directory
+        const auto compiled_blobs = overlay_blobs.find(epoch_info.epoch_id);
         epoch_info.binary->update_overlay_binary(config.output_dir, graph_name, epoch_info.epoch_id, chip_id, &sdesc_per_chip.at(chip_id),
-                                                 cluster.get());
+                                                 cluster.get(), compiled_blobs != overlay_blobs.end() ? &compiled_blobs->second : nullptr);
     }
 }
 
@@ -1053,15 +1065,18 @@ void tt_runtime::load_parameter_and_constant_queues() {
         auto q_desc = get_queue_descriptor(io);
         tt_PytorchTensorDesc pytorch_tensor_desc;
         tt_TilizedTensorDesc tilized_tensor_desc;
-        bool tilized = tensor_meta_to_tensor_desc(config.tti->get_tensor_meta(io), data, pytorch_tensor_desc, tilized_tensor_desc, q_desc.bufq_target_format);
+        bool tilized = tensor_meta_to_tensor_desc(*config.tti, io, data, pytorch_tensor_desc, tilized_tensor_desc, q_desc.bufq_target_format);
         tt::io::translate_addresses(q_desc);
         if(tilized) {
             tt::io::push_input_to_device(q_desc, tilized_tensor_desc, -1, 0);
         }
         else {
-            tt::io::push_input_to_device(q_desc, pytorch_tensor_desc, true, -1, 0);
+            tt::io::push_parameter_to_device(q_desc, pytorch_tensor_desc, -1, 0);
         }
     }
+    if (tt::io::tt_tilized_tensor_cache::get() != nullptr) {
+        tt::io::tt_tilized_tensor_cache::get()->report_stats();
+    }
 }
 
 void tt_runtime::drain_perf_dram_buffers(bool last_drain) {
@@ -1429,8 +1444,17 @@ tt::DEVICE_STATUS_CODE tt_runtime::run_program(const string &program_name, const
 
         // Main program execution loop
         program.set_params(parameters);
+        // Loops that only compute variables not bound to queue header fields need no host action per iteration
+        tt_runtime_queue_ptrs_wrap &qptrs_wrap = workload.get_qptrs_wrap(program_name);
+        program.set_loop_batching([&qptrs_wrap](const string &variable) { return !qptrs_wrap.get_var_field_types(variable).empty(); });
+        if (loader && loader->enable_belady_bin_cache) {
+            loader->set_epoch_binary_cache_trace(program.get_execute_trace(
+                parse_env("TT_BACKEND_EPOCH_BIN_CACHE_TRACE_LIMIT", 1 << 20),
+                parse_env("TT_BACKEND_EPOCH_BIN_CACHE_TRACE_MAX_INSTRUCTIONS", 1 << 24)));
+        }
+        const tt_runtime_program_handles &handles = get_program_handles(program);
         while (!program.done()) {
-            run_instruction(program);
+            run_instruction(program, handles);
         }
         program_queue.push_back(program_name);
 
@@ -1527,35 +1551,57 @@ tt::DEVICE_STATUS_CODE tt_runtime::finish() {
     }
 }
 
-void tt_runtime::run_instruction(netlist_program &program) {
+const tt_runtime_program_handles &tt_runtime::get_program_handles(const netlist_program &program) {
+    const auto handles_it = program_handles.find(program.get_name());
+    if (handles_it != program_handles.end()) {
+        return handles_it->second;
+    }
+
+    // Graphs and queues the netlist lacks are reported when an execute instruction first refers to them
+    tt_runtime_program_handles &handles = program_handles[program.get_name()];
+    for (const string &graph_name : program.get_graph_handle_names()) {
+        tt_runtime_graph_handle &graph = handles.graphs.emplace_back();
+        graph.name = graph_name;
+        const auto graph_it = workload.graphs.find(graph_name);
+        graph.graph_info = graph_it != workload.graphs.end() ? &graph_it->second.my_graph_info : nullptr;
+        const auto epoch_it = loader->graph_to_epoch_map.find(graph_name);
+        graph.epoch_info = epoch_it != loader->graph_to_epoch_map.end() ? &epoch_it->second : nullptr;
+        graph.has_queue_decouplings = loader->graph_name_to_queue_decouplings.find(graph_name) != loader->graph_name_to_queue_decouplings.end();
+    }
+    for (const string &queue_name : program.get_queue_handle_names()) {
+        const auto queue_it = workload.queues.find(queue_name);
+        handles.queues.push_back(queue_it != workload.queues.end() ? &queue_it->second.my_queue_info : nullptr);
+    }
+    return handles;
+}
+
+void tt_runtime::run_instruction(netlist_program &program, const tt_runtime_program_handles &handles) {
 
     log_debug(tt::LogRuntime, "Starting run_instruction() with PC: {} OpCode: {}", program.get_current_pc(), program.get_current_instruction().opcode);
 
     // Run instruction with an execution callback which gets called whenever an execute command happens
     program.run_instruction_with_callbacks(
         [this](netlist_program &program) { this->pre_instrn_instruction_callback(program); },
-        [this](netlist_program &program) { this->execute_instruction_callback(program); },
+        [this, &handles](netlist_program &program) { this->execute_instruction_callback(program, handles); },
         [this](netlist_program &program) { this->post_instrn_instruction_callback(program); });
 
 };
 
 void tt_runtime::pre_instrn_instruction_callback(netlist_program &program) {
-    std::string prog_name = program.get_name();
     if (cluster && config.do_run() && config.perf_desc.enabled()) {
         cluster->perf_state.update_executed_instr(program.get_name(), program.get_current_pc());
     }
 }
 
-void tt_runtime::execute_instruction_callback(netlist_program &program) {
-    std::string prog_name = program.get_name();
-    tt_instruction_info instrn = program.get_current_instruction();
-    workload.bind_queue_field_vars(instrn.queue_settings, prog_name);
-    this->run_execute_instrn(program, instrn);
+void tt_runtime::execute_instruction_callback(netlist_program &program, const tt_runtime_program_handles &handles) {
+    const tt_instruction_info &instrn = program.get_current_instruction();
+    workload.bind_queue_field_vars(instrn.queue_settings, program.get_name());
+    this->run_execute_instrn(program, instrn, handles);
 }
 
 void tt_runtime::post_instrn_instruction_callback(netlist_program &program) {
     std::string prog_name = program.get_name();
-    tt_instruction_info instrn = program.get_current_instruction();
+    const tt_instruction_info &instrn = program.get_current_instruction();
 
     if (instrn.opcode == INSTRUCTION_OPCODE::Execute) {
         std::map<string, std::vector<tt_queue_setting_info>> pending;
@@ -1754,16 +1800,16 @@ void tt_runtime::post_instrn_instruction_callback(netlist_program &program) {
 }
 
 
-void tt_runtime::sync_on_execute_dependencies(netlist_program &program, tt_instruction_info &instrn) {
+void tt_runtime::sync_on_execute_dependencies(netlist_program &program, const tt_instruction_info &instrn) {
     // atomicity guarantee of a temporal epoch requires us to only sync on the device we're about to exeucte on
     // ie. epochs within the same temporal epoch must launch together, else we may deadlock due to a launch and dataflow dependency loop
     this->wait_for_idle({workload.get_graph_chip(instrn.graph_name)}, "sync-on-execute");
 }
 
-void tt_runtime::run_execute_instrn(netlist_program &program, tt_instruction_info &instrn) {
+void tt_runtime::run_execute_instrn(netlist_program &program, const tt_instruction_info &instrn, const tt_runtime_program_handles &handles) {
     log_assert(instrn.opcode == INSTRUCTION_OPCODE::Execute, "Expected instruction op code Execute");
-    std::string graph_name  = instrn.graph_name;
-    std::string prog_name   = program.get_name();
+    const tt_runtime_graph_handle &graph = handles.graphs.at(program.get_current_graph_handle());
+    const std::string &graph_name = graph.name;
     tt_queue_header_mask update_mask = {tt_queue_header_mask::GLOBAL_RD_PTR_MASK | tt_queue_header_mask::LOCAL_SETTINGS_MASK};
 
     // Skip dispatch if inside loop on device
@@ -1774,12 +1820,13 @@ void tt_runtime::run_execute_instrn(netlist_program &program, tt_instruction_inf
 
     perf::ScopedEventProfiler profile(perf::HostEventType::RUN_EXECUTE_INSTRUCTION);
 
-    log_assert(workload.graphs.find(graph_name) != workload.graphs.end(), "Could not find graph to run.");
+    log_assert(graph.graph_info != nullptr, "Could not find graph to run.");
+    tt_epoch_program_info &epoch_info = graph.epoch_info ? *graph.epoch_info : loader->get_epoch_program_info(graph_name);
 
-    int input_count     = workload.graphs[graph_name].my_graph_info.input_count;
-    int device_id       = workload.graphs.at(graph_name).my_graph_info.target_device;
-    int epoch_id        = loader->graph_to_epoch_map[graph_name].epoch_id;
-    auto queue_settings = workload.collect_temporal_epoch_instance_queue_settings(program, device_id);
+    int input_count     = graph.graph_info->input_count;
+    int device_id       = graph.graph_info->target_device;
+    int epoch_id        = epoch_info.epoch_id;
+    auto queue_settings = workload.collect_temporal_epoch_instance_queue_settings(program, device_id, handles.queues);
 
     log_debug(tt::LogRuntime, "\tRunning graph '{}', epoch_id = {}, input_count = {}, pc = {}, device_id = {}, queue_settings.size() = {}",
         graph_name, epoch_id, input_count, program.get_current_pc(), device_id, queue_settings.size());
@@ -1795,7 +1842,7 @@ void tt_runtime::run_execute_instrn(netlist_program &program, tt_instruction_inf
     loader->update_io_queue_settings(workload.queues, workload.get_dual_view_rams_map(), queue_settings, program.get_variables(), update_mask);
 
     loader->mark_io_queues_in_use(workload.queues, queue_settings);
-    if (loader->graph_name_to_queue_decouplings.find(graph_name) != loader->graph_name_to_queue_decouplings.end()) {
+    if (graph.has_queue_decouplings) {
         update_queue_header_dram_decouplings(graph_name, false);
     }
 
@@ -1813,9 +1860,9 @@ void tt_runtime::run_execute_instrn(netlist_program &program, tt_instruction_inf
     //     check_for_dual_view_ram_rd_wr_overlap_in_graph(graph_name);
     // }
 
-    loader->send_epoch_program(graph_name, false);
+    loader->send_epoch_program(epoch_info, false);
 
-    if (loader->graph_name_to_queue_decouplings.find(graph_name) != loader->graph_name_to_queue_decouplings.end()) {
+    if (graph.has_queue_decouplings) {
         update_queue_header_dram_decouplings(graph_name, true);
     }
     if (config.perf_desc.overlay_decouplings.size() > 0) {
@@ -2183,7 +2230,7 @@ void tt_runtime::export_runtime_data_to_yaml() {
 
 // To avoid crashing with segfault, check and see if requested silicon device resources are installed.
 void tt_runtime::ensure_devices_present(const TargetDevice &target_type) {
-    log_assert(target_type == TargetDevice::Versim or target_type == TargetDevice::Silicon or target_type == TargetDevice::Emulation, "Expected Versim, Emulation or Silicon Backend");
+    log_assert(target_type == TargetDevice::Versim or target_type == TargetDevice::Silicon or target_type == TargetDevice::Emulation or target_type == TargetDevice::Mock, "Expected Versim, Emulation, Mock or Silicon Backend");
 
     std::vector<tt::ARCH> available_devices       = tt_cluster::detect_available_devices(target_type);
     tt_runtime_workload &workload               = *get_workload();
@@ -2407,14 +2454,22 @@ void tt_runtime::compile_overlay(tt_overlay_compile_result& overlay_compile_resu
             std::string n2p_soc_desc_for_harvested_wh = config.output_dir + "/device_descs_for_net2pipe.yaml";
             std::string n2p_soc_desc_for_unharvested_wh_or_gs = config.output_dir + "/device_desc.yaml";
             string sdesc_to_use = (arch_name == tt::ARCH::GRAYSKULL or !fs::exists(n2p_soc_desc_for_harvested_wh)) ? n2p_soc_desc_for_unharvested_wh_or_gs : n2p_soc_desc_for_harvested_wh;
-            run_net2pipe(netlist_path, config.output_dir, compiled_epochs, sdesc_to_use, cluster_descriptor_path, overlay_compile_result);
-            
+            // Net2pipe runs in process on the already parsed workload netlist and hands pipegen graphs over in memory.
+            // TT_BACKEND_NET2PIPE_SUBPROCESS falls back to the standalone binary communicating through pipegen.yaml files.
+            this->pipegen_graphs.clear();
+            if (parse_env("TT_BACKEND_NET2PIPE_SUBPROCESS", false)) {
+                run_net2pipe(netlist_path, config.output_dir, compiled_epochs, sdesc_to_use, cluster_descriptor_path, overlay_compile_result);
+            } else {
+                run_net2pipe(workload.parser, config.output_dir, compiled_epochs, sdesc_to_use, cluster_descriptor_path, this->pipegen_graphs, overlay_compile_result);
+            }
+
             if (!overlay_compile_result.success) {
                 // net2pipe compilation failed, we don't want to proceed further
                 return;
             }
 
             overlay_compile_result = create_graph_overlay_binaries();
+            this->pipegen_graphs.clear();
             patch_overlay_compile_result_with_op_name(overlay_compile_result);
         } 
         assign_global_epoch_ids(true);
@@ -21,6 +21,20 @@ namespace perf {
     class MemoryProfiler;
 }
 
+// Graph run by a netlist program, resolved from the graph handle assigned when the program was compiled
+struct tt_runtime_graph_handle {
+    std::string name = "";
+    const tt_graph_info *graph_info = nullptr;  // Null if the workload has no such graph
+    tt_epoch_program_info *epoch_info = nullptr;  // Null if no epoch program was created for the graph
+    bool has_queue_decouplings = false;
+};
+
+// Graphs and queues of a netlist program, indexed by the handles of its execute instructions
+struct tt_runtime_program_handles {
+    std::vector<tt_runtime_graph_handle> graphs = {};
+    std::vector<const tt_queue_info *> queues = {};  // Null if the workload has no such queue
+};
+
 /**
  * Buda runtime
  *
@@ -71,8 +85,14 @@ class tt_runtime : public tt_backend
     std::unordered_map<chip_id_t, uint32_t> rows_to_harvest = {};
     std::unordered_map<string, uint32_t> graph_to_epoch_id = {};
     std::unordered_map<string, tt::tt_dram_io_desc> queue_descriptor_cache = {};
+    // maps program name to its graph and queue handles, resolved on the first run of the program
+    std::unordered_map<string, tt_runtime_program_handles> program_handles = {};
     // maps {global_epoch_id, device_id} to graph_name
     std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>> global_epoch_device_to_graph;
+    // maps global_epoch_id to the pipegen graph handed over by in-process net2pipe, released once overlays are built
+    std::unordered_map<int, pipegen2::PipeGraphDescription> pipegen_graphs;
+    // maps global_epoch_id to the overlay blob images built by this process, handed to the epoch binaries once they exist
+    std::unordered_map<int, tt::tt_overlay_blob_images> overlay_blobs;
     std::set<chip_id_t> workload_target_device_ids;
     tt_compile_result compile_result;
 
@@ -109,12 +129,13 @@ class tt_runtime : public tt_backend
     void check_graphs_fit_on_device();
     void check_netlist_constraints();
     //! Run instruction level methods
-    void run_instruction(netlist_program &program);
-    void run_execute_instrn(netlist_program &program, tt_instruction_info &instrn);
+    const tt_runtime_program_handles &get_program_handles(const netlist_program &program);
+    void run_instruction(netlist_program &program, const tt_runtime_program_handles &handles);
+    void run_execute_instrn(netlist_program &program, const tt_instruction_info &instrn, const tt_runtime_program_handles &handles);
     void update_queue_header_dram_decouplings(string graph_name, bool reset);
 
     //! Run instruction level callbacks
-    void execute_instruction_callback(netlist_program &program);
+    void execute_instruction_callback(netlist_program &program, const tt_runtime_program_handles &handles);
     void pre_instrn_instruction_callback(netlist_program &program);
     void post_instrn_instruction_callback(netlist_program &program);
 
@@ -199,5 +220,5 @@ class tt_runtime : public tt_backend
     void get_noc_translated_soc_desc();
     void query_all_device_aiclks(std::string loc);
 
-    void sync_on_execute_dependencies(netlist_program &program, tt_instruction_info &instrn);
+    void sync_on_execute_dependencies(netlist_program &program, const tt_instruction_info &instrn);
 };
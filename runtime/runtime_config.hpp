@@ -73,7 +73,7 @@ inline tt_runtime_config get_runtime_config(
 };
 
 inline tt_runtime_config get_runtime_config(const tt_backend_config &base_config, const string &netlist_path) {
-    log_assert(base_config.type == tt::DEVICE::Silicon or base_config.type == tt::DEVICE::Versim  or base_config.type == tt::DEVICE::Emulation, "Expected device type Silicon, Versim or Emulation.");
+    log_assert(base_config.type == tt::DEVICE::Silicon or base_config.type == tt::DEVICE::Versim  or base_config.type == tt::DEVICE::Emulation or base_config.type == tt::DEVICE::Mock, "Expected device type Silicon, Versim, Emulation or Mock.");
     tt_runtime_config runtime_config;
     // Upcast to base config and use copy constructor
     tt_backend_config &copy_to_config = runtime_config;
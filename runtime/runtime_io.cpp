@@ -7,15 +7,16 @@
 #include "common/tt_queue_ptr.hpp"
 #include "common/error_types.hpp"
 #include "device/cpuset_lib.hpp"
+#include "common/tt_parallel_for.h"
 #include "common/data_binary_lib.hpp"
+#include "common/wait_lib.hpp"
+#include "runtime/tilized_tensor_cache.hpp"
 #include "mem_lib.hpp"
 
 extern perf::tt_backend_perf backend_profiler;
 namespace tt::io {
 bool debug = false;
 
-constexpr int TIMEOUT_CHECK_FREQ = 1000;
-
 struct DataFormatPairHash {
     size_t operator()(const std::pair<DataFormat, DataFormat>& p) const {
         uint32_t combined = static_cast<uint32_t>(p.first)<<16 | static_cast<uint32_t>(p.second);
@@ -97,6 +98,8 @@ void free_object_cache() {
     // it is safe to destroy an empty cache, hence a super set is used
     tt_object_cache<DeviceTilizer<Tilizer::FastTilizeDevicePush>>::destroy();
     tt_object_cache<DeviceTilizer<Tilizer::FastTilizeMMIOPush>>::destroy();
+    // Staging buffers of the offline tilizers, only after the tilizers pointing into them are gone
+    tt_object_cache<std::vector<uint32_t>>::destroy();
     tt_object_cache<tt_cluster>::destroy();
     tt_object_cache<tt_runtime_workload>::destroy();
 }
@@ -292,20 +295,12 @@ void wait_until_dram_output_queue_populated(std::chrono::high_resolution_clock::
     log_trace(tt::LogIO, "DRAM Queue not fully populated, waiting up to timeout_in_seconds: {}.", timeout_in_seconds);
 
     log_assert(timeout_in_seconds > 0, "Only expected to be called with timeout_in_seconds>0");
-    bool queue_is_fully_populated   = false;
-    int loop_idx                    = 0;
-    auto timeout_in_ms              = 1000 * timeout_in_seconds;
-
-    while (!queue_is_fully_populated){
-        if (loop_idx++ == TIMEOUT_CHECK_FREQ){
-            cluster->read_dram_vec(dram_ptr.ptrs, dram_loc, alloc.address, 8);
-            queue_is_fully_populated = dram_ptr.occupancy() >= pop_count;
-            auto elapsed_time_in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time);
-            if (elapsed_time_in_ms > std::chrono::milliseconds{timeout_in_ms}){
-                throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to get/pop " + std::to_string(pop_count) + " entries from device DRAM queue.");
-            }
-            loop_idx = 0;
-        }
+    bool queue_is_fully_populated = tt::wait::wait_with_backoff([&] {
+        cluster->read_dram_vec(dram_ptr.ptrs, dram_loc, alloc.address, 8);
+        return dram_ptr.occupancy() >= pop_count;
+    }, start_time, std::chrono::seconds{timeout_in_seconds});
+    if (!queue_is_fully_populated) {
+        throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to get/pop " + std::to_string(pop_count) + " entries from device DRAM queue.");
     }
     if (backend_profiler.is_enabled()) {
         log_trace(tt::LogIO, "DRAM Queue outputs seen after waiting {} ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time).count());
@@ -318,21 +313,14 @@ void wait_until_host_output_queue_populated(const tt_dram_io_desc &desc, uint32_
     log_trace(tt::LogIO, "Host Queue not fully populated, waiting up to timeout_in_seconds: {}.", timeout_in_seconds);
 
     log_assert(timeout_in_seconds > 0, "Only expected to be called with timeout_in_seconds>0");
-    bool queue_is_fully_populated   = false;
-    int loop_idx                    = 0;
-    auto timeout_in_ms              = 1000 * timeout_in_seconds;
-
     std::chrono::high_resolution_clock::time_point start_time = std::chrono::high_resolution_clock::now();
-    while (!queue_is_fully_populated){
-        if (loop_idx++ == TIMEOUT_CHECK_FREQ){
-            sysmem_ptr.wr_ptr = *(q_ptr + 1); // Just check wrptr, rdptr not expected to be changing after it's read once.
-            queue_is_fully_populated = sysmem_ptr.occupancy() >= pop_count;
-            auto elapsed_time_in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time);
-            if (elapsed_time_in_ms > std::chrono::milliseconds{timeout_in_ms}){
-                throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to get/pop " + std::to_string(pop_count) + " entries from device HOST queue.");
-            }
-            loop_idx = 0;
-        }
+    volatile uint32_t *wr_ptr = q_ptr + 1;
+    bool queue_is_fully_populated = tt::wait::wait_with_backoff([&] {
+        sysmem_ptr.wr_ptr = *wr_ptr; // Just check wrptr, rdptr not expected to be changing after it's read once.
+        return sysmem_ptr.occupancy() >= pop_count;
+    }, start_time, std::chrono::seconds{timeout_in_seconds});
+    if (!queue_is_fully_populated) {
+        throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to get/pop " + std::to_string(pop_count) + " entries from device HOST queue.");
     }
     if (backend_profiler.is_enabled()) {
         log_trace(tt::LogIO, "Host Queue outputs seen after waiting {} ms.", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time).count());
@@ -343,21 +331,41 @@ void wait_until_host_output_queue_populated(const tt_dram_io_desc &desc, uint32_
 void wait_until_input_queue_freed(std::chrono::high_resolution_clock::time_point &start_time, tt_cluster *cluster, const tt_queue_allocation_info &alloc, const tt_target_dram &q_target, const QUEUE_LOCATION q_location , tt_queue_ptr &q_ptr, int push_count, const int timeout_in_seconds){
 
     log_assert(timeout_in_seconds > 0, "Only expected to be called with timeout_in_seconds>0");
-    bool queue_is_fully_freed       = false;
-    int loop_idx                    = 0;
-    auto timeout_in_ms              = 1000 * timeout_in_seconds;
-
-    while (!queue_is_fully_freed){
-        if (loop_idx++ == TIMEOUT_CHECK_FREQ){
-            read_from_queue(cluster, q_ptr.ptrs, q_target, alloc.address, q_location, 8);
-            queue_is_fully_freed = q_ptr.free_space() >= push_count;
-            auto elapsed_time_in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start_time);
-            if (elapsed_time_in_ms > std::chrono::milliseconds{timeout_in_ms}){
-                throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to push " + std::to_string(push_count) + " entries to device DRAM queue.");
-            }
-            loop_idx = 0;
+    bool queue_is_fully_freed = tt::wait::wait_with_backoff([&] {
+        read_from_queue(cluster, q_ptr.ptrs, q_target, alloc.address, q_location, 8);
+        return q_ptr.free_space() >= push_count;
+    }, start_time, std::chrono::seconds{timeout_in_seconds});
+    if (!queue_is_fully_freed) {
+        throw tt::error_types::timeout_error("Exceeded timeout of " + std::to_string(timeout_in_seconds) + " seconds to push " + std::to_string(push_count) + " entries to device DRAM queue.");
+    }
+}
+
+// Non-blocking checks used by asynchronous pushes/gets, reads the ptrs of every buffer of the queue once
+bool is_queue_ready(const tt::tt_dram_io_desc &q_desc, const int num_entries, const bool for_push) {
+    if (q_desc.io_type != IO_TYPE::Queue) {
+        return true; // ram is always accessible
+    }
+    tt_cluster *cluster = get_cluster(q_desc.netlist_path, q_desc.backend_type);
+    tt_runtime_workload &workload = *get_workload(q_desc.netlist_path);
+    const tt_queue_info &queue_info = workload.queues.at(q_desc.queue_name).my_queue_info;
+    tt_queue_ptr q_ptr(queue_info.entries);
+    for (const auto &alloc : queue_info.alloc_info) {
+        tt_target_dram q_target = {queue_info.target_device, alloc.channel, 0};
+        read_from_queue(cluster, q_ptr.ptrs, q_target, alloc.address, queue_info.loc, 8);
+        const uint32_t num_available = for_push ? q_ptr.free_space() : q_ptr.occupancy();
+        if (num_available < num_entries) {
+            return false;
         }
     }
+    return true;
+}
+
+bool is_input_queue_freed(const tt::tt_dram_io_desc &q_desc, const int push_count) {
+    return is_queue_ready(q_desc, push_count, true);
+}
+
+bool is_output_queue_populated(const tt::tt_dram_io_desc &q_desc, const int num_entries) {
+    return is_queue_ready(q_desc, num_entries, false);
 }
 
 // Get a user space pointer to an untilized ptr in a dma buffer
@@ -556,6 +564,14 @@ void *get_tilized_from_dram(const tt_dram_io_desc &desc, const tt_queue_info &qu
     // pop data from device
     tt_runtime_workload &workload = *get_workload(desc.netlist_path);
     Dim ublock_scan = workload.get_ublock_scan(queue_info.name);
+    if (can_untilize_bfp_batch_directly(desc, queue_info)) {
+        shared_ptr<vector<uint32_t>> mem = workload.allocate_untilized_memory(desc.queue_name, pop_count);
+        uint16_t *dst = reinterpret_cast<uint16_t *>(mem->data());
+        read_tilized_output_from_dram(queue_info, cluster, false/*update_rdptr*/, pop_count, timeout_in_seconds, ram_ptr, [&](const std::uint32_t *batch, std::size_t batch_words, int alloc_index) {
+            untilize_bfp_batch_to_row_major(queue_info, batch, batch_words, alloc_index, pop_count, ublock_scan, dst);
+        });
+        return mem->data();
+    }
     tt_tensor result = pop_queue_tilized_output(queue_info, cluster, false/*update_rdptr*/, pop_count, ublock_scan, timeout_in_seconds, ram_ptr); // Unpack is done in this function now
     //result.unpack_data();
     // t-slices stacking operations
@@ -612,6 +628,17 @@ void *get_tilized_from_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &
     // pop data from device
     tt_runtime_workload &workload = *get_workload(desc.netlist_path);
     Dim ublock_scan = workload.get_ublock_scan(queue_info.name);
+    if (can_untilize_bfp_batch_directly(desc, queue_info)) {
+        uint16_t *dst = reinterpret_cast<uint16_t *>(mem->data());
+        read_tilized_output_from_sysmem(desc, queue_info, false/*update_rdptr*/, pop_count, timeout_in_seconds, ram_ptr, [&](const std::uint32_t *batch, std::size_t batch_words, int alloc_index) {
+            untilize_bfp_batch_to_row_major(queue_info, batch, batch_words, alloc_index, pop_count, ublock_scan, dst);
+        });
+        auto get_end1 = std::chrono::high_resolution_clock::now();
+        log_trace(tt::LogIO, "get_tilized_from_sysmem: allocate={}, pop and untilize={}",
+            std::chrono::duration_cast<std::chrono::microseconds>(get_end0 - get_start).count(),
+            std::chrono::duration_cast<std::chrono::microseconds>(get_end1 - get_end0).count());
+        return mem->data();
+    }
     tt_tensor result = pop_queue_tilized_output_sysmem(desc, queue_info, cluster, false/*update_rdptr*/, pop_count, ublock_scan, timeout_in_seconds, ram_ptr); // Unpack is done in this function now
     auto get_end1 = std::chrono::high_resolution_clock::now();
 
@@ -947,54 +974,88 @@ void push_queue_tilized_input(const tt_queue_info &queue_info, tt_tensor &input_
 
 }
 
-void get_ublock_data(
-    const tt_queue_info &queue_info,
-    const tt_tensor &tensor,
-    const std::vector<std::uint32_t> &rv,
-    const int global_offset,
-    const int buf_index,
-    uint32_t &buf_offset,
-    const int wi,
-    const int zi,
-    const int ubr,
-    const int ubc)
-{
-    int gr = buf_index / queue_info.grid_size.c;
-    int gc = buf_index % queue_info.grid_size.c;
-    for (int tr=0; tr<queue_info.dim.ublock_rt; ++tr) {
-        for (int tc=0; tc<queue_info.dim.ublock_ct; ++tc) {
-            int rt_index = gr*queue_info.dim.ublock_rt*queue_info.dim.mblock_m + ubr*queue_info.dim.ublock_rt + tr;
-            int ct_index = gc*queue_info.dim.ublock_ct*queue_info.dim.mblock_n + ubc*queue_info.dim.ublock_ct + tc;
-            tt_tile *tile = tensor.get_tile_ptr(rt_index, ct_index, zi, wi, get_tile_dim_y(queue_info), get_tile_dim_x(queue_info));
-            log_assert(!tile->packed_data_present(), "Did not expect packed data to be be populated.");
-            uint32_t tile_size = tile->size_bytes(true);
-            tile->packed_data.resize(tile_size);
-            std::memcpy(tile->packed_data.data(), rv.data() + global_offset + buf_offset, tile_size);
-            tile->verify_tile_header();
-            tile->packed_data_to_tile();
-            buf_offset += tile_size / sizeof(uint32_t);
+// Calls func(tile_data, wi, zi, rt_index, ct_index) for every tile of one buffer's batch. Tiles are stored back to back
+// in ublock scan order and all have the same size, so each tile's offset into the batch is known up front and large batches
+// are split across threads.
+template <typename Function>
+void for_each_tile_in_batch(const tt_queue_info &queue_info, const std::uint32_t *batch, const std::size_t batch_words, const int buf_index, const int pop_count, const Dim ublock_scan, Function func) {
+    log_assert(ublock_scan == Dim::R or ublock_scan == Dim::C, "Invalid ublock scan order!");
+    constexpr int min_tiles_per_thread = 128;
+    const int gr = buf_index / queue_info.grid_size.c;
+    const int gc = buf_index % queue_info.grid_size.c;
+    const uint32_t tile_words = tt::size::get_tile_size_in_bytes(queue_info.data_format, true, get_tile_dim_y(queue_info), get_tile_dim_x(queue_info)) / sizeof(uint32_t);
+    const uint32_t entry_words = get_entry_size_in_bytes(queue_info, true) / sizeof(uint32_t);
+    const int tiles_per_ublock = queue_info.dim.ublock_rt * queue_info.dim.ublock_ct;
+    const int tiles_per_z = tiles_per_ublock * queue_info.dim.mblock_m * queue_info.dim.mblock_n;
+    const int tiles_per_entry = tiles_per_z * queue_info.dim.t;
+    const int num_tiles = tiles_per_entry * pop_count;
+
+    auto unpack_tile = [&](int tile_index) {
+        const int wi = tile_index / tiles_per_entry;
+        const int zi = (tile_index % tiles_per_entry) / tiles_per_z;
+        const int tile_in_z = tile_index % tiles_per_z;
+        const int ublock_index = tile_in_z / tiles_per_ublock;
+        const int tr = (tile_in_z % tiles_per_ublock) / queue_info.dim.ublock_ct;
+        const int tc = (tile_in_z % tiles_per_ublock) % queue_info.dim.ublock_ct;
+        const int ubr = ublock_scan == Dim::R ? ublock_index / queue_info.dim.mblock_n : ublock_index % queue_info.dim.mblock_m;
+        const int ubc = ublock_scan == Dim::R ? ublock_index % queue_info.dim.mblock_n : ublock_index / queue_info.dim.mblock_m;
+        const int rt_index = gr*queue_info.dim.ublock_rt*queue_info.dim.mblock_m + ubr*queue_info.dim.ublock_rt + tr;
+        const int ct_index = gc*queue_info.dim.ublock_ct*queue_info.dim.mblock_n + ubc*queue_info.dim.ublock_ct + tc;
+        const size_t offset = size_t(wi) * entry_words + size_t(zi * tiles_per_z + tile_in_z) * tile_words;
+        log_assert(offset + tile_words <= batch_words, "Tile {} of queue {} is outside of the read back batch", tile_index, queue_info.name);
+        func(batch + offset, wi, zi, rt_index, ct_index);
+    };
+
+    const int num_threads = std::min<int>(tt::cpuset::get_allowed_num_threads(), num_tiles / min_tiles_per_thread);
+    if (num_threads > 1) {
+        tt::parallel_for(0, num_tiles, unpack_tile, num_threads);
+    } else {
+        for (int tile_index = 0; tile_index < num_tiles; ++tile_index) {
+            unpack_tile(tile_index);
         }
     }
 }
 
-tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr) {
+void unpack_batch_to_tensor(const tt_queue_info &queue_info, const tt_tensor &tensor, const std::uint32_t *batch, const std::size_t batch_words, const int buf_index, const Dim ublock_scan) {
+    for_each_tile_in_batch(queue_info, batch, batch_words, buf_index, tensor.getw(), ublock_scan, [&](const uint32_t *tile_data, int wi, int zi, int rt_index, int ct_index) {
+        tt_tile *tile = tensor.get_tile_ptr(rt_index, ct_index, zi, wi, get_tile_dim_y(queue_info), get_tile_dim_x(queue_info));
+        log_assert(!tile->packed_data_present(), "Did not expect packed data to be be populated.");
+        uint32_t tile_size = tile->size_bytes(true);
+        tile->packed_data.resize(tile_size / sizeof(uint32_t));
+        std::memcpy(tile->packed_data.data(), tile_data, tile_size);
+        tile->verify_tile_header();
+        tile->packed_data_to_tile();
+    });
+}
 
-    std::string queue_name = queue_info.name;
+// Bfp outputs with 32x32 tiles and no t-slice stacking skip the tt_tensor entirely: tiles are decoded from the read
+// back batch straight into the row major output, as the same halves untilize_to_flat_tensor_data_half would produce.
+bool can_untilize_bfp_batch_directly(const tt_dram_io_desc &desc, const tt_queue_info &queue_info) {
+    static const std::unordered_set<DataFormat> bfp_formats = {DataFormat::Bfp8, DataFormat::Bfp8_b, DataFormat::Bfp4, DataFormat::Bfp4_b, DataFormat::Bfp2, DataFormat::Bfp2_b};
+    return bfp_formats.count(queue_info.data_format) and get_tile_dim_y(queue_info) == 32 and get_tile_dim_x(queue_info) == 32 and
+           desc.hstack_factor <= 1 and desc.vstack_factor <= 1 and !tt_tile::force_slow_untilize;
+}
 
-    tt_tensor_metadata md;
-    md.shape.rt = queue_info.dim.mblock_m * queue_info.dim.ublock_rt * queue_info.grid_size.r;
-    md.shape.ct = queue_info.dim.mblock_n * queue_info.dim.ublock_ct * queue_info.grid_size.c;
-    md.shape.z  = queue_info.dim.t;
-    md.shape.w  = pop_count;
-    md.shape.tile_height = get_tile_dim_y(queue_info);
-    md.shape.tile_width = get_tile_dim_x(queue_info);
-    md.is_tilized = true;
-    md.data_format = queue_info.data_format;
-    tt_tensor tensor(md);
-    tensor.reserve_tile_tensor();
+void untilize_bfp_batch_to_row_major(const tt_queue_info &queue_info, const std::uint32_t *batch, const std::size_t batch_words, const int buf_index, const int pop_count, const Dim ublock_scan, uint16_t *dst) {
+    const bool is_b_format = queue_info.data_format == DataFormat::Bfp8_b or queue_info.data_format == DataFormat::Bfp4_b or queue_info.data_format == DataFormat::Bfp2_b;
+    const DataFormat dst_format = is_b_format ? DataFormat::Float16_b : DataFormat::Float16;
+    const uint32_t tile_size = tt::size::get_tile_size_in_bytes(queue_info.data_format, true);
+    const size_t row_pitch = size_t(queue_info.dim.mblock_n) * queue_info.dim.ublock_ct * queue_info.grid_size.c * 32;
+    const size_t z_pitch = row_pitch * queue_info.dim.mblock_m * queue_info.dim.ublock_rt * queue_info.grid_size.r * 32;
+    for_each_tile_in_batch(queue_info, batch, batch_words, buf_index, pop_count, ublock_scan, [&](const uint32_t *tile_data, int wi, int zi, int rt_index, int ct_index) {
+        log_assert((tile_data[0] << 4) == tile_size, "Invalid tile header. Expected tile size: {} but got: {}", tile_size, tile_data[0]);
+        const size_t dst_index = (size_t(wi) * queue_info.dim.t + zi) * z_pitch + size_t(rt_index) * 32 * row_pitch + size_t(ct_index) * 32;
+        tt::untilize_utils::unpack_bfp_tile_to_row_major(tile_data, queue_info.data_format, dst_format, dst + dst_index, row_pitch);
+    });
+}
+
+// Reads pop_count entries of each buffer of a tilized DRAM output queue and hands every buffer's batch to unpack_batch.
+void read_tilized_output_from_dram(const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, const int timeout_in_seconds, int ram_ptr, const std::function<void(const std::uint32_t *, std::size_t, int)> &unpack_batch) {
+
+    std::string queue_name = queue_info.name;
 
     const uint32_t entry_size = get_entry_size_in_bytes(queue_info, true);
-    const uint32_t batch_size = entry_size * tensor.getw();
+    const uint32_t batch_size = entry_size * pop_count;
 
     std::vector<std::uint32_t> rv(batch_size); // rv stores a batch
     log_assert(queue_info.alloc_info.size() == queue_info.grid_size.r * queue_info.grid_size.c, "Queue grid size and number of bufs mismatch.");
@@ -1032,14 +1093,11 @@ tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *
             log_assert(!update_rdptr, "RAM must never update ptrs!");
         }
 
-        int gr = alloc_index / queue_info.grid_size.c;
-        int gc = alloc_index % queue_info.grid_size.c;
-
         dram_rd_ptr = dram_ptr.get_rd_ptr();
         uint64_t dram_rd_addr = alloc.address + tt::io::io_queue_header_size_bytes + (dram_rd_ptr * entry_size);
 
-        log_assert(!(dram_ptr.empty() or dram_ptr.empty_during_batched_read(tensor.getw())), "Cannot pop {} slots from queue on device! Queue = {}, rd_ptr = {}, wr_ptr = {}", tensor.getw(), queue_name, dram_ptr.rd_ptr, dram_ptr.wr_ptr);
-        if(dram_rd_ptr + tensor.getw() < queue_info.entries){
+        log_assert(!(dram_ptr.empty() or dram_ptr.empty_during_batched_read(pop_count)), "Cannot pop {} slots from queue on device! Queue = {}, rd_ptr = {}, wr_ptr = {}", pop_count, queue_name, dram_ptr.rd_ptr, dram_ptr.wr_ptr);
+        if(dram_rd_ptr + pop_count < queue_info.entries){
             // The data for this batch is stored in DRAM contiguously
             cluster->read_dram_vec(rv, dram_loc, dram_rd_addr, batch_size);
         }
@@ -1052,29 +1110,11 @@ tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *
             cluster->read_dram_vec(tmp, dram_loc, second_dram_rd_addr, batch_size - first_batch_size);
             rv.insert(rv.end(), tmp.begin(), tmp.end());
         }
-        
-        for (int wi=0; wi<tensor.getw(); ++wi) {
-            uint32_t offset = 0;
-            for (int zi=0; zi<tensor.getz(); ++zi) {
-                if (ublock_scan == Dim::R) {
-                    for (int ubr=0; ubr<queue_info.dim.mblock_m; ++ubr) {
-                        for (int ubc=0; ubc<queue_info.dim.mblock_n; ++ubc) {
-                            // tt::io::get_ublock_data()
-                            get_ublock_data(queue_info, tensor, rv,  wi*(entry_size/sizeof(uint32_t)), alloc_index, offset, wi, zi, ubr, ubc);
-                        }
-                    }
-                } else if (ublock_scan == Dim::C) {
-                    for (int ubc=0; ubc<queue_info.dim.mblock_n; ++ubc) {
-                        for (int ubr=0; ubr<queue_info.dim.mblock_m; ++ubr) {
-                            get_ublock_data(queue_info, tensor, rv,  wi*(entry_size/sizeof(uint32_t)), alloc_index, offset, wi, zi, ubr, ubc);
-                        }
-                    }
-                } else {
-                    log_fatal("Invalid ublock scan order!");
-                }
-            }
+
+        unpack_batch(rv.data(), rv.size(), alloc_index);
+        for (int wi=0; wi<pop_count; ++wi) {
             if (update_rdptr) {
-                dram_ptr.incr_rd(tensor.getw());
+                dram_ptr.incr_rd(pop_count);
                 update_queue_ptr(cluster, dram_ptr.rd_ptr, dram_loc, alloc.address, queue_info.loc);
             }
         }
@@ -1083,14 +1123,9 @@ tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *
     if (update_rdptr) {
         tt_driver_atomics::sfence();
     }
-    return tensor;
 }
 
-
-tt_tensor pop_queue_tilized_output_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr) {
-
-    std::string queue_name = queue_info.name;
-
+tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr) {
     tt_tensor_metadata md;
     md.shape.rt = queue_info.dim.mblock_m * queue_info.dim.ublock_rt * queue_info.grid_size.r;
     md.shape.ct = queue_info.dim.mblock_n * queue_info.dim.ublock_ct * queue_info.grid_size.c;
@@ -1103,9 +1138,19 @@ tt_tensor pop_queue_tilized_output_sysmem(const tt_dram_io_desc &desc, const tt_
     tt_tensor tensor(md);
     tensor.reserve_tile_tensor();
 
+    read_tilized_output_from_dram(queue_info, cluster, update_rdptr, pop_count, timeout_in_seconds, ram_ptr, [&](const std::uint32_t *batch, std::size_t batch_words, int alloc_index) {
+        unpack_batch_to_tensor(queue_info, tensor, batch, batch_words, alloc_index, ublock_scan);
+    });
+    return tensor;
+}
+
+
+// Host memory counterpart of read_tilized_output_from_dram. Batches are handed to unpack_batch in place, without a copy.
+void read_tilized_output_from_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &queue_info, bool update_rdptr, int pop_count, const int timeout_in_seconds, int ram_ptr, const std::function<void(const std::uint32_t *, std::size_t, int)> &unpack_batch) {
+
     const uint32_t num_entries = desc.bufq_num_slots;
     const uint32_t entry_size = get_entry_size_in_bytes(queue_info, true);
-    const uint32_t batch_size = entry_size * tensor.getw();
+    const uint32_t batch_size = entry_size * pop_count;
     log_assert(desc.bufq_mapping.size() == desc.bufq_grid_dim_r * desc.bufq_grid_dim_c, "Queue grid size and number of bufs mismatch.");
 
     // tt_target_dram dram_loc = {queue_info.target_device, -1/*chan*/, 0/*subchan*/};
@@ -1142,34 +1187,33 @@ tt_tensor pop_queue_tilized_output_sysmem(const tt_dram_io_desc &desc, const tt_
         log_assert((rd_ptr_to_range + pop_count) <= num_entries, "Entries read must reside in contiguous memory!");
         q_ptr = reinterpret_cast<uint32_t *>(desc.bufq_mapping.at(alloc_index));
         uint32_t offset = (entry_size * rd_ptr_to_range + tt::io::io_queue_header_size_bytes) / sizeof(uint32_t); // div by 4 for uint32 ptr arithmetic
-        uint32_t *data = q_ptr + offset;
-        vector<uint32_t> rv(data, data + (batch_size/sizeof(uint32_t)));
+        unpack_batch(q_ptr + offset, batch_size / sizeof(uint32_t), alloc_index);
 
-        for (int wi=0; wi<tensor.getw(); ++wi) {
-            uint32_t offset = 0;
-            for (int zi=0; zi<tensor.getz(); ++zi) {
-                if (ublock_scan == Dim::R) {
-                    for (int ubr=0; ubr<queue_info.dim.mblock_m; ++ubr) {
-                        for (int ubc=0; ubc<queue_info.dim.mblock_n; ++ubc) {
-                            get_ublock_data(queue_info, tensor, rv,  wi*(entry_size/sizeof(uint32_t)), alloc_index, offset, wi, zi, ubr, ubc);
-                        }
-                    }
-                } else if (ublock_scan == Dim::C) {
-                    for (int ubc=0; ubc<queue_info.dim.mblock_n; ++ubc) {
-                        for (int ubr=0; ubr<queue_info.dim.mblock_m; ++ubr) {
-                            get_ublock_data(queue_info, tensor, rv,  wi*(entry_size/sizeof(uint32_t)), alloc_index, offset, wi, zi, ubr, ubc);
-                        }
-                    }
-                } else {
-                    log_fatal("Invalid ublock scan order!");
-                }
-            }
+        for (int wi=0; wi<pop_count; ++wi) {
             if (update_rdptr) {
-                sysmem_ptr.incr_rd(tensor.getw());
+                sysmem_ptr.incr_rd(pop_count);
                 *q_ptr = sysmem_ptr.rd_ptr;
             }
         }
     }
+}
+
+tt_tensor pop_queue_tilized_output_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr) {
+    tt_tensor_metadata md;
+    md.shape.rt = queue_info.dim.mblock_m * queue_info.dim.ublock_rt * queue_info.grid_size.r;
+    md.shape.ct = queue_info.dim.mblock_n * queue_info.dim.ublock_ct * queue_info.grid_size.c;
+    md.shape.z  = queue_info.dim.t;
+    md.shape.w  = pop_count;
+    md.shape.tile_height = get_tile_dim_y(queue_info);
+    md.shape.tile_width = get_tile_dim_x(queue_info);
+    md.is_tilized = true;
+    md.data_format = queue_info.data_format;
+    tt_tensor tensor(md);
+    tensor.reserve_tile_tensor();
+
+    read_tilized_output_from_sysmem(desc, queue_info, update_rdptr, pop_count, timeout_in_seconds, ram_ptr, [&](const std::uint32_t *batch, std::size_t batch_words, int alloc_index) {
+        unpack_batch_to_tensor(queue_info, tensor, batch, batch_words, alloc_index, ublock_scan);
+    });
     return tensor;
 }
 
@@ -1251,7 +1295,8 @@ void pop_outputs_to_tqs_sw_untilize(std::vector<tt_dram_io_desc> &dram_io_desc,
     }
 }
 
-void create_tilized_data_vector(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, tt::tt_TilizedTensorDesc &tilized_tensor_desc, std::vector<uint32_t>& packed_data) {
+// Copy of q_desc with its buffers placed back to back in packed_data, for tilizing on host
+tt_dram_io_desc get_host_buffer_desc(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, const tt::tt_TilizedTensorDesc &tilized_tensor_desc, std::vector<uint32_t>& packed_data) {
     tt_dram_io_desc temp_q_desc = q_desc; // This object will be modified to have its buffers on host
     temp_q_desc.bufq_num_slots = py_tensor_desc.shape[0];
     temp_q_desc.io_type = tt::IO_TYPE::Queue;
@@ -1262,7 +1307,11 @@ void create_tilized_data_vector(const tt::tt_dram_io_desc &q_desc, const tt::tt_
     for(int buf_idx = 0; buf_idx < temp_q_desc.bufq_start_addr_channel.size(); buf_idx++) {
         temp_q_desc.bufq_mapping.push_back(reinterpret_cast<void*>(packed_data.data() + buffer_size * buf_idx)); // Assign host buffers to temp_q_desc object
     }
-    static constexpr Tilizer binary_tilizer_backend = Tilizer::FastTilizeMMIOPush;
+    return temp_q_desc;
+}
+
+void create_tilized_data_vector(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, tt::tt_TilizedTensorDesc &tilized_tensor_desc, std::vector<uint32_t>& packed_data) {
+    tt_dram_io_desc temp_q_desc = get_host_buffer_desc(q_desc, py_tensor_desc, tilized_tensor_desc, packed_data);
     auto tilizer = new DeviceTilizer<Tilizer::FastTilizeMMIOPush>({temp_q_desc}, py_tensor_desc, temp_q_desc.s_descriptor, temp_q_desc.tile_height, temp_q_desc.tile_width, true); // offline tilize
     tilizer -> tilize_and_push_to_device({py_tensor_desc}, 0, 0); // "Device" buffers here are those initialized in host_grid.
     
@@ -1311,26 +1360,61 @@ void create_tilized_data_scalar(const tt::tt_dram_io_desc &q_desc, const tt::tt_
     }
 }
 
-tt::tt_TilizedTensorDesc tilize_tensor(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc) {
-    std::uint32_t packed_data_size = tt::size::get_entry_size_in_bytes(q_desc.bufq_target_format, q_desc.layout == IO_LAYOUT::Tilized, 
-                                    q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width) * py_tensor_desc.shape[0];
+tt::tt_TilizedTensorDesc get_tilized_tensor_desc(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc) {
     tt_TilizedTensorDesc rval;
     rval.owner = OWNERSHIP::Backend; // Backend allocates memory for this tensor
     rval.format = q_desc.bufq_target_format;
     rval.num_buffers = q_desc.bufq_grid_dim_r * q_desc.bufq_grid_dim_c;
-    rval.buf_size_bytes = packed_data_size;
+    rval.buf_size_bytes = tt::size::get_entry_size_in_bytes(q_desc.bufq_target_format, q_desc.layout == IO_LAYOUT::Tilized, 
+                                    q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width) * py_tensor_desc.shape[0];
+    return rval;
+}
 
-    packed_data_size = (packed_data_size * q_desc.bufq_grid_dim_c * q_desc.bufq_grid_dim_r) / 4;   
-    std::vector<uint32_t> concatenated_packed_data(packed_data_size, 0);
+bool use_offline_hw_tilize(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc) {
     bool force_slow_offline_tilize = parse_env("TT_BACKEND_FORCE_SW_OFFLINE_TILIZE", false);
-    if(hw_tilizer_conversions.find({py_tensor_desc.format, q_desc.bufq_target_format}) != hw_tilizer_conversions.end() and !force_slow_offline_tilize) {
-        create_tilized_data_vector(q_desc, py_tensor_desc, rval, concatenated_packed_data);
+    return hw_tilizer_conversions.find({py_tensor_desc.format, q_desc.bufq_target_format}) != hw_tilizer_conversions.end() and !force_slow_offline_tilize;
+}
+
+// Tilizes py_tensor_desc into packed_data, which the returned descriptor points to. Looks the queue up in the workload
+// of q_desc, creating it on a miss.
+tt::tt_TilizedTensorDesc tilize_tensor_to_buffer(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, std::vector<uint32_t> &packed_data) {
+    tt_TilizedTensorDesc rval = get_tilized_tensor_desc(q_desc, py_tensor_desc);
+    packed_data.assign(rval.buf_size_bytes * rval.num_buffers / 4, 0);
+    if(use_offline_hw_tilize(q_desc, py_tensor_desc)) {
+        create_tilized_data_vector(q_desc, py_tensor_desc, rval, packed_data);
     }
     else {
-        create_tilized_data_scalar(q_desc, py_tensor_desc, rval, concatenated_packed_data);
+        create_tilized_data_scalar(q_desc, py_tensor_desc, rval, packed_data);
     }
+    rval.ptr = packed_data.data();
+    return rval;
+}
+
+// Cached offline tilizer of a queue, tilizing into a host staging buffer cached under the same tag. The tilizer is
+// built once per queue, host format and microbatch size, so the buffer holds exactly one push and each push rewrites
+// it from the start. Quad headers and padding are laid down once, when the tilizer is built.
+DeviceTilizer<Tilizer::FastTilizeMMIOPush> *get_offline_tilizer(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, tt::tt_TilizedTensorDesc &tilized_tensor) {
+    const std::string tag = q_desc.queue_name + "_offline_" + std::to_string(static_cast<int>(py_tensor_desc.format)) + "_" + std::to_string(py_tensor_desc.shape[0]);
+    tilized_tensor = get_tilized_tensor_desc(q_desc, py_tensor_desc);
+    if (tt_object_cache<DeviceTilizer<Tilizer::FastTilizeMMIOPush>>::exists(tag)) {
+        tilized_tensor.ptr = tt_object_cache<std::vector<uint32_t>>::get(tag)->data();
+        return tt_object_cache<DeviceTilizer<Tilizer::FastTilizeMMIOPush>>::get(tag);
+    }
+    auto staging = new std::vector<uint32_t>(tilized_tensor.buf_size_bytes * tilized_tensor.num_buffers / 4, 0);
+    tt_dram_io_desc temp_q_desc = get_host_buffer_desc(q_desc, py_tensor_desc, tilized_tensor, *staging);
+    auto tilizer = new DeviceTilizer<Tilizer::FastTilizeMMIOPush>({temp_q_desc}, py_tensor_desc, temp_q_desc.s_descriptor, temp_q_desc.tile_height, temp_q_desc.tile_width, true); // offline tilize
+    tt_object_cache<std::vector<uint32_t>>::set(tag, staging);
+    tt_object_cache<DeviceTilizer<Tilizer::FastTilizeMMIOPush>>::set(tag, tilizer);
+    log_trace(tt::LogIO, "{} cache MISS, added object to cache with tag '{}'", __FUNCTION__, tag);
+    tilized_tensor.ptr = staging->data();
+    return tilizer;
+}
+
+tt::tt_TilizedTensorDesc tilize_tensor(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc) {
+    std::vector<uint32_t> concatenated_packed_data;
+    tt_TilizedTensorDesc rval = tilize_tensor_to_buffer(q_desc, py_tensor_desc, concatenated_packed_data);
     shared_ptr<vector<uint32_t>> mem = get_workload(q_desc.netlist_path)->allocate_tilized_memory(q_desc.queue_name, py_tensor_desc.shape[0]);
-    std::memcpy(mem->data(), concatenated_packed_data.data(), packed_data_size * 4);
+    std::memcpy(mem->data(), concatenated_packed_data.data(), concatenated_packed_data.size() * 4);
 
     rval.ptr = mem->data();
     return rval;
@@ -1383,7 +1467,6 @@ bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_Tilize
         else {
             q_wr_ptr = ram_ptr;
         }
-        std::vector<uint32_t> vec_to_write(reinterpret_cast<const uint32_t*>(tilized_tensor.ptr) + alloc_idx * entry_size / 4, reinterpret_cast<const uint32_t*>(tilized_tensor.ptr) + alloc_idx * entry_size / 4 + entry_size / 4);
         std::uint32_t wr_addr = alloc.address + tt::io::io_queue_header_size_bytes + q_wr_ptr * block_size;
         const uint32_t* data_ptr = reinterpret_cast<const uint32_t*>(tilized_tensor.ptr) + alloc_idx * entry_size / 4;
         write_to_queue(cluster, data_ptr, entry_size, dram, wr_addr, queue_info.loc);
@@ -1395,6 +1478,26 @@ bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_Tilize
     }
     return true;
 }
+bool push_parameter_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, const int timeout_in_seconds, const int ram_ptr) {
+    tt_tilized_tensor_cache *cache = tt_tilized_tensor_cache::get();
+    if (cache == nullptr or !tt_tilized_tensor_cache::is_cacheable(q_desc)) {
+        return push_input_to_device(q_desc, py_tensor_desc, true, timeout_in_seconds, ram_ptr);
+    }
+    tt_cluster *cluster = get_cluster(q_desc.netlist_path, q_desc.backend_type);
+    const std::string ublock_scan = netlist_utils::get_string(get_workload(q_desc.netlist_path)->get_ublock_scan(q_desc.queue_name));
+    const std::string key = cache->get_key(q_desc, py_tensor_desc, get_string(cluster->cluster_arch), ublock_scan);
+    // Cached entries are written to each queue buffer with one large write, no host side conversion left to do. Misses
+    // are tilized into a scratch buffer rather than workload memory, which would keep a host copy of every weight.
+    cache->load_or_tilize(
+        key,
+        [&](std::vector<uint32_t> &packed_data) { return tilize_tensor_to_buffer(q_desc, py_tensor_desc, packed_data); },
+        [&](const tt::tt_TilizedTensorDesc &tilized_tensor) {
+            log_debug(tt::LogIO, "Pushing tilized tensor {} to {}", key, q_desc.queue_name);
+            push_input_to_device(q_desc, tilized_tensor, timeout_in_seconds, ram_ptr);
+        });
+    return true;
+}
+
 bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, const bool push_one, const int timeout_in_seconds, const int ram_ptr) {
     tt_cluster *cluster = get_cluster(q_desc.netlist_path, q_desc.backend_type);
     vector<tt::tt_dram_io_desc> io_desc = {q_desc};
@@ -1453,6 +1556,205 @@ bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_Pytorc
     return true;
 }
 
+namespace {
+
+// An input of a batched push whose host side conversion runs on the task scheduler
+struct batched_push_input {
+    const tt::tt_dram_io_desc *q_desc = nullptr;
+    const tt::tt_PytorchTensorDesc *py_tensor_desc = nullptr;
+    std::uint32_t index = 0;
+    bool pipelined = false;
+    // Points into the staging buffer of the tilizer, which only this input of the batch writes
+    tt::tt_TilizedTensorDesc tilized_tensor;
+    std::atomic<bool> converted = false;
+    std::exception_ptr exception;
+};
+
+// Conversions still queued or running, which point into the inputs of the batch and the tensors of the caller
+struct batched_push_conversions {
+    std::atomic<int> num_outstanding = 0;
+    std::mutex mutex;
+    std::condition_variable converted_cv;
+
+    // The tilizer is looked up here, on the pushing thread, so the task itself stays clear of the object caches and the
+    // workload
+    void submit(batched_push_input &input, const uint device_id) {
+        DeviceTilizer<Tilizer::FastTilizeMMIOPush> *tilizer = get_offline_tilizer(*input.q_desc, *input.py_tensor_desc, input.tilized_tensor);
+        num_outstanding++;
+        tt_task_scheduler::get().submit([this, &input, tilizer, device_id] {
+            try {
+                perf::ScopedEventProfiler profile(perf::get_event_id(perf::HostEventType::PUSH_INPUTS_CONVERT, device_id, input.index));
+                tilizer->tilize_and_push_to_device({*input.py_tensor_desc}, 0, 0);
+            } catch (...) {
+                input.exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            input.converted.store(true, std::memory_order_release);
+            num_outstanding--;
+            converted_cv.notify_all();
+        });
+    }
+
+    // Helps with queued tasks while waiting, so a busy scheduler cannot stall the push
+    void wait(const std::function<bool()> &done) {
+        while (!done()) {
+            if (tt_task_scheduler::get().run_pending_task()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            converted_cv.wait_for(lock, std::chrono::microseconds(100), done);
+        }
+    }
+
+    ~batched_push_conversions() {
+        // Only outstanding if the push failed part way
+        wait([this] { return num_outstanding.load() == 0; });
+        // The last task may still hold the lock it counted down under
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+};
+
+struct pending_wptr_update {
+    tt_cluster *cluster;
+    tt_target_dram dram;
+    QUEUE_LOCATION loc;
+    std::uint32_t address;
+    std::uint32_t wr_ptr;
+};
+
+bool can_pipeline_push(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, tt_cluster *cluster) {
+    // Prestrided inputs are shuffled on the way, ram is written in place and the slow tilizers are left to the single queue path
+    if (q_desc.io_type != IO_TYPE::Queue or q_desc.s_descriptor.stride > 0 or force_sw_tilize() or !use_offline_hw_tilize(q_desc, py_tensor_desc)) {
+        return false;
+    }
+    return get_tilizer_based_on_io_config(q_desc, py_tensor_desc.format, q_desc.bufq_target_format, cluster->type) != Tilizer::SlowTilize;
+}
+
+// Writes the device layout of an input to every buffer of its queue without publishing it. The wptrs to publish once
+// all writes of the batch are done are appended to wptr_updates.
+void write_converted_input(
+    std::chrono::high_resolution_clock::time_point &start_time, const tt::tt_dram_io_desc &q_desc, const tt::tt_TilizedTensorDesc &tilized_tensor,
+    const int timeout_in_seconds, std::vector<pending_wptr_update> &wptr_updates) {
+    tt_cluster *cluster = get_cluster(q_desc.netlist_path, q_desc.backend_type);
+    tt_queue_info &queue_info = get_workload(q_desc.netlist_path)->queues.at(q_desc.queue_name).my_queue_info;
+    const std::uint32_t entry_size = tilized_tensor.buf_size_bytes;
+    const std::uint32_t block_size = tt::size::get_entry_size_in_bytes(q_desc.bufq_target_format, q_desc.layout == IO_LAYOUT::Tilized,
+                                    q_desc.ublock_ct, q_desc.ublock_rt, q_desc.mblock_m, q_desc.mblock_n, q_desc.t, q_desc.tile_height, q_desc.tile_width);
+    log_assert(tilized_tensor.num_buffers == queue_info.alloc_info.size(), "Num buffers specified in tilized tensor do not match num buffers in queue grid");
+    const std::uint32_t push_count = entry_size / block_size;
+    tt_queue_ptr q_ptr(queue_info.entries);
+
+    for (std::uint32_t alloc_idx = 0; alloc_idx < queue_info.alloc_info.size(); alloc_idx++) {
+        const tt_queue_allocation_info &alloc = queue_info.alloc_info.at(alloc_idx);
+        tt_target_dram dram = {queue_info.target_device, alloc.channel, 0};
+        wait_until_input_queue_freed(start_time, cluster, alloc, dram, queue_info.loc, q_ptr, push_count, timeout_in_seconds);
+        std::uint32_t wr_addr = alloc.address + tt::io::io_queue_header_size_bytes + q_ptr.get_wr_ptr() * block_size;
+        const uint32_t *data_ptr = reinterpret_cast<const uint32_t *>(tilized_tensor.ptr) + alloc_idx * entry_size / 4;
+        write_to_queue(cluster, data_ptr, entry_size, dram, wr_addr, queue_info.loc);
+        q_ptr.incr_wr(push_count);
+        wptr_updates.push_back({cluster, dram, queue_info.loc, alloc.address + 4, q_ptr.wr_ptr});
+    }
+}
+
+// Publishes the wptrs of a batch with one fence and one memory barrier per device, instead of one per queue buffer
+void flush_wptr_updates(const std::vector<pending_wptr_update> &wptr_updates) {
+    // Data written over ethernet must land before any wptr of a remote chip does, once per cluster covers all of them
+    std::unordered_set<tt_cluster *> flushed_clusters;
+    tt_driver_atomics::sfence();
+    for (const pending_wptr_update &update : wptr_updates) {
+        if (update.loc == QUEUE_LOCATION::DRAM and !update.cluster->get_cluster_desc()->is_chip_mmio_capable(std::get<0>(update.dram)) and
+            flushed_clusters.insert(update.cluster).second) {
+            update.cluster->wait_for_non_mmio_flush();
+        }
+    }
+
+    bool has_host_queues = false;
+    std::map<std::pair<tt_cluster *, chip_id_t>, std::unordered_set<uint32_t>> dram_channels;
+    for (const pending_wptr_update &update : wptr_updates) {
+        vector<uint32_t> ptr_vec = {update.wr_ptr};
+        if (update.loc == QUEUE_LOCATION::HOST) {
+            update.cluster->write_sysmem_vec(ptr_vec, update.address, std::get<1>(update.dram), std::get<0>(update.dram));
+            has_host_queues = true;
+        } else {
+            update.cluster->write_dram_vec(ptr_vec, update.dram, update.address);
+            dram_channels[{update.cluster, std::get<0>(update.dram)}].insert(std::get<1>(update.dram));
+        }
+    }
+    tt_driver_atomics::sfence();
+
+    if (has_host_queues) {
+        tt_driver_atomics::mfence();
+    }
+    for (const auto &[device, channels] : dram_channels) {
+        device.first->memory_barrier(MemBarType::host_device_dram, device.second, channels);
+    }
+}
+
+}  // namespace
+
+bool push_inputs_to_device(const std::vector<tt::tt_dram_io_desc> &q_descs, const std::vector<tt::tt_PytorchTensorDesc> &py_tensor_descs, const bool push_one, const int timeout_in_seconds) {
+    log_assert(q_descs.size() == py_tensor_descs.size(), "Expected one tensor per queue in a batched push, got {} queues and {} tensors", q_descs.size(), py_tensor_descs.size());
+    if (q_descs.empty()) {
+        return true;
+    }
+    std::chrono::high_resolution_clock::time_point start_time = std::chrono::high_resolution_clock::now();
+    std::vector<batched_push_input> inputs(q_descs.size());
+    std::unordered_set<std::string> queue_names;
+    for (std::uint32_t i = 0; i < inputs.size(); i++) {
+        const tt::tt_dram_io_desc &q_desc = q_descs.at(i);
+        // A queue pushed twice would see its own unpublished writes as free space
+        log_assert(queue_names.insert(q_desc.queue_name).second, "Queue {} is pushed more than once in a batched push", q_desc.queue_name);
+        inputs.at(i).q_desc = &q_desc;
+        inputs.at(i).py_tensor_desc = &py_tensor_descs.at(i);
+        inputs.at(i).index = i;
+        inputs.at(i).pipelined = can_pipeline_push(q_desc, py_tensor_descs.at(i), get_cluster(q_desc.netlist_path, q_desc.backend_type));
+    }
+    const tt::tt_dram_io_desc &first_desc = q_descs.front();
+    tt_cluster *first_cluster = get_cluster(first_desc.netlist_path, first_desc.backend_type);
+    if (first_desc.backend_type == DEVICE::Silicon) {
+        const tt_queue_info &queue_info = get_workload(first_desc.netlist_path)->queues.at(first_desc.queue_name).my_queue_info;
+        tt::cpuset::tt_cpuset_allocator::bind_thread_to_cpuset(first_cluster->get_cluster_desc(), queue_info.target_device);
+    }
+
+    // Converted inputs wait in host memory until written, which bounds how far conversion may run ahead of the writes
+    const std::uint32_t pipeline_depth = std::max(parse_env<std::uint32_t>("TT_BACKEND_PUSH_PIPELINE_DEPTH", tt_task_scheduler::get().get_num_threads() + 1), 1u);
+    std::vector<pending_wptr_update> wptr_updates;
+    batched_push_conversions conversions;
+    std::uint32_t next_conversion = 0;
+    const auto get_device_id = [](const batched_push_input &input) {
+        return static_cast<uint>(get_workload(input.q_desc->netlist_path)->queues.at(input.q_desc->queue_name).my_queue_info.target_device);
+    };
+    const auto submit_conversions = [&](const std::uint32_t until) {
+        for (; next_conversion < std::min<std::uint32_t>(until, inputs.size()); next_conversion++) {
+            if (inputs.at(next_conversion).pipelined) {
+                conversions.submit(inputs.at(next_conversion), get_device_id(inputs.at(next_conversion)));
+            }
+        }
+    };
+
+    for (batched_push_input &input : inputs) {
+        // Keeps the scheduler converting the next inputs while this one is written
+        submit_conversions(input.index + 1 + pipeline_depth);
+        if (!input.pipelined) {
+            log_debug(tt::LogIO, "Batched push falls back to a single queue push for {}", input.q_desc->queue_name);
+            push_input_to_device(*input.q_desc, *input.py_tensor_desc, push_one, timeout_in_seconds);
+            continue;
+        }
+        conversions.wait([&input] { return input.converted.load(std::memory_order_acquire); });
+        if (input.exception) {
+            std::rethrow_exception(input.exception);
+        }
+        {
+            perf::ScopedEventProfiler profile(perf::get_event_id(perf::HostEventType::PUSH_INPUTS_WRITE, get_device_id(input), input.index));
+            write_converted_input(start_time, *input.q_desc, input.tilized_tensor, timeout_in_seconds, wptr_updates);
+        }
+    }
+
+    perf::ScopedEventProfiler profile(perf::HostEventType::PUSH_INPUTS_FLUSH);
+    flush_wptr_updates(wptr_updates);
+    return true;
+}
+
 bool pop_output_from_device(const tt::tt_dram_io_desc &q_desc, const bool pop_one, const int timeout_in_seconds) {
     perf::ScopedEventProfiler profile(perf::HostEventType::POP_OUTPUT);
     tt_runtime_workload &workload = *get_workload(q_desc.netlist_path);
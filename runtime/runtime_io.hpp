@@ -37,11 +37,18 @@ void free_object_cache();
 // --------------------------------------------------------------------------------------
 bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_TilizedTensorDesc &tilized_tensor, const int timeout_in_seconds, const int ptr = -1);
 bool push_input_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, const bool push_one, const int timeout_in_seconds, const int ptr = -1);
+// Pushes the inputs of a step to their queues. Later inputs are tilized on the task scheduler while earlier ones are
+// written, and the wptrs of all queues are published together once every write is done.
+bool push_inputs_to_device(const std::vector<tt::tt_dram_io_desc> &q_descs, const std::vector<tt::tt_PytorchTensorDesc> &py_tensor_descs, const bool push_one, const int timeout_in_seconds);
+// Pushes a constant or parameter tensor through the tilized tensor cache if it is enabled, skipping tilization on a hit
+bool push_parameter_to_device(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, const int timeout_in_seconds, const int ptr = -1);
 template<typename T>
 void binarize_tensor(const T& tensor, const std::string& file_path);
 template<typename T>
 void debinarize_tensor(T& tensor, const std::string& file_path);
 tt::tt_TilizedTensorDesc tilize_tensor(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc);
+// Tilizes into packed_data, which the returned descriptor points to, instead of workload owned memory
+tt::tt_TilizedTensorDesc tilize_tensor_to_buffer(const tt::tt_dram_io_desc &q_desc, const tt::tt_PytorchTensorDesc &py_tensor_desc, std::vector<uint32_t> &packed_data);
 bool pop_output_from_device(const tt::tt_dram_io_desc &q_desc, const bool pop_one, const int timeout_in_seconds);
 bool get_output_from_device(const tt::tt_dram_io_desc &q_desc, tt::tt_PytorchTensorDesc &py_tensor_desc, const bool get_one, const int timeout_in_seconds, const int ptr = -1);
 
@@ -50,6 +57,9 @@ bool get_output_from_device(const tt::tt_dram_io_desc &q_desc, tt::tt_PytorchTen
 // --------------------------------------------------------------------------------------
 
 bool is_queue_empty(const tt_dram_io_desc& desc, const tt_queue_info &queue_info, tt_cluster *cluster);
+// Whether a push/get of the given number of entries can proceed without waiting
+bool is_input_queue_freed(const tt::tt_dram_io_desc &q_desc, const int push_count);
+bool is_output_queue_populated(const tt::tt_dram_io_desc &q_desc, const int num_entries);
 bool is_host_queue_empty(const tt_dram_io_desc &desc);
 bool is_dram_queue_empty(const tt_dram_io_desc& desc, const tt_queue_info &queue_info, tt_cluster *cluster);
 
@@ -64,6 +74,10 @@ std::vector<uint32_t> pop_untilized_vector(const tt_dram_io_desc &desc, const tt
 void push_queue_tilized_input(const tt_queue_info &queue_info, tt_tensor &input_tensor, tt_cluster *cluster,  const int timeout_in_seconds, int ram_ptr = -1, Dim ublock_scan = Dim::R);
 tt_tensor pop_queue_tilized_output(const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr = -1);
 tt_tensor pop_queue_tilized_output_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, Dim ublock_scan, const int timeout_in_seconds, int ram_ptr = -1);
+void read_tilized_output_from_dram(const tt_queue_info &queue_info, tt_cluster *cluster, bool update_rdptr, int pop_count, const int timeout_in_seconds, int ram_ptr, const std::function<void(const std::uint32_t *, std::size_t, int)> &unpack_batch);
+void read_tilized_output_from_sysmem(const tt_dram_io_desc &desc, const tt_queue_info &queue_info, bool update_rdptr, int pop_count, const int timeout_in_seconds, int ram_ptr, const std::function<void(const std::uint32_t *, std::size_t, int)> &unpack_batch);
+bool can_untilize_bfp_batch_directly(const tt_dram_io_desc &desc, const tt_queue_info &queue_info);
+void untilize_bfp_batch_to_row_major(const tt_queue_info &queue_info, const std::uint32_t *batch, const std::size_t batch_words, const int buf_index, const int pop_count, const Dim ublock_scan, uint16_t *dst);
 
 // --------------------------------------------------------------------------------------
 //! Cpp test environment IO methods
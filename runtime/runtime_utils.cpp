@@ -9,6 +9,7 @@
 
 #include "blobgen2.h"
 #include "client/pipegen2_client.h"
+#include "net2pipe.h"
 #include "pipegen2_exceptions.h"
 #include "pipegen2_location_utils.h"
 #include "utils/scoped_timer.hpp"
@@ -60,6 +61,31 @@ void run_net2pipe(const string &netlist, const string &build_dir_path, const int
     }
 }
 
+void run_net2pipe(const netlist_parser &parsed_netlist, const string &build_dir_path, const int global_epoch_start,
+                  const string &soc_descriptor_path, const string &network_desc_path,
+                  std::unordered_map<int, pipegen2::PipeGraphDescription> &pipegen_graphs,
+                  tt_overlay_compile_result& overlay_compile_result) {
+    try {
+        PROFILE_SCOPE_MS();
+        log_debug(tt::LogRuntime, "Run net2pipe in process, output_dir={}, global_epoch_start={}", build_dir_path, global_epoch_start);
+
+        if (!fs::exists(build_dir_path)) {
+            fs::create_directories(build_dir_path);
+        }
+        try {
+            Net2Pipe net2pipe(parsed_netlist, build_dir_path, global_epoch_start, soc_descriptor_path, network_desc_path);
+            net2pipe.keep_pipegen_graphs_in_memory(parse_env("TT_BACKEND_DUMP_PIPEGEN_YAML", false));
+            net2pipe.output_pipes();
+            pipegen_graphs = net2pipe.take_pipegen_graphs();
+        } catch (std::exception &e) {
+            // Same wording as the subprocess path, which compile result population keys on
+            log_fatal("Running net2pipe command failed: in process, error_message: {}", e.what());
+        }
+    } catch (std::exception& e) {
+        populate_compile_result_from_string_net2pipe(&overlay_compile_result, e.what());
+    }
+}
+
 void generate_sdesc_yaml_for_overlay_compile(std::set<chip_id_t> chips, tt::ARCH arch_name, bool noc_trans_en){
     YAML::Node device_descs;
     for(auto it = chips.begin(); it != chips.end(); it++)
@@ -106,11 +132,12 @@ std::unique_ptr<pipegen2::StreamGraphCollection> run_pipegen2(const string &desc
                                                               const uint32_t perf_dump_info,
                                                               const std::unordered_map<chip_id_t, buda_soc_description> &sdesc_per_chip,
                                                               tt_compile_result_per_epoch &compile_result,
-                                                              perf::MemoryProfiler* memory_profiler) {
+                                                              perf::MemoryProfiler* memory_profiler,
+                                                              const pipegen2::PipeGraphDescription* pipe_graph_description) {
 
     try {
         pipegen2::Pipegen2Client pipegen2_client(desc_name, pipegen_yaml_path, blob_yaml_path, temporal_epoch,
-                                                 perf_dump_info);
+                                                 perf_dump_info, pipe_graph_description);
 
         std::unique_ptr<pipegen2::StreamGraphCollection> stream_graph = pipegen2_client.run_pipegen2();
 
@@ -140,10 +167,22 @@ void run_blobgen2(const string &desc_name,
                   const int temporal_epoch,
                   const string &blob_out_dir,
                   tt_compile_result_per_epoch &compile_result,
-                  const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph) {
+                  const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph,
+                  tt_overlay_blob_images &overlay_blobs) {
 
     try {
-        blobgen2::Blobgen2::create_and_output_blobs(std::move(stream_graphs), desc_name, perf_dump_info, temporal_epoch, blob_out_dir);
+        const string container_path = get_overlay_blob_container_path(blob_out_dir, temporal_epoch);
+        const bool write_container = parse_env("TT_BACKEND_OVERLAY_BLOB_CONTAINER", true);
+        // Without the container, hex files are what later runs reusing the build directory load
+        const bool dump_hex = parse_env("TT_BACKEND_DUMP_OVERLAY_HEX", false) or !write_container;
+        overlay_blobs = blobgen2::Blobgen2::create_blob_images(
+            std::move(stream_graphs), desc_name, perf_dump_info, temporal_epoch, dump_hex ? blob_out_dir : "");
+        if (write_container) {
+            write_overlay_blob_container(container_path, overlay_blobs);
+        } else {
+            // The loader prefers a container over hex files, so one left by an earlier compile must go
+            fs::remove(container_path);
+        }
     } catch(const std::exception &ex) {
         // TODO: Add blobgen specific exceptions.
         log_error("Blobgen2 internal error : {}", ex.what());
@@ -161,7 +200,9 @@ void run_pipegen_and_blobgen(
     const std::unordered_map<chip_id_t, buda_soc_description> &sdesc_per_chip,
     tt_compile_result_per_epoch &compile_result,
     perf::MemoryProfiler* memory_profiler,
-    const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph) {
+    const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph,
+    tt_overlay_blob_images &overlay_blobs,
+    const pipegen2::PipeGraphDescription* pipe_graph_description) {
 
     string root = buda_home();
     string build_graph_dir = get_overlay_output_dir(build_dir_path, temporal_epoch);
@@ -176,14 +217,15 @@ void run_pipegen_and_blobgen(
     }
 
     // Pipegen2 can be run as a library or as a command line tool. The library is used by default.
+    // With net2pipe run in process, its buffers and pipes are handed over directly rather than read from build_graph_dir.
     std::unique_ptr<pipegen2::StreamGraphCollection> stream_graphs = run_pipegen2(
         desc_name, pipegen_yaml_path, graph_name, temporal_epoch, blob_yaml_path, perf_dump_info,
-        sdesc_per_chip, compile_result, memory_profiler);
+        sdesc_per_chip, compile_result, memory_profiler, pipe_graph_description);
 
     // Blobgen should be ran only if pipegen was run successfully.
     if (compile_result.success) {
         run_blobgen2(desc_name, std::move(stream_graphs), perf_dump_info, temporal_epoch,
-                     blob_out_dir, compile_result, global_epoch_device_to_graph);
+                     blob_out_dir, compile_result, global_epoch_device_to_graph, overlay_blobs);
     }
 }
 
@@ -12,6 +12,7 @@
 #include "common/base.hpp"
 #include "common/env_lib.hpp"
 #include "device/device_api.h"
+#include "loader/overlay_blob_container.hpp"
 #include "runtime_io.hpp"
 #include "perf_lib/perf_descriptor.hpp"
 #include "runtime_types.hpp"
@@ -32,6 +33,8 @@ class BasePipegen2CompileException;
 class BasePipegen2IOException;
 struct L1BufferAllocationInfo;
 class StreamGraphCollection;
+struct PipeGraphNodeDescription;
+using PipeGraphDescription = std::vector<PipeGraphNodeDescription>;
 
 }
 
@@ -39,12 +42,20 @@ namespace perf {
     class MemoryProfiler;
 }
 
+class netlist_parser;
+
 namespace tt {
 
 void pause(const string &msg="");
 void run_net2pipe(const string &netlist, const string &build_dir_path, const int global_epoch_start,
                   const string &soc_descriptor_path, const string &network_desc_path,
                   tt_overlay_compile_result& overlay_compile_result);
+// Runs net2pipe in process on an already parsed netlist. Buffers and pipes of each pipegen graph are returned in
+// pipegen_graphs keyed by global epoch id, pipegen.yaml files are only written if TT_BACKEND_DUMP_PIPEGEN_YAML is set.
+void run_net2pipe(const netlist_parser &parsed_netlist, const string &build_dir_path, const int global_epoch_start,
+                  const string &soc_descriptor_path, const string &network_desc_path,
+                  std::unordered_map<int, pipegen2::PipeGraphDescription> &pipegen_graphs,
+                  tt_overlay_compile_result& overlay_compile_result);
 std::unique_ptr<pipegen2::StreamGraphCollection> run_pipegen2(const string &desc_name,
                                                               const string &pipegen_yaml_path,
                                                               const std::string &graph_name,
@@ -53,21 +64,28 @@ std::unique_ptr<pipegen2::StreamGraphCollection> run_pipegen2(const string &desc
                                                               const uint32_t perf_dump_info,
                                                               const std::unordered_map<chip_id_t, buda_soc_description> &sdesc_per_chip,
                                                               tt_compile_result_per_epoch &compile_result,
-                                                              perf::MemoryProfiler* memory_profiler);
+                                                              perf::MemoryProfiler* memory_profiler,
+                                                              const pipegen2::PipeGraphDescription* pipe_graph_description = nullptr);
+// Overlay blobs are returned in overlay_blobs as binary images, and cached in blob_out_dir as a binary container unless
+// TT_BACKEND_OVERLAY_BLOB_CONTAINER is disabled. Per core hex files are only written if TT_BACKEND_DUMP_OVERLAY_HEX is
+// set or the container is disabled.
 void run_blobgen2(const string &desc_name,
                   std::unique_ptr<pipegen2::StreamGraphCollection> stream_graphs,
                   const uint32_t perf_dump_info,
                   const int temporal_epoch,
                   const string &blob_out_dir,
                   tt_compile_result_per_epoch &compile_result,
-                  const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph);
+                  const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph,
+                  tt_overlay_blob_images &overlay_blobs);
 void run_pipegen_and_blobgen(const string &build_dir_path, const std::string &graph_name, int temporal_epoch,
                              const std::vector<chip_id_t> &chip_ids, const perf::PerfDesc &perf_desc,
                              const string &desc_name,
                              const std::unordered_map<chip_id_t, buda_soc_description> &sdesc_per_chip,
                              tt_compile_result_per_epoch &compile_result, 
                              perf::MemoryProfiler* memory_profiler,
-                             const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph);
+                             const std::unordered_map<uint32_t, std::unordered_map<chip_id_t, std::string>>& global_epoch_device_to_graph,
+                             tt_overlay_blob_images &overlay_blobs,
+                             const pipegen2::PipeGraphDescription* pipe_graph_description = nullptr);
 void handle_pipegen2_compile_exception(const pipegen2::BasePipegen2CompileException &ex,
                                        const std::string &graph_name,
                                        const int temporal_epoch,
@@ -112,12 +112,10 @@ void tt_runtime_workload::check_program(string prog_name) {
 }
 
 // Consider rename to bind_queue_settings , unbind_queue_settings
-void tt_runtime_workload::bind_queue_field_vars(std::vector<tt_queue_setting_info> &queue_settings, string prog_name) {
-    vector<tt_queue_setting_info>::iterator it;
-    netlist_program &program = get_program(prog_name);
+void tt_runtime_workload::bind_queue_field_vars(const std::vector<tt_queue_setting_info> &queue_settings, const string &prog_name) {
     tt_runtime_queue_ptrs_wrap &qptrs_wrap = get_qptrs_wrap(prog_name);
-    for (it = queue_settings.begin(); it != queue_settings.end(); ++it) {
-        string queue_name = it->name;
+    for (auto it = queue_settings.begin(); it != queue_settings.end(); ++it) {
+        const string &queue_name = it->name;
         qptrs_wrap.map_queue_field_var(tt_queue_header_field::GlobalRdptr, queue_name, it->rd_ptr_global);
         qptrs_wrap.map_queue_field_var(tt_queue_header_field::GlobalWrptr, queue_name, it->wr_ptr_global);
         qptrs_wrap.map_queue_field_var(tt_queue_header_field::LocalRdptr,  queue_name, it->rd_ptr_local);
@@ -611,21 +609,25 @@ void tt_runtime_workload::deallocate_memory(void* ptr) {
     }
 }
 /* Only return queue settings when called for the first execute of the temporal epoch */
-vector<tt_queue_setting_info> tt_runtime_workload::collect_temporal_epoch_instance_queue_settings(netlist_program &program, int target_device) {
+vector<tt_queue_setting_info> tt_runtime_workload::collect_temporal_epoch_instance_queue_settings(
+    netlist_program &program, int target_device, const std::vector<const tt_queue_info *> &queue_handles) {
 
     auto queue_settings = vector<tt_queue_setting_info>();
     auto execute_statements = this->get_execute_statements_belonging_to_current_temporal_graph_instance(program);
-    std::unordered_set<std::string> visited_queue_names = {};
+    std::vector<bool> visited_queues(queue_handles.size(), false);
 
     for (const auto execute_statement_index : execute_statements) {
         const auto &exec_instrn = program.get_program_trace().at(execute_statement_index);
-        for (const auto &queue_setting : exec_instrn.queue_settings) {
-            auto &queue_info = queues.at(queue_setting.name).my_queue_info;
+        const std::vector<int> &exec_queue_handles = program.get_queue_handles(execute_statement_index);
+        for (std::size_t i = 0; i < exec_instrn.queue_settings.size(); i++) {
+            const int queue_handle = exec_queue_handles.at(i);
+            const tt_queue_info *queue_info = queue_handles.at(queue_handle);
+            log_assert(queue_info != nullptr, "Queue settings refer to queue={} which is not in the netlist", exec_instrn.queue_settings[i].name);
             // Filter queue settings that are targeting queues on current execute instruction's device.
-            if (queue_info.target_device == target_device){
-                if (visited_queue_names.find(queue_setting.name) == visited_queue_names.end()) {
-                    queue_settings.push_back(queue_setting);
-                    visited_queue_names.insert(queue_setting.name);
+            if (queue_info->target_device == target_device){
+                if (!visited_queues[queue_handle]) {
+                    queue_settings.push_back(exec_instrn.queue_settings[i]);
+                    visited_queues[queue_handle] = true;
                 }
             }
         }
@@ -123,7 +123,7 @@ class tt_runtime_workload : public netlist_workload_data
     std::string get_op_name(const string& graph_name, const tt_xy_pair& logical_core_xy);
 
     //! Queue state management
-    void bind_queue_field_vars(std::vector<tt_queue_setting_info> &queue_settings, string prog_name);
+    void bind_queue_field_vars(const std::vector<tt_queue_setting_info> &queue_settings, const string &prog_name);
     void unbind_queue_field_vars(string queue_name, string prog_name);
     void add_pending_update_queues(string prog_name, string var_name);
     void add_pending_varinst_update_queues(string prog_name, tt_instruction_info instrn, tt_queue_varinst_update_field_mask update_type_mask);
@@ -139,7 +139,8 @@ class tt_runtime_workload : public netlist_workload_data
     std::shared_ptr<std::vector<uint32_t>> allocate_untilized_memory(std::string q_name, int num_entries);
     std::shared_ptr<std::vector<uint32_t>> allocate_tilized_memory(const std::string& q_name, uint32_t num_entries);
     void deallocate_memory(void* ptr);
-    std::vector<tt_queue_setting_info> collect_temporal_epoch_instance_queue_settings(netlist_program &program, int target_device);
+    std::vector<tt_queue_setting_info> collect_temporal_epoch_instance_queue_settings(
+        netlist_program &program, int target_device, const std::vector<const tt_queue_info *> &queue_handles);
     std::set<string> collect_output_e2e_queues(string graph_name);
     std::set<string> collect_pending_dealloc_queues(set<int> &target_devices);
     std::set<int> collect_output_e2e_devices(string graph_name);
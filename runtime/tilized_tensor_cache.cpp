@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "runtime/tilized_tensor_cache.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "common/disk_cache_lib.hpp"
+#include "common/env_lib.hpp"
+#include "common/tt_parallel_for.h"
+#include "device/cpuset_lib.hpp"
+#include "utils/logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tt::io {
+
+namespace {
+
+constexpr char ENTRY_MAGIC[8] = {'T', 'T', 'T', 'I', 'L', 'C', 'A', 'C'};
+// Bump whenever the tilized layout or the entry encoding changes, older entries then miss
+constexpr std::uint32_t ENTRY_VERSION = 1;
+const std::string ENTRY_EXTENSION = ".tilized";
+// Tensor contents are hashed in chunks of this size in parallel
+constexpr std::size_t HASH_CHUNK_SIZE = 4 << 20;
+
+struct entry_header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t format;
+    std::uint32_t num_buffers;
+    std::uint32_t buf_size_bytes;
+};
+
+// Bytes spanned by a (possibly strided) host tensor
+std::size_t get_tensor_extent_bytes(const tt_PytorchTensorDesc &py_tensor_desc) {
+    std::size_t extent = py_tensor_desc.itemsize;
+    for (int i = 0; i < PY_TENSOR_DIMS; i++) {
+        if (py_tensor_desc.shape[i] == 0) {
+            return 0;
+        }
+        extent += static_cast<std::size_t>(py_tensor_desc.shape[i] - 1) * py_tensor_desc.strides[i];
+    }
+    return extent;
+}
+
+}  // namespace
+
+tt_tilized_tensor_cache::tt_tilized_tensor_cache(const std::string &cache_dir, std::uint64_t max_size_bytes) :
+    cache_dir(cache_dir), max_size_bytes(max_size_bytes) {
+    fs::create_directories(cache_dir);
+}
+
+tt_tilized_tensor_cache *tt_tilized_tensor_cache::get() {
+    static const std::unique_ptr<tt_tilized_tensor_cache> cache = []() -> std::unique_ptr<tt_tilized_tensor_cache> {
+        const std::string cache_dir = parse_env<std::string>("TT_BACKEND_TILIZED_TENSOR_CACHE_DIR", "");
+        if (cache_dir.empty()) {
+            return nullptr;
+        }
+        const std::uint64_t max_size_mb = parse_env<std::uint64_t>("TT_BACKEND_TILIZED_TENSOR_CACHE_MAX_MB", 16384);
+        log_debug(tt::LogIO, "Tilized tensor cache at {}, limited to {} MB", cache_dir, max_size_mb);
+        return std::make_unique<tt_tilized_tensor_cache>(cache_dir, max_size_mb << 20);
+    }();
+    return cache.get();
+}
+
+bool tt_tilized_tensor_cache::is_cacheable(const tt_dram_io_desc &q_desc) {
+    // Flat queues are pushed as raw host data without tilizing
+    return q_desc.layout != IO_LAYOUT::Flat and q_desc.s_descriptor.stride <= 0;
+}
+
+std::string tt_tilized_tensor_cache::get_key(const tt_dram_io_desc &q_desc, const tt_PytorchTensorDesc &py_tensor_desc, const std::string &arch, const std::string &ublock_scan) const {
+    disk_cache::content_hasher hasher;
+    hasher.update_value(ENTRY_VERSION);
+    hasher.update(arch);
+
+    // Queue layout, everything the tilizer reads from the descriptor except the buffer addresses
+    for (std::uint32_t value : {q_desc.bufq_grid_dim_r, q_desc.bufq_grid_dim_c, q_desc.ublock_rt, q_desc.ublock_ct, q_desc.mblock_m, q_desc.mblock_n,
+                                q_desc.tile_height, q_desc.tile_width, q_desc.t, q_desc.hstack_factor, q_desc.vstack_factor,
+                                static_cast<std::uint32_t>(q_desc.stack_row_major), static_cast<std::uint32_t>(q_desc.bufq_target_format),
+                                static_cast<std::uint32_t>(q_desc.layout)}) {
+        hasher.update_value(value);
+    }
+    hasher.update(ublock_scan);
+
+    // Host tensor layout and contents
+    hasher.update_value(static_cast<std::uint32_t>(py_tensor_desc.format));
+    hasher.update_value(py_tensor_desc.itemsize);
+    hasher.update_value(py_tensor_desc.dim);
+    for (int i = 0; i < PY_TENSOR_DIMS; i++) {
+        hasher.update_value(py_tensor_desc.shape[i]);
+        hasher.update_value(py_tensor_desc.strides[i]);
+    }
+    const auto *data = static_cast<const std::uint8_t *>(py_tensor_desc.ptr);
+    const std::size_t size = get_tensor_extent_bytes(py_tensor_desc);
+    std::vector<disk_cache::content_hash> chunk_hashes((size + HASH_CHUNK_SIZE - 1) / HASH_CHUNK_SIZE);
+    tt::parallel_for(0, static_cast<int>(chunk_hashes.size()), [&](int chunk) {
+        const std::size_t offset = chunk * HASH_CHUNK_SIZE;
+        chunk_hashes[chunk] = disk_cache::hash_bytes(data + offset, std::min(HASH_CHUNK_SIZE, size - offset));
+    }, tt::cpuset::get_allowed_num_threads());
+    for (const disk_cache::content_hash &hash : chunk_hashes) {
+        hasher.update(hash);
+    }
+    return hasher.hex();
+}
+
+std::string tt_tilized_tensor_cache::get_entry_path(const std::string &key) const {
+    return (fs::path(cache_dir) / (key + ENTRY_EXTENSION)).string();
+}
+
+bool tt_tilized_tensor_cache::load(const std::string &key, const std::function<void(const tt_TilizedTensorDesc &)> &use) {
+    const std::string path = get_entry_path(key);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        num_misses++;
+        return false;
+    }
+    struct stat file_stat;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &file_stat) == 0 and static_cast<std::size_t>(file_stat.st_size) >= sizeof(entry_header)) {
+        data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    }
+    close(fd);
+    if (data == MAP_FAILED) {
+        num_misses++;
+        return false;
+    }
+
+    entry_header header;
+    std::memcpy(&header, data, sizeof(header));
+    const bool valid = std::memcmp(header.magic, ENTRY_MAGIC, sizeof(header.magic)) == 0 and header.version == ENTRY_VERSION and
+                       sizeof(header) + static_cast<std::uint64_t>(header.num_buffers) * header.buf_size_bytes == static_cast<std::uint64_t>(file_stat.st_size);
+    if (!valid) {
+        log_warning(tt::LogIO, "Ignoring invalid tilized tensor cache entry {}", path);
+        munmap(data, file_stat.st_size);
+        num_misses++;
+        return false;
+    }
+
+    tt_TilizedTensorDesc tilized_tensor(
+        static_cast<const std::uint8_t *>(data) + sizeof(header), header.num_buffers, header.buf_size_bytes, static_cast<DataFormat>(header.format));
+    try {
+        use(tilized_tensor);
+    } catch (...) {
+        munmap(data, file_stat.st_size);
+        throw;
+    }
+    munmap(data, file_stat.st_size);
+
+    disk_cache::touch(path);
+    num_hits++;
+    num_bytes_loaded += file_stat.st_size;
+    return true;
+}
+
+void tt_tilized_tensor_cache::store(const std::string &key, const tt_TilizedTensorDesc &tilized_tensor) {
+    entry_header header = {};
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(header.magic));
+    header.version = ENTRY_VERSION;
+    header.format = static_cast<std::uint32_t>(tilized_tensor.format);
+    header.num_buffers = tilized_tensor.num_buffers;
+    header.buf_size_bytes = tilized_tensor.buf_size_bytes;
+
+    // Written under a unique name and renamed into place, so concurrent readers never see a partial entry
+    const std::string path = get_entry_path(key);
+    const std::string staging_path = disk_cache::get_staging_path(path).string();
+    {
+        std::ofstream file(staging_path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(static_cast<const char *>(tilized_tensor.ptr), static_cast<std::uint64_t>(tilized_tensor.num_buffers) * tilized_tensor.buf_size_bytes);
+        if (!file.good()) {
+            log_warning(tt::LogIO, "Failed to write tilized tensor cache entry {}", staging_path);
+            file.close();
+            std::error_code ec;
+            fs::remove(staging_path, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    fs::rename(staging_path, path, ec);
+    if (ec) {
+        log_warning(tt::LogIO, "Failed to publish tilized tensor cache entry {}: {}", path, ec.message());
+        fs::remove(staging_path, ec);
+        return;
+    }
+    evict();
+}
+
+bool tt_tilized_tensor_cache::load_or_tilize(
+    const std::string &key,
+    const std::function<tt_TilizedTensorDesc(std::vector<std::uint32_t> &)> &tilize,
+    const std::function<void(const tt_TilizedTensorDesc &)> &use) {
+    if (load(key, use)) {
+        return true;
+    }
+    std::vector<std::uint32_t> packed_data;
+    const tt_TilizedTensorDesc tilized_tensor = tilize(packed_data);
+    store(key, tilized_tensor);
+    use(tilized_tensor);
+    return false;
+}
+
+void tt_tilized_tensor_cache::evict() {
+    num_evictions += disk_cache::evict_least_recently_used(cache_dir, max_size_bytes, [](const fs::directory_entry &entry) {
+        return entry.is_regular_file() and entry.path().extension() == ENTRY_EXTENSION;
+    }, tt::LogIO);
+}
+
+void tt_tilized_tensor_cache::report_stats() const {
+    log_info(
+        tt::LogIO,
+        "Tilized tensor cache {}: {} hits ({} MB pushed as is), {} misses, {} evicted",
+        cache_dir,
+        num_hits.load(),
+        num_bytes_loaded.load() >> 20,
+        num_misses.load(),
+        num_evictions.load());
+}
+
+}  // namespace tt::io
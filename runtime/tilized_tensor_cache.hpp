@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "netlist/tt_backend_api_types.hpp"
+
+namespace tt::io {
+
+// Persistent cache of the device layout of constant and parameter tensors, shared across runs and processes.
+//
+// Enabled by pointing TT_BACKEND_TILIZED_TENSOR_CACHE_DIR at a directory. Entries hold the output of the offline
+// tilizer (tt::io::tilize_tensor_to_buffer) and are keyed by a hash of the host tensor contents and layout, the queue
+// layout and the device arch, so a hit can be pushed to DRAM as is. Least recently used entries are evicted once the
+// cache grows past TT_BACKEND_TILIZED_TENSOR_CACHE_MAX_MB (16384 by default).
+class tt_tilized_tensor_cache {
+   public:
+    tt_tilized_tensor_cache(const std::string &cache_dir, std::uint64_t max_size_bytes);
+
+    // Returns the process wide cache configured through the environment, or nullptr if caching is disabled
+    static tt_tilized_tensor_cache *get();
+    // Only tensors going through the offline tilizer unchanged can be cached, prestrided (conv) inputs are shuffled first
+    static bool is_cacheable(const tt_dram_io_desc &q_desc);
+
+    std::string get_key(const tt_dram_io_desc &q_desc, const tt_PytorchTensorDesc &py_tensor_desc, const std::string &arch, const std::string &ublock_scan) const;
+    // Calls use with a view of the cached tensor, which is only valid during the call. Returns false on a miss.
+    bool load(const std::string &key, const std::function<void(const tt_TilizedTensorDesc &)> &use);
+    void store(const std::string &key, const tt_TilizedTensorDesc &tilized_tensor);
+    // Calls use with the cached tensor, or on a miss with the tensor tilize writes into a scratch buffer that is stored
+    // and released once use returns. Returns whether it was a hit.
+    bool load_or_tilize(
+        const std::string &key,
+        const std::function<tt_TilizedTensorDesc(std::vector<std::uint32_t> &)> &tilize,
+        const std::function<void(const tt_TilizedTensorDesc &)> &use);
+    // Removes least recently used entries until the cache fits its size limit
+    void evict();
+    void report_stats() const;
+
+   private:
+    std::string cache_dir;
+    std::uint64_t max_size_bytes;
+
+    std::atomic<std::uint32_t> num_hits = 0;
+    std::atomic<std::uint32_t> num_misses = 0;
+    std::atomic<std::uint32_t> num_evictions = 0;
+    std::atomic<std::uint64_t> num_bytes_loaded = 0;
+
+    std::string get_entry_path(const std::string &key) const;
+};
+
+}  // namespace tt::io
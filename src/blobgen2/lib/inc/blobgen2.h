@@ -5,6 +5,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "model/typedefs.h"
 #include "overlay_blob/typedef.h"
@@ -52,15 +53,24 @@ public:
         const std::string& output_dir,
         const bool dump_debug_info = false);
 
+    // Generates the overlay blobs and returns them as packed binary images per core, which the epoch loader can take
+    // without going through hex files (see BlobData::get_binary_image). Hex files are still written to
+    // hex_output_dir for debugging if it is not empty.
+    static std::map<tt_cxy_pair, std::vector<uint32_t>> create_blob_images(
+        std::unique_ptr<StreamGraphCollection> stream_graphs,
+        const std::string& soc_descriptor_yaml_path,
+        const uint32_t dram_perf_info_arguments,
+        const int epoch_num,
+        const std::string& hex_output_dir = "",
+        const bool dump_debug_info = false);
+
 private:
-    // Main function, called from both public entry points. Glues other overlay_generation components together.
-    static void create_and_output_blobs_internal(
+    // Main function, called from all public entry points. Glues other overlay_generation components together.
+    static std::map<tt_cxy_pair, BlobData> create_blobs(
         std::unique_ptr<StreamGraphCollection> stream_graphs,
         const SoCHelper& soc_helper,
         const std::map<tt_cxy_pair, dram_perf_info_t>& dram_perf_info,
-        const int epoch_num,
-        const std::string& output_dir,
-        const bool dump_debug_info);
+        const int epoch_num);
 
     // Constructs a PerfManager and extracts vectors of dram_perf_info_t from it, needed by firmware.
     static std::map<tt_cxy_pair, dram_perf_info_t> get_perf_info_from_manager(
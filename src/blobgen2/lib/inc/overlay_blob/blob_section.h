@@ -111,6 +111,13 @@ public:
     // If debug is set to true, will produce non-functioning output, but will greatly aid in debugging.
     void print_out(std::ostream& os, const bool dump_debug_info) const;
 
+    // Copy the section into a packed binary image of the blob, which starts at L1 address image_address.
+    // The image is grown as needed, with any gap before the section zeroed.
+    void copy_to_image(std::vector<uint32_t>& image, const uint32_t image_address) const;
+
+    // Get the L1 address this section will be written to.
+    uint32_t get_address() const { return m_address; }
+
 private:
     // Used exclusively for merging two blob sections.
     uint32_t get_dw_at(const int ind);
@@ -135,6 +142,10 @@ struct BlobData
         const tt_cxy_pair& core_location,
         const int epoch_num,
         const bool dump_debug_info) const;
+
+    // Packs the blob into the binary image that the epoch loader copies to DRAM: the blob words from the lowest L1
+    // address of the blob on, with gaps between sections zeroed. Same content as parsing the printed out hex file.
+    std::vector<uint32_t> get_binary_image() const;
 };
 
 }  // namespace blobgen2
@@ -29,13 +29,10 @@ void Blobgen2::create_and_output_blobs(
 {
     SoCHelper soc_helper(soc_descriptor_yaml_path, StreamGraphUtils::get_chip_ids(*stream_graphs));
 
-    create_and_output_blobs_internal(
-        std::move(stream_graphs),
-        soc_helper,
-        get_perf_info_from_manager(dram_perf_info_arguments, soc_helper),
-        epoch_num,
-        output_dir,
-        dump_debug_info);
+    std::map<tt_cxy_pair, BlobData> blobs = create_blobs(
+        std::move(stream_graphs), soc_helper, get_perf_info_from_manager(dram_perf_info_arguments, soc_helper), epoch_num);
+
+    output_blobs(blobs, output_dir, epoch_num, dump_debug_info);
 }
 
 void Blobgen2::create_and_output_blobs(
@@ -48,17 +45,43 @@ void Blobgen2::create_and_output_blobs(
 {
     SoCHelper soc_helper(soc_descriptor_yaml_path, StreamGraphUtils::get_chip_ids(*stream_graphs));
 
-    create_and_output_blobs_internal(
-        std::move(stream_graphs), soc_helper, dram_perf_info, epoch_num, output_dir, dump_debug_info);
+    std::map<tt_cxy_pair, BlobData> blobs = create_blobs(std::move(stream_graphs), soc_helper, dram_perf_info, epoch_num);
+
+    output_blobs(blobs, output_dir, epoch_num, dump_debug_info);
 }
 
-void Blobgen2::create_and_output_blobs_internal(
+std::map<tt_cxy_pair, std::vector<uint32_t>> Blobgen2::create_blob_images(
     std::unique_ptr<StreamGraphCollection> stream_graphs,
-    const SoCHelper& soc_helper,
-    const std::map<tt_cxy_pair, dram_perf_info_t>& dram_perf_info,
+    const std::string& soc_descriptor_yaml_path,
+    const uint32_t dram_perf_info_arguments,
     const int epoch_num,
-    const std::string& output_dir,
+    const std::string& hex_output_dir,
     const bool dump_debug_info)
+{
+    SoCHelper soc_helper(soc_descriptor_yaml_path, StreamGraphUtils::get_chip_ids(*stream_graphs));
+
+    std::map<tt_cxy_pair, BlobData> blobs = create_blobs(
+        std::move(stream_graphs), soc_helper, get_perf_info_from_manager(dram_perf_info_arguments, soc_helper), epoch_num);
+
+    if (!hex_output_dir.empty())
+    {
+        output_blobs(blobs, hex_output_dir, epoch_num, dump_debug_info);
+    }
+
+    std::map<tt_cxy_pair, std::vector<uint32_t>> blob_images;
+    for (const auto& [location, blob] : blobs)
+    {
+        blob_images.emplace(location, blob.get_binary_image());
+    }
+
+    return blob_images;
+}
+
+std::map<tt_cxy_pair, BlobData> Blobgen2::create_blobs(
+    std::unique_ptr<StreamGraphCollection> stream_graphs,
+    const SoCHelper& soc_helper,
+    const std::map<tt_cxy_pair, dram_perf_info_t>& dram_perf_info,
+    const int epoch_num)
 {
     EpochBlobData epoch_blob_data = StreamGraphUtils::get_epoch_blob_data(*stream_graphs, epoch_num);
 
@@ -78,10 +101,7 @@ void Blobgen2::create_and_output_blobs_internal(
         epoch_num,
         soc_helper);
 
-    std::map<tt_cxy_pair, BlobData> blobs =
-        BlobFiller::fill_blobs(epoch_allocators, epoch_blob_data, soc_helper, epoch_num);
-
-    output_blobs(blobs, output_dir, epoch_num, dump_debug_info);
+    return BlobFiller::fill_blobs(epoch_allocators, epoch_blob_data, soc_helper, epoch_num);
 }
 
 std::map<tt_cxy_pair, dram_perf_info_t> Blobgen2::get_perf_info_from_manager(
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "overlay_blob/blob_section.h"
 
+#include <cstring>
 #include <filesystem>
 
 #include "epoch.h"
@@ -375,6 +376,20 @@ void BlobSection::print_out(std::ostream& os, const bool dump_debug_info) const
     }
 }
 
+void BlobSection::copy_to_image(std::vector<uint32_t>& image, const uint32_t image_address) const
+{
+    log_assert(m_data.size() % 4 == 0, "Data that in a section is not 4 byte aligned {}", m_data.size());
+    log_assert(m_address >= image_address, "Blob section at {} starts before its image at {}", m_address, image_address);
+
+    const size_t offset = (m_address - image_address) / sizeof(uint32_t);
+    if (image.size() < offset + dw_size())
+    {
+        image.resize(offset + dw_size(), 0);
+    }
+    // Bytes are appended little endian, the same order print_out reverses them into for each hex word.
+    std::memcpy(image.data() + offset, m_data.data(), m_data.size());
+}
+
 // Ind is the normal index of the first byte of wanted dword.
 uint32_t BlobSection::get_dw_at(const int ind)
 {
@@ -432,4 +447,31 @@ void BlobData::print_out(
     file.close();
 }
 
+std::vector<uint32_t> BlobData::get_binary_image() const
+{
+    std::vector<uint32_t> image;
+    uint32_t image_address = 0;
+    uint32_t end_address = 0;
+    for (const auto& section : blob_sections)
+    {
+        // Empty sections print only an address line, which doesn't place any data.
+        if (section.size() == 0)
+        {
+            continue;
+        }
+        if (image.empty())
+        {
+            image_address = section.get_address();
+        }
+        log_assert(
+            section.get_address() >= end_address,
+            "Blob section at {} overlaps the previous one, which ends at {}",
+            section.get_address(),
+            end_address);
+        section.copy_to_image(image, image_address);
+        end_address = section.get_address() + section.size();
+    }
+    return image;
+}
+
 }  // namespace blobgen2
\ No newline at end of file
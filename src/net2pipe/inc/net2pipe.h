@@ -24,6 +24,7 @@
 #include "common/tt_parallel_for.h"
 #include "device/cpuset_lib.hpp"
 #include "unique_id_generator.h"
+#include "pipegen_graph_emitter.h"
 
 #define SET_KEY_VAL(key, val) YAML::Key << key << YAML::Value << val
 
@@ -130,7 +131,14 @@ class Net2Pipe {
 public:
 
   Net2Pipe(const std::string &netlist_file, const std::string &output_dir, const std::string &epoch_start, const std::string &soc_descriptor_list_file_path, const std::string &cluster_description_file="");
+  // Runs on a netlist which the caller (e.g. the runtime, in process) has already parsed.
+  Net2Pipe(const netlist_parser &parsed_netlist, const std::string &output_dir, int epoch_start, const std::string &soc_descriptor_list_file_path, const std::string &cluster_description_file="");
   void output_pipes();
+  // Keeps the buffers and pipes of each epoch's pipegen graph in memory, to be handed over to pipegen2 with
+  // take_pipegen_graphs(). When emit_files is false, pipegen.yaml files are not written at all.
+  void keep_pipegen_graphs_in_memory(bool emit_files);
+  // Releases the pipegen graphs kept by output_pipes(), keyed by global epoch id.
+  std::unordered_map<int, pipegen2::PipeGraphDescription> take_pipegen_graphs();
   void get_graph_names(std::vector<std::string> & names_vec);
 
 protected:
@@ -151,6 +159,9 @@ protected:
 
   std::string netlist_file;
   std::string output_dir;
+  bool keep_pipegen_graphs = false;
+  bool emit_pipegen_yaml_files = true;
+  std::unordered_map<int, pipegen2::PipeGraphDescription> pipegen_graphs;
   int starting_device_id;
   int ending_device_id;
   router::RouterConfig config;
@@ -169,7 +180,9 @@ protected:
   int program_counter;
   std::vector<int> variables = std::vector<int>(128);
 
-  netlist_parser parsed_netlist;
+  // Set when net2pipe parsed the netlist file itself, otherwise the caller's parsed netlist is used as is
+  std::unique_ptr<netlist_parser> owned_parsed_netlist;
+  const netlist_parser &parsed_netlist;
 
   std::set<chip_id_t> workload_target_device_ids;
 
@@ -194,7 +207,7 @@ protected:
   void build_padding_table();
   void emit_padding_table();
   std::unordered_map<DataFormat, std::unordered_map<float, uint32_t>> dram_pad_addr_table;
-  void emit_padding_buffers(YAML::Emitter &out_yaml, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const;
+  void emit_padding_buffers(n2p::PipegenGraphEmitter &out_yaml, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const;
 
   void run_router(int temporal_epoch, temporal_epoch_context& epoch_context, ClusterDescription cluster_description) const;
   void populate_buffer_info_map();
@@ -225,6 +238,7 @@ protected:
   void get_program_trace();
   void run_instruction(netlist_program &program);
 
+  void initialize(const std::string &soc_descriptor_list_file_path, const std::string &cluster_description_file_path);
   std::string create_temporal_epoch_output_directory(int temporal_epoch) const;
   void dump_yaml_to_file(YAML::Emitter const& out_yaml, const std::string &out_file_dir) const;
 
@@ -234,7 +248,7 @@ protected:
   void get_queue_consumer_map(std::map<router::unique_id_t, std::vector<router::unique_id_t>> inputs_to_output_pipes_map, temporal_epoch_context& epoch_context) const;
   void get_queue_producer_map(std::map<router::unique_id_t, std::vector<router::unique_id_t>> inputs_to_output_pipes_map, temporal_epoch_context& epoch_context) const;
   void dump_queue_to_core_map_to_file(const std::string& output_dir, bool queue_to_producer, const temporal_epoch_context& epoch_context) const;
-  void emit_pipes(YAML::Emitter &out_yaml, temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const;
+  void emit_pipes(n2p::PipegenGraphEmitter &out_yaml, temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const;
   void read_epoch_queue_info(const std::string &queue_name, int input_count, const QueueSettings& queue_setting, temporal_epoch_context& epoch_context) const;
   void collect_epoch_info(const std::vector<GraphExecVars> &graph_exec_vars, temporal_epoch_context& epoch_context) const;
   void register_pipe_as_output_of_buffers(std::uint64_t buffer_id, const std::vector<std::uint64_t> &buffer_ids, temporal_epoch_context& epoch_context) const;
@@ -245,10 +259,10 @@ protected:
   void collect_queue_input_pipes(const std::string &queue_name, temporal_epoch_context& epoch_context) const;
   void collect_op_input_pipes(const std::string &op_name, int input_count, temporal_epoch_context& epoch_context) const;
   void collect_pipe_info(const tt_graph_info &graph_info, temporal_epoch_context& epoch_context) const;
-  void emit_epoch(const GraphExecVars &graph_exec, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int temporal_epoch, std::map<std::string, bool> &op_queue_emitted, YAML::Emitter &out_yaml) const;
+  void emit_epoch(const GraphExecVars &graph_exec, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int temporal_epoch, std::map<std::string, bool> &op_queue_emitted, n2p::PipegenGraphEmitter &out_yaml) const;
   int get_queue_dram_subchannel(std::uint64_t q_buf_id, const temporal_epoch_context& epoch_context) const;
   bool is_target_device_downstream(int starting_device_id, int ending_device_id, int epoch_device, int target_device) const;
-  void emit_queue(YAML::Emitter& out, std::string queue_name, std::string graph_name, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int epoch_device, int input_count, const QueueSettings& queue_settings) const;
+  void emit_queue(n2p::PipegenGraphEmitter& out, std::string queue_name, std::string graph_name, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int epoch_device, int input_count, const QueueSettings& queue_settings) const;
   int compute_intermediate_buffer_size_tiles(const tt_op_info &op_info, int input_count, int int_id, int output_is_scatter, int output_size_tiles, int output_replicate) const;
   const unsigned int splice_op_input_size_tiles(const int input_index, const int mblock_size_tiles, const tt_op_info& op_info) const;
 
@@ -270,10 +284,10 @@ protected:
    */
   void naive_place_unplaced_ethernet_datacopy_ops(const std::string &op_name, const temporal_epoch_context& epoch_context) const;
   void collect_epoch_buffer_info(const tt_graph_info &graph_info, int input_count, temporal_epoch_context& epoch_context) const;
-  void emit_buffers(const tt_graph_info &graph_info, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int input_count, std::map<std::string, bool> &op_queue_emitted, YAML::Emitter &out_yaml) const;
-  void emit_relay_buffers(int runtime_input_count, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, YAML::Emitter& out) const;
-  void emit_kernel_bufs(YAML::Emitter& out,const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, const std::string &op_name, int input_count) const;
-  void emit_untilize_output(YAML::Emitter& out, const tt_op_info* op_info = NULL) const;
+  void emit_buffers(const tt_graph_info &graph_info, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, int input_count, std::map<std::string, bool> &op_queue_emitted, n2p::PipegenGraphEmitter &out_yaml) const;
+  void emit_relay_buffers(int runtime_input_count, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, n2p::PipegenGraphEmitter& out) const;
+  void emit_kernel_bufs(n2p::PipegenGraphEmitter& out,const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, const std::string &op_name, int input_count) const;
+  void emit_untilize_output(n2p::PipegenGraphEmitter& out, const tt_op_info* op_info = NULL) const;
 
   bool name_is_queue(std::string name) const;
   bool name_is_op(std::string name, const temporal_epoch_context& epoch_context) const;
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "io/pipe_graph_description.h"
+#include "yaml-cpp/yaml.h"
+
+namespace n2p {
+
+// Emits the pipegen graph of a temporal epoch. Net2pipe writes buffers and pipes as the same stream of yaml
+// manipulators and values it always did, which goes into pipegen.yaml text and/or into the buffer and pipe descriptions
+// pipegen2 takes directly when run in process, without any yaml in between.
+class PipegenGraphEmitter {
+   public:
+    PipegenGraphEmitter(bool emit_yaml, bool build_description);
+
+    PipegenGraphEmitter &operator<<(YAML::EMITTER_MANIP manip);
+    PipegenGraphEmitter &operator<<(const YAML::_Comment &comment);
+    PipegenGraphEmitter &operator<<(const std::string &value);
+    PipegenGraphEmitter &operator<<(const char *value);
+    PipegenGraphEmitter &operator<<(bool value);
+
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    PipegenGraphEmitter &operator<<(T value) {
+        if (this->emit_yaml) {
+            this->yaml << value;
+        }
+        if (this->build_description) {
+            add_value(pipegen2::PipeGraphAttributeValue::from_number(static_cast<std::int64_t>(value)));
+        }
+        return *this;
+    }
+
+    template <typename T>
+    PipegenGraphEmitter &operator<<(const std::vector<T> &values) {
+        *this << YAML::BeginSeq;
+        for (const T &value : values) {
+            *this << value;
+        }
+        return *this << YAML::EndSeq;
+    }
+
+    // Pipegen yaml emitted so far, empty unless emit_yaml was set.
+    const YAML::Emitter &get_yaml() const { return this->yaml; }
+
+    // Releases the buffers and pipes emitted so far, empty unless build_description was set.
+    pipegen2::PipeGraphDescription take_description();
+
+   private:
+    // Map or sequence which is open in the emitted stream.
+    struct OpenContainer {
+        bool is_map;
+        // Whether the next value in the map is a key
+        bool next_is_key = true;
+        // Last key emitted into the map
+        std::string key;
+        // Attributes of the buffer or pipe, when the map is a graph node
+        std::vector<std::pair<std::string, pipegen2::PipeGraphAttributeValue>> attributes;
+        // Elements of the sequence
+        pipegen2::PipeGraphAttributeValue list = pipegen2::PipeGraphAttributeValue::from_list();
+    };
+
+    // Adds a scalar value or a closed sequence into the open container.
+    void add_value(pipegen2::PipeGraphAttributeValue value);
+
+    bool emit_yaml;
+    bool build_description;
+    YAML::Emitter yaml;
+    pipegen2::PipeGraphDescription description;
+    // Top level map of each yaml document, then the graph node map, then sequences of the attribute value
+    std::vector<OpenContainer> open_containers;
+};
+
+}  // namespace n2p
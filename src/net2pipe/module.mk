@@ -3,16 +3,21 @@ NET2PIPE_SRCS = $(wildcard src/net2pipe/src/*.cpp)
 NET2PIPE_SRCS += $(wildcard src/net2pipe/src/router/*.cpp)
 NET2PIPE_SRCS += $(wildcard src/net2pipe/src/address_map_adaptors/l1/*.cpp)
 NET2PIPE = $(BINDIR)/net2pipe
+NET2PIPE_LIB = $(LIBDIR)/libnet2pipe.a
 
 NET2PIPE_OBJS = $(addprefix $(OBJDIR)/, $(NET2PIPE_SRCS:.cpp=.o))
 NET2PIPE_DEPS = $(addprefix $(OBJDIR)/, $(NET2PIPE_SRCS:.cpp=.d))
 
+# Runtime runs net2pipe in process, so everything but main goes into libtt as well
+NET2PIPE_LIB_OBJS = $(filter-out %/main.o, $(NET2PIPE_OBJS))
+
 NET2PIPE_OBJS += $(NETLIST_OBJS)
 NET2PIPE_DEPS += $(NETLIST_DEPS)
 
 NET2PIPE_INCLUDES = \
 	-I$(YAML_PATH) \
 	-I$(BUDA_HOME)/src/net2pipe/inc \
+	-I$(BUDA_HOME)/src/pipegen2/lib/inc \
 	-I$(BUDA_HOME)/netlist \
 	-I$(BUDA_HOME)/model \
 	-Iumd
@@ -44,6 +49,13 @@ endif
 # Each module has a top level target as the entrypoint which must match the subdir name
 src/net2pipe: $(NET2PIPE)
 
+$(NET2PIPE_LIB): $(NET2PIPE_LIB_OBJS)
+	@mkdir -p $(@D)
+	ar rcs -o $@ $(NET2PIPE_LIB_OBJS)
+
+# backend/module.mk is included before this file, so the archive is added to libtt's prerequisites here
+$(BACKEND_LIB): $(NET2PIPE_LIB)
+
 ALL_NET2PIPE_DEPENDENCY_OBJS = $(NET2PIPE_OBJS) $(OPS_LIB) $(MODEL_LIB) $(COMMON_LIB) $(NETLIST_LIB)
 
 $(NET2PIPE): $(ALL_NET2PIPE_DEPENDENCY_OBJS) $(UMD_DEVICE_LIB) $(BACKEND_LIB)
@@ -53,7 +65,7 @@ $(NET2PIPE): $(ALL_NET2PIPE_DEPENDENCY_OBJS) $(UMD_DEVICE_LIB) $(BACKEND_LIB)
 .PRECIOUS: $(OBJDIR)/src/net2pipe/%.o  
 $(OBJDIR)/src/net2pipe/%.o: src/net2pipe/%.cpp
 	@mkdir -p $(@D)
-	$(CXX) $(CFLAGS) $(CXXFLAGS) $(NET2PIPE_INCLUDES) $(NET2PIPE_DEFINES) -c -o $@ $<
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(STATIC_LIB_FLAGS) $(NET2PIPE_INCLUDES) $(NET2PIPE_DEFINES) -c -o $@ $<
 
 
 # Include unit test modules
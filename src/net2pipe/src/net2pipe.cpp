@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <limits>
@@ -37,7 +38,13 @@
 
 namespace {
 
-  void emit_single_prolog_buffer(YAML::Emitter &out, const n2p::DeterministicKeyMap& deterministic_id_map, const n2p::prolog_buffer& p) {
+  std::unique_ptr<netlist_parser> parse_netlist_file(const std::string &netlist_file) {
+    auto parsed_netlist = std::make_unique<netlist_parser>();
+    parsed_netlist->parse_file(netlist_file);
+    return parsed_netlist;
+  }
+
+  void emit_single_prolog_buffer(n2p::PipegenGraphEmitter &out, const n2p::DeterministicKeyMap& deterministic_id_map, const n2p::prolog_buffer& p) {
     out << YAML::BeginMap;
     out << YAML::Key << ("buffer_" + std::to_string(deterministic_id_map.get_deterministic_key(p.uniqid)));
     out << YAML::Comment(p.comment);
@@ -175,13 +182,27 @@ Net2Pipe::Net2Pipe(
     const std::string &output_dir,
     const std::string &epoch_start,
     const std::string &soc_descriptor_list_file_path,
-    const std::string &cluster_description_file_path) {
+    const std::string &cluster_description_file_path) :
+    owned_parsed_netlist(parse_netlist_file(netlist_file)), parsed_netlist(*owned_parsed_netlist) {
     this->start_epoch_id = std::stoi(epoch_start);
     this->netlist_file = netlist_file;
     this->output_dir = output_dir;
 
-    this->parsed_netlist.parse_file(netlist_file);
+    initialize(soc_descriptor_list_file_path, cluster_description_file_path);
+}
+
+Net2Pipe::Net2Pipe(
+    const netlist_parser &parsed_netlist,
+    const std::string &output_dir,
+    int epoch_start,
+    const std::string &soc_descriptor_list_file_path,
+    const std::string &cluster_description_file_path) : parsed_netlist(parsed_netlist) {
+    this->start_epoch_id = epoch_start;
+    this->output_dir = output_dir;
+    initialize(soc_descriptor_list_file_path, cluster_description_file_path);
+}
 
+void Net2Pipe::initialize(const std::string &soc_descriptor_list_file_path, const std::string &cluster_description_file_path) {
     for (const auto& queue_it : this->parsed_netlist.queue_map) {
         if (queue_it.second.loc != QUEUE_LOCATION::HOST){
             workload_target_device_ids.insert(queue_it.second.target_device);
@@ -226,6 +247,15 @@ Net2Pipe::Net2Pipe(
     set_ring_start_end_device_ids();
 }
 
+void Net2Pipe::keep_pipegen_graphs_in_memory(bool emit_files) {
+    this->keep_pipegen_graphs = true;
+    this->emit_pipegen_yaml_files = emit_files;
+}
+
+std::unordered_map<int, pipegen2::PipeGraphDescription> Net2Pipe::take_pipegen_graphs() {
+    return std::move(this->pipegen_graphs);
+}
+
 
 std::uint64_t Net2Pipe::get_next_unique_id(std::vector<std::uint64_t>& per_epoch_hronological_unique_ids, int align, int id_block) const {
     auto new_key = this->unique_id_gen.get_next_unique_id(align, id_block);
@@ -320,7 +350,7 @@ void Net2Pipe::get_program_trace() {
         TT_ASSERT(
             this->parsed_netlist.program_map.find(program_name) != this->parsed_netlist.program_map.end(),
             "Program being executed doesn't exist...");
-        netlist_program program(program_name, this->parsed_netlist.program_map[program_name].program_trace);
+        netlist_program program(program_name, this->parsed_netlist.program_map.at(program_name).program_trace);
 
         program.set_ignore_runtime_parameters(true);
 
@@ -389,6 +419,7 @@ void Net2Pipe::output_pipes() {
     size_t num_temporal_epochs = this->temporal_epoch_graph_exec_vars.size();
     {
         std::vector<temporal_epoch_context> epoch_contexts(num_temporal_epochs);
+        std::vector<pipegen2::PipeGraphDescription> epoch_pipegen_graphs(this->keep_pipegen_graphs ? num_temporal_epochs : 0);
 
         tt::parallel_for(
             0,
@@ -445,7 +476,7 @@ void Net2Pipe::output_pipes() {
                     epoch_id);
                 const auto& out_dir = this->create_temporal_epoch_output_directory(epoch_id);
 
-                YAML::Emitter out_yaml;
+                n2p::PipegenGraphEmitter out_yaml(this->emit_pipegen_yaml_files, this->keep_pipegen_graphs);
                 std::map<std::string, bool> op_queue_emitted;
                 std::unordered_map<string, tt_op_info> temporal_epoch_op_map;
                 for (const auto& graph_exec_var : graph_exec_vars) {
@@ -467,9 +498,18 @@ void Net2Pipe::output_pipes() {
                 // This pass has to be called after emit_pipes
                 this->dump_queue_to_core_map_to_file(out_dir, false, epoch_context);
                 this->dump_queue_to_core_map_to_file(out_dir, true, epoch_context);
-                dump_yaml_to_file(out_yaml, out_dir);
+                if (this->emit_pipegen_yaml_files) {
+                    dump_yaml_to_file(out_yaml.get_yaml(), out_dir);
+                }
+                if (this->keep_pipegen_graphs) {
+                    epoch_pipegen_graphs[temporal_epoch] = out_yaml.take_description();
+                }
                 emit_operand_and_pipe_info(temporal_epoch_op_map, epoch_id, epoch_context, deterministic_id_map);
             }, tt::cpuset::get_allowed_num_threads());
+
+        for (int temporal_epoch = 0; temporal_epoch < epoch_pipegen_graphs.size(); temporal_epoch++) {
+            this->pipegen_graphs[start_epoch_id + temporal_epoch] = std::move(epoch_pipegen_graphs[temporal_epoch]);
+        }
     }
 }
 
@@ -777,7 +817,7 @@ void Net2Pipe::compute_consumer_input_tile_mappings(const tt_graph_info &graph_i
     }
 }
 
-void Net2Pipe::emit_relay_buffers(int runtime_input_count, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, YAML::Emitter &out) const {
+void Net2Pipe::emit_relay_buffers(int runtime_input_count, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map, n2p::PipegenGraphEmitter &out) const {
 
     auto get_eth_connected_buffer_id_and_core = [this](bool is_eth_core_relay, router::unique_id_t relay_buffer_id, router::router_buffer_info_t const& relay_buffer, const temporal_epoch_context& epoch_context) -> std::optional<std::tuple<router::unique_id_t, tt_cxy_pair, bool>> {
         // Return nullopt if this relay buffer is not connected to another over ethernet
@@ -953,7 +993,7 @@ void Net2Pipe::emit_buffers(
     const n2p::DeterministicKeyMap& deterministic_id_map,
     int input_count,
     std::map<std::string, bool> &op_queue_emitted,
-    YAML::Emitter &out_yaml) const {;
+    n2p::PipegenGraphEmitter &out_yaml) const {;
 
     for (const auto& [_, op_info] : graph_info.op_map) {
         int num_op_inputs = op_info.input_names.size();
@@ -1183,9 +1223,9 @@ std::string Net2Pipe::create_temporal_epoch_output_directory(int temporal_epoch)
                     << "/temporal_epoch_" + std::to_string(temporal_epoch) +
                            "/overlay/";  // + "/graph_" << graph_info.name << "/overlay/";
     n2p::Log() << "  Directory: " << yaml_output_dir.str() << "\n";
-    std::string cmd = "mkdir -p " + yaml_output_dir.str();
-    const int status = system(cmd.c_str());
-    n2p::Log() << "return value=" << status << std::endl;
+    std::error_code error;
+    std::filesystem::create_directories(yaml_output_dir.str(), error);
+    n2p::Log() << "return value=" << error.value() << std::endl;
 
     return yaml_output_dir.str();
 }
@@ -1203,7 +1243,7 @@ void Net2Pipe::emit_epoch(
     const n2p::DeterministicKeyMap& deterministic_id_map,
     int temporal_epoch,
     std::map<std::string, bool> &op_queue_emitted,
-    YAML::Emitter &out_yaml) const {
+    n2p::PipegenGraphEmitter &out_yaml) const {
     tt_graph_info graph_info = this->parsed_netlist.graph_map.at(graph_exec.instrn.graph_name);
     int input_count = graph_info.input_count;
     tt_instruction_info instrn_info = graph_exec.instrn;
@@ -1633,7 +1673,7 @@ void Net2Pipe::get_queue_attributes(const tt_queue_info &queue_info,
 
 
 void Net2Pipe::emit_queue(
-    YAML::Emitter &out,
+    n2p::PipegenGraphEmitter &out,
     std::string queue_name,
     std::string graph_name,
     const temporal_epoch_context &epoch_context,
@@ -1951,7 +1991,7 @@ int Net2Pipe::compute_intermediate_buffer_size_tiles(const tt_op_info &op_info,
 }
 
 void Net2Pipe::emit_kernel_bufs(
-    YAML::Emitter &out,
+    n2p::PipegenGraphEmitter &out,
     const temporal_epoch_context& epoch_context,
     const n2p::DeterministicKeyMap& deterministic_id_map,
     const std::string &op_name,
@@ -2966,7 +3006,7 @@ bool Net2Pipe::producer_output_row_major_ublock_scan_order(std::string producer_
   }
 }
 
-void Net2Pipe::emit_untilize_output(YAML::Emitter &out, const tt_op_info *op_info) const {
+void Net2Pipe::emit_untilize_output(n2p::PipegenGraphEmitter &out, const tt_op_info *op_info) const {
     int full_r_dim = 0;
     int full_c_dim = 0;
     int r_dim = 0;
@@ -5530,7 +5570,7 @@ void Net2Pipe::process_dram_fork_pipes(const std::unordered_map<string, tt_op_in
     }
 }
 
-void Net2Pipe::emit_pipes(YAML::Emitter &out, temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const {
+void Net2Pipe::emit_pipes(n2p::PipegenGraphEmitter &out, temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const {
     std::map<router::unique_id_t, std::vector<router::unique_id_t>> inputs_to_output_pipes_map;
     // Clear this map for each temporal epoch
     epoch_context.input_queue_id_to_consumer_cores.clear();
@@ -6601,7 +6641,7 @@ uint32_t Net2Pipe::get_dram_pad_addr(DataFormat df, float pad_val) const {
     return this->dram_pad_addr_table.at(df).at(pad_val);
 }
 
-void Net2Pipe::emit_padding_buffers(YAML::Emitter &out, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const {
+void Net2Pipe::emit_padding_buffers(n2p::PipegenGraphEmitter &out, const temporal_epoch_context& epoch_context, const n2p::DeterministicKeyMap& deterministic_id_map) const {
     for (const auto& [key, buf]: epoch_context.pad_buffers_db) {
 
         out << YAML::BeginMap;
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "pipegen_graph_emitter.h"
+
+#include <utility>
+
+#include "utils/logger.hpp"
+
+namespace n2p {
+
+PipegenGraphEmitter::PipegenGraphEmitter(bool emit_yaml, bool build_description) :
+    emit_yaml(emit_yaml), build_description(build_description) {}
+
+PipegenGraphEmitter &PipegenGraphEmitter::operator<<(YAML::EMITTER_MANIP manip) {
+    if (this->emit_yaml) {
+        this->yaml << manip;
+    }
+    if (!this->build_description) {
+        return *this;
+    }
+
+    switch (manip) {
+        case YAML::BeginMap:
+            // Graph nodes are maps in the top level map of a document, their attributes are scalars or sequences
+            log_assert(this->open_containers.size() < 2, "Pipegen graph attribute values can't be maps");
+            log_assert(
+                this->open_containers.empty() or !this->open_containers.back().next_is_key,
+                "Pipegen graph nodes must be emitted as map values");
+            this->open_containers.push_back({.is_map = true});
+            break;
+        case YAML::EndMap: {
+            log_assert(
+                !this->open_containers.empty() and this->open_containers.back().is_map, "EndMap without an open map");
+            OpenContainer node = std::move(this->open_containers.back());
+            this->open_containers.pop_back();
+            if (!this->open_containers.empty()) {
+                OpenContainer &graph = this->open_containers.back();
+                this->description.push_back({std::move(graph.key), std::move(node.attributes)});
+                graph.next_is_key = true;
+            }
+            break;
+        }
+        case YAML::BeginSeq:
+            log_assert(this->open_containers.size() >= 2, "Pipegen graph sequences must be attribute values");
+            this->open_containers.push_back({.is_map = false});
+            break;
+        case YAML::EndSeq: {
+            log_assert(
+                !this->open_containers.empty() and !this->open_containers.back().is_map, "EndSeq without an open sequence");
+            pipegen2::PipeGraphAttributeValue list = std::move(this->open_containers.back().list);
+            this->open_containers.pop_back();
+            add_value(std::move(list));
+            break;
+        }
+        case YAML::Key:
+            log_assert(!this->open_containers.empty() and this->open_containers.back().is_map, "Key outside of a map");
+            this->open_containers.back().next_is_key = true;
+            break;
+        case YAML::Value:
+            log_assert(!this->open_containers.empty() and this->open_containers.back().is_map, "Value outside of a map");
+            this->open_containers.back().next_is_key = false;
+            break;
+        default:
+            // Formatting only, e.g. Flow
+            break;
+    }
+    return *this;
+}
+
+PipegenGraphEmitter &PipegenGraphEmitter::operator<<(const YAML::_Comment &comment) {
+    if (this->emit_yaml) {
+        this->yaml << comment;
+    }
+    return *this;
+}
+
+PipegenGraphEmitter &PipegenGraphEmitter::operator<<(const std::string &value) {
+    if (this->emit_yaml) {
+        this->yaml << value;
+    }
+    if (!this->build_description) {
+        return *this;
+    }
+
+    if (!this->open_containers.empty() and this->open_containers.back().is_map and
+        this->open_containers.back().next_is_key) {
+        this->open_containers.back().key = value;
+        this->open_containers.back().next_is_key = false;
+    } else {
+        add_value(pipegen2::PipeGraphAttributeValue::from_text(value));
+    }
+    return *this;
+}
+
+PipegenGraphEmitter &PipegenGraphEmitter::operator<<(const char *value) { return *this << std::string(value); }
+
+PipegenGraphEmitter &PipegenGraphEmitter::operator<<(bool value) {
+    if (this->emit_yaml) {
+        this->yaml << value;
+    }
+    if (this->build_description) {
+        add_value(pipegen2::PipeGraphAttributeValue::from_number(value ? 1 : 0));
+    }
+    return *this;
+}
+
+pipegen2::PipeGraphDescription PipegenGraphEmitter::take_description() {
+    log_assert(this->open_containers.empty(), "Pipegen graph taken while a node is still being emitted");
+    return std::move(this->description);
+}
+
+void PipegenGraphEmitter::add_value(pipegen2::PipeGraphAttributeValue value) {
+    log_assert(!this->open_containers.empty(), "Pipegen graph values must be emitted into a map");
+    OpenContainer &container = this->open_containers.back();
+    if (!container.is_map) {
+        container.list.add_element(std::move(value));
+        return;
+    }
+
+    log_assert(!container.next_is_key, "Pipegen graph keys must be strings");
+    container.next_is_key = true;
+    // Values in the top level map, e.g. graph_name, aren't part of the graph
+    if (this->open_containers.size() == 2) {
+        container.attributes.emplace_back(container.key, std::move(value));
+    }
+}
+
+}  // namespace n2p
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "pipegen_graph_emitter.h"
+
+namespace {
+
+// Emits a buffer and a pipe the way net2pipe does, into any emitter taking yaml manipulators and values.
+template <typename Emitter>
+void emit_graph(Emitter &out) {
+    out << YAML::BeginMap;
+    out << YAML::Key << "graph_name" << YAML::Value << std::string("test_graph");
+    out << YAML::Comment("buffer of op1");
+    out << YAML::Key << "buffer_10000" << YAML::Value << YAML::BeginMap;
+    out << YAML::Key << "md_op_name" << YAML::Value << "op1";
+    out << YAML::Key << "id" << YAML::Value << 0;
+    out << YAML::Key << "uniqid" << YAML::Value << std::uint64_t(10000);
+    out << YAML::Key << "core_coordinates" << YAML::Value << YAML::Flow << std::vector<int>{1, 2};
+    out << YAML::Key << "tile_clear_granularity" << YAML::Value << false;
+    out << YAML::EndMap;
+    out << YAML::Key << "pipe_20000" << YAML::Value << YAML::BeginMap;
+    out << YAML::Key << "id" << YAML::Value << std::uint64_t(20000);
+    out << YAML::Key << "input_list" << YAML::Value << YAML::Flow << std::vector<std::uint64_t>{10000, 10000};
+    out << YAML::Key << "output_list" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+    out << std::vector<std::uint64_t>{30000};
+    out << std::vector<std::uint64_t>{30001};
+    out << YAML::EndSeq;
+    out << YAML::Key << "ethernet_chan" << YAML::Value << -1;
+    out << YAML::EndMap;
+    out << YAML::EndMap;
+}
+
+std::vector<std::string> attribute_names(const pipegen2::PipeGraphNodeDescription &node) {
+    std::vector<std::string> names;
+    for (const auto &[name, value] : node.attributes) {
+        names.push_back(name);
+    }
+    return names;
+}
+
+}  // namespace
+
+TEST(PipegenGraphEmitter, DescribesBuffersAndPipes) {
+    n2p::PipegenGraphEmitter emitter(false /* emit_yaml */, true /* build_description */);
+    emit_graph(emitter);
+    const pipegen2::PipeGraphDescription description = emitter.take_description();
+
+    ASSERT_EQ(description.size(), 2u);
+
+    const pipegen2::PipeGraphNodeDescription &buffer = description.at(0);
+    EXPECT_EQ(buffer.name, "buffer_10000");
+    EXPECT_EQ(
+        attribute_names(buffer),
+        std::vector<std::string>({"md_op_name", "id", "uniqid", "core_coordinates", "tile_clear_granularity"}));
+    EXPECT_EQ(buffer.attributes.at(0).second.get_string(), "op1");
+    EXPECT_EQ(buffer.attributes.at(1).second.get_int(), 0);
+    EXPECT_EQ(buffer.attributes.at(2).second.get_ulong(), 10000u);
+    EXPECT_EQ(buffer.attributes.at(3).second.get_vector_of_ints(), std::vector<int>({1, 2}));
+    EXPECT_EQ(buffer.attributes.at(4).second.get_int(), 0);
+
+    const pipegen2::PipeGraphNodeDescription &pipe = description.at(1);
+    EXPECT_EQ(pipe.name, "pipe_20000");
+    EXPECT_EQ(attribute_names(pipe), std::vector<std::string>({"id", "input_list", "output_list", "ethernet_chan"}));
+    EXPECT_EQ(pipe.attributes.at(1).second.get_vector_of_ulongs(), std::vector<std::uint64_t>({10000, 10000}));
+    EXPECT_TRUE(pipe.attributes.at(2).second.is_two_dim_list());
+    EXPECT_EQ(
+        pipe.attributes.at(2).second.get_two_dim_vector_of_ulongs(),
+        std::vector<std::vector<std::uint64_t>>({{30000}, {30001}}));
+    EXPECT_EQ(pipe.attributes.at(3).second.get_int(), -1);
+
+    EXPECT_EQ(std::string(emitter.get_yaml().c_str()), "") << "Yaml isn't emitted unless asked for";
+}
+
+TEST(PipegenGraphEmitter, EmitsSameYamlAsYamlEmitter) {
+    YAML::Emitter expected;
+    emit_graph(expected);
+
+    n2p::PipegenGraphEmitter emitter(true /* emit_yaml */, false /* build_description */);
+    emit_graph(emitter);
+
+    EXPECT_EQ(std::string(emitter.get_yaml().c_str()), std::string(expected.c_str()));
+    EXPECT_TRUE(emitter.take_description().empty());
+}
@@ -10,14 +10,18 @@ namespace pipegen2
 class Pipegen2Client
 {
 public:
+    // When pipe_graph_description is given, buffers and pipes are taken from it instead of being parsed from
+    // pipegen_yaml_path. It has to outlive the call to run_pipegen2.
     Pipegen2Client(
         const std::string& soc_descriptors_yaml_path,
         const std::string& pipegen_yaml_path,
         const std::string& blob_yaml_path,
         const int epoch_num,
-        const int perf_dump_info) :
+        const int perf_dump_info,
+        const PipeGraphDescription* pipe_graph_description = nullptr) :
         m_pipegen(soc_descriptors_yaml_path),
         m_pipegen_yaml_path(pipegen_yaml_path),
+        m_pipe_graph_description(pipe_graph_description),
         m_soc_descriptors_yaml_path(soc_descriptors_yaml_path),
         m_blob_yaml_path(blob_yaml_path),
         m_epoch_num(epoch_num),
@@ -52,6 +56,9 @@ private:
     // Path to pipegen yaml.
     std::string m_pipegen_yaml_path;
 
+    // Buffers and pipes handed over in memory by net2pipe, not owned. Null when pipegen yaml is read from file.
+    const PipeGraphDescription* m_pipe_graph_description;
+
     // Path to SOC descriptors yaml.
     std::string m_soc_descriptors_yaml_path;
 
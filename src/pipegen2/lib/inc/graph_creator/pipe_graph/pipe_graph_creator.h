@@ -8,6 +8,7 @@
 
 #include "graph_creator/pipe_graph/pipe_graph_handler.h"
 #include "graph_creator/pipe_graph/pipe_graph_info.h"
+#include "io/pipe_graph_description.h"
 #include "model/pipe_graph/pg_buffer.h"
 #include "model/pipe_graph/pg_pipe.h"
 #include "model/pipe_graph/pipe_graph.h"
@@ -22,7 +23,13 @@ public:
     // Creates pipe graph from the pipegen yaml.
     std::unique_ptr<PipeGraph> create_pipe_graph(const std::string& pipegen_yaml_path);
 
+    // Creates pipe graph from the buffers and pipes handed over in memory by net2pipe run in process.
+    std::unique_ptr<PipeGraph> create_pipe_graph(const PipeGraphDescription& pipe_graph_description);
+
 private:
+    // Connects the nodes of the freshly parsed pipe graph and patches it up, so it is ready for further processing.
+    void finalize_pipe_graph(PipeGraph& pipe_graph);
+
     // Creates pipe inputs for scatter buffers and adds them to map per buffer ID.
     void create_pipe_inputs_for_scatter_buffers(const PipeGraph& pipe_graph);
 
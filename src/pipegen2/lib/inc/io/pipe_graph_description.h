@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pipegen2
+{
+
+// Value of a pipe graph node attribute. Values read from pipegen yaml keep their text and are converted when accessed,
+// while net2pipe run in process hands over numbers and lists as they are.
+class PipeGraphAttributeValue
+{
+public:
+    // Creates value from its text in pipegen yaml, e.g. "12" or "[[0, 1, 2], [0, 1, 3]]".
+    static PipeGraphAttributeValue from_text(std::string text)
+    {
+        PipeGraphAttributeValue value(Kind::Text);
+        value.m_text = std::move(text);
+        return value;
+    }
+
+    // Creates number value. Unsigned numbers above the int64 range are kept by their bits.
+    static PipeGraphAttributeValue from_number(std::int64_t number)
+    {
+        PipeGraphAttributeValue value(Kind::Number);
+        value.m_number = number;
+        return value;
+    }
+
+    // Creates empty list value, elements are added with add_element().
+    static PipeGraphAttributeValue from_list() { return PipeGraphAttributeValue(Kind::List); }
+
+    void add_element(PipeGraphAttributeValue element) { m_elements.push_back(std::move(element)); }
+
+    std::string get_string() const;
+
+    int get_int() const;
+
+    unsigned int get_uint() const;
+
+    std::uint64_t get_ulong() const;
+
+    std::vector<int> get_vector_of_ints() const;
+
+    std::vector<std::vector<int>> get_two_dim_vector_of_ints() const;
+
+    std::vector<std::uint64_t> get_vector_of_ulongs() const;
+
+    std::vector<std::vector<std::uint64_t>> get_two_dim_vector_of_ulongs() const;
+
+    // Checks if value is a list of lists, e.g. multicast locations of a pipe going to multiple cores.
+    bool is_two_dim_list() const;
+
+private:
+    enum class Kind
+    {
+        Text,
+        Number,
+        List
+    };
+
+    explicit PipeGraphAttributeValue(Kind kind) : m_kind(kind) {}
+
+    // Kind of the value, determines which of the members below holds it.
+    Kind m_kind;
+
+    // Text of the value in pipegen yaml, or a string value handed over in memory.
+    std::string m_text;
+
+    // Number value handed over in memory.
+    std::int64_t m_number = 0;
+
+    // Elements of the list value handed over in memory.
+    std::vector<PipeGraphAttributeValue> m_elements;
+};
+
+// Buffer or pipe of the pipe graph, described by its attributes in the order net2pipe emitted them.
+struct PipeGraphNodeDescription
+{
+    // Name of the node, i.e. its key in pipegen yaml: "buffer_<id>" or "pipe_<id>".
+    std::string name;
+
+    std::vector<std::pair<std::string, PipeGraphAttributeValue>> attributes;
+};
+
+// Buffers and pipes of one temporal epoch, as net2pipe run in process hands them over to pipegen instead of writing
+// them into pipegen yaml.
+using PipeGraphDescription = std::vector<PipeGraphNodeDescription>;
+
+}  // namespace pipegen2
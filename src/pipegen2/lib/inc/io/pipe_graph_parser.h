@@ -5,6 +5,7 @@
 
 #include <string>
 
+#include "io/pipe_graph_description.h"
 #include "model/pipe_graph/pipe_graph.h"
 
 namespace pipegen2
@@ -15,6 +16,10 @@ class PipeGraphParser
 public:
     // Parses buffers and pipes from pipegen graph yaml into the pipe graph.
     static void parse_graph(PipeGraph& pipe_graph, const std::string& pipegen_yaml_path);
+
+    // Parses buffers and pipes which net2pipe handed over in memory, instead of writing them to pipegen yaml, into the
+    // pipe graph.
+    static void parse_graph(PipeGraph& pipe_graph, const PipeGraphDescription& pipe_graph_description);
 };
 
 }  // namespace pipegen2
\ No newline at end of file
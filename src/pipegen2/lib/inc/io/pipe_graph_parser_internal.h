@@ -9,6 +9,7 @@
 // clang-format off
 #include "device/soc_info.h"
 
+#include "io/pipe_graph_description.h"
 #include "model/pipe_graph/pg_buffer.h"
 #include "model/pipe_graph/pg_pipe.h"
 #include "model/pipe_graph/pipe_graph.h"
@@ -38,15 +39,33 @@ const std::string s_graph_name_prefix = "graph_name:";
 // Parses the definition of pipe in pipegen.yaml and adds the corresponding pipe to the pipe_graph.
 void parse_pipe(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_graph);
 
+// Adds the pipe described in memory to the pipe_graph.
+void parse_pipe(const PipeGraphNodeDescription& pipe_description, PipeGraph& pipe_graph);
+
+// Sets pipe attribute with given name to the given value. Attributes which pipegen doesn't use are ignored.
+void set_pipe_attribute(PGPipe* pipe, const std::string& attr_name, const PipeGraphAttributeValue& attr_value);
+
 // Parses the definition of buffer in pipegen.yaml and adds the corresponding buffer to the pipe_graph.
 void parse_buffer(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_graph);
 
+// Adds the buffer described in memory to the pipe_graph.
+void parse_buffer(const PipeGraphNodeDescription& buffer_description, PipeGraph& pipe_graph);
+
+// Sets buffer attribute with given name to the given value. Attributes which pipegen doesn't use are ignored.
+void set_buffer_attribute(PGBuffer* buffer, const std::string& attr_name, const PipeGraphAttributeValue& attr_value);
+
 // Parses the definition of node in pipegen.yaml and adds the corresponding node to the pipe_graph.
 void parse_node(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_graph);
 
+// Adds the node described in memory to the pipe_graph.
+void parse_node(const PipeGraphNodeDescription& node_description, PipeGraph& pipe_graph);
+
 // Parses the whole pipegen.yaml file, adding the corresponding buffers and pipes.
 void parse_graph(PipeGraph& pipe_graph, std::istream& input_stream);
 
+// Adds the buffers and pipes of the pipe graph description handed over in memory to the pipe_graph.
+void parse_graph(PipeGraph& pipe_graph, const PipeGraphDescription& pipe_graph_description);
+
 // Throws parsing error with given message.
 void throw_parsing_error(const std::string& error_msg);
 
@@ -64,24 +83,31 @@ std::uint64_t parse_ulong_attribute_value(const std::string& attr_value);
 
 // Parses operand id attribute of the buffer.
 void parse_buffer_operand_id(PGBuffer* buffer, const std::string& attr_value);
+void parse_buffer_operand_id(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value);
 
 // Parses chip id attribute of the buffer.
 void parse_buffer_chip_id(PGBuffer* buffer, const std::string& attr_value);
+void parse_buffer_chip_id(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value);
 
 // Parses buffer location.
 void parse_buffer_location(PGBuffer* buffer, const std::string& attr_value);
+void parse_buffer_location(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value);
 
 // Parses pipe multicast cores locations.
 void parse_pipe_mcast_locations(PGPipe* pipe, const std::string& attr_value);
+void parse_pipe_mcast_locations(PGPipe* pipe, const PipeGraphAttributeValue& attr_value);
 
 // Parses list of pipe inputs.
 void parse_pipe_inputs(PGPipe* pipe, const std::string& attr_value);
+void parse_pipe_inputs(PGPipe* pipe, const PipeGraphAttributeValue& attr_value);
 
 // Parses list of pipe outputs.
 void parse_pipe_outputs(PGPipe* pipe, const std::string& attr_value);
+void parse_pipe_outputs(PGPipe* pipe, const PipeGraphAttributeValue& attr_value);
 
 // Parses list of pipe output padding buffers.
 void parse_pipe_output_padding_list(PGPipe* pipe, const std::string& attr_value);
+void parse_pipe_output_padding_list(PGPipe* pipe, const PipeGraphAttributeValue& attr_value);
 
 // Parses vector of ints from string: "[1, 2, 3]" -> {1, 2, 3}
 std::vector<int> parse_vector_of_ints(const std::string& str);
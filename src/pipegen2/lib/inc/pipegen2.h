@@ -10,6 +10,7 @@
 // clang-format off
 #include "device/tt_xy_pair.h"
 
+#include "io/pipe_graph_description.h"
 #include "model/fork_join_graph/fork_join_graph_collection.h"
 #include "model/stream_graph/stream_graph_collection.h"
 // clang-format on
@@ -46,6 +47,10 @@ private:
     // Pipegen releases ownership of the created stream graphs.
     std::unique_ptr<StreamGraphCollection> create_stream_graphs(const std::string& pipegen_yaml_path, int epoch_num);
 
+    // Same as above, but for the buffers and pipes which net2pipe handed over in memory instead of through a file.
+    std::unique_ptr<StreamGraphCollection> create_stream_graphs(
+        const PipeGraphDescription& pipe_graph_description, int epoch_num);
+
     // Writes stream and firmware configurations into blob yaml for all stream graphs in the collection.
     void output_blob_yaml(
         const StreamGraphCollection* stream_graph_collection, const std::string& blob_yaml_path, int perf_dump_info);
@@ -65,6 +70,12 @@ private:
     // Creates pipe graph from the input net2pipe pipegen yaml.
     void create_pipe_graph(const std::string& pipegen_yaml_path);
 
+    // Creates pipe graph from the buffers and pipes net2pipe handed over in memory.
+    void create_pipe_graph(const PipeGraphDescription& pipe_graph_description);
+
+    // Runs all the stages after pipe graph creation and releases the created stream graphs.
+    std::unique_ptr<StreamGraphCollection> create_stream_graphs_from_pipe_graph(int epoch_num);
+
     // Creates a fork-join graph graphs from the pipe_graph and stream graphs.
     std::unique_ptr<ForkJoinGraphCollection> create_fork_join_graphs();
 
@@ -13,7 +13,8 @@ std::unique_ptr<StreamGraphCollection> Pipegen2Client::run_pipegen2()
     log_assert(!m_pipegen_was_run, "Pipegen2 was already run");
 
     std::unique_ptr<StreamGraphCollection> stream_graphs =
-        m_pipegen.create_stream_graphs(m_pipegen_yaml_path, m_epoch_num);
+        m_pipe_graph_description ? m_pipegen.create_stream_graphs(*m_pipe_graph_description, m_epoch_num)
+                                 : m_pipegen.create_stream_graphs(m_pipegen_yaml_path, m_epoch_num);
 
     m_pipegen.output_blob_yaml(stream_graphs.get(), m_blob_yaml_path, m_perf_dump_info);
 
@@ -20,17 +20,31 @@ std::unique_ptr<PipeGraph> PipeGraphCreator::create_pipe_graph(const std::string
     std::unique_ptr<PipeGraph> pipe_graph = std::make_unique<PipeGraph>();
 
     PipeGraphParser::parse_graph(*pipe_graph, pipegen_yaml_path);
+    finalize_pipe_graph(*pipe_graph);
 
-    create_pipe_inputs_for_scatter_buffers(*pipe_graph);
-    populate_buffers_map(*pipe_graph);
-    find_pipe_graph_nodes_connections(*pipe_graph);
+    return pipe_graph;
+}
 
-    // Populate the handler vector and do the necessary modifications of the created pipe graph.
-    patch_deficiencies(*pipe_graph);
+std::unique_ptr<PipeGraph> PipeGraphCreator::create_pipe_graph(const PipeGraphDescription& pipe_graph_description)
+{
+    std::unique_ptr<PipeGraph> pipe_graph = std::make_unique<PipeGraph>();
+
+    PipeGraphParser::parse_graph(*pipe_graph, pipe_graph_description);
+    finalize_pipe_graph(*pipe_graph);
 
     return pipe_graph;
 }
 
+void PipeGraphCreator::finalize_pipe_graph(PipeGraph& pipe_graph)
+{
+    create_pipe_inputs_for_scatter_buffers(pipe_graph);
+    populate_buffers_map(pipe_graph);
+    find_pipe_graph_nodes_connections(pipe_graph);
+
+    // Populate the handler vector and do the necessary modifications of the created pipe graph.
+    patch_deficiencies(pipe_graph);
+}
+
 void PipeGraphCreator::create_pipe_inputs_for_scatter_buffers(const PipeGraph& pipe_graph)
 {
     for (const std::unique_ptr<PGBuffer>& buffer : pipe_graph.get_buffers())
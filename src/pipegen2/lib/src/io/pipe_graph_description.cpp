@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: © 2024 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "io/pipe_graph_description.h"
+
+#include <limits>
+
+#include "io/pipe_graph_parser_internal.h"
+
+namespace pipegen2
+{
+
+using namespace pipe_graph_parser_internal;
+
+std::string PipeGraphAttributeValue::get_string() const
+{
+    if (m_kind == Kind::Number)
+    {
+        return std::to_string(m_number);
+    }
+    else if (m_kind == Kind::List)
+    {
+        throw_parsing_error("Found list where a single value is expected");
+    }
+
+    return m_text;
+}
+
+int PipeGraphAttributeValue::get_int() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_int_attribute_value(m_text);
+    }
+    else if (m_kind == Kind::List || m_number < std::numeric_limits<int>::min() ||
+             m_number > std::numeric_limits<int>::max())
+    {
+        throw_parsing_error("Found invalid integer value");
+    }
+
+    return static_cast<int>(m_number);
+}
+
+unsigned int PipeGraphAttributeValue::get_uint() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_uint_attribute_value(m_text);
+    }
+    else if (m_kind == Kind::List)
+    {
+        throw_parsing_error("Found invalid unsigned integer value");
+    }
+
+    return static_cast<unsigned int>(m_number);
+}
+
+std::uint64_t PipeGraphAttributeValue::get_ulong() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_ulong_attribute_value(m_text);
+    }
+    else if (m_kind == Kind::List)
+    {
+        throw_parsing_error("Found invalid unsigned long value");
+    }
+
+    return static_cast<std::uint64_t>(m_number);
+}
+
+std::vector<int> PipeGraphAttributeValue::get_vector_of_ints() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_vector_of_ints(m_text);
+    }
+    else if (m_kind == Kind::Number)
+    {
+        throw_parsing_error("Found improperly formatted list attribute");
+    }
+
+    std::vector<int> values;
+    for (const PipeGraphAttributeValue& element : m_elements)
+    {
+        values.push_back(element.get_int());
+    }
+
+    return values;
+}
+
+std::vector<std::vector<int>> PipeGraphAttributeValue::get_two_dim_vector_of_ints() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_two_dim_vector_of_ints(m_text);
+    }
+    else if (!is_two_dim_list())
+    {
+        throw_parsing_error("Found improperly formatted two-dimensional list attribute");
+    }
+
+    std::vector<std::vector<int>> values;
+    for (const PipeGraphAttributeValue& element : m_elements)
+    {
+        if (element.m_kind != Kind::List)
+        {
+            throw_parsing_error("Found improperly formatted two-dimensional list attribute");
+        }
+        values.push_back(element.get_vector_of_ints());
+    }
+
+    return values;
+}
+
+std::vector<std::uint64_t> PipeGraphAttributeValue::get_vector_of_ulongs() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_vector_of_ulongs(m_text);
+    }
+    else if (m_kind == Kind::Number)
+    {
+        throw_parsing_error("Found improperly formatted list attribute");
+    }
+
+    std::vector<std::uint64_t> values;
+    for (const PipeGraphAttributeValue& element : m_elements)
+    {
+        values.push_back(element.get_ulong());
+    }
+
+    return values;
+}
+
+std::vector<std::vector<std::uint64_t>> PipeGraphAttributeValue::get_two_dim_vector_of_ulongs() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return parse_two_dim_vector_of_ulongs(m_text);
+    }
+    else if (!is_two_dim_list())
+    {
+        throw_parsing_error("Found improperly formatted two-dimensional list attribute");
+    }
+
+    std::vector<std::vector<std::uint64_t>> values;
+    for (const PipeGraphAttributeValue& element : m_elements)
+    {
+        if (element.m_kind != Kind::List)
+        {
+            throw_parsing_error("Found improperly formatted two-dimensional list attribute");
+        }
+        values.push_back(element.get_vector_of_ulongs());
+    }
+
+    return values;
+}
+
+bool PipeGraphAttributeValue::is_two_dim_list() const
+{
+    if (m_kind == Kind::Text)
+    {
+        return string_starts_with(m_text, "[[");
+    }
+
+    return m_kind == Kind::List && !m_elements.empty() && m_elements.front().m_kind == Kind::List;
+}
+
+}  // namespace pipegen2
@@ -23,4 +23,16 @@ void PipeGraphParser::parse_graph(PipeGraph& pipe_graph, const std::string& pipe
     }
 }
 
+void PipeGraphParser::parse_graph(PipeGraph& pipe_graph, const PipeGraphDescription& pipe_graph_description)
+{
+    try
+    {
+        pipe_graph_parser_internal::parse_graph(pipe_graph, pipe_graph_description);
+    }
+    catch (const std::exception& e)
+    {
+        throw InvalidPipegenYamlException("Can't parse pipe graph handed over in memory : " + std::string(e.what()));
+    }
+}
+
 }  // namespace pipegen2
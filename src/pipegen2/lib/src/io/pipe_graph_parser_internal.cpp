@@ -31,93 +31,114 @@ void parse_pipe(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_grap
     {
         std::string attr_name, attr_value;
         parse_attribute(yaml_lines[i], attr_name, attr_value);
+        set_pipe_attribute(pipe.get(), attr_name, PipeGraphAttributeValue::from_text(attr_value));
+    }
 
-        if (attr_name == "id")
-        {
-            pipe->set_id(parse_ulong_attribute_value(attr_value));
-        }
-        else if (attr_name == "pipe_periodic_repeat")
-        {
-            pipe->set_pipe_periodic_repeat(std::max((unsigned int)1, parse_uint_attribute_value(attr_value)));
-        }
-        else if (attr_name == "pipe_consumer_repeat")
-        {
-            pipe->set_consumer_repeat(std::max((unsigned int)1, parse_uint_attribute_value(attr_value)));
-        }
-        else if (attr_name == "ethernet_chan")
-        {
-            // Ethernet channel for pipes is written as signed integer from net2pipe.
-            pipe->set_ethernet_channel(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "incoming_noc_id")
-        {
-            pipe->set_incoming_noc_id(static_cast<NOC_ROUTE>(parse_int_attribute_value(attr_value)));
-        }
-        else if (attr_name == "incoming_vc")
-        {
-            pipe->set_incoming_noc_vc(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "outgoing_noc_id")
-        {
-            pipe->set_outgoing_noc_id(static_cast<NOC_ROUTE>(parse_int_attribute_value(attr_value)));
-        }
-        else if (attr_name == "outgoing_vc")
-        {
-            pipe->set_outgoing_noc_vc(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "mmio_pipe")
-        {
-            pipe->set_is_mmio_pipe(parse_ulong_attribute_value(attr_value) != 0);
-        }
-        else if (attr_name == "mmio_pipe_downstream")
-        {
-            pipe->set_is_mmio_pipe_downstream(parse_ulong_attribute_value(attr_value) != 0);
-        }
-        else if (attr_name == "ethernet_pipe")
-        {
-            pipe->set_is_ethernet_pipe(parse_ulong_attribute_value(attr_value) != 0);
-        }
-        else if (attr_name == "dis_gather_opt")
-        {
-            pipe->set_gather_optimization_disabled(parse_ulong_attribute_value(attr_value) != 0);
-        }
-        else if (attr_name == "direct_mcast")
-        {
-            pipe->set_packer_multicast_optimization_enabled(parse_ulong_attribute_value(attr_value) != 0);
-        }
-        else if (attr_name == "op_input_dram_io_buf_size_tiles")
-        {
-            pipe->set_op_input_dram_io_buf_size_tiles(parse_ulong_attribute_value(attr_value));
-        }
-        else if (attr_name == "mcast_core_rc")
-        {
-            parse_pipe_mcast_locations(pipe.get(), attr_value);
-        }
-        else if (attr_name == "dram_pipe_total_readers")
-        {
-            pipe->set_dram_pipe_total_readers(parse_vector_of_ints(attr_value));
-        }
-        else if (attr_name == "dram_pipe_reader_index")
-        {
-            pipe->set_dram_pipe_reader_index(parse_vector_of_ints(attr_value));
-        }
-        else if (attr_name == "input_list")
-        {
-            parse_pipe_inputs(pipe.get(), attr_value);
-        }
-        else if (attr_name == "output_list")
-        {
-            parse_pipe_outputs(pipe.get(), attr_value);
-        }
-        else if (attr_name == "output_padding_list")
-        {
-            parse_pipe_output_padding_list(pipe.get(), attr_value);
-        }
+    pipe_graph.add_pipe(std::move(pipe));
+}
+
+void parse_pipe(const PipeGraphNodeDescription& pipe_description, PipeGraph& pipe_graph)
+{
+    std::unique_ptr<PGPipe> pipe = std::make_unique<PGPipe>();
+
+    if (pipe_description.attributes.empty())
+    {
+        return;
+    }
+
+    for (const auto& [attr_name, attr_value] : pipe_description.attributes)
+    {
+        set_pipe_attribute(pipe.get(), attr_name, attr_value);
     }
 
     pipe_graph.add_pipe(std::move(pipe));
 }
 
+void set_pipe_attribute(PGPipe* pipe, const std::string& attr_name, const PipeGraphAttributeValue& attr_value)
+{
+    if (attr_name == "id")
+    {
+        pipe->set_id(attr_value.get_ulong());
+    }
+    else if (attr_name == "pipe_periodic_repeat")
+    {
+        pipe->set_pipe_periodic_repeat(std::max((unsigned int)1, attr_value.get_uint()));
+    }
+    else if (attr_name == "pipe_consumer_repeat")
+    {
+        pipe->set_consumer_repeat(std::max((unsigned int)1, attr_value.get_uint()));
+    }
+    else if (attr_name == "ethernet_chan")
+    {
+        // Ethernet channel for pipes is written as signed integer from net2pipe.
+        pipe->set_ethernet_channel(attr_value.get_int());
+    }
+    else if (attr_name == "incoming_noc_id")
+    {
+        pipe->set_incoming_noc_id(static_cast<NOC_ROUTE>(attr_value.get_int()));
+    }
+    else if (attr_name == "incoming_vc")
+    {
+        pipe->set_incoming_noc_vc(attr_value.get_int());
+    }
+    else if (attr_name == "outgoing_noc_id")
+    {
+        pipe->set_outgoing_noc_id(static_cast<NOC_ROUTE>(attr_value.get_int()));
+    }
+    else if (attr_name == "outgoing_vc")
+    {
+        pipe->set_outgoing_noc_vc(attr_value.get_int());
+    }
+    else if (attr_name == "mmio_pipe")
+    {
+        pipe->set_is_mmio_pipe(attr_value.get_ulong() != 0);
+    }
+    else if (attr_name == "mmio_pipe_downstream")
+    {
+        pipe->set_is_mmio_pipe_downstream(attr_value.get_ulong() != 0);
+    }
+    else if (attr_name == "ethernet_pipe")
+    {
+        pipe->set_is_ethernet_pipe(attr_value.get_ulong() != 0);
+    }
+    else if (attr_name == "dis_gather_opt")
+    {
+        pipe->set_gather_optimization_disabled(attr_value.get_ulong() != 0);
+    }
+    else if (attr_name == "direct_mcast")
+    {
+        pipe->set_packer_multicast_optimization_enabled(attr_value.get_ulong() != 0);
+    }
+    else if (attr_name == "op_input_dram_io_buf_size_tiles")
+    {
+        pipe->set_op_input_dram_io_buf_size_tiles(attr_value.get_ulong());
+    }
+    else if (attr_name == "mcast_core_rc")
+    {
+        parse_pipe_mcast_locations(pipe, attr_value);
+    }
+    else if (attr_name == "dram_pipe_total_readers")
+    {
+        pipe->set_dram_pipe_total_readers(attr_value.get_vector_of_ints());
+    }
+    else if (attr_name == "dram_pipe_reader_index")
+    {
+        pipe->set_dram_pipe_reader_index(attr_value.get_vector_of_ints());
+    }
+    else if (attr_name == "input_list")
+    {
+        parse_pipe_inputs(pipe, attr_value);
+    }
+    else if (attr_name == "output_list")
+    {
+        parse_pipe_outputs(pipe, attr_value);
+    }
+    else if (attr_name == "output_padding_list")
+    {
+        parse_pipe_output_padding_list(pipe, attr_value);
+    }
+}
+
 void parse_buffer(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_graph)
 {
     std::unique_ptr<PGBuffer> buffer = std::make_unique<PGBuffer>();
@@ -131,252 +152,274 @@ void parse_buffer(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_gr
     {
         std::string attr_name, attr_value;
         parse_attribute(yaml_lines[i], attr_name, attr_value);
+        set_buffer_attribute(buffer.get(), attr_name, PipeGraphAttributeValue::from_text(attr_value));
+    }
 
-        if (attr_name == "md_op_name")
-        {
-            buffer->set_op_name(attr_value);
-        }
-        else if (attr_name == "buffer_type")
-        {
-            buffer->set_type(parse_buffer_type_string(attr_value));
-        }
-        else if (attr_name == "uniqid")
-        {
-            buffer->set_id(parse_ulong_attribute_value(attr_value));
-        }
-        else if (attr_name == "id")
-        {
-            parse_buffer_operand_id(buffer.get(), attr_value);
-        }
-        else if (attr_name == "epoch_tiles")
-        {
-            buffer->set_num_epoch_tiles(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "size_tiles")
-        {
-            buffer->set_size_tiles(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "tile_size")
-        {
-            buffer->set_tile_size(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "tiles_per_input")
-        {
-            buffer->set_num_tiles_per_input(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "scatter_gather_num_tiles")
-        {
-            buffer->set_scatter_gather_num_tiles(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "q_slots")
-        {
-            buffer->set_num_queue_slots(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_io_flag")
-        {
-            buffer->set_dram_io_flag(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_io_flag_is_remote")
-        {
-            buffer->set_dram_io_flag_is_remote(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_buf_streaming")
-        {
-            buffer->set_dram_buf_streaming(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_buf_flag")
-        {
-            buffer->set_dram_buf_flag(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "write_dram_buf_flag")
-        {
-            buffer->set_write_dram_buf_flag(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_ram_flag")
-        {
-            buffer->set_dram_ram_flag(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output")
-        {
-            buffer->set_moves_raw_data(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_full_r_dim")
-        {
-            buffer->set_untilized_output_full_r_dim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_full_c_dim")
-        {
-            buffer->set_untilized_output_full_c_dim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_r_dim")
-        {
-            buffer->set_untilized_output_r_dim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_c_dim")
-        {
-            buffer->set_untilized_output_c_dim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_z_dim")
-        {
-            buffer->set_untilized_output_z_dim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_type_0_zdim")
-        {
-            buffer->set_untilized_output_type_0_zdim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_type_1_zdim")
-        {
-            buffer->set_untilized_output_type_1_zdim(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "untilized_output_tile_dim_r")
-        {
-            unsigned int untilized_output_tile_dim_r = parse_uint_attribute_value(attr_value);
-            // If tile size is not set, leave the default value.
-            if (untilized_output_tile_dim_r > 0)
-            {
-                buffer->set_untilized_output_tile_dim_r(untilized_output_tile_dim_r);
-            }
-        }
-        else if (attr_name == "untilized_output_tile_dim_c")
-        {
-            unsigned int untilized_output_tile_dim_c = parse_uint_attribute_value(attr_value);
-            // If tile size is not set, leave the default value.
-            if (untilized_output_tile_dim_c > 0)
-            {
-                buffer->set_untilized_output_tile_dim_c(untilized_output_tile_dim_c);
-            }
-        }
-        else if (attr_name == "ublock_rt")
-        {
-            buffer->set_ublock_rt(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "ublock_ct")
-        {
-            buffer->set_ublock_ct(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "mblock_m")
-        {
-            buffer->set_mblock_m(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "mblock_n")
-        {
-            buffer->set_mblock_n(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "mblock_k")
-        {
-            buffer->set_mblock_k(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "tile_clear_granularity")
-        {
-            buffer->set_tile_clear_granularity(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "buffer_space_shared")
-        {
-            buffer->set_shared_space_buffer_id(parse_ulong_attribute_value(attr_value));
-        }
-        else if (attr_name == "producer_epoch_id")
-        {
-            buffer->set_producer_epoch_id(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "is_scatter")
-        {
-            buffer->set_is_scatter(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "replicate")
-        {
-            buffer->set_replicate_count(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "ethernet_chan")
-        {
-            buffer->set_ethernet_channel(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_chan")
-        {
-            buffer->set_dram_channel(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_sub_chan")
-        {
-            buffer->set_dram_sub_channel(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "dram_addr")
-        {
-            buffer->set_dram_address(parse_ulong_attribute_value(attr_value));
-        }
-        else if (attr_name == "chip_id")
-        {
-            parse_buffer_chip_id(buffer.get(), attr_value);
-        }
-        else if (attr_name == "core_coordinates")
-        {
-            parse_buffer_location(buffer.get(), attr_value);
-        }
-        else if (attr_name == "dram_prefetch_incoming_noc_id")
-        {
-            // All NOC IDs are assigned by net2pipe through the incoming/outgoing noc_id attributes of pipes.
-            // The only case where we need to tag buffers with NOC ID is for prefetch buffers, which have no
-            // explicit pipes for preloading.
-            buffer->set_dram_prefetch_incoming_noc_id(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "prefetch_type")
-        {
-            buffer->set_prefetch_type(static_cast<PrefetchType>(parse_int_attribute_value(attr_value)));
-        }
-        else if (attr_name == "embedding_table")
-        {
-            buffer->set_embedding_table(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "embedding_table_core_c_div")
-        {
-            buffer->set_embedding_table_core_c_div(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "embedding_table_row_size_per_core")
-        {
-            buffer->set_embedding_table_row_size_per_core(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "embedding_index")
-        {
-            buffer->set_embedding_index(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "embedding_indices_per_tile")
-        {
-            buffer->set_embedding_indices_per_tile(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "embedding_indices_per_input")
-        {
-            buffer->set_embedding_indices_per_input(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "hw_tilize")
-        {
-            buffer->set_hw_tilize(bool(parse_int_attribute_value(attr_value)));
-        }
-        else if (attr_name == "tilize_mblock_n_loop_num_rows")
-        {
-            buffer->set_tilize_mblock_n_loop_num_rows(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "tilize_row_col_offset")
-        {
-            buffer->set_tilize_row_col_offset(parse_uint_attribute_value(attr_value));
-        }
-        else if (attr_name == "is_padding")
-        {
-            buffer->set_is_padding(parse_int_attribute_value(attr_value));
-        }
-        else if (attr_name == "use_ethernet_fw_stream")
-        {
-            buffer->set_use_ethernet_fw_stream(bool(parse_int_attribute_value(attr_value)));
-        }
-        else if (attr_name == "overlay_blob_size")
+    check_buffer_constraints(buffer.get());
+    pipe_graph.add_buffer(std::move(buffer));
+}
+
+void parse_buffer(const PipeGraphNodeDescription& buffer_description, PipeGraph& pipe_graph)
+{
+    std::unique_ptr<PGBuffer> buffer = std::make_unique<PGBuffer>();
+
+    if (buffer_description.attributes.empty())
+    {
+        return;
+    }
+
+    for (const auto& [attr_name, attr_value] : buffer_description.attributes)
+    {
+        set_buffer_attribute(buffer.get(), attr_name, attr_value);
+    }
+
+    check_buffer_constraints(buffer.get());
+    pipe_graph.add_buffer(std::move(buffer));
+}
+
+void set_buffer_attribute(PGBuffer* buffer, const std::string& attr_name, const PipeGraphAttributeValue& attr_value)
+{
+    if (attr_name == "md_op_name")
+    {
+        buffer->set_op_name(attr_value.get_string());
+    }
+    else if (attr_name == "buffer_type")
+    {
+        buffer->set_type(parse_buffer_type_string(attr_value.get_string()));
+    }
+    else if (attr_name == "uniqid")
+    {
+        buffer->set_id(attr_value.get_ulong());
+    }
+    else if (attr_name == "id")
+    {
+        parse_buffer_operand_id(buffer, attr_value);
+    }
+    else if (attr_name == "epoch_tiles")
+    {
+        buffer->set_num_epoch_tiles(attr_value.get_uint());
+    }
+    else if (attr_name == "size_tiles")
+    {
+        buffer->set_size_tiles(attr_value.get_uint());
+    }
+    else if (attr_name == "tile_size")
+    {
+        buffer->set_tile_size(attr_value.get_uint());
+    }
+    else if (attr_name == "tiles_per_input")
+    {
+        buffer->set_num_tiles_per_input(attr_value.get_uint());
+    }
+    else if (attr_name == "scatter_gather_num_tiles")
+    {
+        buffer->set_scatter_gather_num_tiles(attr_value.get_uint());
+    }
+    else if (attr_name == "q_slots")
+    {
+        buffer->set_num_queue_slots(attr_value.get_uint());
+    }
+    else if (attr_name == "dram_io_flag")
+    {
+        buffer->set_dram_io_flag(attr_value.get_int());
+    }
+    else if (attr_name == "dram_io_flag_is_remote")
+    {
+        buffer->set_dram_io_flag_is_remote(attr_value.get_int());
+    }
+    else if (attr_name == "dram_buf_streaming")
+    {
+        buffer->set_dram_buf_streaming(attr_value.get_int());
+    }
+    else if (attr_name == "dram_buf_flag")
+    {
+        buffer->set_dram_buf_flag(attr_value.get_int());
+    }
+    else if (attr_name == "write_dram_buf_flag")
+    {
+        buffer->set_write_dram_buf_flag(attr_value.get_int());
+    }
+    else if (attr_name == "dram_ram_flag")
+    {
+        buffer->set_dram_ram_flag(attr_value.get_int());
+    }
+    else if (attr_name == "untilized_output")
+    {
+        buffer->set_moves_raw_data(attr_value.get_int());
+    }
+    else if (attr_name == "untilized_output_full_r_dim")
+    {
+        buffer->set_untilized_output_full_r_dim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_full_c_dim")
+    {
+        buffer->set_untilized_output_full_c_dim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_r_dim")
+    {
+        buffer->set_untilized_output_r_dim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_c_dim")
+    {
+        buffer->set_untilized_output_c_dim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_z_dim")
+    {
+        buffer->set_untilized_output_z_dim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_type_0_zdim")
+    {
+        buffer->set_untilized_output_type_0_zdim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_type_1_zdim")
+    {
+        buffer->set_untilized_output_type_1_zdim(attr_value.get_uint());
+    }
+    else if (attr_name == "untilized_output_tile_dim_r")
+    {
+        unsigned int untilized_output_tile_dim_r = attr_value.get_uint();
+        // If tile size is not set, leave the default value.
+        if (untilized_output_tile_dim_r > 0)
         {
-            buffer->set_overlay_blob_size(parse_uint_attribute_value(attr_value));
+            buffer->set_untilized_output_tile_dim_r(untilized_output_tile_dim_r);
         }
-        else if (attr_name == "is_post_tm_relay_buf")
+    }
+    else if (attr_name == "untilized_output_tile_dim_c")
+    {
+        unsigned int untilized_output_tile_dim_c = attr_value.get_uint();
+        // If tile size is not set, leave the default value.
+        if (untilized_output_tile_dim_c > 0)
         {
-            buffer->set_is_post_tm_relay_buf(bool(parse_int_attribute_value(attr_value)));
+            buffer->set_untilized_output_tile_dim_c(untilized_output_tile_dim_c);
         }
     }
-
-    check_buffer_constraints(buffer.get());
-    pipe_graph.add_buffer(std::move(buffer));
+    else if (attr_name == "ublock_rt")
+    {
+        buffer->set_ublock_rt(attr_value.get_uint());
+    }
+    else if (attr_name == "ublock_ct")
+    {
+        buffer->set_ublock_ct(attr_value.get_uint());
+    }
+    else if (attr_name == "mblock_m")
+    {
+        buffer->set_mblock_m(attr_value.get_uint());
+    }
+    else if (attr_name == "mblock_n")
+    {
+        buffer->set_mblock_n(attr_value.get_uint());
+    }
+    else if (attr_name == "mblock_k")
+    {
+        buffer->set_mblock_k(attr_value.get_uint());
+    }
+    else if (attr_name == "tile_clear_granularity")
+    {
+        buffer->set_tile_clear_granularity(attr_value.get_uint());
+    }
+    else if (attr_name == "buffer_space_shared")
+    {
+        buffer->set_shared_space_buffer_id(attr_value.get_ulong());
+    }
+    else if (attr_name == "producer_epoch_id")
+    {
+        buffer->set_producer_epoch_id(attr_value.get_int());
+    }
+    else if (attr_name == "is_scatter")
+    {
+        buffer->set_is_scatter(attr_value.get_int());
+    }
+    else if (attr_name == "replicate")
+    {
+        buffer->set_replicate_count(attr_value.get_uint());
+    }
+    else if (attr_name == "ethernet_chan")
+    {
+        buffer->set_ethernet_channel(attr_value.get_uint());
+    }
+    else if (attr_name == "dram_chan")
+    {
+        buffer->set_dram_channel(attr_value.get_uint());
+    }
+    else if (attr_name == "dram_sub_chan")
+    {
+        buffer->set_dram_sub_channel(attr_value.get_uint());
+    }
+    else if (attr_name == "dram_addr")
+    {
+        buffer->set_dram_address(attr_value.get_ulong());
+    }
+    else if (attr_name == "chip_id")
+    {
+        parse_buffer_chip_id(buffer, attr_value);
+    }
+    else if (attr_name == "core_coordinates")
+    {
+        parse_buffer_location(buffer, attr_value);
+    }
+    else if (attr_name == "dram_prefetch_incoming_noc_id")
+    {
+        // All NOC IDs are assigned by net2pipe through the incoming/outgoing noc_id attributes of pipes.
+        // The only case where we need to tag buffers with NOC ID is for prefetch buffers, which have no
+        // explicit pipes for preloading.
+        buffer->set_dram_prefetch_incoming_noc_id(attr_value.get_int());
+    }
+    else if (attr_name == "prefetch_type")
+    {
+        buffer->set_prefetch_type(static_cast<PrefetchType>(attr_value.get_int()));
+    }
+    else if (attr_name == "embedding_table")
+    {
+        buffer->set_embedding_table(attr_value.get_int());
+    }
+    else if (attr_name == "embedding_table_core_c_div")
+    {
+        buffer->set_embedding_table_core_c_div(attr_value.get_int());
+    }
+    else if (attr_name == "embedding_table_row_size_per_core")
+    {
+        buffer->set_embedding_table_row_size_per_core(attr_value.get_int());
+    }
+    else if (attr_name == "embedding_index")
+    {
+        buffer->set_embedding_index(attr_value.get_int());
+    }
+    else if (attr_name == "embedding_indices_per_tile")
+    {
+        buffer->set_embedding_indices_per_tile(attr_value.get_uint());
+    }
+    else if (attr_name == "embedding_indices_per_input")
+    {
+        buffer->set_embedding_indices_per_input(attr_value.get_uint());
+    }
+    else if (attr_name == "hw_tilize")
+    {
+        buffer->set_hw_tilize(bool(attr_value.get_int()));
+    }
+    else if (attr_name == "tilize_mblock_n_loop_num_rows")
+    {
+        buffer->set_tilize_mblock_n_loop_num_rows(attr_value.get_uint());
+    }
+    else if (attr_name == "tilize_row_col_offset")
+    {
+        buffer->set_tilize_row_col_offset(attr_value.get_uint());
+    }
+    else if (attr_name == "is_padding")
+    {
+        buffer->set_is_padding(attr_value.get_int());
+    }
+    else if (attr_name == "use_ethernet_fw_stream")
+    {
+        buffer->set_use_ethernet_fw_stream(bool(attr_value.get_int()));
+    }
+    else if (attr_name == "overlay_blob_size")
+    {
+        buffer->set_overlay_blob_size(attr_value.get_uint());
+    }
+    else if (attr_name == "is_post_tm_relay_buf")
+    {
+        buffer->set_is_post_tm_relay_buf(bool(attr_value.get_int()));
+    }
 }
 
 void parse_node(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_graph)
@@ -395,6 +438,22 @@ void parse_node(const std::vector<std::string>& yaml_lines, PipeGraph& pipe_grap
     }
 }
 
+void parse_node(const PipeGraphNodeDescription& node_description, PipeGraph& pipe_graph)
+{
+    if (string_starts_with(node_description.name, s_buffer_prefix))
+    {
+        parse_buffer(node_description, pipe_graph);
+    }
+    else if (string_starts_with(node_description.name, s_pipe_prefix))
+    {
+        parse_pipe(node_description, pipe_graph);
+    }
+    else
+    {
+        throw_parsing_error("Found graph node other than buffer and pipe");
+    }
+}
+
 void parse_graph(PipeGraph& pipe_graph, std::istream& input_stream)
 {
     if (input_stream.fail())
@@ -439,6 +498,14 @@ void parse_graph(PipeGraph& pipe_graph, std::istream& input_stream)
     }
 }
 
+void parse_graph(PipeGraph& pipe_graph, const PipeGraphDescription& pipe_graph_description)
+{
+    for (const PipeGraphNodeDescription& node_description : pipe_graph_description)
+    {
+        parse_node(node_description, pipe_graph);
+    }
+}
+
 void throw_parsing_error(const std::string& error_msg) { throw InvalidPipegenYamlException(error_msg); }
 
 void parse_attribute(const std::string& yaml_line, std::string& attr_name, std::string& attr_value)
@@ -497,7 +564,12 @@ std::uint64_t parse_ulong_attribute_value(const std::string& attr_value)
 
 void parse_buffer_operand_id(PGBuffer* buffer, const std::string& attr_value)
 {
-    buffer->set_operand_id(parse_int_attribute_value(attr_value));
+    parse_buffer_operand_id(buffer, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_buffer_operand_id(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value)
+{
+    buffer->set_operand_id(attr_value.get_int());
     if (buffer->get_operand_id() < 0)
     {
         throw_parsing_error("Operand ID is invalid");
@@ -506,7 +578,12 @@ void parse_buffer_operand_id(PGBuffer* buffer, const std::string& attr_value)
 
 void parse_buffer_chip_id(PGBuffer* buffer, const std::string& attr_value)
 {
-    std::vector<int> chip_ids = parse_vector_of_ints(attr_value);
+    parse_buffer_chip_id(buffer, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_buffer_chip_id(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value)
+{
+    std::vector<int> chip_ids = attr_value.get_vector_of_ints();
 
     // Currently chip id is a single number.
     if (chip_ids.size() != 1)
@@ -519,7 +596,12 @@ void parse_buffer_chip_id(PGBuffer* buffer, const std::string& attr_value)
 
 void parse_buffer_location(PGBuffer* buffer, const std::string& attr_value)
 {
-    std::vector<int> core_coordinates = parse_vector_of_ints(attr_value);
+    parse_buffer_location(buffer, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_buffer_location(PGBuffer* buffer, const PipeGraphAttributeValue& attr_value)
+{
+    std::vector<int> core_coordinates = attr_value.get_vector_of_ints();
 
     if (core_coordinates.size() != 2)
     {
@@ -533,16 +615,21 @@ void parse_buffer_location(PGBuffer* buffer, const std::string& attr_value)
 }
 
 void parse_pipe_mcast_locations(PGPipe* pipe, const std::string& attr_value)
+{
+    parse_pipe_mcast_locations(pipe, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_pipe_mcast_locations(PGPipe* pipe, const PipeGraphAttributeValue& attr_value)
 {
     std::vector<std::vector<int>> locations_coords;
 
-    if (string_starts_with(attr_value, "[["))
+    if (attr_value.is_two_dim_list())
     {
-        locations_coords = parse_two_dim_vector_of_ints(attr_value);
+        locations_coords = attr_value.get_two_dim_vector_of_ints();
     }
     else
     {
-        locations_coords.push_back(parse_vector_of_ints(attr_value));
+        locations_coords.push_back(attr_value.get_vector_of_ints());
     }
 
     for (const std::vector<int>& location_coords : locations_coords)
@@ -559,21 +646,36 @@ void parse_pipe_mcast_locations(PGPipe* pipe, const std::string& attr_value)
 
 void parse_pipe_inputs(PGPipe* pipe, const std::string& attr_value)
 {
-    pipe->set_input_buffers_ids(convert_ul_to_node_id_vector(parse_vector_of_ulongs(attr_value)));
+    parse_pipe_inputs(pipe, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_pipe_inputs(PGPipe* pipe, const PipeGraphAttributeValue& attr_value)
+{
+    pipe->set_input_buffers_ids(convert_ul_to_node_id_vector(attr_value.get_vector_of_ulongs()));
 }
 
 void parse_pipe_output_padding_list(PGPipe* pipe, const std::string& attr_value)
 {
-    pipe->set_output_padding_buffers_ids(convert_ul_to_node_id_vector(parse_vector_of_ulongs(attr_value)));
+    parse_pipe_output_padding_list(pipe, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_pipe_output_padding_list(PGPipe* pipe, const PipeGraphAttributeValue& attr_value)
+{
+    pipe->set_output_padding_buffers_ids(convert_ul_to_node_id_vector(attr_value.get_vector_of_ulongs()));
 }
 
 void parse_pipe_outputs(PGPipe* pipe, const std::string& attr_value)
+{
+    parse_pipe_outputs(pipe, PipeGraphAttributeValue::from_text(attr_value));
+}
+
+void parse_pipe_outputs(PGPipe* pipe, const PipeGraphAttributeValue& attr_value)
 {
     std::vector<std::vector<NodeId>> outputNodesIds;
 
-    if (string_starts_with(attr_value, "[["))
+    if (attr_value.is_two_dim_list())
     {
-        std::vector<std::vector<std::uint64_t>> ul_ids_vec = parse_two_dim_vector_of_ulongs(attr_value);
+        std::vector<std::vector<std::uint64_t>> ul_ids_vec = attr_value.get_two_dim_vector_of_ulongs();
         for (const std::vector<std::uint64_t>& ul_ids : ul_ids_vec)
         {
             outputNodesIds.push_back(convert_ul_to_node_id_vector(ul_ids));
@@ -581,7 +683,7 @@ void parse_pipe_outputs(PGPipe* pipe, const std::string& attr_value)
     }
     else
     {
-        outputNodesIds.push_back(convert_ul_to_node_id_vector(parse_vector_of_ulongs(attr_value)));
+        outputNodesIds.push_back(convert_ul_to_node_id_vector(attr_value.get_vector_of_ulongs()));
     }
 
     pipe->set_output_buffers_ids(outputNodesIds);
@@ -36,6 +36,18 @@ std::unique_ptr<StreamGraphCollection> Pipegen2::create_stream_graphs(
     const std::string& pipegen_yaml_path, int epoch_num)
 {
     create_pipe_graph(pipegen_yaml_path);
+    return create_stream_graphs_from_pipe_graph(epoch_num);
+}
+
+std::unique_ptr<StreamGraphCollection> Pipegen2::create_stream_graphs(
+    const PipeGraphDescription& pipe_graph_description, int epoch_num)
+{
+    create_pipe_graph(pipe_graph_description);
+    return create_stream_graphs_from_pipe_graph(epoch_num);
+}
+
+std::unique_ptr<StreamGraphCollection> Pipegen2::create_stream_graphs_from_pipe_graph(int epoch_num)
+{
     create_resource_manager();
     create_rational_graphs();
     create_stream_graphs(epoch_num);
@@ -50,6 +62,12 @@ void Pipegen2::create_pipe_graph(const std::string& pipegen_yaml_path)
     m_pipe_graph = pipe_graph_creator.create_pipe_graph(pipegen_yaml_path);
 }
 
+void Pipegen2::create_pipe_graph(const PipeGraphDescription& pipe_graph_description)
+{
+    PipeGraphCreator pipe_graph_creator;
+    m_pipe_graph = pipe_graph_creator.create_pipe_graph(pipe_graph_description);
+}
+
 std::unique_ptr<ForkJoinGraphCollection> Pipegen2::create_fork_join_graphs()
 {
     ForkJoinGraphCreator fork_join_graph_creator;
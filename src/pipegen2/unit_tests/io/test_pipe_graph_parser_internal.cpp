@@ -1162,6 +1162,103 @@ TEST(Pipegen2_PipeGraphParserInternal, ParseGraph_ParsePipeAndBuffer)
     EXPECT_EQ(buffer.get_type(), BufferType::kUnpacker);
 }
 
+TEST(Pipegen2_PipeGraphParserInternal, ParseGraph_DescriptionMatchesStream)
+{
+    constexpr std::uint64_t buffer_id = 106000000000;
+    constexpr std::uint64_t pipe_id = 109000000000;
+    constexpr std::uint64_t output_buffer_ids[2][2] = {{106000000001, 106000000002}, {106000000003, 106000000004}};
+    std::string graph_data = "graph_name: test_op\n";
+    graph_data += "---\n";
+    graph_data += "buffer_" + std::to_string(buffer_id) + ":\n";
+    graph_data += "md_op_name: target_op0\n";
+    graph_data += "buffer_type: unpacker\n";
+    graph_data += "id: 0\n";
+    graph_data += "uniqid: " + std::to_string(buffer_id) + "\n";
+    graph_data += "chip_id: [0]\n";
+    graph_data += "core_coordinates: [1, 2]\n";
+    graph_data += "---\n";
+    graph_data += "pipe_" + std::to_string(pipe_id) + ":\n";
+    graph_data += "id: " + std::to_string(pipe_id) + "\n";
+    graph_data += "input_list: [" + std::to_string(buffer_id) + "]\n";
+    graph_data += "output_list: [[" + std::to_string(output_buffer_ids[0][0]) + ", " +
+                  std::to_string(output_buffer_ids[0][1]) + "], [" + std::to_string(output_buffer_ids[1][0]) + ", " +
+                  std::to_string(output_buffer_ids[1][1]) + "]]\n";
+    graph_data += "mcast_core_rc: [0, 3, 4]\n";
+    graph_data += "ethernet_chan: -1\n";
+
+    // The same graph as net2pipe hands it over in memory, with numbers and lists instead of their text.
+    auto make_list = [](const std::vector<std::uint64_t>& numbers)
+    {
+        PipeGraphAttributeValue list = PipeGraphAttributeValue::from_list();
+        for (std::uint64_t number : numbers)
+        {
+            list.add_element(PipeGraphAttributeValue::from_number(static_cast<std::int64_t>(number)));
+        }
+        return list;
+    };
+    PipeGraphNodeDescription buffer_description{"buffer_" + std::to_string(buffer_id), {}};
+    buffer_description.attributes.emplace_back("md_op_name", PipeGraphAttributeValue::from_text("target_op0"));
+    buffer_description.attributes.emplace_back("buffer_type", PipeGraphAttributeValue::from_text("unpacker"));
+    buffer_description.attributes.emplace_back("id", PipeGraphAttributeValue::from_number(0));
+    buffer_description.attributes.emplace_back("uniqid", PipeGraphAttributeValue::from_number(buffer_id));
+    buffer_description.attributes.emplace_back("chip_id", make_list({0}));
+    buffer_description.attributes.emplace_back("core_coordinates", make_list({1, 2}));
+    PipeGraphNodeDescription pipe_description{"pipe_" + std::to_string(pipe_id), {}};
+    pipe_description.attributes.emplace_back("id", PipeGraphAttributeValue::from_number(pipe_id));
+    pipe_description.attributes.emplace_back("input_list", make_list({buffer_id}));
+    PipeGraphAttributeValue output_list = PipeGraphAttributeValue::from_list();
+    for (const auto& scatter_output_buffer_ids : output_buffer_ids)
+    {
+        output_list.add_element(make_list({scatter_output_buffer_ids[0], scatter_output_buffer_ids[1]}));
+    }
+    pipe_description.attributes.emplace_back("output_list", std::move(output_list));
+    pipe_description.attributes.emplace_back("mcast_core_rc", make_list({0, 3, 4}));
+    pipe_description.attributes.emplace_back("ethernet_chan", PipeGraphAttributeValue::from_number(-1));
+    const PipeGraphDescription pipe_graph_description = {buffer_description, pipe_description};
+
+    std::stringstream string_stream(graph_data);
+    PipeGraph stream_pipe_graph;
+    parse_graph(stream_pipe_graph, string_stream);
+    PipeGraph description_pipe_graph;
+    parse_graph(description_pipe_graph, pipe_graph_description);
+
+    ASSERT_EQ(description_pipe_graph.get_pipes().size(), 1);
+    ASSERT_EQ(description_pipe_graph.get_buffers().size(), 1);
+    const PGBuffer& stream_buffer = *stream_pipe_graph.get_buffers()[0];
+    const PGBuffer& description_buffer = *description_pipe_graph.get_buffers()[0];
+    EXPECT_EQ(description_buffer.get_id(), buffer_id);
+    EXPECT_EQ(description_buffer.get_op_name(), stream_buffer.get_op_name());
+    EXPECT_EQ(description_buffer.get_type(), BufferType::kUnpacker);
+    EXPECT_EQ(description_buffer.get_logical_location(), stream_buffer.get_logical_location());
+    const PGPipe& stream_pipe = *stream_pipe_graph.get_pipes()[0];
+    const PGPipe& description_pipe = *description_pipe_graph.get_pipes()[0];
+    EXPECT_EQ(description_pipe.get_id(), pipe_id);
+    EXPECT_EQ(description_pipe.get_input_buffers_ids(), stream_pipe.get_input_buffers_ids());
+    EXPECT_EQ(description_pipe.get_output_buffers_ids(), stream_pipe.get_output_buffers_ids());
+    EXPECT_EQ(description_pipe.get_output_buffers_ids().size(), 2);
+    EXPECT_EQ(description_pipe.get_mcast_core_logical_locations(), stream_pipe.get_mcast_core_logical_locations());
+    EXPECT_EQ(description_pipe.get_ethernet_channel(), stream_pipe.get_ethernet_channel());
+}
+
+TEST(Pipegen2_PipeGraphParserInternal, ParseGraph_DescriptionWrongNode)
+{
+    PipeGraphNodeDescription node_description{"queue_0", {}};
+    node_description.attributes.emplace_back("id", PipeGraphAttributeValue::from_number(0));
+
+    PipeGraph pipe_graph;
+    EXPECT_THROW(parse_graph(pipe_graph, PipeGraphDescription{node_description}), InvalidPipegenYamlException);
+}
+
+TEST(Pipegen2_PipeGraphParserInternal, ParseGraph_DescriptionWrongAttributeValue)
+{
+    // Buffer location handed over as a single number instead of a list of coordinates.
+    PipeGraphNodeDescription buffer_description{"buffer_0", {}};
+    buffer_description.attributes.emplace_back("core_coordinates", PipeGraphAttributeValue::from_number(1));
+
+    PipeGraph pipe_graph;
+    EXPECT_THROW(parse_graph(pipe_graph, PipeGraphDescription{buffer_description}), InvalidPipegenYamlException);
+}
+
 TEST(Pipegen2_PipeGraphParserInternal, ParseGraph_CommentSuccess)
 {
     constexpr std::uint64_t buffer_id = 106000000000;
@@ -3,9 +3,16 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "verif_comparison.hpp"
 
+#include <array>
 #include <iomanip>
+#include <tuple>
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
 
 #include "common/tensor_lib.hpp"
+#include "common/tt_parallel_for.h"
 #include "utils/logger.hpp"
 #include "verif_test_config.hpp"
 #include "yaml-cpp/yaml.h"
@@ -166,85 +173,236 @@ std::tuple<bool, double> allclose(
     return std::tie(close, total_matched_pct);
 }
 
-bool exact_compare_on_vectors(vector<float>::iterator lhs, const vector<float>::iterator rhs, int num_datums_to_check){
-    bool match = true;
-    for(int idx = 0; idx < num_datums_to_check; idx++){
-        match &= *(lhs + idx) == *(rhs + idx);
-    }
-    return match;
+namespace {
+// Relative errors at or above which a finite datum moves to the next histogram bin, the first bin holds exact matches
+constexpr std::array<double, FLAT_COMPARISON_REL_ERROR_BINS - 1> REL_ERROR_BIN_EDGES = {
+    0.0, 1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1.0};
+
+// Sums of a slice for its Pearson correlation, over values with nan as 0 and inf as +-MAXFLOAT
+struct pcc_sums {
+    double sum_t1 = 0;
+    double sum_t2 = 0;
+    double square_sum_t1 = 0;
+    double square_sum_t2 = 0;
+    double sum_t1_t2 = 0;
+    bool is_same_t1 = true;
+    bool is_same_t2 = true;
+};
+
+struct slice_stats {
+    std::size_t num_mismatches = 0;
+    std::size_t num_unequal = 0;
+    std::size_t num_nonfinite = 0;
+    float max_abs_error = 0;
+    double max_rel_error = 0;
+    // Finite datums with a relative error above the first edge and at or above the others
+    std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS - 1> num_at_or_above_edge = {};
+    pcc_sums pcc;
+};
+
+float clamp_to_num(float in) {
+    return static_cast<float>(nan_to_num(inf_to_num(in)));
 }
 
-bool allclose_on_vectors(vector<float>::iterator lhs, vector<float>::iterator rhs, double rtol, double atol, double pct_matched, int num_datums_to_check, double& total_pct_across_threads, std::mutex& pct_mutex){
-    bool close = true;
-    int total_mismatches = 0;
-    for(int idx = 0; idx < num_datums_to_check; idx++){
-        if(isnan(*(lhs + idx)) or isnan(*(rhs + idx))){
-            total_mismatches += (isnan(*(lhs + idx)) and isnan(*(rhs + idx))) ? 0 : 1;
-        }
-        else if(isinf(*(lhs + idx)) or isinf(*(rhs + idx))){
-            total_mismatches += inf_compare(*(lhs + idx), *(rhs + idx)) ? 0 : 1;
-        }
-        else{
-            bool nums_close = fabs(*(lhs + idx) - *(rhs + idx)) <= (atol + rtol * std::max(fabs(*(lhs + idx)), fabs(*(rhs + idx))));
-            total_mismatches += nums_close ? 0 : 1;
-        }
+// Allclose of a datum with a nan or inf on either side, like numpy isclose with equal_nan
+bool nonfinite_close(float a, float b) {
+    if (isnan(a) or isnan(b)) {
+        return isnan(a) and isnan(b);
     }
-    double total_matched_pct = (num_datums_to_check - double(total_mismatches))/ num_datums_to_check;
+    return inf_compare(a, b);
+}
 
-    std::lock_guard<std::mutex> lock(pct_mutex); // guard shared resource
-    total_pct_across_threads = total_pct_across_threads + total_matched_pct;
-    bool pass = total_matched_pct >= pct_matched;
-    if(!pass) log_error("AllClose Check Failed on Vector Slice with pct = {}", total_matched_pct);
-    return pass;
+// Tolerance of a finite datum in double like allclose on tiles, as one fma so the vectorized path gets the same bits
+double allclose_tolerance(float a, float b, double rtol, double atol) {
+    return std::fma(rtol, static_cast<double>(std::max(fabs(a), fabs(b))), atol);
 }
 
-bool pcc_compare_on_vectors(vector<float>::iterator lhs, vector<float>::iterator rhs, double rtol, double atol, double pass_pcc, int num_datums_to_check, double& total_pcc){
-    bool pass = false;
-    if (fabs(pass_pcc) > 1.0) {
-        log_fatal("pcc_compare: pcc_compare must be -1 <= x <= 1");
+void accumulate_datum(float a, float b, double rtol, double atol, float first_t1, float first_t2, slice_stats &stats) {
+    stats.num_unequal += a == b ? 0 : 1;
+    if (isfinite(a) and isfinite(b)) {
+        const float abs_error = fabs(a - b);
+        stats.num_mismatches += abs_error <= allclose_tolerance(a, b, rtol, atol) ? 0 : 1;
+        stats.max_abs_error = std::max(stats.max_abs_error, abs_error);
+        const double rel_error =
+            static_cast<double>(abs_error) / (b == 0.0f ? numeric_limits<float>::min() : fabs(static_cast<double>(b)));
+        stats.max_rel_error = std::max(stats.max_rel_error, rel_error);
+        stats.num_at_or_above_edge[0] += rel_error > REL_ERROR_BIN_EDGES[0] ? 1 : 0;
+        for (std::size_t edge = 1; edge < REL_ERROR_BIN_EDGES.size(); edge++) {
+            stats.num_at_or_above_edge[edge] += rel_error >= REL_ERROR_BIN_EDGES[edge] ? 1 : 0;
+        }
+    } else {
+        stats.num_nonfinite++;
+        stats.num_mismatches += nonfinite_close(a, b) ? 0 : 1;
     }
 
-    if ((rtol < 0.0) || (atol < 0.0)) {
-        log_fatal("pcc_compare: rtol and atol must be non-negative!");
-    }
+    const double num1 = clamp_to_num(a);
+    const double num2 = clamp_to_num(b);
+    stats.pcc.is_same_t1 = stats.pcc.is_same_t1 && (num1 == first_t1);
+    stats.pcc.is_same_t2 = stats.pcc.is_same_t2 && (num2 == first_t2);
+    stats.pcc.sum_t1 += num1;
+    stats.pcc.square_sum_t1 += num1 * num1;
+    stats.pcc.sum_t2 += num2;
+    stats.pcc.square_sum_t2 += num2 * num2;
+    stats.pcc.sum_t1_t2 += num1 * num2;
+}
 
-    double sum_t1 = 0;
-    double sum_t2 = 0;
-    double square_sum_t1 = 0;
-    double square_sum_t2 = 0;
-    double sum_t1_t2 = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+inline double hsum_pd(__m256d v) {
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
 
-    bool is_same_t1 = true;
-    bool is_same_t2 = true;
+inline double hmax_pd(__m256d v) {
+    __m128d max = _mm_max_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(max, _mm_unpackhi_pd(max, max)));
+}
 
-    const double first_val_t1 = nan_to_num(inf_to_num(static_cast<double>(*lhs)));
-    const double first_val_t2 = nan_to_num(inf_to_num(static_cast<double>(*rhs)));
+inline float hmax_ps(__m256 v) {
+    __m128 max = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+    return _mm_cvtss_f32(_mm_max_ss(max, _mm_shuffle_ps(max, max, 1)));
+}
+
+// Accumulates datums [0, num_datums - num_datums % 8) of a slice, 8 at a time. Lanes with a nan or inf are rare and
+// handed to the scalar checks.
+std::size_t accumulate_datums_avx2(
+    const float *lhs, const float *rhs, std::size_t num_datums, double rtol, double atol, float first_t1, float first_t2,
+    slice_stats &stats) {
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    const __m256 inf = _mm256_set1_ps(numeric_limits<float>::infinity());
+    const __m256 max_float = _mm256_set1_ps(MAXFLOAT);
+    const __m256 min_float = _mm256_set1_ps(-MAXFLOAT);
+    const __m256 smallest_float = _mm256_set1_ps(numeric_limits<float>::min());
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256d rtol_v = _mm256_set1_pd(rtol);
+    const __m256d atol_v = _mm256_set1_pd(atol);
+    const __m256 first_t1_v = _mm256_set1_ps(first_t1);
+    const __m256 first_t2_v = _mm256_set1_ps(first_t2);
+
+    __m256 max_abs_error = zero;
+    __m256d max_rel_error = _mm256_setzero_pd();
+    __m256d sum_t1 = _mm256_setzero_pd();
+    __m256d sum_t2 = _mm256_setzero_pd();
+    __m256d square_sum_t1 = _mm256_setzero_pd();
+    __m256d square_sum_t2 = _mm256_setzero_pd();
+    __m256d sum_t1_t2 = _mm256_setzero_pd();
+    int same_t1 = 0xff;
+    int same_t2 = 0xff;
+
+    const std::size_t num_vector_datums = num_datums - num_datums % 8;
+    for (std::size_t i = 0; i < num_vector_datums; i += 8) {
+        const __m256 a = _mm256_loadu_ps(lhs + i);
+        const __m256 b = _mm256_loadu_ps(rhs + i);
+        const __m256 abs_a = _mm256_andnot_ps(sign_mask, a);
+        const __m256 abs_b = _mm256_andnot_ps(sign_mask, b);
+        const __m256 finite =
+            _mm256_and_ps(_mm256_cmp_ps(abs_a, inf, _CMP_LT_OQ), _mm256_cmp_ps(abs_b, inf, _CMP_LT_OQ));
+        const int finite_lanes = _mm256_movemask_ps(finite);
+
+        stats.num_unequal += 8 - __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+
+        // Allclose and errors of the finite lanes, the others get an error of 0 here
+        const __m256 abs_error = _mm256_and_ps(_mm256_andnot_ps(sign_mask, _mm256_sub_ps(a, b)), finite);
+        const __m256 max_abs = _mm256_max_ps(abs_a, abs_b);
+        int close_lanes = 0;
+        for (int half = 0; half < 2; half++) {
+            const __m128 abs_error_half = half == 0 ? _mm256_castps256_ps128(abs_error) : _mm256_extractf128_ps(abs_error, 1);
+            const __m128 max_abs_half = half == 0 ? _mm256_castps256_ps128(max_abs) : _mm256_extractf128_ps(max_abs, 1);
+            const __m256d tolerance = _mm256_fmadd_pd(rtol_v, _mm256_cvtps_pd(max_abs_half), atol_v);
+            close_lanes |= _mm256_movemask_pd(_mm256_cmp_pd(_mm256_cvtps_pd(abs_error_half), tolerance, _CMP_LE_OQ)) << (4 * half);
+        }
+        stats.num_mismatches += __builtin_popcount(finite_lanes & ~close_lanes);
+        max_abs_error = _mm256_max_ps(max_abs_error, abs_error);
+
+        __m256 denominator = _mm256_blendv_ps(abs_b, smallest_float, _mm256_cmp_ps(b, zero, _CMP_EQ_OQ));
+        denominator = _mm256_blendv_ps(one, denominator, finite);
+        const __m256d rel_error_lo = _mm256_div_pd(
+            _mm256_cvtps_pd(_mm256_castps256_ps128(abs_error)), _mm256_cvtps_pd(_mm256_castps256_ps128(denominator)));
+        const __m256d rel_error_hi = _mm256_div_pd(
+            _mm256_cvtps_pd(_mm256_extractf128_ps(abs_error, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(denominator, 1)));
+        max_rel_error = _mm256_max_pd(max_rel_error, _mm256_max_pd(rel_error_lo, rel_error_hi));
+        for (std::size_t edge = 0; edge < REL_ERROR_BIN_EDGES.size(); edge++) {
+            const __m256d edge_v = _mm256_set1_pd(REL_ERROR_BIN_EDGES[edge]);
+            const int above_lo = edge == 0 ? _mm256_movemask_pd(_mm256_cmp_pd(rel_error_lo, edge_v, _CMP_GT_OQ))
+                                           : _mm256_movemask_pd(_mm256_cmp_pd(rel_error_lo, edge_v, _CMP_GE_OQ));
+            const int above_hi = edge == 0 ? _mm256_movemask_pd(_mm256_cmp_pd(rel_error_hi, edge_v, _CMP_GT_OQ))
+                                           : _mm256_movemask_pd(_mm256_cmp_pd(rel_error_hi, edge_v, _CMP_GE_OQ));
+            stats.num_at_or_above_edge[edge] += __builtin_popcount(above_lo | (above_hi << 4));
+        }
 
-    for(int idx = 0; idx < num_datums_to_check; idx++){
-        double num1 = nan_to_num(inf_to_num((double)*(lhs + idx)));
-        double num2 = nan_to_num(inf_to_num((double)*(rhs + idx)));
+        if (finite_lanes != 0xff) {
+            for (int lane = 0; lane < 8; lane++) {
+                if (not(finite_lanes & (1 << lane))) {
+                    stats.num_nonfinite++;
+                    stats.num_mismatches += nonfinite_close(lhs[i + lane], rhs[i + lane]) ? 0 : 1;
+                }
+            }
+        }
 
-        is_same_t1 = is_same_t1 && (num1 == first_val_t1);
-        is_same_t2 = is_same_t2 && (num2 == first_val_t2);
+        // PCC sums in double with nan as 0 and inf as +-MAXFLOAT
+        const __m256 num1 = _mm256_min_ps(
+            _mm256_max_ps(_mm256_and_ps(a, _mm256_cmp_ps(a, a, _CMP_ORD_Q)), min_float), max_float);
+        const __m256 num2 = _mm256_min_ps(
+            _mm256_max_ps(_mm256_and_ps(b, _mm256_cmp_ps(b, b, _CMP_ORD_Q)), min_float), max_float);
+        same_t1 &= _mm256_movemask_ps(_mm256_cmp_ps(num1, first_t1_v, _CMP_EQ_OQ));
+        same_t2 &= _mm256_movemask_ps(_mm256_cmp_ps(num2, first_t2_v, _CMP_EQ_OQ));
+        for (int half = 0; half < 2; half++) {
+            const __m256d num1_d = _mm256_cvtps_pd(half == 0 ? _mm256_castps256_ps128(num1) : _mm256_extractf128_ps(num1, 1));
+            const __m256d num2_d = _mm256_cvtps_pd(half == 0 ? _mm256_castps256_ps128(num2) : _mm256_extractf128_ps(num2, 1));
+            sum_t1 = _mm256_add_pd(sum_t1, num1_d);
+            sum_t2 = _mm256_add_pd(sum_t2, num2_d);
+            square_sum_t1 = _mm256_fmadd_pd(num1_d, num1_d, square_sum_t1);
+            square_sum_t2 = _mm256_fmadd_pd(num2_d, num2_d, square_sum_t2);
+            sum_t1_t2 = _mm256_fmadd_pd(num1_d, num2_d, sum_t1_t2);
+        }
+    }
 
-        sum_t1 += num1;                  // Sum of elements of tile1
-        square_sum_t1 += (num1 * num1);  // Sum of square of tile1 elements.
-        sum_t2 += num2;                  // Sum of elements of tile2
-        square_sum_t2 += (num2 * num2);  // Sum of square of tile2 elements.
-        sum_t1_t2 += (num1 * num2);
+    stats.max_abs_error = std::max(stats.max_abs_error, hmax_ps(max_abs_error));
+    stats.max_rel_error = std::max(stats.max_rel_error, hmax_pd(max_rel_error));
+    stats.pcc.sum_t1 += hsum_pd(sum_t1);
+    stats.pcc.sum_t2 += hsum_pd(sum_t2);
+    stats.pcc.square_sum_t1 += hsum_pd(square_sum_t1);
+    stats.pcc.square_sum_t2 += hsum_pd(square_sum_t2);
+    stats.pcc.sum_t1_t2 += hsum_pd(sum_t1_t2);
+    stats.pcc.is_same_t1 = stats.pcc.is_same_t1 && same_t1 == 0xff;
+    stats.pcc.is_same_t2 = stats.pcc.is_same_t2 && same_t2 == 0xff;
+    return num_vector_datums;
+}
+#endif
+
+slice_stats accumulate_slice(
+    const float *lhs, const float *rhs, std::size_t num_datums, double rtol, double atol, [[maybe_unused]] bool vectorized) {
+    slice_stats stats;
+    const float first_t1 = clamp_to_num(lhs[0]);
+    const float first_t2 = clamp_to_num(rhs[0]);
+    std::size_t i = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+    if (vectorized) {
+        i = accumulate_datums_avx2(lhs, rhs, num_datums, rtol, atol, first_t1, first_t2, stats);
+    }
+#endif
+    for (; i < num_datums; i++) {
+        accumulate_datum(lhs[i], rhs[i], rtol, atol, first_t1, first_t2, stats);
     }
+    return stats;
+}
 
-    double mean_t1 = sum_t1 / num_datums_to_check;
-    double mean_t2 = sum_t2 / num_datums_to_check;
-    double var_t1 = (square_sum_t1 / num_datums_to_check) - (mean_t1 * mean_t1);
-    double var_t2 = (square_sum_t2 / num_datums_to_check) - (mean_t2 * mean_t2);
+// PCC of a slice from its sums and whether it passes pass_pcc, slices of (nearly) constant values pass as 1.0
+std::tuple<bool, double> evaluate_pcc(
+    const pcc_sums &sums, std::size_t num_datums, double rtol, double atol, double pass_pcc) {
+    const double n = static_cast<double>(num_datums);
+    double mean_t1 = sums.sum_t1 / n;
+    double mean_t2 = sums.sum_t2 / n;
+    double var_t1 = (sums.square_sum_t1 / n) - (mean_t1 * mean_t1);
+    double var_t2 = (sums.square_sum_t2 / n) - (mean_t2 * mean_t2);
     double mean_delta = fabs(mean_t1 - mean_t2);
     // use allclose condition to prevent false pass
     bool pass_threshold = (mean_delta <= (atol + rtol * mean_t2));
-    bool tiles_identical = pass_threshold && is_same_t1 && is_same_t2;
+    bool tiles_identical = pass_threshold && sums.is_same_t1 && sums.is_same_t2;
 
-    double ratio_t1 = (mean_t1 * mean_t1) / (square_sum_t1 / num_datums_to_check);
-    double ratio_t2 = (mean_t2 * mean_t2) / (square_sum_t2 / num_datums_to_check);
+    double ratio_t1 = (mean_t1 * mean_t1) / (sums.square_sum_t1 / n);
+    double ratio_t2 = (mean_t2 * mean_t2) / (sums.square_sum_t2 / n);
     bool rnd_err_t1 = (var_t1 < 0 && ratio_t1 >= 1.00 && ratio_t1 <= 1.0000001);
     bool rnd_err_t2 = (var_t2 < 0 && ratio_t2 >= 1.00 && ratio_t2 <= 1.0000001);
     if (rnd_err_t1)
@@ -252,11 +410,11 @@ bool pcc_compare_on_vectors(vector<float>::iterator lhs, vector<float>::iterator
     if (rnd_err_t2)
         var_t2 = 0.0f;
 
-    double stdev_t1 = sqrt(var_t1);                                           // Standard deviation for tile1
-    double stdev_t2 = sqrt(var_t2);                                           // Standard deviation for tile2
-    double cov_t1_t2 = (sum_t1_t2 / num_datums_to_check) - (mean_t1 * mean_t2);  // Covariance of tile1 and tile2
+    double stdev_t1 = sqrt(var_t1);                                // Standard deviation for tile1
+    double stdev_t2 = sqrt(var_t2);                                // Standard deviation for tile2
+    double cov_t1_t2 = (sums.sum_t1_t2 / n) - (mean_t1 * mean_t2);  // Covariance of tile1 and tile2
 
-    double ratio_cov = (mean_t1 * mean_t2) / (sum_t1_t2 / num_datums_to_check);
+    double ratio_cov = (mean_t1 * mean_t2) / (sums.sum_t1_t2 / n);
     bool rnd_err_cov = (cov_t1_t2 < 0 && ratio_cov >= 1.00 && ratio_cov <= 1.0000001);
     if (rnd_err_cov)
         cov_t1_t2 = 0.0f;  // correct neg rounding error
@@ -269,15 +427,14 @@ bool pcc_compare_on_vectors(vector<float>::iterator lhs, vector<float>::iterator
         stdev_t2 = 0.00001;
 
     double pcc = (cov_t1_t2) / (stdev_t1 * stdev_t2);
-    total_pcc += pcc;
-    
+
     if (cov_t1_t2 == 0.0)
         log_debug(tt::LogVerif, "pcc_compare: Covariance for two tiles is 0. Data in two tiles might be independent");
-    
+
+    bool pass = false;
     bool sign_equal = signbit(pcc) == signbit(pass_pcc);
-    
     if (fabs(pcc) >= fabs(pass_pcc) && sign_equal) {
-        pass = fabs(pcc) <=  1.0000001;
+        pass = fabs(pcc) <= 1.0000001;
     } else if (tiles_identical or tiles_very_close) {
         pass = true;
         log_debug(
@@ -290,17 +447,14 @@ bool pcc_compare_on_vectors(vector<float>::iterator lhs, vector<float>::iterator
             tt::LogVerif,
             "   resulting in a coefficient of effectively 0, thus Pearson's correlation is not defined and we assume "
             "tile is fine");
-
         pcc = 1.0;
     } else if (pass_pcc == 0.0) {
         pass = true;
         log_warning(tt::LogVerif, "pcc_compare skipped due to pass_pcc being set to 0");
-    } else {
-        pass = false;
     }
-    if(!pass) log_error("PCC Check Failed on Vector Slice with pcc = {}", pcc);
-    return pass;
+    return std::make_tuple(pass, pcc);
 }
+}  // namespace
 
 /*
     Compare two tiles using Pearson correlation coefficient (PCC). PCC it is a measure of the linear correlation between
@@ -450,86 +604,177 @@ std::tuple<bool, double> pcc_compare(
     log_debug(tt::LogVerif, "{}", out_ss.str());
     return std::tie(pass, pcc);
 }
-bool compare_flat_tensor_data(vector<float>& lhs, vector<float>& rhs, const VerifComparisonConfig &comp){
-    int num_threads = 8;
-    std::vector<std::thread> compare_threads;
-    std::vector<exception_ptr> exceptions_all_threads(num_threads, nullptr);
+FlatComparisonResult compare_flat_buffers(
+    const float *lhs, const float *rhs, std::size_t num_datums, const VerifComparisonConfig &comp, std::size_t slice_size) {
+    return detail::compare_flat_buffers(lhs, rhs, num_datums, comp, slice_size, true);
+}
 
-    bool pass = true;
-    double total_pcc = 0;
-    double total_pct = 0;
-    std::mutex pass_mutex, pcc_mutex, pct_mutex; //guard shared resources across threads
-    
-    log_assert(lhs.size() == rhs.size(), "Flat Tensor Dims Mismatch -- lhs:{} rhs:{}", lhs.size(), rhs.size());
-    if(lhs.size() != rhs.size()) return false;
+FlatComparisonResult detail::compare_flat_buffers(
+    const float *lhs,
+    const float *rhs,
+    std::size_t num_datums,
+    const VerifComparisonConfig &comp,
+    std::size_t slice_size,
+    bool vectorized) {
+    log_assert(slice_size > 0, "Flat buffer comparison needs a non-empty slice size");
+    log_assert(
+        comp.type == ComparisonType::Exact or comp.type == ComparisonType::AllClose or
+            comp.type == ComparisonType::AllCloseHw,
+        "ComparisonType not supported");
+    if (comp.type != ComparisonType::Exact) {
+        log_assert(comp.rtol >= 0.0 and comp.atol >= 0.0, "allclose: rtol and atol must be non-negative!");
+    }
+    if (comp.type == ComparisonType::AllCloseHw) {
+        log_assert(fabs(comp.check_pcc) <= 1.0, "pcc_compare: pcc_compare must be -1 <= x <= 1");
+    }
 
-    if(comp.type == ComparisonType::Exact){
-        log_info(tt::LogVerif, "Performing Exact Check on Flattened Tensors");
-        for(int th = 0; th < num_threads; th++){
-            compare_threads.push_back(std::thread([th, &lhs, &rhs, num_threads, &pass, &comp, &exceptions_all_threads, &pass_mutex] {
-                try{
-                    bool result = exact_compare_on_vectors(lhs.begin() + th*lhs.size()/num_threads, rhs.begin() + th*rhs.size()/num_threads, lhs.size()/num_threads);
-                    std::lock_guard<std::mutex> lock(pass_mutex);
-                    pass &= result;
-                } catch(std::exception &e){
-                    exceptions_all_threads.at(th) = std::current_exception();
+    FlatComparisonResult result;
+    result.num_datums = num_datums;
+    result.num_slices = (num_datums + slice_size - 1) / slice_size;
+    if (result.num_slices == 0) {
+        return result;
+    }
+
+    // Slices are compared in groups, each group merges its slices in order so the result does not depend on threading
+    struct group_result {
+        FlatComparisonResult result;
+        std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS - 1> num_at_or_above_edge = {};
+        double sum_matched_pct = 0.0;
+        double sum_pcc = 0.0;
+    };
+    const int num_threads = tt::tt_task_scheduler::get().get_num_threads();
+    const int num_groups = tt::get_parallel_for_num_chunks(result.num_slices, num_threads);
+    std::vector<group_result> groups(num_groups);
+    tt::parallel_for(
+        0,
+        num_groups,
+        [&](int group_index) {
+            group_result &group = groups.at(group_index);
+            const std::size_t slice_begin = tt::get_parallel_for_chunk_offset(result.num_slices, num_groups, group_index);
+            const std::size_t slice_end = tt::get_parallel_for_chunk_offset(result.num_slices, num_groups, group_index + 1);
+            for (std::size_t slice = slice_begin; slice < slice_end; slice++) {
+                const std::size_t offset = slice * slice_size;
+                const std::size_t size = std::min(slice_size, num_datums - offset);
+                const slice_stats stats = accumulate_slice(lhs + offset, rhs + offset, size, comp.rtol, comp.atol, vectorized);
+
+                const std::size_t mismatches = comp.type == ComparisonType::Exact ? stats.num_unequal : stats.num_mismatches;
+                const double matched_pct = (size - static_cast<double>(mismatches)) / size;
+                bool slice_pass = comp.type == ComparisonType::Exact ? mismatches == 0 : matched_pct >= comp.check_pct;
+                if (comp.type != ComparisonType::Exact and not slice_pass) {
+                    log_error("AllClose Check Failed on Vector Slice {} with pct = {}", slice, matched_pct);
+                }
+                if (comp.type == ComparisonType::AllCloseHw) {
+                    const auto [pcc_pass, pcc] = evaluate_pcc(stats.pcc, size, comp.rtol, comp.atol, comp.check_pcc);
+                    if (not pcc_pass) {
+                        log_error("PCC Check Failed on Vector Slice {} with pcc = {}", slice, pcc);
+                    }
+                    slice_pass &= pcc_pass;
+                    group.sum_pcc += pcc;
+                    group.result.min_pcc = std::min(group.result.min_pcc, pcc);
+                }
+
+                group.result.num_mismatches += mismatches;
+                group.result.num_nonfinite += stats.num_nonfinite;
+                group.result.max_abs_error = std::max(group.result.max_abs_error, static_cast<double>(stats.max_abs_error));
+                group.result.max_rel_error = std::max(group.result.max_rel_error, stats.max_rel_error);
+                for (std::size_t edge = 0; edge < stats.num_at_or_above_edge.size(); edge++) {
+                    group.num_at_or_above_edge[edge] += stats.num_at_or_above_edge[edge];
+                }
+                group.sum_matched_pct += matched_pct;
+                group.result.min_matched_pct = std::min(group.result.min_matched_pct, matched_pct);
+                if (not slice_pass) {
+                    group.result.pass = false;
+                    group.result.num_failed_slices++;
+                    if (group.result.first_failed_slice < 0) {
+                        group.result.first_failed_slice = slice;
+                    }
                 }
-            }));
-        }
-        for (auto th = 0; th < num_threads; th++) {
-            compare_threads.at(th).join();
-        }
-        for (auto th = 0; th < num_threads; th++) {
-            if (exceptions_all_threads.at(th)) {
-                std::rethrow_exception(exceptions_all_threads.at(th));
-                return false;
             }
+        },
+        num_threads);
+
+    std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS - 1> num_at_or_above_edge = {};
+    double sum_matched_pct = 0.0;
+    double sum_pcc = 0.0;
+    for (const group_result &group : groups) {
+        result.pass &= group.result.pass;
+        result.num_failed_slices += group.result.num_failed_slices;
+        if (result.first_failed_slice < 0) {
+            result.first_failed_slice = group.result.first_failed_slice;
         }
-    }
-    else if(comp.type == ComparisonType::AllCloseHw){
-        log_info(tt::LogVerif, "Performing All Close Check and PCC Check on Flattened Tensors");
-        int num_tiles = 0;
-        for(int i = 0; i < lhs.size(); i+= 32*32){
-            pass &= allclose_on_vectors(lhs.begin() + i, rhs.begin() + i, comp.rtol, comp.atol, comp.check_pct, 32*32, total_pct, pct_mutex)
-                            && pcc_compare_on_vectors(lhs.begin() + i, rhs.begin() + i, comp.rtol, comp.atol, comp.check_pcc, 32*32, total_pcc);
-            num_tiles++;
+        result.num_mismatches += group.result.num_mismatches;
+        result.num_nonfinite += group.result.num_nonfinite;
+        result.max_abs_error = std::max(result.max_abs_error, group.result.max_abs_error);
+        result.max_rel_error = std::max(result.max_rel_error, group.result.max_rel_error);
+        result.min_matched_pct = std::min(result.min_matched_pct, group.result.min_matched_pct);
+        result.min_pcc = std::min(result.min_pcc, group.result.min_pcc);
+        for (std::size_t edge = 0; edge < num_at_or_above_edge.size(); edge++) {
+            num_at_or_above_edge[edge] += group.num_at_or_above_edge[edge];
         }
+        sum_matched_pct += group.sum_matched_pct;
+        sum_pcc += group.sum_pcc;
+    }
+    result.average_matched_pct = sum_matched_pct / result.num_slices;
+    if (comp.type == ComparisonType::AllCloseHw) {
+        result.average_pcc = sum_pcc / result.num_slices;
+    }
 
-        total_pcc = total_pcc / num_tiles;
-        total_pct = total_pct / num_tiles;
-        log_info(tt::LogVerif, "Average pcc {}", total_pcc);
-        log_info(tt::LogVerif, "Average allclose pct {}", total_pct);
+    // Cumulative counts to bins, the last bin holds the finite datums at or above the last edge
+    const std::size_t num_finite = num_datums - result.num_nonfinite;
+    result.rel_error_histogram[0] = num_finite - num_at_or_above_edge[0];
+    for (std::size_t edge = 0; edge + 1 < num_at_or_above_edge.size(); edge++) {
+        result.rel_error_histogram[edge + 1] = num_at_or_above_edge[edge] - num_at_or_above_edge[edge + 1];
     }
+    result.rel_error_histogram.back() = num_at_or_above_edge.back();
+    return result;
+}
+
+bool compare_flat_tensors(vector<float>& lhs, vector<float>& rhs, const VerifComparisonConfig &comp) {
+    log_assert(lhs.size() == rhs.size(), "Flat Tensor Dims Mismatch -- lhs:{} rhs:{}", lhs.size(), rhs.size());
 
-    else if(comp.type == ComparisonType::AllClose) {
+    // The other types check per tile. AllClose checks the matched percentage per slice of ceil(n / 8) datums, so the
+    // n % 8 datums left over by the old split into eighths of n / 8 datums are checked as well. Every slice but the
+    // last is full, so the last one can be shorter than the others and small tensors can end up with less than 8.
+    std::size_t slice_size = tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH;
+    if (comp.type == ComparisonType::Exact) {
+        log_info(tt::LogVerif, "Performing Exact Check on Flattened Tensors");
+    } else if (comp.type == ComparisonType::AllCloseHw) {
+        log_info(tt::LogVerif, "Performing All Close Check and PCC Check on Flattened Tensors");
+    } else if (comp.type == ComparisonType::AllClose) {
         log_info(tt::LogVerif, "Performing All Close Check on Flattened Tensors");
-        for(int th = 0; th < num_threads; th++){
-            compare_threads.push_back(std::thread([th, &lhs, &rhs, num_threads, &pass, &comp, &total_pct, &exceptions_all_threads, &pass_mutex, &pct_mutex] {
-                try{
-                    bool result = allclose_on_vectors(lhs.begin() + th*lhs.size()/num_threads, rhs.begin() + th*rhs.size()/num_threads, comp.rtol, comp.atol, comp.check_pct, lhs.size()/num_threads, total_pct, pct_mutex);
-                    std::lock_guard<std::mutex> lock(pass_mutex);
-                    pass &= result;
-                } catch(std::exception &e){
-                    exceptions_all_threads.at(th) = std::current_exception();
-                }
-            }));
-        }
-        for (auto th = 0; th < num_threads; th++) {
-            compare_threads.at(th).join();
-        }
-        for (auto th = 0; th < num_threads; th++) {
-            if (exceptions_all_threads.at(th)) {
-                std::rethrow_exception(exceptions_all_threads.at(th));
-                return false;
-            }
-        }
-        total_pct = total_pct / num_threads;
-        log_info(tt::LogVerif, "Average allclose pct {}", total_pct);
-    }
-    else{
+        slice_size = std::max<std::size_t>((lhs.size() + 7) / 8, 1);
+    } else {
         log_fatal("ComparisonType not supported");
     }
-    return pass;
+
+    const FlatComparisonResult result = compare_flat_buffers(lhs.data(), rhs.data(), lhs.size(), comp, slice_size);
+    if (comp.type != ComparisonType::Exact) {
+        log_info(tt::LogVerif, "Average allclose pct {}", result.average_matched_pct);
+    }
+    if (comp.type == ComparisonType::AllCloseHw) {
+        log_info(tt::LogVerif, "Average pcc {}", result.average_pcc);
+    }
+    log_info(
+        tt::LogVerif,
+        "Max abs error {}, max rel error {}, {} non-finite datums",
+        result.max_abs_error,
+        result.max_rel_error,
+        result.num_nonfinite);
+    if (not result.pass) {
+        log_error(
+            "Flat Tensor Check Failed on {} of {} slices of {} datums, first failed slice {}, min allclose pct {}, "
+            "min pcc {}",
+            result.num_failed_slices,
+            result.num_slices,
+            slice_size,
+            result.first_failed_slice,
+            result.min_matched_pct,
+            result.min_pcc);
+        log_error(
+            "Relative error histogram (0, <1e-6, <1e-5, <1e-4, <1e-3, <1e-2, <0.1, <1, >=1): {}",
+            fmt::join(result.rel_error_histogram, ", "));
+    }
+    return result.pass;
 }
 
 bool compare_tensor_data(const tt_tensor &lhs, const tt_tensor &rhs, const VerifComparisonConfig &comp) {
@@ -643,7 +888,7 @@ bool compare_tensors(vector<float>& lhs, vector<float>& rhs, const VerifComparis
     tt_queue_info q_info = get_tt_queue_info_from_tt_dram_io_desc(q_desc);
     bool pass = true;
     if(!(comp.method == ComparisonMethod::TilizedTensor || comp.verbosity == ComparisonVerbosity::Verbose)){
-        if(compare_flat_tensor_data(lhs, rhs, comp)){
+        if(compare_flat_tensors(lhs, rhs, comp)){
             pass = true;
             log_info(tt::LogVerif, "Flat Tensors Passed Comparison Check for output={}", q_info.name);
             return true;
@@ -51,6 +51,28 @@ bool compare_tensors(vector<float>& lhs, vector<float>& rhs, const VerifComparis
 bool compare_tensors(const tt_tensor &lhs, const tt_tensor &rhs, const VerifComparisonConfig &comp);
 bool compare_tensors_exact(const tt_tensor &lhs, const tt_tensor &rhs);
 bool compare_flat_tensors(vector<float>& lhs, vector<float>& rhs, const VerifComparisonConfig &comp);
+/*!
+ *  Compares flat buffers, eg. untilized device outputs, in one vectorized multithreaded pass
+ *     -- Slices of slice_size datums are checked like tiles: exact match, allclose matched percentage and for AllCloseHw
+ *        the PCC of each slice must pass
+ *     -- Max abs/rel errors and the relative error histogram are gathered in the same pass for any comparison type
+ */
+FlatComparisonResult compare_flat_buffers(
+    const float *lhs,
+    const float *rhs,
+    std::size_t num_datums,
+    const VerifComparisonConfig &comp,
+    std::size_t slice_size = tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH);
+namespace detail {
+// compare_flat_buffers with the AVX2 checks turned off when vectorized is false, both give the same counts and errors
+FlatComparisonResult compare_flat_buffers(
+    const float *lhs,
+    const float *rhs,
+    std::size_t num_datums,
+    const VerifComparisonConfig &comp,
+    std::size_t slice_size,
+    bool vectorized);
+}  // namespace detail
 //! Will read only the default config from the yaml file
 VerifComparisonConfig read_from_yaml_file(const std::string &filepath);
 //! Will read default config + any overrides which are keyed off a tag
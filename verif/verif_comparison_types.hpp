@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: Apache-2.0
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <unordered_set>
 
 #include "common/model/constants.hpp"
@@ -43,3 +45,23 @@ struct VerifComparisonConfig {
     VerifComparisonConfig(ComparisonType type, ComparisonVerbosity verbosity) : type(type), verbosity(verbosity){};
     VerifComparisonConfig(){};
 };
+
+// Finite datums by relative error |lhs - rhs| / |rhs|: 0, (0, 1e-6), [1e-6, 1e-5), ..., [0.1, 1), >= 1
+constexpr int FLAT_COMPARISON_REL_ERROR_BINS = 9;
+
+struct FlatComparisonResult {
+    bool pass = true;
+    std::size_t num_datums = 0;
+    std::size_t num_slices = 0;
+    std::size_t num_failed_slices = 0;
+    std::int64_t first_failed_slice = -1;
+    std::size_t num_mismatches = 0;  // Datums not allclose, or not equal for exact comparisons
+    std::size_t num_nonfinite = 0;   // Datums with a nan or inf on either side
+    double max_abs_error = 0.0;
+    double max_rel_error = 0.0;
+    double average_matched_pct = 1.0;
+    double min_matched_pct = 1.0;
+    double average_pcc = 1.0;  // AllCloseHw only
+    double min_pcc = 1.0;
+    std::array<std::size_t, FLAT_COMPARISON_REL_ERROR_BINS> rel_error_histogram = {};
+};
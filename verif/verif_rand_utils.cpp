@@ -9,17 +9,24 @@
 #include <set>
 #include <type_traits>
 
+#include "model/tt_rnd_util.hpp"
 #include "utils/logger.hpp"
 
 thread_local std::mt19937 verif::random::rand_gen(0);
 thread_local bool verif::random::is_seed_initialized(false);
+static thread_local std::uint64_t rand_seed = 0;
+static thread_local std::uint64_t rand_tensor_id = 0;
 
 void verif::random::tt_rnd_set_seed(int seed) {
     log_info(tt::LogVerif, "Setting Test Seed = {}", seed);
     rand_gen.seed(seed);
+    rand_seed = static_cast<std::uint32_t>(seed);
+    rand_tensor_id = 0;
     is_seed_initialized = true;
 }
 
+std::uint64_t verif::random::tt_rnd_tensor_key() { return tt::test::tt_philox_key(rand_seed, rand_tensor_id++); }
+
 int32_t verif::random::tt_gen_seed() {
     std::mt19937::result_type result;
     std::random_device rd;
@@ -79,18 +86,21 @@ void verif::random::randomize_normal(tt_tensor &tensor, T mean, T stddev) {
 template <typename T>
 void verif::random::randomize_normal(
     tt_tensor &tensor, T mean, T stddev, const std::pair<int, int> &r_bounds, const std::pair<int, int> &c_bounds) {
-    std::mt19937 &generator = verif::random::rand_gen;
-    std::normal_distribution<double> distribution(mean, stddev);
     log_assert_seed_uninitialized(__func__);
 
+    // Every tile draws all of its datums, so the values do not depend on the bounds nor on the thread count
+    const std::uint64_t key = tt_rnd_tensor_key();
     tensor.reserve_tile_tensor();
-    tensor.apply([mean, stddev, &generator, &distribution, &r_bounds, &c_bounds](tt_tile &tile) {
+    tensor.apply_parallel_indexed([key, mean, stddev, &r_bounds, &c_bounds](int tile_index, tt_tile &tile) {
+        float values[tt::constants::TILE_HEIGHT][tt::constants::TILE_WIDTH];
+        tt::test::tt_philox_fill_normal(
+            key, tile_index, values[0], tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH, mean, stddev);
         for (int i = r_bounds.first; i <= r_bounds.second; ++i) {
             for (int j = c_bounds.first; j <= c_bounds.second; ++j) {
                 if (std::is_floating_point<T>::value) {
-                    tile.set(i, j, distribution(generator));
+                    tile.set(i, j, values[i][j]);
                 } else {
-                    T val = static_cast<T>(std::round(distribution(generator)));
+                    T val = static_cast<T>(std::round(values[i][j]));
                     tile.set(i, j, val);
                 }
             }
@@ -110,20 +120,30 @@ void verif::random::randomize_uniform(
     T upper_bound,
     const std::pair<int, int> &r_bounds,
     const std::pair<int, int> &c_bounds) {
-    std::mt19937 &generator = verif::random::rand_gen;
+    log_assert((lower_bound <= upper_bound), "min is greater than max!");
     log_assert_seed_uninitialized(__func__);
 
-    using DistributionType = typename std::conditional<
-        std::is_floating_point<T>::value,
-        std::uniform_real_distribution<T>,
-        std::uniform_int_distribution<T>>::type;
-    DistributionType distribution(lower_bound, upper_bound);
-
+    const std::uint64_t key = tt_rnd_tensor_key();
     tensor.reserve_tile_tensor();
-    tensor.apply([lower_bound, upper_bound, &generator, &distribution, &r_bounds, &c_bounds](tt_tile &tile) {
-        for (int i = r_bounds.first; i <= r_bounds.second; ++i) {
-            for (int j = c_bounds.first; j <= c_bounds.second; ++j) {
-                tile.set(i, j, distribution(generator));
+    tensor.apply_parallel_indexed([key, lower_bound, upper_bound, &r_bounds, &c_bounds](int tile_index, tt_tile &tile) {
+        constexpr int num_datums = tt::constants::TILE_HEIGHT * tt::constants::TILE_WIDTH;
+        if constexpr (std::is_floating_point<T>::value) {
+            float values[tt::constants::TILE_HEIGHT][tt::constants::TILE_WIDTH];
+            tt::test::tt_philox_fill_uniform(key, tile_index, values[0], num_datums, lower_bound, upper_bound);
+            for (int i = r_bounds.first; i <= r_bounds.second; ++i) {
+                for (int j = c_bounds.first; j <= c_bounds.second; ++j) {
+                    tile.set(i, j, values[i][j]);
+                }
+            }
+        } else {
+            // Integers in [lower_bound, upper_bound] scale a 32 bit word to the range
+            std::uint32_t words[tt::constants::TILE_HEIGHT][tt::constants::TILE_WIDTH];
+            tt::test::tt_philox_fill(key, tile_index, words[0], num_datums);
+            const std::uint64_t range = static_cast<std::int64_t>(upper_bound) - static_cast<std::int64_t>(lower_bound) + 1;
+            for (int i = r_bounds.first; i <= r_bounds.second; ++i) {
+                for (int j = c_bounds.first; j <= c_bounds.second; ++j) {
+                    tile.set(i, j, static_cast<T>(lower_bound + static_cast<T>((words[i][j] * range) >> 32)));
+                }
             }
         }
     });
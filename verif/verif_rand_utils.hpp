@@ -17,6 +17,8 @@ void tt_rnd_set_seed(int seed);
 int32_t tt_gen_seed();
 
 void log_assert_seed_uninitialized(const char* caller);
+// Key of the next randomized tensor of this thread, tensors are filled per tile from tt::test::tt_philox_fill streams
+std::uint64_t tt_rnd_tensor_key();
 
 // Random api
 int tt_rnd_int(int min, int max);